@@ -1,263 +1,813 @@
-/****************************************************************************
-
-  Copyright (c) 2021 Ronald Sieber
-
-  Project:      Project independend / Standard class
-  Description:  Class <ESP32BleAppCfgData> Implementation
-
-  -------------------------------------------------------------------------
-
-  Revision History:
-
-  2021/07/06 -rs:   V1.00 Initial version
-
-****************************************************************************/
-
-
-#include "Arduino.h"
-#include "EEPROM.h"
-#include "ESP32BleCfgProfile.h"         // -> typedef struct tAppCfgData
-#include "ESP32BleAppCfgData.h"
-
-
-
-
-
-/***************************************************************************/
-/*                                                                         */
-/*                                                                         */
-/*          CLASS  ESP32BleAppCfgData                                      */
-/*                                                                         */
-/*                                                                         */
-/***************************************************************************/
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          C O N S T R U C T O R   /   D E S T R U C T O R                //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-//---------------------------------------------------------------------------
-//  Constructor
-//---------------------------------------------------------------------------
-
-ESP32BleAppCfgData::ESP32BleAppCfgData (
-        unsigned int uiEepromSize_p)
-{
-
-    m_uiEepromSize = uiEepromSize_p;
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Destructor
-//---------------------------------------------------------------------------
-
-ESP32BleAppCfgData::~ESP32BleAppCfgData ()
-{
-
-    return;
-
-}
-
-
-
-
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          P U B L I C    M E T H O D E N                                 //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-//---------------------------------------------------------------------------
-//  LoadAppCfgDataFromEeprom()
-//---------------------------------------------------------------------------
-//  Return:      1 -> return the previously saved user data
-//               0 -> keep default data untouched
-//              -1 -> Error (invalid parameter, EEPROM access error)
-//---------------------------------------------------------------------------
-
-int  ESP32BleAppCfgData::LoadAppCfgDataFromEeprom (
-        tAppCfgData* pAppCfgData_p)
-{
-
-tAppCfgData  AppCfgData;
-int          iEepromAddr;
-uint32_t     ui32AppCfgDataCrc;
-uint32_t     ui32Crc;
-bool         fCrcMatch;
-bool         fRes;
-int          iResult;
-
-    if (pAppCfgData_p == NULL)
-    {
-        return (-1);
-    }
-
-    // init EEPROM access
-    fRes = EEPROM.begin(m_uiEepromSize);
-    if ( !fRes )
-    {
-        return (-1);
-    }
-
-    // try to get Configuration Data from EEPROM
-    iEepromAddr = 0;
-    memset(&AppCfgData, 0x00, sizeof(AppCfgData));
-    EEPROM.get(iEepromAddr, AppCfgData);
-
-    // calculate CRC for data read from EEPROM and compare with saved CRC value
-    ui32AppCfgDataCrc = AppCfgData.m_ui32Crc32;
-    AppCfgData.m_ui32Crc32 = 0;                                   // restore same state as when calulated CRC for saving data
-    ui32Crc = CalulateCrc32(&AppCfgData, sizeof(AppCfgData));
-    fCrcMatch = (ui32AppCfgDataCrc == ui32Crc) ? true : false;
-
-    // Configuration Data read from EEPROM are valid?
-    // yes -> return the previously saved user data
-    // no  -> keep default data untouched
-    if ( fCrcMatch )
-    {
-        memcpy(pAppCfgData_p, &AppCfgData, sizeof(AppCfgData));
-        iResult = 1;
-    }
-    else
-    {
-        iResult = 0;
-    }
-
-    return (iResult);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  SaveAppCfgDataToEeprom()
-//---------------------------------------------------------------------------
-//  Return:      1 -> user data saved
-//              -1 -> Error (invalid parameter, EEPROM access error)
-//---------------------------------------------------------------------------
-
-int  ESP32BleAppCfgData::SaveAppCfgDataToEeprom (
-        tAppCfgData* pAppCfgData_p)
-{
-
-int       iEepromAddr;
-uint32_t  ui32Crc;
-bool      fRes;
-
-    if (pAppCfgData_p == NULL)
-    {
-        return (-1);
-    }
-
-    // init EEPROM access
-    fRes = EEPROM.begin(m_uiEepromSize);
-    if ( !fRes )
-    {
-        return (-1);
-    }
-
-    // calculate CRC for data write to EEPROM
-    pAppCfgData_p->m_ui32Crc32 = 0;
-    ui32Crc = CalulateCrc32(pAppCfgData_p, sizeof(*pAppCfgData_p));
-    pAppCfgData_p->m_ui32Crc32 = ui32Crc;
-
-    // save Configuration Data to EEPROM
-    iEepromAddr = 0;
-    EEPROM.put(iEepromAddr, *pAppCfgData_p);
-    EEPROM.commit();
-
-    return (1);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  ClearAppCfgDataInEeprom()
-//---------------------------------------------------------------------------
-//  Return:      1 -> user data cleared
-//              -1 -> Error (invalid parameter, EEPROM access error)
-//---------------------------------------------------------------------------
-
-int  ESP32BleAppCfgData::ClearAppCfgDataInEeprom ()
-{
-
-tAppCfgData  AppCfgData;
-int          iEepromAddr;
-bool         fRes;
-
-    // init EEPROM access
-    fRes = EEPROM.begin(m_uiEepromSize);
-    if ( !fRes )
-    {
-        return (-1);
-    }
-
-    // clear Configuration Data in EEPROM
-    memset(&AppCfgData, 0xFF, sizeof(AppCfgData));
-    iEepromAddr = 0;
-    EEPROM.put(iEepromAddr, AppCfgData);
-    EEPROM.commit();
-
-    return (1);
-
-}
-
-
-
-
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          P R I V A T E    M E T H O D E S                               //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-//---------------------------------------------------------------------------
-//  CalulateCrc32
-//---------------------------------------------------------------------------
-//  Code Orgin: https://lxp32.github.io/docs/a-simple-example-crc32-calculation/
-//---------------------------------------------------------------------------
-
-uint32_t  ESP32BleAppCfgData::CalulateCrc32 (
-        const void* pDataBuff_p,
-        int iDataSize_p)
-{
-
-uint32_t  ui32Crc;
-char      cDataByte;
-uint32_t  fDataBit;
-int       iBuffIdx;
-int       iBitIdx;
-
-    ui32Crc = 0xFFFFFFFF;
-
-    for (iBuffIdx=0; iBuffIdx<iDataSize_p; iBuffIdx++)
-    {
-        cDataByte = ((const char*)pDataBuff_p)[iBuffIdx];
-        for (iBitIdx=0; iBitIdx<8; iBitIdx++)
-        {
-            fDataBit = (cDataByte ^ ui32Crc) & 1;
-            ui32Crc >>= 1;
-            if ( fDataBit )
-            {
-                ui32Crc = ui32Crc ^ 0xEDB88320;
-            }
-            cDataByte >>= 1;
-        }
-    }
-
-    return (~ui32Crc);
-
-}
-
-
-
-
-//  EOF
+/****************************************************************************
+
+  Copyright (c) 2021 Ronald Sieber
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleAppCfgData> Implementation
+
+  -------------------------------------------------------------------------
+
+    EEPROM Layout:
+
+      [tAppCfgSlotCtrl][Slot 0][Slot 1]
+      Slot = [tAppCfgImageHdr][tAppCfgData (layout version <m_ui16LayoutVersion>)]
+
+    The EEPROM holds two complete images (A/B slots). A save writes the
+    inactive slot first and afterwards switches the small control record
+    to this slot, so an interrupted save always leaves the previous image
+    active. A new image starts in state TRIAL. The application calls
+    BeginTrialRun() when it starts Normal Operation Mode and
+    ConfirmAppCfgData() as soon as the new configuration has proven to
+    work (e.g. WiFi connected). If the device boots again without a
+    confirmation, LoadAppCfgDataFromEeprom() rolls back to the previous
+    (known-good) slot.
+
+    The image header holds the layout version and size of the stored data.
+    If an image with an older layout version is found at boot, it is
+    upgraded in place by the chain of migration functions
+    (APP_CFG_MIGRATION_LIST) and written back in the current layout. An
+    image without header (as written by V1.00 of this class) is treated as
+    layout version 0.
+
+    To change <tAppCfgData>:
+      (1) increment APP_CFG_LAYOUT_VERSION
+      (2) add a function MigrateVxtoVy() that converts the previous layout
+      (3) append { x, MigrateVxtoVy } to APP_CFG_MIGRATION_LIST
+      (4) add a fixture of the new layout to HostTest/CfgMigrationTest.cpp
+    Fields appended to the end of the structure need no conversion, they
+    keep the default values preset by the application.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2021/07/06 -rs:   V1.00 Initial version
+  2026/10/18:       V1.10 Versioned EEPROM image with migration chain
+  2026/10/18:       V1.20 A/B slots with trial run and rollback
+  2026/10/18:       V1.21 EEPROM.begin() only once
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "ESP32BleCfgProfile.h"         // -> typedef struct tAppCfgData
+#include "ESP32BleAppCfgData.h"
+#include "ESP32BleCfgStats.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          M I G R A T I O N   F U N C T I O N S                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  MigrateV0toV1
+//---------------------------------------------------------------------------
+//  V0 -> V1: image without header (V1.00 of this class), the data layout
+//            itself is identical, only the header has been introduced
+//---------------------------------------------------------------------------
+
+static  bool  MigrateV0toV1 (
+        uint8_t* pabData_p,
+        unsigned int* puiDataSize_p,
+        unsigned int uiBuffSize_p)
+{
+
+    (void)pabData_p;
+    (void)uiBuffSize_p;
+
+    if (*puiDataSize_p != sizeof(tAppCfgData))
+    {
+        return (false);
+    }
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Migration List
+//---------------------------------------------------------------------------
+//  Entry [n] upgrades layout version n to n+1, so the list must contain
+//  exactly one entry for each version from 0 to APP_CFG_LAYOUT_VERSION-1
+//  (checked at compile time).
+//---------------------------------------------------------------------------
+
+static  constexpr tAppCfgMigration  APP_CFG_MIGRATION_LIST[] =
+{
+    { 0,    MigrateV0toV1   }
+};
+
+static  constexpr unsigned int  APP_CFG_MIGRATION_CNT = sizeof(APP_CFG_MIGRATION_LIST) / sizeof(APP_CFG_MIGRATION_LIST[0]);
+
+static  constexpr bool  IsMigrationChainComplete (unsigned int uiIdx_p)
+{
+    return ((uiIdx_p >= APP_CFG_MIGRATION_CNT) ? (uiIdx_p == APP_CFG_LAYOUT_VERSION)
+                                               : ((APP_CFG_MIGRATION_LIST[uiIdx_p].m_ui16FromVersion == uiIdx_p) &&
+                                                  (APP_CFG_MIGRATION_LIST[uiIdx_p].m_pfnMigrate != nullptr)      &&
+                                                  IsMigrationChainComplete(uiIdx_p + 1)));
+}
+
+static_assert(IsMigrationChainComplete(0), "APP_CFG_MIGRATION_LIST must cover all layout versions up to APP_CFG_LAYOUT_VERSION");
+static_assert(sizeof(tAppCfgData) <= APP_CFG_MAX_DATA_SIZE, "APP_CFG_SLOT_SIZE too small for tAppCfgData");
+static_assert(sizeof(tAppCfgSlotCtrl) <= APP_CFG_CTRL_SIZE, "APP_CFG_CTRL_SIZE too small for tAppCfgSlotCtrl");
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleAppCfgData                                      */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          C O N S T R U C T O R   /   D E S T R U C T O R                //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Constructor
+//---------------------------------------------------------------------------
+
+ESP32BleAppCfgData::ESP32BleAppCfgData (
+        unsigned int uiEepromSize_p)
+{
+
+    m_uiEepromSize = uiEepromSize_p;
+    m_fEepromOpen  = false;
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Destructor
+//---------------------------------------------------------------------------
+
+ESP32BleAppCfgData::~ESP32BleAppCfgData ()
+{
+
+    return;
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E N                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  LoadAppCfgDataFromEeprom()
+//---------------------------------------------------------------------------
+//  Return:      3 -> return the data of the previous (known-good) slot,
+//                    the unconfirmed data has been rolled back
+//               2 -> return the previously saved user data, migrated from
+//                    an older layout version (already written back)
+//               1 -> return the previously saved user data
+//               0 -> keep default data untouched
+//              -1 -> Error (invalid parameter, EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::LoadAppCfgDataFromEeprom (
+        tAppCfgData* pAppCfgData_p)
+{
+
+tAppCfgSlotCtrl  SlotCtrl;
+uint8_t          abData[APP_CFG_MAX_DATA_SIZE];
+unsigned int     uiDataSize;
+unsigned int     uiLayoutVersion;
+unsigned int     uiSlot;
+bool             fCtrlValid;
+bool             fImageValid;
+bool             fRollback;
+bool             fRes;
+int              iRes;
+int              iResult;
+unsigned long    ulStartTime;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    ulStartTime = micros();
+
+    // init EEPROM access
+    fRes = OpenEeprom();
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    // try to get Configuration Data from EEPROM
+    fRollback = false;
+    fCtrlValid = ReadSlotCtrl(&SlotCtrl);
+    if ( fCtrlValid )
+    {
+        // unconfirmed slot has already been used for a run -> roll back
+        uiSlot = SlotCtrl.m_ui8ActiveSlot;
+        fImageValid = false;
+        if ( (SlotCtrl.m_ui8State != APP_CFG_SLOT_STATE_TRIAL) ||
+             (SlotCtrl.m_ui8TrialRuns < APP_CFG_TRIAL_MAX_RUNS) )
+        {
+            fImageValid = ReadImage(APP_CFG_CTRL_SIZE + (uiSlot * APP_CFG_SLOT_SIZE), false, abData, &uiDataSize, &uiLayoutVersion);
+        }
+
+        // active slot rejected or corrupted -> use the other slot
+        if ( !fImageValid )
+        {
+            uiSlot = (uiSlot + 1) % APP_CFG_SLOT_CNT;
+            fImageValid = ReadImage(APP_CFG_CTRL_SIZE + (uiSlot * APP_CFG_SLOT_SIZE), false, abData, &uiDataSize, &uiLayoutVersion);
+            if ( fImageValid )
+            {
+                SlotCtrl.m_ui8ActiveSlot = (uint8_t)uiSlot;
+                SlotCtrl.m_ui8State      = APP_CFG_SLOT_STATE_CONFIRMED;
+                SlotCtrl.m_ui8TrialRuns  = 0;
+                SlotCtrl.m_ui32Sequence++;
+                WriteSlotCtrl(&SlotCtrl);
+                fRollback = true;
+            }
+        }
+    }
+    else
+    {
+        // no slots yet -> image written by a previous version of this class
+        fImageValid = ReadImage(0, true, abData, &uiDataSize, &uiLayoutVersion);
+    }
+
+    // Configuration Data read from EEPROM are valid?
+    // yes -> upgrade to current layout (if required) and return the previously saved user data
+    // no  -> keep default data untouched
+    iResult = 0;
+    if ( fImageValid )
+    {
+        iRes = MigrateData(abData, &uiDataSize, uiLayoutVersion);
+        if (iRes >= 0)
+        {
+            // fields not contained in older layouts keep the default values
+            if (uiDataSize > sizeof(tAppCfgData))
+            {
+                uiDataSize = sizeof(tAppCfgData);
+            }
+            memcpy(pAppCfgData_p, abData, uiDataSize);
+            iResult = (fRollback) ? 3 : 1;
+
+            // write back migrated data in current layout (an unconfirmed
+            // slot is kept untouched, so that the known-good slot remains)
+            if ( ((iRes > 0) || !fCtrlValid) &&
+                 (!fCtrlValid || (SlotCtrl.m_ui8State == APP_CFG_SLOT_STATE_CONFIRMED)) )
+            {
+                StoreImage(pAppCfgData_p, APP_CFG_SLOT_STATE_CONFIRMED);
+                iResult = (fRollback) ? 3 : 2;
+            }
+        }
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_LOAD, (uint32_t)(micros() - ulStartTime));
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  SaveAppCfgDataToEeprom()
+//---------------------------------------------------------------------------
+//  Return:      1 -> user data saved
+//              -1 -> Error (invalid parameter, EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::SaveAppCfgDataToEeprom (
+        tAppCfgData* pAppCfgData_p)
+{
+
+bool           fRes;
+int            iResult;
+unsigned long  ulStartTime;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    ulStartTime = micros();
+
+    // init EEPROM access
+    fRes = OpenEeprom();
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    // save Configuration Data to EEPROM, it stays on trial until confirmed by the application
+    iResult = StoreImage(pAppCfgData_p, APP_CFG_SLOT_STATE_TRIAL);
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_SAVE, (uint32_t)(micros() - ulStartTime));
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ClearAppCfgDataInEeprom()
+//---------------------------------------------------------------------------
+//  Return:      1 -> user data cleared
+//              -1 -> Error (invalid parameter, EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::ClearAppCfgDataInEeprom ()
+{
+
+unsigned int   uiEepromAddr;
+unsigned int   uiClearSize;
+bool           fRes;
+unsigned long  ulStartTime;
+
+    ulStartTime = micros();
+
+    // init EEPROM access
+    fRes = OpenEeprom();
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    // clear Slot Control and both Slots in EEPROM
+    uiClearSize = APP_CFG_CTRL_SIZE + (APP_CFG_SLOT_CNT * APP_CFG_SLOT_SIZE);
+    if (uiClearSize > m_uiEepromSize)
+    {
+        uiClearSize = m_uiEepromSize;
+    }
+    for (uiEepromAddr=0; uiEepromAddr<uiClearSize; uiEepromAddr++)
+    {
+        EEPROM.write(uiEepromAddr, 0xFF);
+    }
+    CommitEeprom();
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_CLEAR, (uint32_t)(micros() - ulStartTime));
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  BeginTrialRun()
+//---------------------------------------------------------------------------
+//  Has to be called by the application when starting Normal Operation Mode.
+//  Counts the run of an unconfirmed slot, so that the next boot rolls back
+//  if the application does not call ConfirmAppCfgData() in the meantime.
+//---------------------------------------------------------------------------
+//  Return:      1 -> unconfirmed data on trial, ConfirmAppCfgData() required
+//               0 -> data already confirmed (nothing to do)
+//              -1 -> Error (EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::BeginTrialRun ()
+{
+
+tAppCfgSlotCtrl  SlotCtrl;
+bool             fRes;
+
+    // init EEPROM access
+    fRes = OpenEeprom();
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    fRes = ReadSlotCtrl(&SlotCtrl);
+    if ( !fRes || (SlotCtrl.m_ui8State != APP_CFG_SLOT_STATE_TRIAL) )
+    {
+        return (0);
+    }
+
+    if (SlotCtrl.m_ui8TrialRuns < 0xFF)
+    {
+        SlotCtrl.m_ui8TrialRuns++;
+    }
+    fRes = WriteSlotCtrl(&SlotCtrl);
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ConfirmAppCfgData()
+//---------------------------------------------------------------------------
+//  Marks the active slot as known-good (e.g. after WiFi has been connected
+//  successfully with the new configuration).
+//---------------------------------------------------------------------------
+//  Return:      1 -> active data confirmed
+//               0 -> data already confirmed (nothing to do)
+//              -1 -> Error (EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::ConfirmAppCfgData ()
+{
+
+tAppCfgSlotCtrl  SlotCtrl;
+bool             fRes;
+
+    // init EEPROM access
+    fRes = OpenEeprom();
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    fRes = ReadSlotCtrl(&SlotCtrl);
+    if ( !fRes || (SlotCtrl.m_ui8State != APP_CFG_SLOT_STATE_TRIAL) )
+    {
+        return (0);
+    }
+
+    SlotCtrl.m_ui8State     = APP_CFG_SLOT_STATE_CONFIRMED;
+    SlotCtrl.m_ui8TrialRuns = 0;
+    fRes = WriteSlotCtrl(&SlotCtrl);
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    return (1);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  CommitEeprom
+//---------------------------------------------------------------------------
+
+bool  ESP32BleAppCfgData::CommitEeprom ()
+{
+
+unsigned long  ulStartTime;
+bool           fRes;
+
+    ulStartTime = micros();
+
+    fRes = EEPROM.commit();
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_COMMIT, (uint32_t)(micros() - ulStartTime));
+    ESP32BleCfgStats::IncCounter(STATS_CNT_FLASH_COMMIT);
+
+    return (fRes);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  OpenEeprom
+//---------------------------------------------------------------------------
+//  EEPROM.begin() allocates and reads the whole emulated EEPROM, so it is
+//  called only once. The buffer remains valid for all further accesses.
+//---------------------------------------------------------------------------
+
+bool  ESP32BleAppCfgData::OpenEeprom ()
+{
+
+    if ( !m_fEepromOpen )
+    {
+        m_fEepromOpen = EEPROM.begin(m_uiEepromSize);
+    }
+
+    return (m_fEepromOpen);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ReadSlotCtrl
+//---------------------------------------------------------------------------
+
+bool  ESP32BleAppCfgData::ReadSlotCtrl (
+        tAppCfgSlotCtrl* pSlotCtrl_p)
+{
+
+uint32_t  ui32Crc;
+
+    EEPROM.get(0, *pSlotCtrl_p);
+    if (pSlotCtrl_p->m_ui32Magic != APP_CFG_CTRL_MAGIC)
+    {
+        return (false);
+    }
+
+    ui32Crc = CalulateCrc32(pSlotCtrl_p, offsetof(tAppCfgSlotCtrl, m_ui32Crc32));
+    if ( (pSlotCtrl_p->m_ui32Crc32 != ui32Crc) || (pSlotCtrl_p->m_ui8ActiveSlot >= APP_CFG_SLOT_CNT) )
+    {
+        return (false);
+    }
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  WriteSlotCtrl
+//---------------------------------------------------------------------------
+
+bool  ESP32BleAppCfgData::WriteSlotCtrl (
+        tAppCfgSlotCtrl* pSlotCtrl_p)
+{
+
+    pSlotCtrl_p->m_ui32Magic   = APP_CFG_CTRL_MAGIC;
+    pSlotCtrl_p->m_ui8Reserved = 0;
+    pSlotCtrl_p->m_ui32Crc32   = CalulateCrc32(pSlotCtrl_p, offsetof(tAppCfgSlotCtrl, m_ui32Crc32));
+
+    EEPROM.put(0, *pSlotCtrl_p);
+
+    return (CommitEeprom());
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ReadImage
+//---------------------------------------------------------------------------
+//  Reads and validates the image at <uiEepromAddr_p>. An image without
+//  header (layout version 0) is only accepted at the location used by
+//  V1.00 of this class (<fAcceptHeaderless_p>).
+//---------------------------------------------------------------------------
+
+bool  ESP32BleAppCfgData::ReadImage (
+        unsigned int uiEepromAddr_p,
+        bool fAcceptHeaderless_p,
+        uint8_t* pabData_p,
+        unsigned int* puiDataSize_p,
+        unsigned int* puiLayoutVersion_p)
+{
+
+tAppCfgImageHdr  ImageHdr;
+tAppCfgData      AppCfgData;
+unsigned int     uiDataSize;
+uint32_t         ui32AppCfgDataCrc;
+uint32_t         ui32Crc;
+
+    EEPROM.get(uiEepromAddr_p, ImageHdr);
+    if (ImageHdr.m_ui32Magic == APP_CFG_IMAGE_MAGIC)
+    {
+        // image with header -> check version, size and CRC of the stored data
+        uiDataSize = ImageHdr.m_ui16DataSize;
+        if ( (ImageHdr.m_ui16LayoutVersion > APP_CFG_LAYOUT_VERSION) ||
+             (uiDataSize > APP_CFG_MAX_DATA_SIZE) ||
+             ((uiEepromAddr_p + sizeof(ImageHdr) + uiDataSize) > m_uiEepromSize) )
+        {
+            return (false);
+        }
+
+        EEPROM.readBytes(uiEepromAddr_p + sizeof(ImageHdr), pabData_p, uiDataSize);
+        ui32Crc = CalulateCrc32(pabData_p, uiDataSize);
+        if (ImageHdr.m_ui32DataCrc32 != ui32Crc)
+        {
+            return (false);
+        }
+
+        *puiDataSize_p = uiDataSize;
+        *puiLayoutVersion_p = ImageHdr.m_ui16LayoutVersion;
+        return (true);
+    }
+
+    if ( !fAcceptHeaderless_p )
+    {
+        return (false);
+    }
+
+    // image without header (layout version 0) -> check embedded CRC
+    memset(&AppCfgData, 0x00, sizeof(AppCfgData));
+    EEPROM.get(uiEepromAddr_p, AppCfgData);
+    ui32AppCfgDataCrc = AppCfgData.m_ui32Crc32;
+    AppCfgData.m_ui32Crc32 = 0;                                   // restore same state as when calulated CRC for saving data
+    ui32Crc = CalulateCrc32(&AppCfgData, sizeof(AppCfgData));
+    if (ui32AppCfgDataCrc != ui32Crc)
+    {
+        return (false);
+    }
+
+    AppCfgData.m_ui32Crc32 = ui32AppCfgDataCrc;
+    memcpy(pabData_p, &AppCfgData, sizeof(AppCfgData));
+    *puiDataSize_p = sizeof(AppCfgData);
+    *puiLayoutVersion_p = 0;
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  StoreImage
+//---------------------------------------------------------------------------
+//  Writes the image to the inactive slot and then switches the Slot Control
+//  to this slot. While the active slot is still on trial, the unconfirmed
+//  slot itself is rewritten, so that the known-good slot is kept.
+//---------------------------------------------------------------------------
+//  Return:      1 -> user data saved
+//              -1 -> Error (EEPROM too small, EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::StoreImage (
+        tAppCfgData* pAppCfgData_p,
+        uint8_t ui8State_p)
+{
+
+tAppCfgSlotCtrl  SlotCtrl;
+tAppCfgImageHdr  ImageHdr;
+uint8_t          abData[APP_CFG_MAX_DATA_SIZE];
+unsigned int     uiDataSize;
+unsigned int     uiLayoutVersion;
+unsigned int     uiSlot;
+unsigned int     uiEepromAddr;
+uint32_t         ui32Crc;
+bool             fKnownGood;
+bool             fRes;
+
+    if ((APP_CFG_CTRL_SIZE + (APP_CFG_SLOT_CNT * APP_CFG_SLOT_SIZE)) > m_uiEepromSize)
+    {
+        return (-1);
+    }
+
+    // select target slot
+    fRes = ReadSlotCtrl(&SlotCtrl);
+    if ( !fRes )
+    {
+        // no slots yet -> slot 1 does not overlap with an image of a previous version of this class
+        memset(&SlotCtrl, 0x00, sizeof(SlotCtrl));
+        uiSlot = 1;
+        fKnownGood = false;
+    }
+    else if (SlotCtrl.m_ui8State == APP_CFG_SLOT_STATE_TRIAL)
+    {
+        uiSlot = SlotCtrl.m_ui8ActiveSlot;
+        fKnownGood = true;
+    }
+    else
+    {
+        uiSlot = (SlotCtrl.m_ui8ActiveSlot + 1) % APP_CFG_SLOT_CNT;
+        uiEepromAddr = APP_CFG_CTRL_SIZE + (SlotCtrl.m_ui8ActiveSlot * APP_CFG_SLOT_SIZE);
+        fKnownGood = ReadImage(uiEepromAddr, false, abData, &uiDataSize, &uiLayoutVersion);
+    }
+
+    // calculate CRC for data write to EEPROM
+    pAppCfgData_p->m_ui32Crc32 = 0;
+    ui32Crc = CalulateCrc32(pAppCfgData_p, sizeof(*pAppCfgData_p));
+    pAppCfgData_p->m_ui32Crc32 = ui32Crc;
+
+    // build header for current layout version
+    ImageHdr.m_ui32Magic         = APP_CFG_IMAGE_MAGIC;
+    ImageHdr.m_ui16LayoutVersion = APP_CFG_LAYOUT_VERSION;
+    ImageHdr.m_ui16DataSize      = sizeof(*pAppCfgData_p);
+    ImageHdr.m_ui32DataCrc32     = CalulateCrc32(pAppCfgData_p, sizeof(*pAppCfgData_p));
+
+    // (1) save Header and Configuration Data to target slot
+    uiEepromAddr = APP_CFG_CTRL_SIZE + (uiSlot * APP_CFG_SLOT_SIZE);
+    EEPROM.put(uiEepromAddr, ImageHdr);
+    EEPROM.put(uiEepromAddr + sizeof(ImageHdr), *pAppCfgData_p);
+    fRes = CommitEeprom();
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    // (2) switch Slot Control to target slot (a trial without known-good
+    //     slot to roll back to is confirmed immediately)
+    SlotCtrl.m_ui8ActiveSlot = (uint8_t)uiSlot;
+    SlotCtrl.m_ui8State      = (fKnownGood) ? ui8State_p : APP_CFG_SLOT_STATE_CONFIRMED;
+    SlotCtrl.m_ui8TrialRuns  = 0;
+    SlotCtrl.m_ui32Sequence++;
+    fRes = WriteSlotCtrl(&SlotCtrl);
+    if ( !fRes )
+    {
+        return (-1);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  MigrateData
+//---------------------------------------------------------------------------
+//  Return:     >0 -> data upgraded to current layout (number of steps)
+//               0 -> data already in current layout
+//              -1 -> Error (unknown layout version, migration failed)
+//---------------------------------------------------------------------------
+
+int  ESP32BleAppCfgData::MigrateData (
+        uint8_t* pabData_p,
+        unsigned int* puiDataSize_p,
+        unsigned int uiLayoutVersion_p)
+{
+
+unsigned int  uiVersion;
+bool          fRes;
+
+    if (uiLayoutVersion_p > APP_CFG_LAYOUT_VERSION)
+    {
+        return (-1);
+    }
+
+    // run all migration steps from the stored version up to the current version
+    for (uiVersion=uiLayoutVersion_p; uiVersion<APP_CFG_LAYOUT_VERSION; uiVersion++)
+    {
+        fRes = APP_CFG_MIGRATION_LIST[uiVersion].m_pfnMigrate(pabData_p, puiDataSize_p, APP_CFG_MAX_DATA_SIZE);
+        if ( !fRes )
+        {
+            return (-1);
+        }
+    }
+
+    return ((int)(APP_CFG_LAYOUT_VERSION - uiLayoutVersion_p));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  CalulateCrc32
+//---------------------------------------------------------------------------
+//  Code Orgin: https://lxp32.github.io/docs/a-simple-example-crc32-calculation/
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleAppCfgData::CalulateCrc32 (
+        const void* pDataBuff_p,
+        int iDataSize_p)
+{
+
+uint32_t  ui32Crc;
+char      cDataByte;
+uint32_t  fDataBit;
+int       iBuffIdx;
+int       iBitIdx;
+
+    ui32Crc = 0xFFFFFFFF;
+
+    for (iBuffIdx=0; iBuffIdx<iDataSize_p; iBuffIdx++)
+    {
+        cDataByte = ((const char*)pDataBuff_p)[iBuffIdx];
+        for (iBitIdx=0; iBitIdx<8; iBitIdx++)
+        {
+            fDataBit = (cDataByte ^ ui32Crc) & 1;
+            ui32Crc >>= 1;
+            if ( fDataBit )
+            {
+                ui32Crc = ui32Crc ^ 0xEDB88320;
+            }
+            cDataByte >>= 1;
+        }
+    }
+
+    return (~ui32Crc);
+
+}
+
+
+
+
+//  EOF
@@ -1,81 +1,163 @@
-/****************************************************************************
-
-  Copyright (c) 2021 Ronald Sieber
-
-  Project:      Project independend / Standard class
-  Description:  Class <ESP32BleAppCfgData> Declaration
-
-  -------------------------------------------------------------------------
-
-  Revision History:
-
-  2021/07/06 -rs:   V1.00 Initial version
-
-****************************************************************************/
-
-#ifndef _ESP32BLEAPPCFGDATA_H_
-#define _ESP32BLEAPPCFGDATA_H_
-
-
-
-
-
-/***************************************************************************/
-/*                                                                         */
-/*                                                                         */
-/*          CLASS  ESP32BleAppCfgData                                      */
-/*                                                                         */
-/*                                                                         */
-/***************************************************************************/
-
-class  ESP32BleAppCfgData
-{
-
-    //-----------------------------------------------------------------------
-    //  Definitions
-    //-----------------------------------------------------------------------
-
-    public:
-
-
-
-    //-----------------------------------------------------------------------
-    //  Private Attributes
-    //-----------------------------------------------------------------------
-
-    private:
-
-    unsigned int    m_uiEepromSize;
-
-
-
-    //-----------------------------------------------------------------------
-    //  Public Methodes
-    //-----------------------------------------------------------------------
-
-    public:
-
-    ESP32BleAppCfgData (unsigned int uiEepromSize_p);
-    ~ESP32BleAppCfgData ();
-
-    int  LoadAppCfgDataFromEeprom (tAppCfgData* pAppCfgData_p);
-    int  SaveAppCfgDataToEeprom (tAppCfgData* pAppCfgData_p);
-    int  ClearAppCfgDataInEeprom ();
-
-
-
-    //-----------------------------------------------------------------------
-    //  Private Methodes
-    //-----------------------------------------------------------------------
-
-    private:
-
-    static  uint32_t  CalulateCrc32 (const void* pDataBuff_p, int iDataSize_p);
-
-
-
-};
-
-
-
-#endif  // _ESP32BLEAPPCFGDATA_H_
+/****************************************************************************
+
+  Copyright (c) 2021 Ronald Sieber
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleAppCfgData> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2021/07/06 -rs:   V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLEAPPCFGDATA_H_
+#define _ESP32BLEAPPCFGDATA_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Layout Version of <tAppCfgData>, must be incremented for each change of
+// the structure together with a new entry in the migration list
+// (see APP_CFG_MIGRATION_LIST in ESP32BleAppCfgData.cpp)
+#define APP_CFG_LAYOUT_VERSION          1
+
+#define APP_CFG_IMAGE_MAGIC             0x48676643          // ASCII 'CfgH' = [C]on[f]i[g] [H]eader
+#define APP_CFG_CTRL_MAGIC              0x53676643          // ASCII 'CfgS' = [C]on[f]i[g] [S]lots
+
+// EEPROM Layout: [Slot Control][Slot 0: Header + Data][Slot 1: Header + Data]
+#define APP_CFG_CTRL_SIZE               16
+#define APP_CFG_SLOT_SIZE               240
+#define APP_CFG_SLOT_CNT                2
+#define APP_CFG_MAX_DATA_SIZE           (APP_CFG_SLOT_SIZE - sizeof(tAppCfgImageHdr))   // max. size of any (old or current) layout
+
+// Slot States
+#define APP_CFG_SLOT_STATE_CONFIRMED    0x01                // active slot is known-good
+#define APP_CFG_SLOT_STATE_TRIAL        0x02                // active slot not yet confirmed by the application
+
+// Number of runs in Normal Operation Mode without confirmation before the
+// next boot rolls back to the last known-good slot
+#define APP_CFG_TRIAL_MAX_RUNS          1
+
+
+// Header stored in front of the Configuration Data in EEPROM
+typedef struct __attribute__((packed))
+{
+
+    uint32_t        m_ui32Magic;                // APP_CFG_IMAGE_MAGIC
+    uint16_t        m_ui16LayoutVersion;        // layout version of the following data
+    uint16_t        m_ui16DataSize;             // size of the following data                   [Bytes]
+    uint32_t        m_ui32DataCrc32;            // CRC32 over the following data
+
+} tAppCfgImageHdr;
+
+
+// Slot Control Record stored at the beginning of the EEPROM
+typedef struct __attribute__((packed))
+{
+
+    uint32_t        m_ui32Magic;                // APP_CFG_CTRL_MAGIC
+    uint8_t         m_ui8ActiveSlot;            // 0 / 1
+    uint8_t         m_ui8State;                 // APP_CFG_SLOT_STATE_xxx
+    uint8_t         m_ui8TrialRuns;             // runs started with the (unconfirmed) active slot
+    uint8_t         m_ui8Reserved;
+    uint32_t        m_ui32Sequence;             // incremented with each switch of the active slot
+    uint32_t        m_ui32Crc32;                // CRC32 over the preceding members
+
+} tAppCfgSlotCtrl;
+
+
+// Migration Function: upgrades the data of layout version N to version N+1
+// in place (<puiDataSize_p> = in: size of old data / out: size of new data)
+typedef  bool  (*tAppCfgMigrateFunc) (uint8_t* pabData_p, unsigned int* puiDataSize_p, unsigned int uiBuffSize_p);
+
+typedef struct
+{
+
+    uint16_t            m_ui16FromVersion;
+    tAppCfgMigrateFunc  m_pfnMigrate;
+
+} tAppCfgMigration;
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleAppCfgData                                      */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleAppCfgData
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+    unsigned int    m_uiEepromSize;
+    bool            m_fEepromOpen;
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+    ESP32BleAppCfgData (unsigned int uiEepromSize_p);
+    ~ESP32BleAppCfgData ();
+
+    int  LoadAppCfgDataFromEeprom (tAppCfgData* pAppCfgData_p);
+    int  SaveAppCfgDataToEeprom (tAppCfgData* pAppCfgData_p);
+    int  ClearAppCfgDataInEeprom ();
+    int  BeginTrialRun ();
+    int  ConfirmAppCfgData ();
+
+    static  uint32_t  CalulateCrc32 (const void* pDataBuff_p, int iDataSize_p);
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+    static  bool      CommitEeprom ();
+    static  int       MigrateData (uint8_t* pabData_p, unsigned int* puiDataSize_p, unsigned int uiLayoutVersion_p);
+
+    bool  OpenEeprom ();
+    bool  ReadSlotCtrl (tAppCfgSlotCtrl* pSlotCtrl_p);
+    bool  WriteSlotCtrl (tAppCfgSlotCtrl* pSlotCtrl_p);
+    bool  ReadImage (unsigned int uiEepromAddr_p, bool fAcceptHeaderless_p, uint8_t* pabData_p, unsigned int* puiDataSize_p, unsigned int* puiLayoutVersion_p);
+    int   StoreImage (tAppCfgData* pAppCfgData_p, uint8_t ui8State_p);
+
+
+
+};
+
+
+
+#endif  // _ESP32BLEAPPCFGDATA_H_
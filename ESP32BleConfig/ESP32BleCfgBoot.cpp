@@ -0,0 +1,413 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgBoot> Implementation
+
+  -------------------------------------------------------------------------
+
+    Boot Pipeline with explicit Stage Dependencies:
+
+    - The application registers its startup steps as stages by
+      <AddStage()>. Each stage names the stages it depends on by a bit
+      mask. A stage may only depend on stages added before, so the list
+      is always in a valid (topological) order and cannot contain cycles.
+    - In parallel mode, <Run()> starts each stage as a FreeRTOS task on
+      the requested core. A stage task waits for the event group bits of
+      its dependencies, executes the stage function and then sets its own
+      bit. <Run()> returns when all stages are finished.
+    - In sequential mode, <Run()> executes the stages in the calling task
+      in the order they were added. This is the reference for the time
+      saved by the parallel boot.
+    - The report lists the wall clock time of <Run()>, the sum of all
+      stage durations (= time of a strictly sequential boot) and the
+      critical path, i.e. the longest chain of dependent stages. The
+      critical path is the lower limit of the boot time, so optimizing
+      a stage which is not on this path does not shorten the boot.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/event_groups.h>
+#include <esp_timer.h>
+#include "ESP32BleCfgBoot.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgBoot                                         */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Local Definitions
+//---------------------------------------------------------------------------
+
+#define BOOT_STAGE_TASK_STACK_SIZE      6144
+#define BOOT_STAGE_TASK_PRIORITY        2       // above loopTask (1), which waits in <Run()>
+
+
+// Registered Stage
+typedef struct
+{
+
+    tBootStageFunc  m_pfnStageFunc;
+    void*           m_pvArg;
+    tBootStageInfo  m_StageInfo;
+
+} tBootStage;
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  tBootStage          aBootStageList_g[BOOT_MAX_STAGES];
+static  unsigned int        uiBootNumStages_g               = 0;
+static  bool                fBootDone_g                     = false;
+
+static  EventGroupHandle_t  BootEventGroup_g                = NULL;
+static  int64_t             i64BootStartTime_g              = 0;
+static  tBootReport         BootReport_g                    = { 0 };
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: AddStage()
+//---------------------------------------------------------------------------
+//  Return:    >=0 -> Index of the stage (use (1 << Index) as dependency)
+//              -1 -> Error (invalid parameter)
+//              -2 -> Error (dependency on a stage not added yet)
+//              -3 -> Error (stage list full)
+//              -4 -> Error (pipeline already executed)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgBoot::AddStage (
+        const char* pszName_p,
+        tBootStageFunc pfnStageFunc_p,
+        void* pvArg_p,
+        uint32_t ui32DependMask_p,
+        int iCore_p)
+{
+
+tBootStage*  pBootStage;
+
+    if ((pszName_p == NULL) || (pfnStageFunc_p == NULL) || (iCore_p < BOOT_CORE_ANY))
+    {
+        return (-1);
+    }
+    if (iCore_p >= portNUM_PROCESSORS)
+    {
+        iCore_p = BOOT_CORE_ANY;                // single core chip
+    }
+    if ((ui32DependMask_p & ~((1UL << uiBootNumStages_g) - 1)) != 0)
+    {
+        return (-2);
+    }
+    if (uiBootNumStages_g >= BOOT_MAX_STAGES)
+    {
+        return (-3);
+    }
+    if ( fBootDone_g )
+    {
+        return (-4);
+    }
+
+    pBootStage = &aBootStageList_g[uiBootNumStages_g];
+    memset(pBootStage, 0x00, sizeof(tBootStage));
+    pBootStage->m_pfnStageFunc = pfnStageFunc_p;
+    pBootStage->m_pvArg        = pvArg_p;
+    pBootStage->m_StageInfo.m_pszName        = pszName_p;
+    pBootStage->m_StageInfo.m_ui32DependMask = ui32DependMask_p;
+    pBootStage->m_StageInfo.m_iCore          = iCore_p;
+
+    return ((int)uiBootNumStages_g++);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Run()
+//---------------------------------------------------------------------------
+//  Executes all stages and blocks the caller until the last stage is
+//  finished. Must be called only once. If the event group or a stage
+//  task cannot be created, the (remaining) stages are executed in the
+//  calling task, so all stages are always executed.
+//
+//  Return:    >=0 -> Number of executed stages
+//              -1 -> Error (pipeline already executed)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgBoot::Run (
+        bool fParallel_p)
+{
+
+EventBits_t   AllStagesMask;
+BaseType_t    Res;
+unsigned int  uiIdx;
+
+    if ( fBootDone_g )
+    {
+        return (-1);
+    }
+
+    fBootDone_g = true;
+    memset(&BootReport_g, 0x00, sizeof(BootReport_g));
+    BootReport_g.m_ui8NumStages = (uint8_t)uiBootNumStages_g;
+    i64BootStartTime_g = esp_timer_get_time();
+
+    if ( fParallel_p && (uiBootNumStages_g > 0) )
+    {
+        BootEventGroup_g = xEventGroupCreate();
+        if (BootEventGroup_g == NULL)
+        {
+            TRACE0("ESP32BleCfgBoot: creation of event group failed -> sequential boot\n");
+            fParallel_p = false;
+        }
+    }
+    else
+    {
+        fParallel_p = false;
+    }
+    BootReport_g.m_fParallel = fParallel_p;
+
+    if ( fParallel_p )
+    {
+        AllStagesMask = (EventBits_t)((1UL << uiBootNumStages_g) - 1);
+        for (uiIdx=0; uiIdx<uiBootNumStages_g; uiIdx++)
+        {
+            Res = xTaskCreatePinnedToCore(StageTask, aBootStageList_g[uiIdx].m_StageInfo.m_pszName, BOOT_STAGE_TASK_STACK_SIZE,
+                                          (void*)(uintptr_t)uiIdx, BOOT_STAGE_TASK_PRIORITY, NULL,
+                                          (aBootStageList_g[uiIdx].m_StageInfo.m_iCore == BOOT_CORE_ANY) ? tskNO_AFFINITY : aBootStageList_g[uiIdx].m_StageInfo.m_iCore);
+            if (Res != pdPASS)
+            {
+                // execute the remaining stages in this task (the stages already
+                // started only depend on each other, so they finish anyway)
+                TRACE1("ESP32BleCfgBoot: creation of task for stage '%s' failed\n", aBootStageList_g[uiIdx].m_StageInfo.m_pszName);
+                for (; uiIdx<uiBootNumStages_g; uiIdx++)
+                {
+                    if (aBootStageList_g[uiIdx].m_StageInfo.m_ui32DependMask != 0)
+                    {
+                        xEventGroupWaitBits(BootEventGroup_g, (EventBits_t)aBootStageList_g[uiIdx].m_StageInfo.m_ui32DependMask, pdFALSE, pdTRUE, portMAX_DELAY);
+                    }
+                    ExecStage(uiIdx);
+                    xEventGroupSetBits(BootEventGroup_g, (EventBits_t)(1UL << uiIdx));
+                }
+                break;
+            }
+        }
+        xEventGroupWaitBits(BootEventGroup_g, AllStagesMask, pdFALSE, pdTRUE, portMAX_DELAY);
+        vEventGroupDelete(BootEventGroup_g);
+        BootEventGroup_g = NULL;
+    }
+    else
+    {
+        for (uiIdx=0; uiIdx<uiBootNumStages_g; uiIdx++)
+        {
+            ExecStage(uiIdx);
+        }
+    }
+
+    BootReport_g.m_ui32BootTime = (uint32_t)(esp_timer_get_time() - i64BootStartTime_g);
+    CalcCriticalPath();
+
+    TRACE3("ESP32BleCfgBoot: Boot=%lu us, Sequential=%lu us, CriticalPath=%lu us\n",
+           (unsigned long)BootReport_g.m_ui32BootTime, (unsigned long)BootReport_g.m_ui32SequentialTime,
+           (unsigned long)BootReport_g.m_ui32CriticalPathTime);
+
+    return ((int)uiBootNumStages_g);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetReport()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgBoot::GetReport (
+        tBootReport* pBootReport_p)
+{
+
+    if ((pBootReport_p == NULL) || !fBootDone_g)
+    {
+        return (false);
+    }
+
+    memcpy(pBootReport_p, &BootReport_g, sizeof(tBootReport));
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetStageInfo()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgBoot::GetStageInfo (
+        unsigned int uiStageIdx_p,
+        tBootStageInfo* pStageInfo_p)
+{
+
+    if ((pStageInfo_p == NULL) || (uiStageIdx_p >= uiBootNumStages_g))
+    {
+        return (false);
+    }
+
+    memcpy(pStageInfo_p, &aBootStageList_g[uiStageIdx_p].m_StageInfo, sizeof(tBootStageInfo));
+
+    return (true);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: StageTask()
+//---------------------------------------------------------------------------
+//  Task of one stage in parallel mode: waits for the dependencies,
+//  executes the stage and signals its completion.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgBoot::StageTask (
+        void* pvParam_p)
+{
+
+unsigned int  uiStageIdx;
+uint32_t      ui32DependMask;
+
+    uiStageIdx = (unsigned int)(uintptr_t)pvParam_p;
+    ui32DependMask = aBootStageList_g[uiStageIdx].m_StageInfo.m_ui32DependMask;
+
+    if (ui32DependMask != 0)
+    {
+        xEventGroupWaitBits(BootEventGroup_g, (EventBits_t)ui32DependMask, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+
+    ExecStage(uiStageIdx);
+
+    xEventGroupSetBits(BootEventGroup_g, (EventBits_t)(1UL << uiStageIdx));
+    vTaskDelete(NULL);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ExecStage()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgBoot::ExecStage (
+        unsigned int uiStageIdx_p)
+{
+
+tBootStage*  pBootStage;
+
+    pBootStage = &aBootStageList_g[uiStageIdx_p];
+
+    pBootStage->m_StageInfo.m_ui32StartTime = (uint32_t)(esp_timer_get_time() - i64BootStartTime_g);
+    pBootStage->m_pfnStageFunc(pBootStage->m_pvArg);
+    pBootStage->m_StageInfo.m_ui32EndTime = (uint32_t)(esp_timer_get_time() - i64BootStartTime_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CalcCriticalPath()
+//---------------------------------------------------------------------------
+//  Longest chain of dependent stages, based on the measured durations.
+//  Since each stage only depends on stages added before, a single pass
+//  in list order is sufficient.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgBoot::CalcCriticalPath ()
+{
+
+uint32_t      aui32PathTime[BOOT_MAX_STAGES];
+uint32_t      aui32PathMask[BOOT_MAX_STAGES];
+uint32_t      ui32Duration;
+unsigned int  uiIdx;
+unsigned int  uiDep;
+
+    for (uiIdx=0; uiIdx<uiBootNumStages_g; uiIdx++)
+    {
+        ui32Duration = aBootStageList_g[uiIdx].m_StageInfo.m_ui32EndTime - aBootStageList_g[uiIdx].m_StageInfo.m_ui32StartTime;
+        BootReport_g.m_ui32SequentialTime += ui32Duration;
+
+        // longest path of all dependencies
+        aui32PathTime[uiIdx] = 0;
+        aui32PathMask[uiIdx] = 0;
+        for (uiDep=0; uiDep<uiIdx; uiDep++)
+        {
+            if ((aBootStageList_g[uiIdx].m_StageInfo.m_ui32DependMask & (1UL << uiDep)) &&
+                (aui32PathTime[uiDep] >= aui32PathTime[uiIdx]))
+            {
+                aui32PathTime[uiIdx] = aui32PathTime[uiDep];
+                aui32PathMask[uiIdx] = aui32PathMask[uiDep];
+            }
+        }
+        aui32PathTime[uiIdx] += ui32Duration;
+        aui32PathMask[uiIdx] |= (1UL << uiIdx);
+
+        if (aui32PathTime[uiIdx] >= BootReport_g.m_ui32CriticalPathTime)
+        {
+            BootReport_g.m_ui32CriticalPathTime = aui32PathTime[uiIdx];
+            BootReport_g.m_ui32CriticalPathMask = aui32PathMask[uiIdx];
+        }
+    }
+
+    return;
+
+}
+
+
+
+
+//  EOF
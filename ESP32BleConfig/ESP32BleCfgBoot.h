@@ -0,0 +1,120 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgBoot> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGBOOT_H_
+#define _ESP32BLECFGBOOT_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+#define BOOT_MAX_STAGES                 8
+#define BOOT_CORE_ANY                   -1      // stage may run on any core
+
+
+// Stage Function, called once by <Run()> after all dependencies are finished
+typedef  void  (*tBootStageFunc) (void* pvArg_p);
+
+
+// Timing of a single Stage (all times relative to the start of <Run()>)
+typedef struct
+{
+
+    const char*     m_pszName;
+    uint32_t        m_ui32DependMask;           // Bit[StageIdx] = 1 -> stage waits for this stage
+    int             m_iCore;                    // 0, 1 or BOOT_CORE_ANY
+    uint32_t        m_ui32StartTime;            // start of the stage function                  [us]
+    uint32_t        m_ui32EndTime;              // end of the stage function                    [us]
+
+} tBootStageInfo;
+
+
+// Report over the last <Run()>
+typedef struct
+{
+
+    uint8_t         m_ui8NumStages;
+    bool            m_fParallel;                // stages ran as tasks on both cores
+    uint32_t        m_ui32BootTime;             // wall clock time of <Run()>                   [us]
+    uint32_t        m_ui32SequentialTime;       // sum of all stage durations                   [us]
+    uint32_t        m_ui32CriticalPathTime;     // longest dependency chain                     [us]
+    uint32_t        m_ui32CriticalPathMask;     // Bit[StageIdx] = 1 -> stage is on critical path
+
+} tBootReport;
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgBoot                                         */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgBoot
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int   AddStage(const char* pszName_p, tBootStageFunc pfnStageFunc_p, void* pvArg_p, uint32_t ui32DependMask_p, int iCore_p);
+        static  int   Run(bool fParallel_p);
+        static  bool  GetReport(tBootReport* pBootReport_p);
+        static  bool  GetStageInfo(unsigned int uiStageIdx_p, tBootStageInfo* pStageInfo_p);
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  void  StageTask(void* pvParam_p);
+        static  void  ExecStage(unsigned int uiStageIdx_p);
+        static  void  CalcCriticalPath();
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGBOOT_H_
@@ -0,0 +1,883 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgFields> Implementation
+
+  -------------------------------------------------------------------------
+
+    Field based Access to the Configuration Data <tAppCfgData>:
+
+    Each field of <tAppCfgData> is identified by a fixed Field ID. This
+    allows a Client to change several settings with one single write access
+    to [DevMnt/ConfigPatch] (Config Patch), instead of writing each
+    characteristic separately followed by a write to [DevMnt/SaveConfig].
+
+    The same entries (Field ID, Length, Value) are used by the Config Image
+    ([DevMnt/ConfigImage]), a self-describing image of the complete
+    configuration for backup and cloning of devices. Encoder and decoder
+    work directly on the caller's buffer and need no heap.
+
+    The Field IDs are independent of the memory layout of <tAppCfgData>,
+    so they remain valid even if the structure is changed.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include "ESP32BleCfgProfile.h"         // -> typedef struct tAppCfgData
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleAppCfgData.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgFields                                       */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Local Definitions
+//---------------------------------------------------------------------------
+
+// List of all fields of <tAppCfgData>
+static  const tCfgFieldDescr  CFG_FIELD_LIST[] =
+{
+    { CFG_FIELD_DEVMNT_DEVNAME,     CFG_FIELD_TYPE_STRING,  sizeof(((tAppCfgData*)0)->m_szDevMntDevName),   1,  CFG_FIELD_FMT_TEXT          },
+    { CFG_FIELD_WIFI_SSID,          CFG_FIELD_TYPE_STRING,  sizeof(((tAppCfgData*)0)->m_szWifiSSID),        1,  CFG_FIELD_FMT_TEXT          },
+    { CFG_FIELD_WIFI_PASSWD,        CFG_FIELD_TYPE_STRING,  sizeof(((tAppCfgData*)0)->m_szWifiPasswd),      0,  CFG_FIELD_FMT_WIFI_PASSWD   },
+    { CFG_FIELD_WIFI_OWNADDR,       CFG_FIELD_TYPE_STRING,  sizeof(((tAppCfgData*)0)->m_szWifiOwnAddr),     7,  CFG_FIELD_FMT_ENDPOINT      },
+    { CFG_FIELD_WIFI_OWNMODE,       CFG_FIELD_TYPE_UINT8,   1,                                              1,  CFG_FIELD_FMT_OWNMODE       },
+    { CFG_FIELD_APP_RT_OPT1,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT2,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT3,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT4,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT5,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT6,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT7,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_OPT8,        CFG_FIELD_TYPE_BOOL,    1,                                              1,  CFG_FIELD_FMT_ANY           },
+    { CFG_FIELD_APP_RT_PEERADDR,    CFG_FIELD_TYPE_STRING,  sizeof(((tAppCfgData*)0)->m_szAppRtPeerAddr),   7,  CFG_FIELD_FMT_ENDPOINT      }
+};
+
+#define CFG_FIELD_LIST_LEN              (sizeof(CFG_FIELD_LIST) / sizeof(CFG_FIELD_LIST[0]))
+
+#define CFG_WIFI_PASSWD_MIN_LEN         8       // WPA2-PSK Passphrase: 8..63 printable ASCII characters
+#define CFG_WIFI_PASSWD_PSK_LEN         64      // WPA2-PSK as 64 hex digits
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  uint8_t             ui8OwnModeFeatList_g            = (WIFI_OPMODE_STA | WIFI_OPMODE_AP);
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: ApplyPatch()
+//---------------------------------------------------------------------------
+//  Applies a Config Patch to <pAppCfgData_p>. In a first pass, all entries
+//  are validated; only if all of them are valid, they are applied in a
+//  second pass. So the patch is applied either completely or not at all.
+//
+//  Return:     Length of the response in <pabRsp_p> (CFG_PATCH_RSP_SIZE)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::ApplyPatch (
+        const uint8_t* pabPatch_p,
+        unsigned int uiPatchLen_p,
+        tAppCfgData* pAppCfgData_p,
+        uint8_t* pabRsp_p)
+{
+
+unsigned int  uiErrEntryIdx;
+unsigned int  uiAppliedEntries;
+int           iStatus;
+
+    if ((pabPatch_p == NULL) || (uiPatchLen_p < CFG_PATCH_HDR_SIZE) || (pAppCfgData_p == NULL))
+    {
+        return (BuildPatchRsp(pabRsp_p, CFG_STATUS_FORMAT_ERROR, CFG_PATCH_NO_ENTRY_IDX, 0));
+    }
+
+    iStatus = ApplyEntries(&pabPatch_p[CFG_PATCH_HDR_SIZE], uiPatchLen_p - CFG_PATCH_HDR_SIZE, false,
+                           pAppCfgData_p, &uiErrEntryIdx, &uiAppliedEntries);
+
+    return (BuildPatchRsp(pabRsp_p, (uint8_t)iStatus, uiErrEntryIdx, uiAppliedEntries));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: EncodeImage()
+//---------------------------------------------------------------------------
+//  Return:     >  0 -> Length of the Config Image in <pabImage_p>
+//              <  0 -> Error (invalid parameter or buffer too small)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::EncodeImage (
+        const tAppCfgData* pAppCfgData_p,
+        uint8_t* pabImage_p,
+        unsigned int uiImageBuffSize_p)
+{
+
+unsigned int  uiOffset;
+unsigned int  uiIdx;
+uint32_t      ui32Crc;
+int           iValueLen;
+
+    if ((pAppCfgData_p == NULL) || (pabImage_p == NULL) || (uiImageBuffSize_p < (CFG_IMAGE_HDR_SIZE + CFG_IMAGE_CRC_SIZE)))
+    {
+        return (-1);
+    }
+
+    pabImage_p[0] = (uint8_t)(CFG_IMAGE_MAGIC);
+    pabImage_p[1] = (uint8_t)(CFG_IMAGE_MAGIC >> 8);
+    pabImage_p[2] = CFG_IMAGE_VERSION;
+    pabImage_p[3] = (uint8_t)CFG_FIELD_LIST_LEN;
+    uiOffset = CFG_IMAGE_HDR_SIZE;
+
+    // each value is written directly behind its entry header
+    for (uiIdx=0; uiIdx<CFG_FIELD_LIST_LEN; uiIdx++)
+    {
+        if ((uiOffset + CFG_PATCH_ENTRY_HDR_SIZE + CFG_IMAGE_CRC_SIZE) > uiImageBuffSize_p)
+        {
+            return (-2);
+        }
+        iValueLen = GetField(pAppCfgData_p, CFG_FIELD_LIST[uiIdx].m_ui8FieldId, &pabImage_p[uiOffset + CFG_PATCH_ENTRY_HDR_SIZE],
+                             uiImageBuffSize_p - uiOffset - CFG_PATCH_ENTRY_HDR_SIZE - CFG_IMAGE_CRC_SIZE);
+        if (iValueLen < 0)
+        {
+            return (-2);
+        }
+        pabImage_p[uiOffset]     = CFG_FIELD_LIST[uiIdx].m_ui8FieldId;
+        pabImage_p[uiOffset + 1] = (uint8_t)iValueLen;
+        uiOffset += CFG_PATCH_ENTRY_HDR_SIZE + iValueLen;
+    }
+
+    ui32Crc = ESP32BleAppCfgData::CalulateCrc32(pabImage_p, uiOffset);
+    pabImage_p[uiOffset]     = (uint8_t)(ui32Crc);
+    pabImage_p[uiOffset + 1] = (uint8_t)(ui32Crc >> 8);
+    pabImage_p[uiOffset + 2] = (uint8_t)(ui32Crc >> 16);
+    pabImage_p[uiOffset + 3] = (uint8_t)(ui32Crc >> 24);
+    uiOffset += CFG_IMAGE_CRC_SIZE;
+
+    return ((int)uiOffset);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: DecodeImage()
+//---------------------------------------------------------------------------
+//  Applies a Config Image to <pAppCfgData_p>. As for a Config Patch, the
+//  image is applied either completely or not at all.
+//
+//  Return:     Length of the response in <pabRsp_p> (CFG_PATCH_RSP_SIZE)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::DecodeImage (
+        const uint8_t* pabImage_p,
+        unsigned int uiImageLen_p,
+        tAppCfgData* pAppCfgData_p,
+        uint8_t* pabRsp_p)
+{
+
+unsigned int  uiEntriesLen;
+unsigned int  uiErrEntryIdx;
+unsigned int  uiAppliedEntries;
+uint32_t      ui32ImageCrc;
+uint32_t      ui32Crc;
+int           iStatus;
+
+    if ((pabImage_p == NULL) || (uiImageLen_p < (CFG_IMAGE_HDR_SIZE + CFG_IMAGE_CRC_SIZE)) || (pAppCfgData_p == NULL))
+    {
+        return (BuildPatchRsp(pabRsp_p, CFG_STATUS_FORMAT_ERROR, CFG_PATCH_NO_ENTRY_IDX, 0));
+    }
+
+    if ((pabImage_p[0] != (uint8_t)(CFG_IMAGE_MAGIC)) || (pabImage_p[1] != (uint8_t)(CFG_IMAGE_MAGIC >> 8)))
+    {
+        return (BuildPatchRsp(pabRsp_p, CFG_STATUS_FORMAT_ERROR, CFG_PATCH_NO_ENTRY_IDX, 0));
+    }
+    // version 0 was never issued (e.g. an erased or zero-filled image)
+    if ((pabImage_p[2] == 0) || (pabImage_p[2] > CFG_IMAGE_VERSION))
+    {
+        return (BuildPatchRsp(pabRsp_p, CFG_STATUS_VERSION_ERROR, CFG_PATCH_NO_ENTRY_IDX, 0));
+    }
+
+    uiEntriesLen = uiImageLen_p - CFG_IMAGE_HDR_SIZE - CFG_IMAGE_CRC_SIZE;
+    ui32ImageCrc = (uint32_t)pabImage_p[uiImageLen_p - 4]         | ((uint32_t)pabImage_p[uiImageLen_p - 3] << 8) |
+                   ((uint32_t)pabImage_p[uiImageLen_p - 2] << 16) | ((uint32_t)pabImage_p[uiImageLen_p - 1] << 24);
+    ui32Crc = ESP32BleAppCfgData::CalulateCrc32(pabImage_p, uiImageLen_p - CFG_IMAGE_CRC_SIZE);
+    if (ui32Crc != ui32ImageCrc)
+    {
+        return (BuildPatchRsp(pabRsp_p, CFG_STATUS_CRC_ERROR, CFG_PATCH_NO_ENTRY_IDX, 0));
+    }
+
+    iStatus = ApplyEntries(&pabImage_p[CFG_IMAGE_HDR_SIZE], uiEntriesLen, true,
+                           pAppCfgData_p, &uiErrEntryIdx, &uiAppliedEntries);
+    if ((iStatus == CFG_STATUS_OK) && (uiErrEntryIdx != pabImage_p[3]))
+    {
+        // number of entries does not match the header
+        iStatus = CFG_STATUS_FORMAT_ERROR;
+        uiAppliedEntries = 0;
+    }
+
+    return (BuildPatchRsp(pabRsp_p, (uint8_t)iStatus, uiErrEntryIdx, uiAppliedEntries));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetFieldDescr()
+//---------------------------------------------------------------------------
+
+const tCfgFieldDescr*  ESP32BleCfgFields::GetFieldDescr (
+        uint8_t ui8FieldId_p)
+{
+
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<CFG_FIELD_LIST_LEN; uiIdx++)
+    {
+        if (CFG_FIELD_LIST[uiIdx].m_ui8FieldId == ui8FieldId_p)
+        {
+            return (&CFG_FIELD_LIST[uiIdx]);
+        }
+    }
+
+    return (NULL);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetFieldDescrByIdx()
+//---------------------------------------------------------------------------
+//  Enumerates all fields, returns NULL after the last field.
+//---------------------------------------------------------------------------
+
+const tCfgFieldDescr*  ESP32BleCfgFields::GetFieldDescrByIdx (
+        unsigned int uiFieldIdx_p)
+{
+
+    if (uiFieldIdx_p >= CFG_FIELD_LIST_LEN)
+    {
+        return (NULL);
+    }
+
+    return (&CFG_FIELD_LIST[uiFieldIdx_p]);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetField()
+//---------------------------------------------------------------------------
+//  Return:     >= 0 -> Length of the value copied into <pabValue_p>
+//              <  0 -> Error (unknown field or buffer too small)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::GetField (
+        const tAppCfgData* pAppCfgData_p,
+        uint8_t ui8FieldId_p,
+        uint8_t* pabValue_p,
+        unsigned int uiValueBuffSize_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+const char*            pszString;
+unsigned int           uiValueLen;
+bool                   fValue;
+
+    pFieldDescr = GetFieldDescr(ui8FieldId_p);
+    if ((pFieldDescr == NULL) || (pAppCfgData_p == NULL) || (pabValue_p == NULL))
+    {
+        return (-1);
+    }
+
+    pszString = NULL;
+    fValue    = false;
+    switch (ui8FieldId_p)
+    {
+        case CFG_FIELD_DEVMNT_DEVNAME:   pszString = pAppCfgData_p->m_szDevMntDevName;  break;
+        case CFG_FIELD_WIFI_SSID:        pszString = pAppCfgData_p->m_szWifiSSID;       break;
+        case CFG_FIELD_WIFI_PASSWD:      pszString = pAppCfgData_p->m_szWifiPasswd;     break;
+        case CFG_FIELD_WIFI_OWNADDR:     pszString = pAppCfgData_p->m_szWifiOwnAddr;    break;
+        case CFG_FIELD_APP_RT_PEERADDR:  pszString = pAppCfgData_p->m_szAppRtPeerAddr;  break;
+        case CFG_FIELD_APP_RT_OPT1:      fValue = pAppCfgData_p->m_fAppRtOpt1;          break;
+        case CFG_FIELD_APP_RT_OPT2:      fValue = pAppCfgData_p->m_fAppRtOpt2;          break;
+        case CFG_FIELD_APP_RT_OPT3:      fValue = pAppCfgData_p->m_fAppRtOpt3;          break;
+        case CFG_FIELD_APP_RT_OPT4:      fValue = pAppCfgData_p->m_fAppRtOpt4;          break;
+        case CFG_FIELD_APP_RT_OPT5:      fValue = pAppCfgData_p->m_fAppRtOpt5;          break;
+        case CFG_FIELD_APP_RT_OPT6:      fValue = pAppCfgData_p->m_fAppRtOpt6;          break;
+        case CFG_FIELD_APP_RT_OPT7:      fValue = pAppCfgData_p->m_fAppRtOpt7;          break;
+        case CFG_FIELD_APP_RT_OPT8:      fValue = pAppCfgData_p->m_fAppRtOpt8;          break;
+        default:                                                                        break;
+    }
+
+    switch (pFieldDescr->m_ui8Type)
+    {
+        case CFG_FIELD_TYPE_STRING:
+        {
+            uiValueLen = strnlen(pszString, pFieldDescr->m_ui8MaxLen);
+            if (uiValueLen > uiValueBuffSize_p)
+            {
+                return (-2);
+            }
+            memcpy(pabValue_p, pszString, uiValueLen);
+            break;
+        }
+
+        case CFG_FIELD_TYPE_UINT8:
+        {
+            if (uiValueBuffSize_p < 1)
+            {
+                return (-2);
+            }
+            pabValue_p[0] = pAppCfgData_p->m_ui8WifiOwnMode;
+            uiValueLen = 1;
+            break;
+        }
+
+        case CFG_FIELD_TYPE_BOOL:
+        {
+            if (uiValueBuffSize_p < 1)
+            {
+                return (-2);
+            }
+            pabValue_p[0] = fValue ? 1 : 0;
+            uiValueLen = 1;
+            break;
+        }
+
+        default:
+        {
+            return (-1);
+        }
+    }
+
+    return ((int)uiValueLen);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: SetField()
+//---------------------------------------------------------------------------
+//  The value must have been checked by <CheckField()> before.
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::SetField (
+        tAppCfgData* pAppCfgData_p,
+        uint8_t ui8FieldId_p,
+        const uint8_t* pabValue_p,
+        unsigned int uiValueLen_p)
+{
+
+char*  pszString;
+bool   fValue;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    pszString = NULL;
+    fValue    = ((uiValueLen_p > 0) && (pabValue_p[0] != 0)) ? true : false;
+    switch (ui8FieldId_p)
+    {
+        case CFG_FIELD_DEVMNT_DEVNAME:   pszString = pAppCfgData_p->m_szDevMntDevName;  break;
+        case CFG_FIELD_WIFI_SSID:        pszString = pAppCfgData_p->m_szWifiSSID;       break;
+        case CFG_FIELD_WIFI_PASSWD:      pszString = pAppCfgData_p->m_szWifiPasswd;     break;
+        case CFG_FIELD_WIFI_OWNADDR:     pszString = pAppCfgData_p->m_szWifiOwnAddr;    break;
+        case CFG_FIELD_APP_RT_PEERADDR:  pszString = pAppCfgData_p->m_szAppRtPeerAddr;  break;
+        case CFG_FIELD_WIFI_OWNMODE:     pAppCfgData_p->m_ui8WifiOwnMode = pabValue_p[0];   break;
+        case CFG_FIELD_APP_RT_OPT1:      pAppCfgData_p->m_fAppRtOpt1 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT2:      pAppCfgData_p->m_fAppRtOpt2 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT3:      pAppCfgData_p->m_fAppRtOpt3 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT4:      pAppCfgData_p->m_fAppRtOpt4 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT5:      pAppCfgData_p->m_fAppRtOpt5 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT6:      pAppCfgData_p->m_fAppRtOpt6 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT7:      pAppCfgData_p->m_fAppRtOpt7 = fValue;          break;
+        case CFG_FIELD_APP_RT_OPT8:      pAppCfgData_p->m_fAppRtOpt8 = fValue;          break;
+        default:                         return (-1);
+    }
+
+    // strings are padded with zeros (same semantic as 'strncpy')
+    if (pszString != NULL)
+    {
+        memset(pszString, 0x00, GetFieldDescr(ui8FieldId_p)->m_ui8MaxLen);
+        memcpy(pszString, pabValue_p, uiValueLen_p);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CheckField()
+//---------------------------------------------------------------------------
+//  Checks type, length and format of a value according to the field
+//  description. Used for all write paths (characteristics, Config Patch,
+//  Config Image, NVS), so an invalid value is rejected before it reaches
+//  the configuration.
+//
+//  Return:     CFG_STATUS_xxx
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::CheckField (
+        uint8_t ui8FieldId_p,
+        const uint8_t* pabValue_p,
+        unsigned int uiValueLen_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+unsigned int           uiIdx;
+uint8_t                ui8Char;
+
+    pFieldDescr = GetFieldDescr(ui8FieldId_p);
+    if (pFieldDescr == NULL)
+    {
+        return (CFG_STATUS_UNKNOWN_FIELD);
+    }
+
+    if ((uiValueLen_p < pFieldDescr->m_ui8MinLen) || (uiValueLen_p > pFieldDescr->m_ui8MaxLen))
+    {
+        return (CFG_STATUS_LENGTH_ERROR);
+    }
+
+    switch (pFieldDescr->m_ui8Type)
+    {
+        case CFG_FIELD_TYPE_STRING:
+        {
+            // embedded zeros would silently truncate the string
+            if (memchr(pabValue_p, '\0', uiValueLen_p) != NULL)
+            {
+                return (CFG_STATUS_VALUE_ERROR);
+            }
+            break;
+        }
+
+        case CFG_FIELD_TYPE_UINT8:
+        {
+            break;
+        }
+
+        case CFG_FIELD_TYPE_BOOL:
+        {
+            if (pabValue_p[0] > 1)
+            {
+                return (CFG_STATUS_VALUE_ERROR);
+            }
+            break;
+        }
+
+        default:
+        {
+            return (CFG_STATUS_UNKNOWN_FIELD);
+        }
+    }
+
+    switch (pFieldDescr->m_ui8Format)
+    {
+        case CFG_FIELD_FMT_TEXT:
+        {
+            for (uiIdx=0; uiIdx<uiValueLen_p; uiIdx++)
+            {
+                if ((pabValue_p[uiIdx] < 0x20) || (pabValue_p[uiIdx] == 0x7F))
+                {
+                    return (CFG_STATUS_VALUE_ERROR);
+                }
+            }
+            break;
+        }
+
+        case CFG_FIELD_FMT_WIFI_PASSWD:
+        {
+            if (uiValueLen_p == 0)
+            {
+                break;                                                  // open network
+            }
+            if (uiValueLen_p < CFG_WIFI_PASSWD_MIN_LEN)
+            {
+                return (CFG_STATUS_LENGTH_ERROR);
+            }
+            for (uiIdx=0; uiIdx<uiValueLen_p; uiIdx++)
+            {
+                ui8Char = pabValue_p[uiIdx];
+                if (uiValueLen_p == CFG_WIFI_PASSWD_PSK_LEN)
+                {
+                    if ( !isxdigit(ui8Char) )
+                    {
+                        return (CFG_STATUS_VALUE_ERROR);
+                    }
+                }
+                else if ((ui8Char < 0x20) || (ui8Char > 0x7E))
+                {
+                    return (CFG_STATUS_VALUE_ERROR);
+                }
+            }
+            break;
+        }
+
+        case CFG_FIELD_FMT_ENDPOINT:
+        {
+            if ( !ParseEndpoint((const char*)pabValue_p, uiValueLen_p, NULL, NULL) )
+            {
+                return (CFG_STATUS_VALUE_ERROR);
+            }
+            break;
+        }
+
+        case CFG_FIELD_FMT_OWNMODE:
+        {
+            // exactly one bit, supported by the application
+            if ( (pabValue_p[0] == 0) || ((pabValue_p[0] & (pabValue_p[0] - 1)) != 0) ||
+                 ((pabValue_p[0] & ui8OwnModeFeatList_g) != pabValue_p[0]) )
+            {
+                return (CFG_STATUS_VALUE_ERROR);
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return (CFG_STATUS_OK);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CheckData()
+//---------------------------------------------------------------------------
+//  Checks all fields of a complete configuration, e.g. before it is saved.
+//  In case of an error, <pui8FieldId_p> receives the ID of the first
+//  invalid field (may be NULL).
+//
+//  Return:     CFG_STATUS_xxx
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::CheckData (
+        const tAppCfgData* pAppCfgData_p,
+        uint8_t* pui8FieldId_p)
+{
+
+uint8_t       abValue[UINT8_MAX];
+unsigned int  uiFieldIdx;
+int           iValueLen;
+int           iStatus;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (CFG_STATUS_FORMAT_ERROR);
+    }
+
+    for (uiFieldIdx=0; uiFieldIdx<CFG_FIELD_LIST_LEN; uiFieldIdx++)
+    {
+        iValueLen = GetField(pAppCfgData_p, CFG_FIELD_LIST[uiFieldIdx].m_ui8FieldId, abValue, sizeof(abValue));
+        iStatus = (iValueLen < 0) ? CFG_STATUS_FORMAT_ERROR : CheckField(CFG_FIELD_LIST[uiFieldIdx].m_ui8FieldId, abValue, (unsigned int)iValueLen);
+        if (iStatus != CFG_STATUS_OK)
+        {
+            if (pui8FieldId_p != NULL)
+            {
+                *pui8FieldId_p = CFG_FIELD_LIST[uiFieldIdx].m_ui8FieldId;
+            }
+            return (iStatus);
+        }
+    }
+
+    return (CFG_STATUS_OK);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: SetOwnModeFeatList()
+//---------------------------------------------------------------------------
+//  WiFi Modes (WIFI_OPMODE_xxx) accepted for CFG_FIELD_WIFI_OWNMODE,
+//  same as <tAppDescriptData::m_ui8OwnModeFeatList>.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgFields::SetOwnModeFeatList (
+        uint8_t ui8OwnModeFeatList_p)
+{
+
+    if (ui8OwnModeFeatList_p != 0)
+    {
+        ui8OwnModeFeatList_g = ui8OwnModeFeatList_p;
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ParseEndpoint()
+//---------------------------------------------------------------------------
+//  Format: "a.b.c.d[:port]", the string ends at the first zero or after
+//  <uiMaxLen_p> characters. <pabIpAddr_p> and <pui16PortNum_p> may be NULL
+//  to check the format only.
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgFields::ParseEndpoint (
+        const char* pszNetAddr_p,
+        unsigned int uiMaxLen_p,
+        uint8_t* pabIpAddr_p,
+        uint16_t* pui16PortNum_p)
+{
+
+uint8_t       abIpAddr[4];
+uint16_t      ui16PortNum;
+unsigned int  uiIdx;
+unsigned int  uiOctet;
+unsigned int  uiValue;
+unsigned int  uiDigits;
+char          cChar;
+
+    uiIdx = 0;
+    for (uiOctet=0; uiOctet<4; uiOctet++)
+    {
+        uiValue = 0;
+        uiDigits = 0;
+        while ((uiIdx < uiMaxLen_p) && (pszNetAddr_p[uiIdx] >= '0') && (pszNetAddr_p[uiIdx] <= '9'))
+        {
+            uiValue = (uiValue * 10) + (pszNetAddr_p[uiIdx] - '0');
+            uiDigits++;
+            uiIdx++;
+        }
+        if ((uiDigits == 0) || (uiDigits > 3) || (uiValue > 255))
+        {
+            return (false);
+        }
+        abIpAddr[uiOctet] = (uint8_t)uiValue;
+
+        cChar = (uiIdx < uiMaxLen_p) ? pszNetAddr_p[uiIdx] : '\0';
+        if (uiOctet < 3)
+        {
+            if (cChar != '.')
+            {
+                return (false);
+            }
+            uiIdx++;
+        }
+    }
+
+    // optional port number
+    ui16PortNum = 0;
+    cChar = (uiIdx < uiMaxLen_p) ? pszNetAddr_p[uiIdx] : '\0';
+    if (cChar == ':')
+    {
+        uiIdx++;
+        uiValue = 0;
+        uiDigits = 0;
+        while ((uiIdx < uiMaxLen_p) && (pszNetAddr_p[uiIdx] >= '0') && (pszNetAddr_p[uiIdx] <= '9'))
+        {
+            uiValue = (uiValue * 10) + (pszNetAddr_p[uiIdx] - '0');
+            uiDigits++;
+            uiIdx++;
+        }
+        if ((uiDigits == 0) || (uiDigits > 5) || (uiValue > 0xFFFF))
+        {
+            return (false);
+        }
+        ui16PortNum = (uint16_t)uiValue;
+        cChar = (uiIdx < uiMaxLen_p) ? pszNetAddr_p[uiIdx] : '\0';
+    }
+
+    if (cChar != '\0')
+    {
+        return (false);
+    }
+
+    if (pabIpAddr_p != NULL)
+    {
+        memcpy(pabIpAddr_p, abIpAddr, sizeof(abIpAddr));
+    }
+    if (pui16PortNum_p != NULL)
+    {
+        *pui16PortNum_p = ui16PortNum;
+    }
+
+    return (true);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: ApplyEntries()
+//---------------------------------------------------------------------------
+//  In a first pass, all entries are validated; only if all of them are
+//  valid, they are applied in a second pass to <pAppCfgData_p>. A Field ID
+//  contained in more than one entry is rejected, as the result would depend
+//  on the order of the entries.
+//
+//  Return:     CFG_STATUS_xxx
+//              <puiErrEntryIdx_p>    -> index of the faulty entry resp.
+//                                       number of entries if all are valid
+//              <puiAppliedEntries_p> -> number of applied entries
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::ApplyEntries (
+        const uint8_t* pabEntries_p,
+        unsigned int uiEntriesLen_p,
+        bool fSkipUnknown_p,
+        tAppCfgData* pAppCfgData_p,
+        unsigned int* puiErrEntryIdx_p,
+        unsigned int* puiAppliedEntries_p)
+{
+
+unsigned int  uiOffset;
+unsigned int  uiEntryIdx;
+unsigned int  uiValueLen;
+unsigned int  uiApplied;
+uint32_t      aui32FieldSeen[256 / 32];
+uint8_t       ui8FieldId;
+int           iStatus;
+
+    *puiAppliedEntries_p = 0;
+    memset(aui32FieldSeen, 0x00, sizeof(aui32FieldSeen));
+
+    // ---- Pass 1: validate all entries ----
+    uiOffset   = 0;
+    uiEntryIdx = 0;
+    while (uiOffset < uiEntriesLen_p)
+    {
+        *puiErrEntryIdx_p = uiEntryIdx;
+        if ((uiOffset + CFG_PATCH_ENTRY_HDR_SIZE) > uiEntriesLen_p)
+        {
+            return (CFG_STATUS_FORMAT_ERROR);
+        }
+
+        ui8FieldId = pabEntries_p[uiOffset];
+        uiValueLen = pabEntries_p[uiOffset + 1];
+        uiOffset  += CFG_PATCH_ENTRY_HDR_SIZE;
+        if ((uiOffset + uiValueLen) > uiEntriesLen_p)
+        {
+            return (CFG_STATUS_FORMAT_ERROR);
+        }
+
+        if (aui32FieldSeen[ui8FieldId / 32] & (1UL << (ui8FieldId % 32)))
+        {
+            TRACE2("ESP32BleCfgFields: entry %u rejected (Field 0x%02X repeated)\n", uiEntryIdx, ui8FieldId);
+            return (CFG_STATUS_DUPLICATE_FIELD);
+        }
+        aui32FieldSeen[ui8FieldId / 32] |= (1UL << (ui8FieldId % 32));
+
+        iStatus = CheckField(ui8FieldId, &pabEntries_p[uiOffset], uiValueLen);
+        if ((iStatus == CFG_STATUS_UNKNOWN_FIELD) && fSkipUnknown_p)
+        {
+            iStatus = CFG_STATUS_OK;
+        }
+        if (iStatus != CFG_STATUS_OK)
+        {
+            TRACE2("ESP32BleCfgFields: entry %u rejected (Status=%d)\n", uiEntryIdx, iStatus);
+            return (iStatus);
+        }
+
+        uiOffset += uiValueLen;
+        uiEntryIdx++;
+    }
+    *puiErrEntryIdx_p = uiEntryIdx;
+
+    // ---- Pass 2: apply all entries ----
+    uiOffset  = 0;
+    uiApplied = 0;
+    while (uiOffset < uiEntriesLen_p)
+    {
+        ui8FieldId = pabEntries_p[uiOffset];
+        uiValueLen = pabEntries_p[uiOffset + 1];
+        uiOffset  += CFG_PATCH_ENTRY_HDR_SIZE;
+
+        if (SetField(pAppCfgData_p, ui8FieldId, &pabEntries_p[uiOffset], uiValueLen) > 0)
+        {
+            uiApplied++;
+        }
+
+        uiOffset += uiValueLen;
+    }
+    *puiAppliedEntries_p = uiApplied;
+
+    return (CFG_STATUS_OK);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: BuildPatchRsp()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgFields::BuildPatchRsp (
+        uint8_t* pabRsp_p,
+        uint8_t ui8Status_p,
+        unsigned int uiErrEntryIdx_p,
+        unsigned int uiAppliedEntries_p)
+{
+
+    pabRsp_p[0] = ui8Status_p;
+    pabRsp_p[1] = ((ui8Status_p == CFG_STATUS_OK) || (uiErrEntryIdx_p > CFG_PATCH_NO_ENTRY_IDX)) ? CFG_PATCH_NO_ENTRY_IDX : (uint8_t)uiErrEntryIdx_p;
+    pabRsp_p[2] = (uint8_t)uiAppliedEntries_p;
+
+    return (CFG_PATCH_RSP_SIZE);
+
+}
+
+
+
+
+//  EOF
@@ -0,0 +1,179 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgFields> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGFIELDS_H_
+#define _ESP32BLECFGFIELDS_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Field IDs of the configuration data <tAppCfgData>
+// (the IDs are part of the protocol and must never be changed or reused)
+#define CFG_FIELD_DEVMNT_DEVNAME        0x01    // String   m_szDevMntDevName
+#define CFG_FIELD_WIFI_SSID             0x10    // String   m_szWifiSSID
+#define CFG_FIELD_WIFI_PASSWD           0x11    // String   m_szWifiPasswd
+#define CFG_FIELD_WIFI_OWNADDR          0x12    // String   m_szWifiOwnAddr
+#define CFG_FIELD_WIFI_OWNMODE          0x13    // UInt8    m_ui8WifiOwnMode (WIFI_OPMODE_STA / WIFI_OPMODE_AP)
+#define CFG_FIELD_APP_RT_OPT1           0x20    // Bool     m_fAppRtOpt1
+#define CFG_FIELD_APP_RT_OPT2           0x21    // Bool     m_fAppRtOpt2
+#define CFG_FIELD_APP_RT_OPT3           0x22    // Bool     m_fAppRtOpt3
+#define CFG_FIELD_APP_RT_OPT4           0x23    // Bool     m_fAppRtOpt4
+#define CFG_FIELD_APP_RT_OPT5           0x24    // Bool     m_fAppRtOpt5
+#define CFG_FIELD_APP_RT_OPT6           0x25    // Bool     m_fAppRtOpt6
+#define CFG_FIELD_APP_RT_OPT7           0x26    // Bool     m_fAppRtOpt7
+#define CFG_FIELD_APP_RT_OPT8           0x27    // Bool     m_fAppRtOpt8
+#define CFG_FIELD_APP_RT_PEERADDR       0x28    // String   m_szAppRtPeerAddr
+
+// Field Types
+#define CFG_FIELD_TYPE_STRING           1       // Len = 0..sizeof(field), no terminating zero required
+#define CFG_FIELD_TYPE_UINT8            2       // Len = 1
+#define CFG_FIELD_TYPE_BOOL             3       // Len = 1, Value = 0 / 1
+
+// Value Formats, checked by CheckField() in addition to Type and Length
+#define CFG_FIELD_FMT_ANY               0
+#define CFG_FIELD_FMT_TEXT              1       // no control characters
+#define CFG_FIELD_FMT_WIFI_PASSWD       2       // empty (open network), 8..63 printable ASCII or 64 hex digits
+#define CFG_FIELD_FMT_ENDPOINT          3       // IPv4 address with optional port number "a.b.c.d[:port]"
+#define CFG_FIELD_FMT_OWNMODE           4       // exactly one mode out of the OwnMode Feature List
+
+
+// Config Patch, written by the Client to [DevMnt/ConfigPatch]:
+//   [Flags:8] { [FieldId:8][Len:8][Value:Len] } ...
+//
+// All entries are validated first. Only if all entries are valid, they are
+// applied together, otherwise the configuration remains unchanged. Each
+// Field ID may occur only once per patch.
+#define CFG_PATCH_FLAG_COMMIT           0x01    // save configuration after applying the patch
+
+#define CFG_PATCH_HDR_SIZE              1
+#define CFG_PATCH_ENTRY_HDR_SIZE        2
+
+// Config Patch Response, notified by the Server via [DevMnt/ConfigPatch]:
+//   [Status:8][ErrEntryIdx:8][AppliedEntries:8]
+#define CFG_PATCH_RSP_SIZE              3
+#define CFG_PATCH_NO_ENTRY_IDX          0xFF
+
+// Config Image, read from resp. written to [DevMnt/ConfigImage]:
+//   [Magic:16][Version:8][EntryCount:8] { [FieldId:8][Len:8][Value:Len] } ... [Crc32:32]
+//
+// Self-describing image of the complete configuration, independent of the
+// memory layout of <tAppCfgData> (used for backup and cloning of devices).
+// The CRC32 covers all preceding bytes. Entries with unknown Field IDs (e.g.
+// from an image created by a newer firmware) are skipped, fields missing
+// in the image keep their current value.
+#define CFG_IMAGE_MAGIC                 0x4943  // ASCII 'CI' = [C]onfig [I]mage
+#define CFG_IMAGE_VERSION               1       // valid versions: 1..CFG_IMAGE_VERSION
+
+#define CFG_IMAGE_HDR_SIZE              4
+#define CFG_IMAGE_CRC_SIZE              4
+#define CFG_IMAGE_MAX_SIZE              256     // currently max. 221 Bytes are used
+
+// Status Codes
+#define CFG_STATUS_OK                   0
+#define CFG_STATUS_FORMAT_ERROR         1       // truncated message or entry
+#define CFG_STATUS_UNKNOWN_FIELD        2
+#define CFG_STATUS_LENGTH_ERROR         3
+#define CFG_STATUS_VALUE_ERROR          4
+#define CFG_STATUS_SAVE_ERROR           5       // configuration could not be saved (storage error)
+#define CFG_STATUS_CRC_ERROR            6
+#define CFG_STATUS_VERSION_ERROR        7
+#define CFG_STATUS_DUPLICATE_FIELD      8       // same Field ID in more than one entry
+#define CFG_STATUS_INTERNAL_ERROR       9       // current configuration not available
+
+
+// Description of a configuration field
+typedef struct
+{
+
+    uint8_t         m_ui8FieldId;               // CFG_FIELD_xxx
+    uint8_t         m_ui8Type;                  // CFG_FIELD_TYPE_xxx
+    uint8_t         m_ui8MaxLen;                // max. length of the value         [Bytes]
+    uint8_t         m_ui8MinLen;                // min. length of the value         [Bytes]
+    uint8_t         m_ui8Format;                // CFG_FIELD_FMT_xxx
+
+} tCfgFieldDescr;
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgFields                                       */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgFields
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int   ApplyPatch(const uint8_t* pabPatch_p, unsigned int uiPatchLen_p, tAppCfgData* pAppCfgData_p, uint8_t* pabRsp_p);
+        static  int   EncodeImage(const tAppCfgData* pAppCfgData_p, uint8_t* pabImage_p, unsigned int uiImageBuffSize_p);
+        static  int   DecodeImage(const uint8_t* pabImage_p, unsigned int uiImageLen_p, tAppCfgData* pAppCfgData_p, uint8_t* pabRsp_p);
+
+        static  const tCfgFieldDescr*  GetFieldDescr(uint8_t ui8FieldId_p);
+        static  const tCfgFieldDescr*  GetFieldDescrByIdx(unsigned int uiFieldIdx_p);
+        static  int   GetField(const tAppCfgData* pAppCfgData_p, uint8_t ui8FieldId_p, uint8_t* pabValue_p, unsigned int uiValueBuffSize_p);
+        static  int   SetField(tAppCfgData* pAppCfgData_p, uint8_t ui8FieldId_p, const uint8_t* pabValue_p, unsigned int uiValueLen_p);
+        static  int   CheckField(uint8_t ui8FieldId_p, const uint8_t* pabValue_p, unsigned int uiValueLen_p);
+        static  int   CheckData(const tAppCfgData* pAppCfgData_p, uint8_t* pui8FieldId_p);
+        static  void  SetOwnModeFeatList(uint8_t ui8OwnModeFeatList_p);
+        static  bool  ParseEndpoint(const char* pszNetAddr_p, unsigned int uiMaxLen_p, uint8_t* pabIpAddr_p, uint16_t* pui16PortNum_p);
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  int   ApplyEntries(const uint8_t* pabEntries_p, unsigned int uiEntriesLen_p, bool fSkipUnknown_p, tAppCfgData* pAppCfgData_p, unsigned int* puiErrEntryIdx_p, unsigned int* puiAppliedEntries_p);
+        static  int   BuildPatchRsp(uint8_t* pabRsp_p, uint8_t ui8Status_p, unsigned int uiErrEntryIdx_p, unsigned int uiAppliedEntries_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGFIELDS_H_
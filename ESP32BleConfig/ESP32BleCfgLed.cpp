@@ -0,0 +1,324 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgLed> Implementation
+
+  -------------------------------------------------------------------------
+
+    Status LED Pattern Engine:
+
+    - Each pattern is declared as a list of steps (LED on/off, duration)
+      in LED_PATTERN_LIST. The timing is generated by a one-shot
+      <esp_timer>, which is re-armed with the duration of the next step.
+      So the blink timing is independent of the main loop, and the LED
+      causes no wake-ups between two edges.
+    - Patterns with a repeat count of 0 run endlessly and become the base
+      pattern. Patterns with a repeat count > 0 (e.g. LED_PATTERN_SAVING)
+      are shown on top of the base pattern, after the last repetition
+      the base pattern is continued.
+    - All steps are executed in the context of the esp_timer task.
+      <SetPattern()> only changes the state and triggers the timer, so
+      it can be called from any task (e.g. from BLE callbacks).
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <freertos/FreeRTOS.h>
+#include <esp_timer.h>
+#include "ESP32BleCfgLed.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgLed                                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Local Definitions
+//---------------------------------------------------------------------------
+
+// Single Step of a Pattern
+typedef struct
+{
+
+    bool            m_fLedOn;
+    uint16_t        m_ui16Duration;             // [ms]
+
+} tLedStep;
+
+
+// Pattern
+typedef struct
+{
+
+    const tLedStep* m_paStepList;
+    uint8_t         m_ui8NumSteps;              // 0 -> LED off
+    uint8_t         m_ui8Repeat;                // 0 -> endless (base pattern), >0 -> one-shot
+
+} tLedPattern;
+
+
+#define LED_PATTERN(StepList_p, Repeat_p)       { StepList_p, (sizeof(StepList_p) / sizeof(StepList_p[0])), Repeat_p }
+
+
+static  const tLedStep  LED_STEPS_ADVERTISING[] =
+{
+    { true,   100 },
+    { false, 2150 }
+};
+
+static  const tLedStep  LED_STEPS_CONNECTED[] =
+{
+    { true,   100 },
+    { false,  650 }
+};
+
+static  const tLedStep  LED_STEPS_SAVING[] =
+{
+    { true,    50 },
+    { false,  100 }
+};
+
+static  const tLedStep  LED_STEPS_ERROR[] =
+{
+    { true,   100 },
+    { false,  100 },
+    { true,   100 },
+    { false,  700 }
+};
+
+
+// List of all Patterns, indexed by LED_PATTERN_xxx
+static  const tLedPattern  LED_PATTERN_LIST[LED_PATTERN_NUM] =
+{
+    { NULL, 0, 0 },                                         // LED_PATTERN_OFF
+    LED_PATTERN (LED_STEPS_ADVERTISING, 0),                 // LED_PATTERN_ADVERTISING
+    LED_PATTERN (LED_STEPS_CONNECTED,   0),                 // LED_PATTERN_CONNECTED
+    LED_PATTERN (LED_STEPS_SAVING,      3),                 // LED_PATTERN_SAVING
+    LED_PATTERN (LED_STEPS_ERROR,       0)                  // LED_PATTERN_ERROR
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  esp_timer_handle_t  hLedTimer_g                     = NULL;
+static  portMUX_TYPE        LedLock_g                       = portMUX_INITIALIZER_UNLOCKED;
+static  int                 iLedPin_g                       = -1;
+
+static  uint8_t             ui8LedBasePattern_g             = LED_PATTERN_OFF;
+static  uint8_t             ui8LedActivePattern_g           = LED_PATTERN_OFF;
+static  uint8_t             ui8LedStepIdx_g                 = 0;
+static  uint8_t             ui8LedRepeatCnt_g               = 0;
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: Setup()
+//---------------------------------------------------------------------------
+//  Return:     1 -> Success
+//              0 -> Already set up (for the same pin)
+//             -1 -> Error (invalid pin or already set up for another pin)
+//             -2 -> Error (timer could not be created)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgLed::Setup (
+        int iLedPin_p)
+{
+
+esp_timer_create_args_t  TimerArgs;
+esp_err_t                EspRes;
+
+    if (iLedPin_p < 0)
+    {
+        return (-1);
+    }
+    if (hLedTimer_g != NULL)
+    {
+        return ((iLedPin_p == iLedPin_g) ? 0 : -1);
+    }
+
+    pinMode(iLedPin_p, OUTPUT);
+    digitalWrite(iLedPin_p, LOW);
+    iLedPin_g = iLedPin_p;
+
+    memset(&TimerArgs, 0, sizeof(TimerArgs));
+    TimerArgs.callback        = TimerCallback;
+    TimerArgs.arg             = NULL;
+    TimerArgs.dispatch_method = ESP_TIMER_TASK;
+    TimerArgs.name            = "StatusLed";
+    EspRes = esp_timer_create(&TimerArgs, &hLedTimer_g);
+    if (EspRes != ESP_OK)
+    {
+        TRACE1("ERROR: esp_timer_create() failed (EspRes=%d)\n", EspRes);
+        hLedTimer_g = NULL;
+        return (-2);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: SetPattern()
+//---------------------------------------------------------------------------
+//  Starts the given pattern with its first step. An endless pattern
+//  replaces the base pattern, a one-shot pattern interrupts it.
+//
+//  Return:     1 -> Success
+//             -1 -> Error (invalid pattern)
+//             -2 -> Error (not set up)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgLed::SetPattern (
+        uint8_t ui8Pattern_p)
+{
+
+    if (ui8Pattern_p >= LED_PATTERN_NUM)
+    {
+        return (-1);
+    }
+    if (hLedTimer_g == NULL)
+    {
+        return (-2);
+    }
+
+    portENTER_CRITICAL(&LedLock_g);
+    if (LED_PATTERN_LIST[ui8Pattern_p].m_ui8Repeat == 0)
+    {
+        ui8LedBasePattern_g = ui8Pattern_p;
+    }
+    ui8LedActivePattern_g = ui8Pattern_p;
+    ui8LedStepIdx_g       = 0;
+    ui8LedRepeatCnt_g     = 0;
+    portEXIT_CRITICAL(&LedLock_g);
+
+    // execute first step in the timer task (if the callback is just running,
+    // it already uses the new state and re-arms the timer itself)
+    esp_timer_stop(hLedTimer_g);
+    esp_timer_start_once(hLedTimer_g, 0);
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetPattern()
+//---------------------------------------------------------------------------
+
+uint8_t  ESP32BleCfgLed::GetPattern ()
+{
+
+    return ( ui8LedActivePattern_g );
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: TimerCallback()
+//---------------------------------------------------------------------------
+//  Executes the current step of the active pattern and re-arms the timer
+//  with its duration. At the end of a one-shot pattern, the base pattern
+//  is continued.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLed::TimerCallback (
+        void* pvArg_p)
+{
+
+const tLedPattern*  pPattern;
+const tLedStep*     pStep;
+bool                fLedOn;
+uint32_t            ui32Duration;
+
+    fLedOn       = false;
+    ui32Duration = 0;
+
+    portENTER_CRITICAL(&LedLock_g);
+    pPattern = &LED_PATTERN_LIST[ui8LedActivePattern_g];
+    if (ui8LedStepIdx_g >= pPattern->m_ui8NumSteps)
+    {
+        ui8LedStepIdx_g = 0;
+        if (pPattern->m_ui8Repeat != 0)
+        {
+            ui8LedRepeatCnt_g++;
+            if (ui8LedRepeatCnt_g >= pPattern->m_ui8Repeat)
+            {
+                // one-shot pattern finished -> continue base pattern
+                ui8LedActivePattern_g = ui8LedBasePattern_g;
+                ui8LedRepeatCnt_g     = 0;
+                pPattern = &LED_PATTERN_LIST[ui8LedActivePattern_g];
+            }
+        }
+    }
+    if (pPattern->m_ui8NumSteps > 0)
+    {
+        pStep = &pPattern->m_paStepList[ui8LedStepIdx_g];
+        fLedOn       = pStep->m_fLedOn;
+        ui32Duration = pStep->m_ui16Duration;
+        ui8LedStepIdx_g++;
+    }
+    portEXIT_CRITICAL(&LedLock_g);
+
+    digitalWrite(iLedPin_g, (fLedOn) ? HIGH : LOW);
+
+    if (ui32Duration > 0)
+    {
+        esp_timer_start_once(hLedTimer_g, (uint64_t)ui32Duration * 1000);
+    }
+
+    return;
+
+}
+
+
+
+
+//  EOF
@@ -0,0 +1,92 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgLed> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGLED_H_
+#define _ESP32BLECFGLED_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Status LED Patterns (see LED_PATTERN_LIST in ESP32BleCfgLed.cpp)
+#define LED_PATTERN_OFF                 0
+#define LED_PATTERN_ADVERTISING         1       // BLE Config Mode, no client:   short flash every 2.25s
+#define LED_PATTERN_CONNECTED           2       // BLE Config Mode, client:      short flash every 0.75s
+#define LED_PATTERN_SAVING              3       // configuration saved:          3 fast flashes (one-shot)
+#define LED_PATTERN_ERROR               4       // error:                        double flash every 1s
+
+#define LED_PATTERN_NUM                 5
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgLed                                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgLed
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int      Setup(int iLedPin_p);
+        static  int      SetPattern(uint8_t ui8Pattern_p);
+        static  uint8_t  GetPattern();
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  void  TimerCallback(void* pvArg_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGLED_H_
@@ -0,0 +1,307 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgLog> Implementation
+
+  -------------------------------------------------------------------------
+
+    Log Ring Buffer for Remote Log Streaming:
+
+    - <Setup()> registers this class as sink of <trace()>, so each TRACE
+      message is stored as one record in a bounded ring buffer, in
+      addition to the output on the serial interface. The buffer has a
+      fixed size and is independent of Serial, so a slow or missing
+      client never blocks the caller of <trace()>.
+    - Each record is stored as [Length][Text]. If the buffer is full,
+      the oldest records are discarded to make room for the new one.
+      The number of discarded records is counted and sent with every
+      packet, so the client can see that the log has gaps.
+    - <GetPacket()> packs as much text as fits into one packet, records
+      are continued in the next packet if necessary. It is used by
+      ESP32BleCfgProfile to fill the notifications of [DevMnt/Log].
+    - All accesses are protected by a spinlock, so <trace()> can be
+      called from any task (e.g. from BLE callbacks).
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <freertos/FreeRTOS.h>
+#include "ESP32BleCfgLog.h"
+
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgLog                                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  portMUX_TYPE    LogLock_g                       = portMUX_INITIALIZER_UNLOCKED;
+static  uint8_t         abLogBuff_g[LOG_BUFF_SIZE];
+static  unsigned int    uiLogHead_g                     = 0;            // next write position
+static  unsigned int    uiLogTail_g                     = 0;            // oldest record
+static  unsigned int    uiLogUsed_g                     = 0;            // used bytes incl. length bytes
+static  unsigned int    uiLogTailSent_g                 = 0;            // bytes of the oldest record already sent
+static  uint32_t        ui32LogDropCnt_g                = 0;
+static  uint8_t         ui8LogSeqNum_g                  = 0;
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: Setup()
+//---------------------------------------------------------------------------
+//  Clears the buffer and registers <Write()> as sink of <trace()>.
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgLog::Setup ()
+{
+
+    Clear();
+    traceSetSink(Write);
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Write()
+//---------------------------------------------------------------------------
+//  Stores one record, discards the oldest records if there is no room.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLog::Write (
+        const char* pszMsg_p,
+        unsigned int uiMsgLen_p)
+{
+
+unsigned int  uiRecLen;
+unsigned int  uiPartLen;
+
+    if ((pszMsg_p == NULL) || (uiMsgLen_p == 0))
+    {
+        return;
+    }
+
+    if (uiMsgLen_p > LOG_RECORD_MAX_LEN)
+    {
+        uiMsgLen_p = LOG_RECORD_MAX_LEN;
+    }
+
+    portENTER_CRITICAL(&LogLock_g);
+
+    // discard oldest records until the new one fits
+    while ((LOG_BUFF_SIZE - uiLogUsed_g) < (1 + uiMsgLen_p))
+    {
+        uiRecLen = abLogBuff_g[uiLogTail_g];
+        uiLogTail_g      = (uiLogTail_g + 1 + uiRecLen) % LOG_BUFF_SIZE;
+        uiLogUsed_g     -= 1 + uiRecLen;
+        uiLogTailSent_g  = 0;
+        if (ui32LogDropCnt_g < 0xFFFFFFFF)
+        {
+            ui32LogDropCnt_g++;
+        }
+    }
+
+    abLogBuff_g[uiLogHead_g] = (uint8_t)uiMsgLen_p;
+    uiLogHead_g = (uiLogHead_g + 1) % LOG_BUFF_SIZE;
+
+    uiPartLen = LOG_BUFF_SIZE - uiLogHead_g;
+    if (uiPartLen > uiMsgLen_p)
+    {
+        uiPartLen = uiMsgLen_p;
+    }
+    memcpy(&abLogBuff_g[uiLogHead_g], pszMsg_p, uiPartLen);
+    memcpy(&abLogBuff_g[0], pszMsg_p + uiPartLen, uiMsgLen_p - uiPartLen);
+    uiLogHead_g  = (uiLogHead_g + uiMsgLen_p) % LOG_BUFF_SIZE;
+    uiLogUsed_g += 1 + uiMsgLen_p;
+
+    portEXIT_CRITICAL(&LogLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetPacket()
+//---------------------------------------------------------------------------
+//  Builds the next Log Packet (see LOG_PACKET_HEADER_SIZE) and removes the
+//  packed text from the buffer.
+//
+//  Return:    >0 -> Size of the packet
+//              0 -> Buffer empty, nothing to send
+//             -1 -> Error (buffer too small)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgLog::GetPacket (
+        uint8_t* pabBuff_p,
+        unsigned int uiBuffSize_p)
+{
+
+unsigned int  uiPos;
+unsigned int  uiRecLen;
+unsigned int  uiLen;
+uint32_t      ui32DropCnt;
+
+    if ((pabBuff_p == NULL) || (uiBuffSize_p <= LOG_PACKET_HEADER_SIZE))
+    {
+        return (-1);
+    }
+
+    portENTER_CRITICAL(&LogLock_g);
+
+    if (uiLogUsed_g == 0)
+    {
+        portEXIT_CRITICAL(&LogLock_g);
+        return (0);
+    }
+
+    uiPos = LOG_PACKET_HEADER_SIZE;
+    while ((uiLogUsed_g > 0) && (uiPos < uiBuffSize_p))
+    {
+        uiRecLen = abLogBuff_g[uiLogTail_g];
+        uiLen    = uiRecLen - uiLogTailSent_g;
+        if (uiLen > (uiBuffSize_p - uiPos))
+        {
+            uiLen = uiBuffSize_p - uiPos;
+        }
+        CopyFromRing(&pabBuff_p[uiPos], (uiLogTail_g + 1 + uiLogTailSent_g) % LOG_BUFF_SIZE, uiLen);
+        uiPos           += uiLen;
+        uiLogTailSent_g += uiLen;
+
+        if (uiLogTailSent_g >= uiRecLen)
+        {
+            // record completely packed
+            uiLogTail_g     = (uiLogTail_g + 1 + uiRecLen) % LOG_BUFF_SIZE;
+            uiLogUsed_g    -= 1 + uiRecLen;
+            uiLogTailSent_g = 0;
+        }
+    }
+
+    ui32DropCnt = ui32LogDropCnt_g;
+    pabBuff_p[0] = ui8LogSeqNum_g++;
+
+    portEXIT_CRITICAL(&LogLock_g);
+
+    if (ui32DropCnt > 0xFFFF)
+    {
+        ui32DropCnt = 0xFFFF;
+    }
+    pabBuff_p[1] = (uint8_t)(ui32DropCnt);
+    pabBuff_p[2] = (uint8_t)(ui32DropCnt >> 8);
+
+    return ((int)uiPos);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetDropCount()
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgLog::GetDropCount ()
+{
+
+    return ( ui32LogDropCnt_g );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Clear()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLog::Clear ()
+{
+
+    portENTER_CRITICAL(&LogLock_g);
+    uiLogHead_g      = 0;
+    uiLogTail_g      = 0;
+    uiLogUsed_g      = 0;
+    uiLogTailSent_g  = 0;
+    ui32LogDropCnt_g = 0;
+    ui8LogSeqNum_g   = 0;
+    portEXIT_CRITICAL(&LogLock_g);
+
+    return;
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: CopyFromRing()
+//---------------------------------------------------------------------------
+//  Must be called with LogLock_g held.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLog::CopyFromRing (
+        uint8_t* pabDst_p,
+        unsigned int uiRingIdx_p,
+        unsigned int uiLen_p)
+{
+
+unsigned int  uiPartLen;
+
+    uiPartLen = LOG_BUFF_SIZE - uiRingIdx_p;
+    if (uiPartLen > uiLen_p)
+    {
+        uiPartLen = uiLen_p;
+    }
+    memcpy(pabDst_p, &abLogBuff_g[uiRingIdx_p], uiPartLen);
+    memcpy(pabDst_p + uiPartLen, &abLogBuff_g[0], uiLen_p - uiPartLen);
+
+    return;
+
+}
+
+
+
+
+//  EOF
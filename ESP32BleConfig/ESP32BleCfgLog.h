@@ -0,0 +1,94 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgLog> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGLOG_H_
+#define _ESP32BLECFGLOG_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+#define LOG_BUFF_SIZE                   2048    // ring buffer for log records [Bytes]
+#define LOG_RECORD_MAX_LEN              160     // longer records are truncated
+
+// Log Packet (see <GetPacket()>):
+//   [0]     Sequence Number (incremented per packet, detects lost packets)
+//   [1..2]  Number of records dropped by overflow (uint16, saturated)
+//   [3..n]  Text of the buffered records (a record may continue in the next packet)
+#define LOG_PACKET_HEADER_SIZE          3
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgLog                                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgLog
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int       Setup();
+        static  void      Write(const char* pszMsg_p, unsigned int uiMsgLen_p);
+        static  int       GetPacket(uint8_t* pabBuff_p, unsigned int uiBuffSize_p);
+        static  uint32_t  GetDropCount();
+        static  void      Clear();
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  void  CopyFromRing(uint8_t* pabDst_p, unsigned int uiRingIdx_p, unsigned int uiLen_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGLOG_H_
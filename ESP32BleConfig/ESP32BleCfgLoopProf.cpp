@@ -0,0 +1,549 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgLoopProf> Implementation
+
+  -------------------------------------------------------------------------
+
+    Lightweight Profiler for the Arduino Main Loop:
+
+    - Duration of each loop iteration (<LoopBegin()> ... <LoopEnd()>)
+    - Period Jitter: deviation of the time between two <LoopBegin()>
+      from the nominal period (e.g. the delay at the end of the loop)
+    - Idle Share per Core: the FreeRTOS tick hook of each core samples
+      whether its idle task is running. At the end of each window
+      (LOOPPROF_WINDOW), the share of idle ticks is recorded.
+
+    All data are held in fixed-size histograms, so the profiler never
+    allocates memory at runtime. The tick hook is executed in interrupt
+    context on each core and must be located in IRAM. The FreeRTOS
+    functions it uses are IRAM resident too (ESP-IDF 4.x places the
+    whole FreeRTOS kernel into IRAM).
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_freertos_hooks.h>
+#include "ESP32BleCfgLoopProf.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgLoopProf                                     */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  bool            fLoopProfActive_g               = false;
+static  uint32_t        ui32NominalPeriodUs_g           = 0;
+
+// Tick Hook (written by the tick interrupt of each core)
+static  TaskHandle_t    ahIdleTask_g[LOOPPROF_NUM_CORES];
+static  uint32_t        aui32TickCnt_g[LOOPPROF_NUM_CORES];
+static  uint32_t        aui32IdleTickCnt_g[LOOPPROF_NUM_CORES];
+static  portMUX_TYPE    LoopProfLock_g                  = portMUX_INITIALIZER_UNLOCKED;
+
+// current Loop Iteration and Window (Arduino loop task only)
+static  unsigned long   ulLoopBeginTime_g               = 0;
+static  bool            fLoopBeginValid_g               = false;
+static  unsigned long   ulWindowStartTime_g             = 0;
+static  uint32_t        ui32WinNumLoops_g               = 0;
+static  uint64_t        ui64WinDurationSumUs_g          = 0;
+static  uint32_t        ui32WinMaxDurationUs_g          = 0;
+static  uint32_t        ui32WinMaxJitterUs_g            = 0;
+static  tLoopProfWindow LastWindow_g;
+static  bool            fLastWindowValid_g              = false;
+
+// Histograms (since <Setup()> resp. <Reset()>, saturated)
+static  uint16_t        aui16HistDuration_g[LOOPPROF_HIST_BUCKETS];
+static  uint16_t        aui16HistJitter_g[LOOPPROF_HIST_BUCKETS];
+static  uint16_t        aui16HistIdle_g[LOOPPROF_NUM_CORES][LOOPPROF_IDLE_BUCKETS];
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: Setup()
+//---------------------------------------------------------------------------
+//  Return:     1 -> Success
+//              0 -> Already set up
+//             -1 -> Error (registration of the tick hook failed)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgLoopProf::Setup (
+        uint32_t ui32NominalPeriodUs_p)
+{
+
+esp_err_t  EspRes;
+int        iCore;
+
+    if ( fLoopProfActive_g )
+    {
+        return (0);
+    }
+
+    ui32NominalPeriodUs_g = ui32NominalPeriodUs_p;
+    Reset();
+
+    for (iCore=0; iCore<LOOPPROF_NUM_CORES; iCore++)
+    {
+        ahIdleTask_g[iCore] = xTaskGetIdleTaskHandleForCPU(iCore);
+        EspRes = esp_register_freertos_tick_hook_for_cpu(TickHook, iCore);
+        if (EspRes != ESP_OK)
+        {
+            TRACE2("ERROR: esp_register_freertos_tick_hook_for_cpu() failed (Core=%d, EspRes=%d)\n", iCore, EspRes);
+            while (--iCore >= 0)
+            {
+                esp_deregister_freertos_tick_hook_for_cpu(TickHook, iCore);
+            }
+            return (-1);
+        }
+    }
+
+    fLoopProfActive_g = true;
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: LoopBegin()
+//---------------------------------------------------------------------------
+//  To be called at the beginning of each loop iteration.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLoopProf::LoopBegin ()
+{
+
+unsigned long  ulCurrTime;
+uint32_t       ui32PeriodUs;
+uint32_t       ui32JitterUs;
+
+    if ( !fLoopProfActive_g )
+    {
+        return;
+    }
+
+    ulCurrTime = micros();
+
+    if ( fLoopBeginValid_g )
+    {
+        ui32PeriodUs = (uint32_t)(ulCurrTime - ulLoopBeginTime_g);
+        ui32JitterUs = (ui32PeriodUs > ui32NominalPeriodUs_g) ? (ui32PeriodUs - ui32NominalPeriodUs_g) : (ui32NominalPeriodUs_g - ui32PeriodUs);
+        if (aui16HistJitter_g[GetBucketIdx(ui32JitterUs)] < 0xFFFF)
+        {
+            aui16HistJitter_g[GetBucketIdx(ui32JitterUs)]++;
+        }
+        if (ui32JitterUs > ui32WinMaxJitterUs_g)
+        {
+            ui32WinMaxJitterUs_g = ui32JitterUs;
+        }
+    }
+    ulLoopBeginTime_g = ulCurrTime;
+    fLoopBeginValid_g = true;
+
+    if ((uint32_t)(ulCurrTime - ulWindowStartTime_g) >= (LOOPPROF_WINDOW * 1000UL))
+    {
+        CloseWindow(ulCurrTime);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: LoopEnd()
+//---------------------------------------------------------------------------
+//  To be called at the end of each loop iteration (before the delay).
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLoopProf::LoopEnd ()
+{
+
+uint32_t  ui32DurationUs;
+
+    if ( !fLoopProfActive_g || !fLoopBeginValid_g )
+    {
+        return;
+    }
+
+    ui32DurationUs = (uint32_t)(micros() - ulLoopBeginTime_g);
+    if (aui16HistDuration_g[GetBucketIdx(ui32DurationUs)] < 0xFFFF)
+    {
+        aui16HistDuration_g[GetBucketIdx(ui32DurationUs)]++;
+    }
+
+    ui32WinNumLoops_g++;
+    ui64WinDurationSumUs_g += ui32DurationUs;
+    if (ui32DurationUs > ui32WinMaxDurationUs_g)
+    {
+        ui32WinMaxDurationUs_g = ui32DurationUs;
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Reset()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLoopProf::Reset ()
+{
+
+    memset(aui16HistDuration_g, 0x00, sizeof(aui16HistDuration_g));
+    memset(aui16HistJitter_g, 0x00, sizeof(aui16HistJitter_g));
+    memset(aui16HistIdle_g, 0x00, sizeof(aui16HistIdle_g));
+
+    fLoopBeginValid_g      = false;
+    fLastWindowValid_g     = false;
+    ulWindowStartTime_g    = micros();
+    ui32WinNumLoops_g      = 0;
+    ui64WinDurationSumUs_g = 0;
+    ui32WinMaxDurationUs_g = 0;
+    ui32WinMaxJitterUs_g   = 0;
+
+    portENTER_CRITICAL(&LoopProfLock_g);
+    {
+        memset(aui32TickCnt_g, 0x00, sizeof(aui32TickCnt_g));
+        memset(aui32IdleTickCnt_g, 0x00, sizeof(aui32IdleTickCnt_g));
+    }
+    portEXIT_CRITICAL(&LoopProfLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetWindow()
+//---------------------------------------------------------------------------
+//  Return:     true  -> Summary of the last completed window
+//              false -> no window completed so far
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgLoopProf::GetWindow (
+        tLoopProfWindow* pWindow_p)
+{
+
+    if ((pWindow_p == NULL) || !fLastWindowValid_g)
+    {
+        return (false);
+    }
+
+    *pWindow_p = LastWindow_g;
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetRecord()
+//---------------------------------------------------------------------------
+//  Compact telemetry record of the last completed window, fits into the
+//  default ATT MTU (signature of <tCbHdlrTelemetry>).
+//
+//  Binary layout (little endian), see LOOPPROF_RECORD_SIZE:
+//    [0]   LOOPPROF_RECORD_ID
+//    [1]   Number of Cores
+//    uint16 NumLoops (saturated), uint32 AvgDurationUs, uint32 MaxDurationUs,
+//    uint32 MaxJitterUs, uint8 IdlePercent[Number of Cores]
+//
+//  Return:     >0 -> size of record
+//               0 -> no window completed so far
+//              -1 -> Error (invalid parameter, buffer too small)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgLoopProf::GetRecord (
+        uint8_t* pabBuff_p,
+        unsigned int uiBuffSize_p)
+{
+
+uint8_t*      pabData;
+uint16_t      ui16NumLoops;
+uint32_t      aui32Value[3];
+unsigned int  uiIdx;
+
+    if ((pabBuff_p == NULL) || (uiBuffSize_p < LOOPPROF_RECORD_SIZE))
+    {
+        return (-1);
+    }
+    if ( !fLastWindowValid_g )
+    {
+        return (0);
+    }
+
+    ui16NumLoops  = (LastWindow_g.m_ui32NumLoops > 0xFFFF) ? 0xFFFF : (uint16_t)LastWindow_g.m_ui32NumLoops;
+    aui32Value[0] = LastWindow_g.m_ui32AvgDurationUs;
+    aui32Value[1] = LastWindow_g.m_ui32MaxDurationUs;
+    aui32Value[2] = LastWindow_g.m_ui32MaxJitterUs;
+
+    pabData = pabBuff_p;
+    *pabData++ = LOOPPROF_RECORD_ID;
+    *pabData++ = LOOPPROF_NUM_CORES;
+    *pabData++ = (uint8_t)(ui16NumLoops);
+    *pabData++ = (uint8_t)(ui16NumLoops >> 8);
+    for (uiIdx=0; uiIdx<3; uiIdx++)
+    {
+        *pabData++ = (uint8_t)(aui32Value[uiIdx]);
+        *pabData++ = (uint8_t)(aui32Value[uiIdx] >> 8);
+        *pabData++ = (uint8_t)(aui32Value[uiIdx] >> 16);
+        *pabData++ = (uint8_t)(aui32Value[uiIdx] >> 24);
+    }
+    for (uiIdx=0; uiIdx<LOOPPROF_NUM_CORES; uiIdx++)
+    {
+        *pabData++ = LastWindow_g.m_aui8IdlePercent[uiIdx];
+    }
+
+    return ((int)(pabData - pabBuff_p));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: DumpToSerial()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLoopProf::DumpToSerial ()
+{
+
+char          szTextBuff[144];                          // summary line with all values at max.: 113 chars
+unsigned int  uiCore;
+
+    if ( !fLoopProfActive_g )
+    {
+        return;
+    }
+
+    Serial.println("Loop Profile:");
+    if ( fLastWindowValid_g )
+    {
+        snprintf(szTextBuff, sizeof(szTextBuff), "  Last %ums: Loops=%lu, AvgDuration=%lu, MaxDuration=%lu, MaxJitter=%lu [us]",
+                 LOOPPROF_WINDOW, (unsigned long)LastWindow_g.m_ui32NumLoops, (unsigned long)LastWindow_g.m_ui32AvgDurationUs,
+                 (unsigned long)LastWindow_g.m_ui32MaxDurationUs, (unsigned long)LastWindow_g.m_ui32MaxJitterUs);
+        Serial.println(szTextBuff);
+        for (uiCore=0; uiCore<LOOPPROF_NUM_CORES; uiCore++)
+        {
+            snprintf(szTextBuff, sizeof(szTextBuff), "  Last %ums: Idle Core%u=%u%%", LOOPPROF_WINDOW, uiCore, LastWindow_g.m_aui8IdlePercent[uiCore]);
+            Serial.println(szTextBuff);
+        }
+    }
+
+    PrintHist("Duration [us]", aui16HistDuration_g, LOOPPROF_HIST_BUCKETS, false);
+    PrintHist("Jitter [us]", aui16HistJitter_g, LOOPPROF_HIST_BUCKETS, false);
+    for (uiCore=0; uiCore<LOOPPROF_NUM_CORES; uiCore++)
+    {
+        snprintf(szTextBuff, sizeof(szTextBuff), "Idle Core%u [%%]", uiCore);
+        PrintHist(szTextBuff, aui16HistIdle_g[uiCore], LOOPPROF_IDLE_BUCKETS, true);
+    }
+    Serial.flush();
+
+    return;
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: TickHook()
+//---------------------------------------------------------------------------
+//  Called by the tick interrupt of each core (ISR context, IRAM).
+//---------------------------------------------------------------------------
+
+void  IRAM_ATTR  ESP32BleCfgLoopProf::TickHook ()
+{
+
+BaseType_t  iCore;
+
+    iCore = xPortGetCoreID();
+
+    portENTER_CRITICAL_ISR(&LoopProfLock_g);
+    {
+        aui32TickCnt_g[iCore]++;
+        if (xTaskGetCurrentTaskHandle() == ahIdleTask_g[iCore])
+        {
+            aui32IdleTickCnt_g[iCore]++;
+        }
+    }
+    portEXIT_CRITICAL_ISR(&LoopProfLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CloseWindow()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLoopProf::CloseWindow (
+        unsigned long ulCurrTime_p)
+{
+
+uint32_t      aui32TickCnt[LOOPPROF_NUM_CORES];
+uint32_t      aui32IdleTickCnt[LOOPPROF_NUM_CORES];
+unsigned int  uiIdlePercent;
+unsigned int  uiCore;
+
+    portENTER_CRITICAL(&LoopProfLock_g);
+    {
+        memcpy(aui32TickCnt, aui32TickCnt_g, sizeof(aui32TickCnt));
+        memcpy(aui32IdleTickCnt, aui32IdleTickCnt_g, sizeof(aui32IdleTickCnt));
+        memset(aui32TickCnt_g, 0x00, sizeof(aui32TickCnt_g));
+        memset(aui32IdleTickCnt_g, 0x00, sizeof(aui32IdleTickCnt_g));
+    }
+    portEXIT_CRITICAL(&LoopProfLock_g);
+
+    for (uiCore=0; uiCore<LOOPPROF_NUM_CORES; uiCore++)
+    {
+        uiIdlePercent = (aui32TickCnt[uiCore] > 0) ? ((aui32IdleTickCnt[uiCore] * 100) / aui32TickCnt[uiCore]) : 0;
+        LastWindow_g.m_aui8IdlePercent[uiCore] = (uint8_t)uiIdlePercent;
+        if (aui16HistIdle_g[uiCore][uiIdlePercent / 10] < 0xFFFF)
+        {
+            aui16HistIdle_g[uiCore][uiIdlePercent / 10]++;
+        }
+    }
+
+    LastWindow_g.m_ui32NumLoops      = ui32WinNumLoops_g;
+    LastWindow_g.m_ui32AvgDurationUs = (ui32WinNumLoops_g > 0) ? (uint32_t)(ui64WinDurationSumUs_g / ui32WinNumLoops_g) : 0;
+    LastWindow_g.m_ui32MaxDurationUs = ui32WinMaxDurationUs_g;
+    LastWindow_g.m_ui32MaxJitterUs   = ui32WinMaxJitterUs_g;
+    fLastWindowValid_g = true;
+
+    ulWindowStartTime_g    = ulCurrTime_p;
+    ui32WinNumLoops_g      = 0;
+    ui64WinDurationSumUs_g = 0;
+    ui32WinMaxDurationUs_g = 0;
+    ui32WinMaxJitterUs_g   = 0;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetBucketIdx()
+//---------------------------------------------------------------------------
+
+unsigned int  ESP32BleCfgLoopProf::GetBucketIdx (
+        uint32_t ui32ValueUs_p)
+{
+
+unsigned int  uiBucketIdx;
+
+    ui32ValueUs_p >>= LOOPPROF_HIST_BUCKET_SHIFT;
+    uiBucketIdx = 0;
+    while ((ui32ValueUs_p != 0) && (uiBucketIdx < (LOOPPROF_HIST_BUCKETS - 1)))
+    {
+        ui32ValueUs_p >>= 1;
+        uiBucketIdx++;
+    }
+
+    return (uiBucketIdx);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: PrintHist()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgLoopProf::PrintHist (
+        const char* pszName_p,
+        const uint16_t* paui16Bucket_p,
+        unsigned int uiNumBuckets_p,
+        bool fIdleScale_p)
+{
+
+char          szTextBuff[32];
+unsigned int  uiBucketIdx;
+
+    snprintf(szTextBuff, sizeof(szTextBuff), "  %-16s", pszName_p);
+    Serial.print(szTextBuff);
+    for (uiBucketIdx=0; uiBucketIdx<uiNumBuckets_p; uiBucketIdx++)
+    {
+        if (paui16Bucket_p[uiBucketIdx] == 0)
+        {
+            continue;
+        }
+        if ( fIdleScale_p )
+        {
+            snprintf(szTextBuff, sizeof(szTextBuff), " %s%u:%u", (uiBucketIdx < 10) ? "<" : "", (uiBucketIdx < 10) ? ((uiBucketIdx + 1) * 10) : 100, paui16Bucket_p[uiBucketIdx]);
+        }
+        else if (uiBucketIdx < (uiNumBuckets_p - 1))
+        {
+            snprintf(szTextBuff, sizeof(szTextBuff), " <%lu:%u", (unsigned long)(1UL << (uiBucketIdx + LOOPPROF_HIST_BUCKET_SHIFT)), paui16Bucket_p[uiBucketIdx]);
+        }
+        else
+        {
+            // overflow bucket
+            snprintf(szTextBuff, sizeof(szTextBuff), " >=%lu:%u", (unsigned long)(1UL << (uiBucketIdx + LOOPPROF_HIST_BUCKET_SHIFT - 1)), paui16Bucket_p[uiBucketIdx]);
+        }
+        Serial.print(szTextBuff);
+    }
+    Serial.println();
+
+    return;
+
+}
+
+
+
+
+//  EOF
@@ -0,0 +1,123 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgLoopProf> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGLOOPPROF_H_
+#define _ESP32BLECFGLOOPPROF_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Histograms of Loop Duration and Period Jitter (log2 scale):
+//   Bucket[0]  ->  0us ... 63us
+//   Bucket[n]  ->  2^(n+5)us ... 2^(n+6)-1us
+//   Bucket[11] ->  >= 65536us
+#define LOOPPROF_HIST_BUCKETS           12
+#define LOOPPROF_HIST_BUCKET_SHIFT      6
+
+// Histogram of the Idle Share per Core (one value per window, linear scale):
+//   Bucket[n]  ->  n*10% ... n*10+9%
+//   Bucket[10] ->  100%
+#define LOOPPROF_IDLE_BUCKETS           11
+
+#define LOOPPROF_NUM_CORES              2
+#define LOOPPROF_WINDOW                 1000    // [ms] evaluation window for the idle share
+
+// Telemetry Record (see <GetRecord()>)
+#define LOOPPROF_RECORD_ID              0x4C    // ASCII 'L', distinct from the version of the Diagnostics Blob
+#define LOOPPROF_RECORD_SIZE            (2 + 2 + (3 * 4) + LOOPPROF_NUM_CORES)
+
+
+// Summary of the last completed window
+typedef struct
+{
+
+    uint32_t        m_ui32NumLoops;             // loop iterations within the window
+    uint32_t        m_ui32AvgDurationUs;        // avg. duration of an iteration          [us]
+    uint32_t        m_ui32MaxDurationUs;        // max. duration of an iteration          [us]
+    uint32_t        m_ui32MaxJitterUs;          // max. deviation from the nominal period [us]
+    uint8_t         m_aui8IdlePercent[LOOPPROF_NUM_CORES];  // share of the idle task per core [%]
+
+} tLoopProfWindow;
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgLoopProf                                     */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgLoopProf
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int   Setup(uint32_t ui32NominalPeriodUs_p);
+        static  void  LoopBegin();
+        static  void  LoopEnd();
+        static  void  Reset();
+
+        static  bool  GetWindow(tLoopProfWindow* pWindow_p);
+        static  int   GetRecord(uint8_t* pabBuff_p, unsigned int uiBuffSize_p);
+        static  void  DumpToSerial();
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  void          TickHook();
+        static  void          CloseWindow(unsigned long ulCurrTime_p);
+        static  unsigned int  GetBucketIdx(uint32_t ui32ValueUs_p);
+        static  void          PrintHist(const char* pszName_p, const uint16_t* paui16Bucket_p, unsigned int uiNumBuckets_p, bool fIdleScale_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGLOOPPROF_H_
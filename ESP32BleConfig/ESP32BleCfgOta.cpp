@@ -0,0 +1,781 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgOta> Implementation
+
+  -------------------------------------------------------------------------
+
+    Firmware Update via BLE (optional service [OTA]):
+
+    - The Client announces the update by OTA_CMD_START (image size and
+      SHA-256 of the complete image) and then writes the image as a
+      pipelined sequence of packets (Write Without Response) sized to
+      the negotiated MTU.
+    - Flow control is done by credits: the Client may only send data up
+      to the offset <CreditLimit> given by the last ACK/CREDIT response.
+      The credit always covers the two write buffers, so the Client never
+      has to wait as long as the flash writer keeps up.
+    - The BLE callback only copies the packets into one of two buffers
+      (double buffering). A full buffer is passed to the Flash Writer Task,
+      which writes it into the next OTA partition and updates the SHA-256
+      over the image, while the BLE callback already fills the other buffer.
+    - OTA_CMD_FINISH passes the last (partial) buffer to the writer, which
+      then compares the SHA-256, validates the image (esp_ota_end) and
+      selects the new partition for the next boot.
+
+    The BLE callbacks never wait for the writer task. All responses are
+    notified by the writer task, so the notifications are serialized and
+    the BLE task is never blocked by flash operations.
+
+    The update requires a partition scheme with two OTA app partitions
+    (see 'partitions_ota.csv').
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include "ESP32BleCfgOta.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgOta                                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Local Definitions
+//---------------------------------------------------------------------------
+
+#define OTA_JOB_START                   1       // begin update (esp_ota_begin)
+#define OTA_JOB_WRITE                   2       // write buffer to flash
+#define OTA_JOB_FINISH                  3       // verify and activate image
+#define OTA_JOB_ABORT                   4       // discard update
+#define OTA_JOB_RSP                     5       // send response only
+
+#define OTA_JOB_QUEUE_LEN               8
+#define OTA_WRITER_TASK_STACK_SIZE      4096
+#define OTA_WRITER_TASK_PRIORITY        5
+
+
+// Job for the Flash Writer Task
+typedef struct
+{
+
+    uint8_t         m_ui8JobType;               // OTA_JOB_xxx
+    uint8_t         m_ui8BuffIdx;
+    uint16_t        m_ui16BuffLen;
+    uint8_t         m_ui8Rsp;                   // response to send after the job (0 = none)
+    uint8_t         m_ui8Status;
+    uint32_t        m_ui32Generation;           // update the job belongs to
+
+} tOtaJob;
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  const esp_partition_t*  pOtaPart_g                  = NULL;
+static  tOtaCbSendRsp       pfnOtaSendRsp_g                 = NULL;
+
+static  QueueHandle_t       OtaJobQueue_g                   = NULL;
+static  TaskHandle_t        OtaWriterTask_g                 = NULL;
+static  portMUX_TYPE        OtaLock_g                       = portMUX_INITIALIZER_UNLOCKED;
+
+static  tOtaStatus          OtaStatus_g                     = { 0 };    // protected by OtaLock_g
+static  uint32_t            ui32OtaGeneration_g             = 0;        // protected by OtaLock_g
+static  uint16_t            ui16OtaMaxPacketSize_g          = 0;
+static  uint8_t             abOtaExpectedSha256_g[OTA_SHA256_SIZE];
+
+// BLE Task: buffer currently filled
+static  uint8_t             aabOtaWriteBuff_g[2][OTA_WRITE_BUFF_SIZE];
+static  unsigned int        uiOtaFillIdx_g                  = 0;
+static  unsigned int        uiOtaFillLen_g                  = 0;
+
+// Writer Task: flash and hash state
+static  esp_ota_handle_t    OtaHandle_g                     = 0;
+static  bool                fOtaHandleOpen_g                = false;
+static  mbedtls_sha256_context  OtaSha256Ctx_g;
+static  unsigned long       ulOtaStartTick_g                = 0;
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: Setup()
+//---------------------------------------------------------------------------
+//  Return:      1 -> OTA partition found, writer task started
+//              -1 -> Error (no OTA partition available)
+//              -2 -> Error (creation of queue or task failed)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgOta::Setup (
+        tOtaCbSendRsp pfnSendRsp_p)
+{
+
+BaseType_t  Res;
+
+    pfnOtaSendRsp_g = pfnSendRsp_p;
+
+    pOtaPart_g = esp_ota_get_next_update_partition(NULL);
+    if (pOtaPart_g == NULL)
+    {
+        TRACE0("ESP32BleCfgOta: no OTA partition available\n");
+        return (-1);
+    }
+
+    TRACE2("ESP32BleCfgOta: update partition '%s', size=%lu\n", pOtaPart_g->label, (unsigned long)pOtaPart_g->size);
+
+    if (OtaJobQueue_g == NULL)
+    {
+        OtaJobQueue_g = xQueueCreate(OTA_JOB_QUEUE_LEN, sizeof(tOtaJob));
+        if (OtaJobQueue_g == NULL)
+        {
+            return (-2);
+        }
+    }
+
+    if (OtaWriterTask_g == NULL)
+    {
+        Res = xTaskCreatePinnedToCore(WriterTask, "BleCfgOta", OTA_WRITER_TASK_STACK_SIZE, NULL,
+                                      OTA_WRITER_TASK_PRIORITY, &OtaWriterTask_g, tskNO_AFFINITY);
+        if (Res != pdPASS)
+        {
+            OtaWriterTask_g = NULL;
+            return (-2);
+        }
+    }
+
+    memset(&OtaStatus_g, 0x00, sizeof(OtaStatus_g));
+    OtaStatus_g.m_ui8State = OTA_STATE_IDLE;
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ProcessCtrl()
+//---------------------------------------------------------------------------
+//  Processes a command written to [OTA/Control] (BLE Task context).
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgOta::ProcessCtrl (
+        const uint8_t* pabData_p,
+        unsigned int uiDataLen_p,
+        unsigned int uiMaxPacketSize_p)
+{
+
+uint32_t  ui32ImageSize;
+uint8_t   ui8State;
+uint32_t  ui32RecvOffset;
+
+    if ((pabData_p == NULL) || (uiDataLen_p < 1) || (pOtaPart_g == NULL))
+    {
+        QueueJob(OTA_JOB_RSP, 0, 0, OTA_RSP_ERROR, OTA_STATUS_PARAM_ERROR);
+        return (-1);
+    }
+
+    switch (pabData_p[0])
+    {
+        // ---- start new update (a running update is discarded) ----
+        case OTA_CMD_START:
+        {
+            if (uiDataLen_p < OTA_CMD_START_SIZE)
+            {
+                QueueJob(OTA_JOB_RSP, 0, 0, OTA_RSP_ERROR, OTA_STATUS_PARAM_ERROR);
+                return (-1);
+            }
+
+            ui32ImageSize = (uint32_t)pabData_p[2] | ((uint32_t)pabData_p[3] << 8) | ((uint32_t)pabData_p[4] << 16) | ((uint32_t)pabData_p[5] << 24);
+            if ((ui32ImageSize == 0) || (ui32ImageSize > pOtaPart_g->size))
+            {
+                QueueJob(OTA_JOB_RSP, 0, 0, OTA_RSP_ERROR, OTA_STATUS_SIZE_ERROR);
+                return (-1);
+            }
+
+            memcpy(abOtaExpectedSha256_g, &pabData_p[6], OTA_SHA256_SIZE);
+            ui16OtaMaxPacketSize_g = (uint16_t)uiMaxPacketSize_p;
+            uiOtaFillIdx_g = 0;
+            uiOtaFillLen_g = 0;
+
+            // no credit until the writer task has started the update
+            portENTER_CRITICAL(&OtaLock_g);
+            {
+                ui32OtaGeneration_g++;
+                OtaStatus_g.m_ui8State          = OTA_STATE_ACTIVE;
+                OtaStatus_g.m_ui8Status         = OTA_STATUS_OK;
+                OtaStatus_g.m_ui32ImageSize     = ui32ImageSize;
+                OtaStatus_g.m_ui32RecvOffset    = 0;
+                OtaStatus_g.m_ui32WrittenOffset = 0;
+                OtaStatus_g.m_ui32CreditLimit   = 0;
+                OtaStatus_g.m_ui32Throughput    = 0;
+                OtaStatus_g.m_ui32MaxWriteTime  = 0;
+            }
+            portEXIT_CRITICAL(&OtaLock_g);
+
+            TRACE2("ESP32BleCfgOta: start, ImageSize=%lu, MaxPacketSize=%u\n", (unsigned long)ui32ImageSize, ui16OtaMaxPacketSize_g);
+            QueueJob(OTA_JOB_START, 0, 0, OTA_RSP_ACK, OTA_STATUS_OK);
+            break;
+        }
+
+        // ---- flush last buffer, verify and activate image ----
+        case OTA_CMD_FINISH:
+        {
+            portENTER_CRITICAL(&OtaLock_g);
+            {
+                ui8State       = OtaStatus_g.m_ui8State;
+                ui32RecvOffset = OtaStatus_g.m_ui32RecvOffset;
+                ui32ImageSize  = OtaStatus_g.m_ui32ImageSize;
+            }
+            portEXIT_CRITICAL(&OtaLock_g);
+
+            if ((ui8State != OTA_STATE_ACTIVE) || (ui32RecvOffset != ui32ImageSize))
+            {
+                QueueJob(OTA_JOB_RSP, 0, 0, OTA_RSP_ERROR, OTA_STATUS_STATE_ERROR);
+                return (-1);
+            }
+
+            if (uiOtaFillLen_g > 0)
+            {
+                QueueJob(OTA_JOB_WRITE, uiOtaFillIdx_g, uiOtaFillLen_g, 0, 0);
+                uiOtaFillIdx_g ^= 1;
+                uiOtaFillLen_g  = 0;
+            }
+            QueueJob(OTA_JOB_FINISH, 0, 0, OTA_RSP_DONE, OTA_STATUS_OK);
+            break;
+        }
+
+        // ---- discard update ----
+        case OTA_CMD_ABORT:
+        {
+            portENTER_CRITICAL(&OtaLock_g);
+            {
+                ui32OtaGeneration_g++;
+                OtaStatus_g.m_ui8State = OTA_STATE_IDLE;
+            }
+            portEXIT_CRITICAL(&OtaLock_g);
+
+            QueueJob(OTA_JOB_ABORT, 0, 0, OTA_RSP_ACK, OTA_STATUS_OK);
+            break;
+        }
+
+        default:
+        {
+            QueueJob(OTA_JOB_RSP, 0, 0, OTA_RSP_ERROR, OTA_STATUS_PARAM_ERROR);
+            return (-1);
+        }
+    }
+
+    return (0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ProcessData()
+//---------------------------------------------------------------------------
+//  Processes an image packet written to [OTA/Data] (BLE Task context).
+//  The packet is only copied into the current write buffer, a full buffer
+//  is passed to the writer task.
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgOta::ProcessData (
+        const uint8_t* pabData_p,
+        unsigned int uiDataLen_p)
+{
+
+uint8_t       ui8State;
+uint32_t      ui32RecvOffset;
+uint32_t      ui32ImageSize;
+uint32_t      ui32CreditLimit;
+unsigned int  uiCopyLen;
+
+    portENTER_CRITICAL(&OtaLock_g);
+    {
+        ui8State        = OtaStatus_g.m_ui8State;
+        ui32RecvOffset  = OtaStatus_g.m_ui32RecvOffset;
+        ui32ImageSize   = OtaStatus_g.m_ui32ImageSize;
+        ui32CreditLimit = OtaStatus_g.m_ui32CreditLimit;
+    }
+    portEXIT_CRITICAL(&OtaLock_g);
+
+    // packets of a failed or aborted update are ignored silently
+    if (ui8State != OTA_STATE_ACTIVE)
+    {
+        return (-1);
+    }
+
+    if ((pabData_p == NULL) || (uiDataLen_p == 0) || (uiDataLen_p > ui16OtaMaxPacketSize_g))
+    {
+        FailUpdate(OTA_STATUS_PARAM_ERROR);
+        return (-1);
+    }
+    if ((ui32RecvOffset + uiDataLen_p) > ui32ImageSize)
+    {
+        FailUpdate(OTA_STATUS_SIZE_ERROR);
+        return (-1);
+    }
+    if ((ui32RecvOffset + uiDataLen_p) > ui32CreditLimit)
+    {
+        FailUpdate(OTA_STATUS_CREDIT_ERROR);
+        return (-1);
+    }
+
+    portENTER_CRITICAL(&OtaLock_g);
+    {
+        OtaStatus_g.m_ui32RecvOffset += uiDataLen_p;
+    }
+    portEXIT_CRITICAL(&OtaLock_g);
+
+    // copy packet into write buffer(s), pass each full buffer to the writer
+    while (uiDataLen_p > 0)
+    {
+        uiCopyLen = OTA_WRITE_BUFF_SIZE - uiOtaFillLen_g;
+        if (uiCopyLen > uiDataLen_p)
+        {
+            uiCopyLen = uiDataLen_p;
+        }
+
+        memcpy(&aabOtaWriteBuff_g[uiOtaFillIdx_g][uiOtaFillLen_g], pabData_p, uiCopyLen);
+        uiOtaFillLen_g += uiCopyLen;
+        pabData_p      += uiCopyLen;
+        uiDataLen_p    -= uiCopyLen;
+
+        if (uiOtaFillLen_g == OTA_WRITE_BUFF_SIZE)
+        {
+            if ( !QueueJob(OTA_JOB_WRITE, uiOtaFillIdx_g, uiOtaFillLen_g, 0, 0) )
+            {
+                FailUpdate(OTA_STATUS_FLASH_ERROR);
+                return (-1);
+            }
+            uiOtaFillIdx_g ^= 1;
+            uiOtaFillLen_g  = 0;
+        }
+    }
+
+    return (0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetStatus()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgOta::GetStatus (
+        tOtaStatus* pOtaStatus_p)
+{
+
+    if (pOtaStatus_p == NULL)
+    {
+        return (false);
+    }
+
+    portENTER_CRITICAL(&OtaLock_g);
+    {
+        memcpy(pOtaStatus_p, &OtaStatus_g, sizeof(tOtaStatus));
+    }
+    portEXIT_CRITICAL(&OtaLock_g);
+
+    return (true);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: WriterTask()
+//---------------------------------------------------------------------------
+//  Flash Writer Task: executes all flash operations of the update and
+//  sends all responses to the Client. Jobs of an update which was already
+//  restarted or discarded (stale generation) only release resources and
+//  send no response.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgOta::WriterTask (
+        void* pvParam_p)
+{
+
+tOtaJob        OtaJob;
+uint8_t        abSha256[OTA_SHA256_SIZE];
+uint32_t       ui32Generation;
+uint32_t       ui32ImageSize;
+uint32_t       ui32WrittenOffset;
+unsigned long  ulStartTime;
+unsigned long  ulElapsedTime;
+esp_err_t      EspRes;
+uint8_t        ui8Rsp;
+uint8_t        ui8Status;
+bool           fStale;
+
+    for (;;)
+    {
+        if (xQueueReceive(OtaJobQueue_g, &OtaJob, portMAX_DELAY) != pdTRUE)
+        {
+            continue;
+        }
+
+        portENTER_CRITICAL(&OtaLock_g);
+        {
+            ui32Generation = ui32OtaGeneration_g;
+            ui32ImageSize  = OtaStatus_g.m_ui32ImageSize;
+        }
+        portEXIT_CRITICAL(&OtaLock_g);
+
+        fStale    = (OtaJob.m_ui32Generation != ui32Generation);
+        ui8Rsp    = OtaJob.m_ui8Rsp;
+        ui8Status = OtaJob.m_ui8Status;
+
+        switch (OtaJob.m_ui8JobType)
+        {
+            // ---- begin update ----
+            case OTA_JOB_START:
+            {
+                if ( fOtaHandleOpen_g )
+                {
+                    esp_ota_abort(OtaHandle_g);
+                    mbedtls_sha256_free(&OtaSha256Ctx_g);
+                    fOtaHandleOpen_g = false;
+                }
+                if ( fStale )
+                {
+                    break;
+                }
+
+                // sequential writes -> flash is erased step by step instead of erasing the whole partition now
+                EspRes = esp_ota_begin(pOtaPart_g, OTA_WITH_SEQUENTIAL_WRITES, &OtaHandle_g);
+                if (EspRes != ESP_OK)
+                {
+                    TRACE1("ESP32BleCfgOta: esp_ota_begin failed (0x%X)\n", EspRes);
+                    ui8Rsp    = OTA_RSP_ERROR;
+                    ui8Status = OTA_STATUS_FLASH_ERROR;
+                    break;
+                }
+                fOtaHandleOpen_g = true;
+
+                mbedtls_sha256_init(&OtaSha256Ctx_g);
+                mbedtls_sha256_starts(&OtaSha256Ctx_g, 0);
+                ulOtaStartTick_g = millis();
+
+                // initial credit: both write buffers
+                portENTER_CRITICAL(&OtaLock_g);
+                {
+                    OtaStatus_g.m_ui32CreditLimit = (ui32ImageSize < (2 * OTA_WRITE_BUFF_SIZE)) ? ui32ImageSize : (2 * OTA_WRITE_BUFF_SIZE);
+                }
+                portEXIT_CRITICAL(&OtaLock_g);
+                break;
+            }
+
+            // ---- write buffer to flash ----
+            case OTA_JOB_WRITE:
+            {
+                if (fStale || !fOtaHandleOpen_g)
+                {
+                    ui8Rsp = 0;
+                    break;
+                }
+
+                ulStartTime = micros();
+                EspRes = esp_ota_write(OtaHandle_g, aabOtaWriteBuff_g[OtaJob.m_ui8BuffIdx], OtaJob.m_ui16BuffLen);
+                if (EspRes != ESP_OK)
+                {
+                    TRACE1("ESP32BleCfgOta: esp_ota_write failed (0x%X)\n", EspRes);
+                    esp_ota_abort(OtaHandle_g);
+                    mbedtls_sha256_free(&OtaSha256Ctx_g);
+                    fOtaHandleOpen_g = false;
+                    ui8Rsp    = OTA_RSP_ERROR;
+                    ui8Status = (EspRes == ESP_ERR_OTA_VALIDATE_FAILED) ? OTA_STATUS_IMAGE_ERROR : OTA_STATUS_FLASH_ERROR;
+                    break;
+                }
+                mbedtls_sha256_update(&OtaSha256Ctx_g, aabOtaWriteBuff_g[OtaJob.m_ui8BuffIdx], OtaJob.m_ui16BuffLen);
+                ulElapsedTime = micros() - ulStartTime;
+
+                // buffer is free again -> grant credit for it
+                portENTER_CRITICAL(&OtaLock_g);
+                {
+                    OtaStatus_g.m_ui32WrittenOffset += OtaJob.m_ui16BuffLen;
+                    ui32WrittenOffset = OtaStatus_g.m_ui32WrittenOffset;
+                    OtaStatus_g.m_ui32CreditLimit = ((ui32ImageSize - ui32WrittenOffset) < (2 * OTA_WRITE_BUFF_SIZE)) ? ui32ImageSize : (ui32WrittenOffset + (2 * OTA_WRITE_BUFF_SIZE));
+                    if (ulElapsedTime > OtaStatus_g.m_ui32MaxWriteTime)
+                    {
+                        OtaStatus_g.m_ui32MaxWriteTime = ulElapsedTime;
+                    }
+                }
+                portEXIT_CRITICAL(&OtaLock_g);
+
+                // no further credit required after the last buffer
+                ui8Rsp = 0;
+                if (ui32WrittenOffset < ui32ImageSize)
+                {
+                    ui8Rsp    = OTA_RSP_CREDIT;
+                    ui8Status = OTA_STATUS_OK;
+                }
+                break;
+            }
+
+            // ---- verify and activate image ----
+            case OTA_JOB_FINISH:
+            {
+                if ( fStale )
+                {
+                    break;
+                }
+                if ( !fOtaHandleOpen_g )
+                {
+                    ui8Rsp    = OTA_RSP_ERROR;
+                    ui8Status = OTA_STATUS_STATE_ERROR;
+                    break;
+                }
+
+                mbedtls_sha256_finish(&OtaSha256Ctx_g, abSha256);
+                mbedtls_sha256_free(&OtaSha256Ctx_g);
+                fOtaHandleOpen_g = false;
+                if (memcmp(abSha256, abOtaExpectedSha256_g, OTA_SHA256_SIZE) != 0)
+                {
+                    TRACE0("ESP32BleCfgOta: SHA-256 mismatch\n");
+                    esp_ota_abort(OtaHandle_g);
+                    ui8Rsp    = OTA_RSP_ERROR;
+                    ui8Status = OTA_STATUS_HASH_ERROR;
+                }
+                else
+                {
+                    // esp_ota_end() validates the image and releases the handle in any case
+                    EspRes = esp_ota_end(OtaHandle_g);
+                    if (EspRes != ESP_OK)
+                    {
+                        TRACE1("ESP32BleCfgOta: esp_ota_end failed (0x%X)\n", EspRes);
+                        ui8Rsp    = OTA_RSP_ERROR;
+                        ui8Status = OTA_STATUS_IMAGE_ERROR;
+                    }
+                    else if (esp_ota_set_boot_partition(pOtaPart_g) != ESP_OK)
+                    {
+                        ui8Rsp    = OTA_RSP_ERROR;
+                        ui8Status = OTA_STATUS_FLASH_ERROR;
+                    }
+                }
+
+                ulElapsedTime = millis() - ulOtaStartTick_g;
+                if (ulElapsedTime == 0)
+                {
+                    ulElapsedTime = 1;
+                }
+                portENTER_CRITICAL(&OtaLock_g);
+                {
+                    OtaStatus_g.m_ui32Throughput = (uint32_t)(((uint64_t)OtaStatus_g.m_ui32WrittenOffset * 1000) / ulElapsedTime);
+                }
+                portEXIT_CRITICAL(&OtaLock_g);
+
+                TRACE2("ESP32BleCfgOta: finished, Status=%u, Throughput=%lu Bytes/s\n", ui8Status, (unsigned long)OtaStatus_g.m_ui32Throughput);
+                break;
+            }
+
+            // ---- discard update ----
+            case OTA_JOB_ABORT:
+            {
+                if ( fOtaHandleOpen_g )
+                {
+                    esp_ota_abort(OtaHandle_g);
+                    mbedtls_sha256_free(&OtaSha256Ctx_g);
+                    fOtaHandleOpen_g = false;
+                }
+                break;
+            }
+
+            // ---- response only (command rejected) ----
+            default:
+            {
+                fStale = false;
+                break;
+            }
+        }
+
+        if ((ui8Rsp == 0) || fStale)
+        {
+            continue;
+        }
+
+        // update state of current update according to the result of the job
+        if (OtaJob.m_ui8JobType != OTA_JOB_RSP)
+        {
+            portENTER_CRITICAL(&OtaLock_g);
+            {
+                if (ui8Rsp == OTA_RSP_ERROR)
+                {
+                    OtaStatus_g.m_ui8State  = OTA_STATE_ERROR;
+                    OtaStatus_g.m_ui8Status = ui8Status;
+                }
+                else if (ui8Rsp == OTA_RSP_DONE)
+                {
+                    OtaStatus_g.m_ui8State  = OTA_STATE_DONE;
+                }
+            }
+            portEXIT_CRITICAL(&OtaLock_g);
+        }
+
+        SendRsp(ui8Rsp, ui8Status);
+    }
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: QueueJob()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgOta::QueueJob (
+        uint8_t ui8JobType_p,
+        unsigned int uiBuffIdx_p,
+        unsigned int uiBuffLen_p,
+        uint8_t ui8Rsp_p,
+        uint8_t ui8Status_p)
+{
+
+tOtaJob  OtaJob;
+
+    if (OtaJobQueue_g == NULL)
+    {
+        return (false);
+    }
+
+    OtaJob.m_ui8JobType  = ui8JobType_p;
+    OtaJob.m_ui8BuffIdx  = (uint8_t)uiBuffIdx_p;
+    OtaJob.m_ui16BuffLen = (uint16_t)uiBuffLen_p;
+    OtaJob.m_ui8Rsp      = ui8Rsp_p;
+    OtaJob.m_ui8Status   = ui8Status_p;
+
+    portENTER_CRITICAL(&OtaLock_g);
+    {
+        OtaJob.m_ui32Generation = ui32OtaGeneration_g;
+    }
+    portEXIT_CRITICAL(&OtaLock_g);
+
+    // never block the BLE Task; the credits guarantee a free queue entry for write jobs
+    return ((xQueueSend(OtaJobQueue_g, &OtaJob, 0) == pdTRUE) ? true : false);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: FailUpdate()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgOta::FailUpdate (
+        uint8_t ui8Status_p)
+{
+
+    TRACE1("ESP32BleCfgOta: update failed, Status=%u\n", ui8Status_p);
+
+    portENTER_CRITICAL(&OtaLock_g);
+    {
+        ui32OtaGeneration_g++;
+        OtaStatus_g.m_ui8State  = OTA_STATE_ERROR;
+        OtaStatus_g.m_ui8Status = ui8Status_p;
+    }
+    portEXIT_CRITICAL(&OtaLock_g);
+
+    uiOtaFillLen_g = 0;
+    QueueJob(OTA_JOB_ABORT, 0, 0, OTA_RSP_ERROR, ui8Status_p);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: SendRsp()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgOta::SendRsp (
+        uint8_t ui8Rsp_p,
+        uint8_t ui8Status_p)
+{
+
+uint8_t   abRsp[OTA_RSP_SIZE];
+uint32_t  ui32CreditLimit;
+uint32_t  ui32WrittenOffset;
+
+    if (pfnOtaSendRsp_g == NULL)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&OtaLock_g);
+    {
+        ui32CreditLimit   = OtaStatus_g.m_ui32CreditLimit;
+        ui32WrittenOffset = OtaStatus_g.m_ui32WrittenOffset;
+    }
+    portEXIT_CRITICAL(&OtaLock_g);
+
+    abRsp[0]  = ui8Rsp_p;
+    abRsp[1]  = ui8Status_p;
+    abRsp[2]  = (uint8_t)(ui16OtaMaxPacketSize_g);
+    abRsp[3]  = (uint8_t)(ui16OtaMaxPacketSize_g >> 8);
+    abRsp[4]  = (uint8_t)(ui32CreditLimit);
+    abRsp[5]  = (uint8_t)(ui32CreditLimit >> 8);
+    abRsp[6]  = (uint8_t)(ui32CreditLimit >> 16);
+    abRsp[7]  = (uint8_t)(ui32CreditLimit >> 24);
+    abRsp[8]  = (uint8_t)(ui32WrittenOffset);
+    abRsp[9]  = (uint8_t)(ui32WrittenOffset >> 8);
+    abRsp[10] = (uint8_t)(ui32WrittenOffset >> 16);
+    abRsp[11] = (uint8_t)(ui32WrittenOffset >> 24);
+
+    pfnOtaSendRsp_g(abRsp, sizeof(abRsp));
+
+    return;
+
+}
+
+
+
+
+//  EOF
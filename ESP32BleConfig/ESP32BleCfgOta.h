@@ -0,0 +1,151 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgOta> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGOTA_H_
+#define _ESP32BLECFGOTA_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// OTA Control Commands, written by the Client to [OTA/Control]
+// (all values little endian)
+#define OTA_CMD_START                   0x01    // [Cmd:8][Rsvd:8][ImageSize:32][Sha256:256]
+#define OTA_CMD_FINISH                  0x02    // [Cmd:8]
+#define OTA_CMD_ABORT                   0x03    // [Cmd:8]
+
+#define OTA_CMD_START_SIZE              38
+#define OTA_SHA256_SIZE                 32
+
+// OTA Responses, notified by the Server via [OTA/Control]:
+//   [Rsp:8][Status:8][MaxPacketSize:16][CreditLimit:32][WrittenOffset:32]
+//
+// The Client may send image data up to offset <CreditLimit>. Each time the
+// flash writer has written a buffer, a new credit is granted. The answer to
+// OTA_CMD_START and OTA_CMD_FINISH is always notified asynchronously.
+#define OTA_RSP_ACK                     0x81    // START accepted, initial credit
+#define OTA_RSP_CREDIT                  0x82    // additional credit granted
+#define OTA_RSP_DONE                    0x83    // image verified and activated for next boot
+#define OTA_RSP_ERROR                   0x84    // update failed (see Status)
+
+#define OTA_RSP_SIZE                    12
+
+// Image Data Packets, written by the Client to [OTA/Data] (Write Without
+// Response), pure image data up to <MaxPacketSize> (= ATT_MTU - 3)
+
+// Status Codes
+#define OTA_STATUS_OK                   0
+#define OTA_STATUS_SIZE_ERROR           1
+#define OTA_STATUS_FLASH_ERROR          2
+#define OTA_STATUS_HASH_ERROR           3
+#define OTA_STATUS_STATE_ERROR          4
+#define OTA_STATUS_PARAM_ERROR          5
+#define OTA_STATUS_CREDIT_ERROR         6
+#define OTA_STATUS_IMAGE_ERROR          7
+
+// Update States
+#define OTA_STATE_IDLE                  0
+#define OTA_STATE_ACTIVE                1
+#define OTA_STATE_DONE                  2
+#define OTA_STATE_ERROR                 3
+
+// Size of each of the two Flash Writer Buffers
+#define OTA_WRITE_BUFF_SIZE             4096
+
+
+// Data structure with the state of the current/last update
+typedef struct
+{
+
+    uint8_t         m_ui8State;                 // OTA_STATE_xxx
+    uint8_t         m_ui8Status;                // OTA_STATUS_xxx of the current/last update
+    uint32_t        m_ui32ImageSize;            // size of the firmware image                   [Bytes]
+    uint32_t        m_ui32RecvOffset;           // number of bytes received so far              [Bytes]
+    uint32_t        m_ui32WrittenOffset;        // number of bytes written to flash so far      [Bytes]
+    uint32_t        m_ui32CreditLimit;          // Client may send data up to this offset       [Bytes]
+    uint32_t        m_ui32Throughput;           // throughput of the last update                [Bytes/s]
+    uint32_t        m_ui32MaxWriteTime;         // max. time for writing one buffer             [us]
+
+} tOtaStatus;
+
+
+// Callback to send a response to the Client (notify via [OTA/Control])
+typedef  void  (*tOtaCbSendRsp) (const uint8_t* pabRsp_p, unsigned int uiRspLen_p);
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgOta                                          */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgOta
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int   Setup(tOtaCbSendRsp pfnSendRsp_p);
+        static  int   ProcessCtrl(const uint8_t* pabData_p, unsigned int uiDataLen_p, unsigned int uiMaxPacketSize_p);
+        static  int   ProcessData(const uint8_t* pabData_p, unsigned int uiDataLen_p);
+        static  bool  GetStatus(tOtaStatus* pOtaStatus_p);
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  void  WriterTask(void* pvParam_p);
+        static  bool  QueueJob(uint8_t ui8JobType_p, unsigned int uiBuffIdx_p, unsigned int uiBuffLen_p, uint8_t ui8Rsp_p, uint8_t ui8Status_p);
+        static  void  FailUpdate(uint8_t ui8Status_p);
+        static  void  SendRsp(uint8_t ui8Rsp_p, uint8_t ui8Status_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGOTA_H_
@@ -1,1046 +1,4504 @@
-/****************************************************************************
-
-  Copyright (c) 2021 Ronald Sieber
-
-  Project:      Project independend / Standard class
-  Description:  Class <ESP32BleCfgProfile> Implementation
-
-  -------------------------------------------------------------------------
-
-    Calculation of Handles required for function <BLEServer::createService>:
-        1 Handle for the Service itself
-      + 2 Handles for each Characteristic
-      + 1 Handle for each Despcription
-
-    (see: https://esp32.com/viewtopic.php?t=7452)
-
-  -------------------------------------------------------------------------
-
-  Revision History:
-
-  2021/07/06 -rs:   V1.00 Initial version
-
-****************************************************************************/
-
-
-#include "Arduino.h"
-#include <BLEDevice.h>
-#include <BLEServer.h>
-#include "ESP32BleCfgProfile.h"
-
-#define DEBUG                                                           // Enable/Disable TRACE
-#include "Trace.h"
-
-
-
-
-
-/***************************************************************************/
-/*                                                                         */
-/*                                                                         */
-/*          CLASS  ESP32BleCfgProfile                                      */
-/*                                                                         */
-/*                                                                         */
-/***************************************************************************/
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          P R I V A T E   A T T R I B U T E S                            //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-//---------------------------------------------------------------------------
-//  BLE specific Definitions
-//---------------------------------------------------------------------------
-//
-// CONVENTION:
-//
-// In a GUID of a Characteristic the 1st group specifies the Characteristic purpose,
-// while the 2nd group is always '0000'. A Descriptor uses in its 1st group the same
-// value as it's assoziated Characteristic, but with a value unequal '0000' in the
-// 2nd group. For the first Descriptor the value '0001' is used. This scheme allows
-// multiple Descriptors for one Characteristic in the future by continue numbering
-// with '0002' etc. However, this implementation always uses only the first descriptor
-// ('001').
-//
-// Sample:
-// GUID Characteristic:         "00003100-0000-1000-8000-E776CC14FE69"
-// GUID Offset Descriptor:      "00000000-0001-0000-0000-000000000000"
-//                              --------------------------------------
-// Resulting Descriptor GUID:   "00003100-0001-1000-8000-E776CC14FE69"
-//
-
-static  const int    NUM_HANDLES_DEVMNT_SERVICE             = 16;               // = (1*Service + 2*Characteristics + 1*Descriptions)
-static  const char*  BLE_UUID_DEVMNT_SERVICE                = "00001000-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_DEVTYPE_CHARACTRSTC    = "00001100-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_DEVTYPE_DSCRPT         = "00001100-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_SYSTICKCNT_CHARACTRSTC = "00001200-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_SYSTICKCNT_DSCRPT      = "00001200-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_DEVNAME_CHARACTRSTC    = "00001300-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_DEVNAME_DSCRPT         = "00001300-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_SAVE_CFG_CHARACTRSTC   = "00001400-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_SAVE_CFG_DSCRPT        = "00001400-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_RST_DEV_CHARACTRSTC    = "00001500-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_DEVMNT_RST_DEV_DSCRPT         = "00001500-0001-1000-8000-E776CC14FE69";
-
-static  const int    NUM_HANDLES_WIFI_SERVICE               = 14;               // = (1*Service + 2*Characteristics + 1*Descriptions)
-static  const char*  BLE_UUID_WIFI_SERVICE                  = "00002000-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_SSID_CHARACTRSTC         = "00002100-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_SSID_DSCRPT              = "00002100-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_PASSWD_CHARACTRSTC       = "00002200-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_PASSWD_DSCRPT            = "00002200-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_OWNADDR_CHARACTRSTC      = "00002300-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_OWNADDR_DSCRPT           = "00002300-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_OWNMODE_CHARACTRSTC      = "00002400-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_OWNMODE_DSCRPT           = "00002400-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_WIFI_OWNMODE_DSCRPT_FEATLIST  = "00002400-0002-1000-8000-E776CC14FE69";
-
-static  const int    NUM_HANDLES_APP_RT_SERVICE             = 28;               // = (1*Service + 2*Characteristics + 1*Descriptions)
-static  const char*  BLE_UUID_APP_RT_SERVICE                = "00003000-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT1_CHARACTRSTC       = "00003100-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT1_DSCRPT            = "00003100-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT2_CHARACTRSTC       = "00003200-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT2_DSCRPT            = "00003200-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT3_CHARACTRSTC       = "00003300-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT3_DSCRPT            = "00003300-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT4_CHARACTRSTC       = "00003400-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT4_DSCRPT            = "00003400-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT5_CHARACTRSTC       = "00003500-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT5_DSCRPT            = "00003500-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT6_CHARACTRSTC       = "00003600-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT6_DSCRPT            = "00003600-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT7_CHARACTRSTC       = "00003700-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT7_DSCRPT            = "00003700-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT8_CHARACTRSTC       = "00003800-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_OPT8_DSCRPT            = "00003800-0001-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_PEERADDR_CHARACTRSTC   = "00003900-0000-1000-8000-E776CC14FE69";
-static  const char*  BLE_UUID_APP_RT_PEERADDR_DSCRPT        = "00003900-0001-1000-8000-E776CC14FE69";
-
-
-
-//---------------------------------------------------------------------------
-//  Module Local Variables
-//---------------------------------------------------------------------------
-
-// The main class ESP32BleCfgProfile and the local callback classes declared
-// below require common access to the variables created here. For this reason,
-// the variables cannot be declared as members of the class ESP32BleCfgProfile,
-// but must be created as module local variables.
-
-static  bool                fBleClientConnected_g           = false;
-
-static  tCbHdlrSaveConfig   pfnAppCbHdlrSaveConfig_g        = NULL;
-static  tCbHdlrRestartDev   pfnAppCbHdlrRestartDev_g        = NULL;
-static  tCbHdlrConStatChg   pfnAppCbHdlrConStatChg_g        = NULL;
-
-static  BLEServer*          pBleServer_g                    = NULL;
-
-static  BLEService*         pBleServiceDevMnt_g             = NULL;
-static  BLECharacteristic*  pBleCharacDevMntDevType_g       = NULL;
-static  BLECharacteristic*  pBleCharacDevMntSysTickCnt_g    = NULL;
-static  BLECharacteristic*  pBleCharacDevMntDevName_g       = NULL;
-static  BLECharacteristic*  pBleCharacDevMntSaveCfg_g       = NULL;
-static  BLECharacteristic*  pBleCharacDevMntRstDev_g        = NULL;
-
-static  BLEService*         pBleServiceWifi_g               = NULL;
-static  BLECharacteristic*  pBleCharacWifiSSID_g            = NULL;
-static  BLECharacteristic*  pBleCharacWifiPasswd_g          = NULL;
-static  BLECharacteristic*  pBleCharacWifiOwnAddr_g         = NULL;
-static  BLECharacteristic*  pBleCharacWifiOwnMode_g         = NULL;
-
-static  BLEService*         pBleServiceAppRt_g              = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt1_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt2_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt3_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt4_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt5_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt6_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt7_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtOpt8_g           = NULL;
-static  BLECharacteristic*  pBleCharacAppRtPeerAddr_g       = NULL;
-
-
-static  uint32_t            ui32DevMntDevType_g             = 0;
-static  uint32_t            ui32DevMntSysTickCnt_g          = 0;
-static  char                szDevMntDevName_g[32]           = { '\0' };     // "{ESP32_BLE_DEVICE}"
-static  uint16_t            ui16DevMntSaveCfg_g             = 0;
-static  uint16_t            ui16DevMntRstDev_g              = 0;
-
-static  char                szWifiSSID_g[32]                = { '\0' };     // "{Enter WIFI SSID Name}"
-static  char                szWifiPasswd_g[64]              = { '\0' };     // "{Enter WIFI Password}"
-static  char                szWifiOwnAddr_g[24]             = { '\0' };     // "{0.0.0.0:0}"
-static  uint16_t            ui16WifiOwnMode_g               = 0;            // WIFI_OPMODE_STA / WIFI_OPMODE_AP
-
-static  uint16_t            ui16AppRtOpt1_g                 = 0;
-static  uint16_t            ui16AppRtOpt2_g                 = 0;
-static  uint16_t            ui16AppRtOpt3_g                 = 0;
-static  uint16_t            ui16AppRtOpt4_g                 = 0;
-static  uint16_t            ui16AppRtOpt5_g                 = 0;
-static  uint16_t            ui16AppRtOpt6_g                 = 0;
-static  uint16_t            ui16AppRtOpt7_g                 = 0;
-static  uint16_t            ui16AppRtOpt8_g                 = 0;
-static  char                szAppRtPeerAddr_g[24]           = { '\0' };     // "{0.0.0.0:0}"
-
-
-
-
-
-//=========================================================================//
-//                                                                         //
-//          B L E   C A L L B A C K   C L A S S E S                        //
-//                                                                         //
-//=========================================================================//
-
-//---------------------------------------------------------------------------
-//  Class BleServerAppCallbacks
-//---------------------------------------------------------------------------
-
-class  BleServerAppCallbacks : public BLEServerCallbacks
-{
-
-    void onConnect(BLEServer* pBleServer_p)
-    {
-        fBleClientConnected_g = true;
-
-        if (pfnAppCbHdlrConStatChg_g != NULL)
-        {
-            pfnAppCbHdlrConStatChg_g(fBleClientConnected_g);
-        }
-        return;
-    };
-
-    //-------------------------------------------------------------------
-    void onDisconnect(BLEServer* pBleServer_p)
-    {
-        fBleClientConnected_g = false;
-
-        if (pfnAppCbHdlrConStatChg_g != NULL)
-        {
-            pfnAppCbHdlrConStatChg_g(fBleClientConnected_g);
-        }
-        return;
-    };
-
-};
-
-
-
-//---------------------------------------------------------------------------
-//  Class BleCharacteristicDevMntSaveConfigCallbacks
-//---------------------------------------------------------------------------
-
-class  BleCharacteristicDevMntSaveConfigCallbacks : public BLECharacteristicCallbacks
-{
-
-    void onWrite(BLECharacteristic* pBleCharacteristic_p)
-    {
-
-        tAppCfgData  AppCfgData;
-        bool         fSuccess;
-        int          iRes;
-
-        fSuccess = ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
-        if ( fSuccess )
-        {
-            if (pfnAppCbHdlrSaveConfig_g != NULL)
-            {
-                iRes = ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData);
-                if (iRes >= 0)
-                {
-                    pfnAppCbHdlrSaveConfig_g(&AppCfgData);
-                }
-                else
-                {
-                    pfnAppCbHdlrSaveConfig_g(NULL);
-                }
-            }
-        }
-
-        return;
-
-    }
-
-};
-
-
-
-//---------------------------------------------------------------------------
-//  Class BleCharacteristicDevMntRestartDevCallbacks
-//---------------------------------------------------------------------------
-
-class  BleCharacteristicDevMntRestartDevCallbacks : public BLECharacteristicCallbacks
-{
-
-    void onWrite(BLECharacteristic* pBleCharacteristic_p)
-    {
-
-        if (pfnAppCbHdlrRestartDev_g != NULL)
-        {
-            pfnAppCbHdlrRestartDev_g();
-        }
-
-        return;
-
-    }
-
-};
-
-
-
-
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          C O N S T R U C T O R   /   D E S T R U C T O R                //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-//---------------------------------------------------------------------------
-//  Constructor
-//---------------------------------------------------------------------------
-
-ESP32BleCfgProfile::ESP32BleCfgProfile ()
-{
-
-    fBleClientConnected_g           = false;
-
-    pfnAppCbHdlrSaveConfig_g        = NULL;
-    pfnAppCbHdlrRestartDev_g        = NULL;
-
-    pBleServer_g                    = NULL;
-
-    pBleServiceDevMnt_g             = NULL;
-    pBleCharacDevMntDevType_g       = NULL;
-    pBleCharacDevMntSysTickCnt_g    = NULL;
-    pBleCharacDevMntDevName_g       = NULL;
-    pBleCharacDevMntSaveCfg_g       = NULL;
-    pBleCharacDevMntRstDev_g        = NULL;
-
-    pBleServiceWifi_g               = NULL;
-    pBleCharacWifiSSID_g            = NULL;
-    pBleCharacWifiPasswd_g          = NULL;
-    pBleCharacWifiOwnAddr_g         = NULL;
-    pBleCharacWifiOwnMode_g         = NULL;
-
-    pBleServiceAppRt_g              = NULL;
-    pBleCharacAppRtOpt1_g           = NULL;
-    pBleCharacAppRtOpt2_g           = NULL;
-    pBleCharacAppRtOpt3_g           = NULL;
-    pBleCharacAppRtOpt4_g           = NULL;
-    pBleCharacAppRtOpt5_g           = NULL;
-    pBleCharacAppRtOpt6_g           = NULL;
-    pBleCharacAppRtOpt7_g           = NULL;
-    pBleCharacAppRtOpt8_g           = NULL;
-    pBleCharacAppRtPeerAddr_g       = NULL;
-
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Destructor
-//---------------------------------------------------------------------------
-
-ESP32BleCfgProfile::~ESP32BleCfgProfile()
-{
-
-    return;
-
-}
-
-
-
-
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          P U B L I C    M E T H O D E S                                 //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-//---------------------------------------------------------------------------
-//  ProfileSetup()
-//---------------------------------------------------------------------------
-
-int  ESP32BleCfgProfile::ProfileSetup (
-        uint32_t ui32DeviceType_p,
-        const tAppCfgData* pAppCfgData_p,
-        const tAppDescriptData* pAppDescriptData_p,
-        tCbHdlrSaveConfig pfnAppCbHdlrSaveConfig_p,
-        tCbHdlrRestartDev pfnAppCbHdlrRestartDev_p,
-        tCbHdlrConStatChg pfnAppCbHdlrConStatChg_p)
-{
-
-BLEDescriptor*  pBleDescriptor;
-uint16_t        ui16OwnModeFeatList;
-int             iRes;
-
-
-    TRACE1("+ 'ProfileSetup()': ui32DeviceType_p=%d\n", ui32DeviceType_p);
-
-    // Import configuration data given by Application into class instance workspace
-    ui32DevMntDevType_g = ui32DeviceType_p;
-    iRes = ImportInstanceWorkspace(pAppCfgData_p);
-    if (iRes < 0)
-    {
-        return (-1);
-    }
-
-    // Save Pointer to Application Callback Handlers for 'SaveCfg' and 'RestartDev' as well as optional Handler 'ConnectionStatusChanged'
-    pfnAppCbHdlrSaveConfig_g = pfnAppCbHdlrSaveConfig_p;
-    pfnAppCbHdlrRestartDev_g = pfnAppCbHdlrRestartDev_p;
-    pfnAppCbHdlrConStatChg_g = pfnAppCbHdlrConStatChg_p;
-    if ((pfnAppCbHdlrSaveConfig_g == NULL) || (pfnAppCbHdlrRestartDev_g == NULL))
-    {
-        return (-2);
-    }
-
-
-    //****************[ SERVER ]****************
-    BLEDevice::init(szDevMntDevName_g);             // e.g. "ESP32-BEACON"
-    pBleServer_g = BLEDevice::createServer();
-    pBleServer_g->setCallbacks(new BleServerAppCallbacks());
-
-
-    // ======= [ SERVICE #1 [Device Management] ] =======
-    {
-        TRACE0("   SERVICE #1 [Device Management]\n");
-        pBleServiceDevMnt_g = pBleServer_g->createService(BLEUUID(BLE_UUID_DEVMNT_SERVICE), NUM_HANDLES_DEVMNT_SERVICE, 0);
-
-        // ---- [ CHARACTERISTIC #1 [DevMnt/DevType] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #1 [DevMnt/DevType]\n");
-            pBleCharacDevMntDevType_g = pBleServiceDevMnt_g->createCharacteristic(
-                                                            BLE_UUID_DEVMNT_DEVTYPE_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ
-                                                        );
-            pBleCharacDevMntDevType_g->setValue(ui32DevMntDevType_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_DEVMNT_DEVTYPE_DSCRPT);
-            pBleDescriptor->setValue("Device Type");
-            pBleCharacDevMntDevType_g->addDescriptor(pBleDescriptor);
-        }
-
-        // ---- [ CHARACTERISTIC #2 [DevMnt/SysTickCnt] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #2 [DevMnt/SysTickCnt]\n");
-            pBleCharacDevMntSysTickCnt_g = pBleServiceDevMnt_g->createCharacteristic(
-                                                            BLE_UUID_DEVMNT_SYSTICKCNT_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacDevMntSysTickCnt_g->setValue(ui32DevMntSysTickCnt_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_DEVMNT_SYSTICKCNT_DSCRPT);
-            pBleDescriptor->setValue("System Tick Count");
-            pBleCharacDevMntSysTickCnt_g->addDescriptor(pBleDescriptor);
-        }
-
-        // ---- [ CHARACTERISTIC #3 [DevMnt/DevName] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #3 [DevMnt/DevName]\n");
-            pBleCharacDevMntDevName_g = pBleServiceDevMnt_g->createCharacteristic(
-                                                            BLE_UUID_DEVMNT_DEVNAME_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacDevMntDevName_g->setValue(szDevMntDevName_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_DEVMNT_DEVNAME_DSCRPT);
-            pBleDescriptor->setValue("Device Name");
-            pBleCharacDevMntDevName_g->addDescriptor(pBleDescriptor);
-        }
-
-        // ---- [ CHARACTERISTIC #4 [DevMnt/SaveConfig] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #4 [DevMnt/SaveConfig]\n");
-            pBleCharacDevMntSaveCfg_g = pBleServiceDevMnt_g->createCharacteristic(
-                                                            BLE_UUID_DEVMNT_SAVE_CFG_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_WRITE
-                                                        );
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_DEVMNT_SAVE_CFG_DSCRPT);
-            pBleDescriptor->setValue("Save Conig");
-            pBleCharacDevMntSaveCfg_g->addDescriptor(pBleDescriptor);
-            pBleCharacDevMntSaveCfg_g->setCallbacks(new BleCharacteristicDevMntSaveConfigCallbacks());
-        }
-
-        // ---- [ CHARACTERISTIC #5 [DevMnt/RstDev] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #5 [DevMnt/RstDev]\n");
-            pBleCharacDevMntRstDev_g = pBleServiceDevMnt_g->createCharacteristic(
-                                                            BLE_UUID_DEVMNT_RST_DEV_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_WRITE
-                                                        );
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_DEVMNT_RST_DEV_DSCRPT);
-            pBleDescriptor->setValue("Restart Device");
-            pBleCharacDevMntRstDev_g->addDescriptor(pBleDescriptor);
-            pBleCharacDevMntRstDev_g->setCallbacks(new BleCharacteristicDevMntRestartDevCallbacks());
-        }
-
-        pBleServiceDevMnt_g->start();
-    }
-
-
-    // ======= [ SERVICE #2 [WIFI Config] ] =======
-    {
-        TRACE0("   SERVICE #2 [WIFI Config]\n");
-        pBleServiceWifi_g = pBleServer_g->createService(BLEUUID(BLE_UUID_WIFI_SERVICE), NUM_HANDLES_WIFI_SERVICE, 0);
-
-        // ---- [ CHARACTERISTIC #1 [Wifi/SSID] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #1 [Wifi/SSID]\n");
-            pBleCharacWifiSSID_g = pBleServiceWifi_g->createCharacteristic(
-                                                            BLE_UUID_WIFI_SSID_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacWifiSSID_g->setValue(szWifiSSID_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_WIFI_SSID_DSCRPT);
-            pBleDescriptor->setValue("WIFI SSID");
-            pBleCharacWifiSSID_g->addDescriptor(pBleDescriptor);
-        }
-
-        // ---- [ CHARACTERISTIC #2 [Wifi/Passwd] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #2 [Wifi/Passwd]\n");
-            pBleCharacWifiPasswd_g = pBleServiceWifi_g->createCharacteristic(
-                                                            BLE_UUID_WIFI_PASSWD_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacWifiPasswd_g->setValue(szWifiPasswd_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_WIFI_PASSWD_DSCRPT);
-            pBleDescriptor->setValue("WIFI PASSWD");
-            pBleCharacWifiPasswd_g->addDescriptor(pBleDescriptor);
-        }
-
-        // ---- [ CHARACTERISTIC #3 [Wifi/OwnAddr] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #3 [Wifi/OwnAddr]\n");
-            pBleCharacWifiOwnAddr_g = pBleServiceWifi_g->createCharacteristic(
-                                                            BLE_UUID_WIFI_OWNADDR_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacWifiOwnAddr_g->setValue(szWifiOwnAddr_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_WIFI_OWNADDR_DSCRPT);
-            pBleDescriptor->setValue("Own Address");
-            pBleCharacWifiOwnAddr_g->addDescriptor(pBleDescriptor);
-        }
-
-        // ---- [ CHARACTERISTIC #4 [Wifi/OwnMode] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #4 [Wifi/OwnMode]\n");
-            pBleCharacWifiOwnMode_g = pBleServiceWifi_g->createCharacteristic(
-                                                            BLE_UUID_WIFI_OWNMODE_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacWifiOwnMode_g->setValue((uint16_t&)ui16WifiOwnMode_g);
-            pBleDescriptor = new BLEDescriptor(BLE_UUID_WIFI_OWNMODE_DSCRPT);
-            pBleDescriptor->setValue("Own Mode");
-            pBleCharacWifiOwnMode_g->addDescriptor(pBleDescriptor);
-            if (pAppDescriptData_p != NULL)
-            {
-                // set descriptor with supported WIFI modes (Station/Client, AccessPoint)
-                ui16OwnModeFeatList = (uint16_t) pAppDescriptData_p->m_ui8OwnModeFeatList;
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_WIFI_OWNMODE_DSCRPT_FEATLIST);
-                pBleDescriptor->setValue((uint8_t*)&ui16OwnModeFeatList, sizeof(ui16OwnModeFeatList));
-                pBleCharacWifiOwnMode_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        pBleServiceWifi_g->start();
-    }
-
-
-    // ======= [ SERVICE #3 [APP RT Config] ] =======
-    {
-        TRACE0("   SERVICE #3 [APP RT Config]\n");
-        pBleServiceAppRt_g = pBleServer_g->createService(BLEUUID(BLE_UUID_APP_RT_SERVICE), NUM_HANDLES_APP_RT_SERVICE, 0);
-
-        // ---- [ CHARACTERISTIC #1 [AppRt/Opt1] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #1 [AppRt/Opt1]\n");
-            pBleCharacAppRtOpt1_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT1_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt1_g->setValue((uint16_t&)ui16AppRtOpt1_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt1 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT1_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt1);
-                pBleCharacAppRtOpt1_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #2 [AppRt/Opt2] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #2 [AppRt/Opt2]\n");
-            pBleCharacAppRtOpt2_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT2_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt2_g->setValue((uint16_t&)ui16AppRtOpt2_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt2 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT2_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt2);
-                pBleCharacAppRtOpt2_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #3 [AppRt/Opt3] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #3 [AppRt/Opt3]\n");
-            pBleCharacAppRtOpt3_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT3_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt3_g->setValue((uint16_t&)ui16AppRtOpt3_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt3 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT3_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt3);
-                pBleCharacAppRtOpt3_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #4 [AppRt/Opt4] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #4 [AppRt/Opt4]\n");
-            pBleCharacAppRtOpt4_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT4_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt4_g->setValue((uint16_t&)ui16AppRtOpt4_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt4 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT4_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt4);
-                pBleCharacAppRtOpt4_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #5[AppRt/Opt5] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #5 [AppRt/Opt5]\n");
-            pBleCharacAppRtOpt5_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT5_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt5_g->setValue((uint16_t&)ui16AppRtOpt5_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt5 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT5_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt5);
-                pBleCharacAppRtOpt5_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #6 [AppRt/Opt6] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #6 [AppRt/Opt6]\n");
-            pBleCharacAppRtOpt6_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT6_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt6_g->setValue((uint16_t&)ui16AppRtOpt6_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt6 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT6_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt6);
-                pBleCharacAppRtOpt6_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #7 [AppRt/Opt7] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #7 [AppRt/Opt7]\n");
-            pBleCharacAppRtOpt7_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT7_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt7_g->setValue((uint16_t&)ui16AppRtOpt7_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt7 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT7_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt7);
-                pBleCharacAppRtOpt7_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #8 [AppRt/Opt8] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #8 [AppRt/Opt8]\n");
-            pBleCharacAppRtOpt8_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_OPT8_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtOpt8_g->setValue((uint16_t&)ui16AppRtOpt8_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt8 != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_OPT8_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt8);
-                pBleCharacAppRtOpt8_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        // ---- [ CHARACTERISTIC #9 [AppRt/PeerAddr] ] ----
-        {
-            TRACE0("     CHARACTERISTIC #9 [AppRt/PeerAddr]\n");
-            pBleCharacAppRtPeerAddr_g = pBleServiceAppRt_g->createCharacteristic(
-                                                            BLE_UUID_APP_RT_PEERADDR_CHARACTRSTC,
-                                                            BLECharacteristic::PROPERTY_READ  |
-                                                            BLECharacteristic::PROPERTY_WRITE |
-                                                            BLECharacteristic::PROPERTY_NOTIFY
-                                                        );
-            pBleCharacAppRtPeerAddr_g->setValue(szAppRtPeerAddr_g);
-            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelPeerAddr != NULL) )
-            {
-                pBleDescriptor = new BLEDescriptor(BLE_UUID_APP_RT_PEERADDR_DSCRPT);
-                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelPeerAddr);
-                pBleCharacAppRtPeerAddr_g->addDescriptor(pBleDescriptor);
-            }
-        }
-
-        pBleServiceAppRt_g->start();
-    }
-
-
-    //---- Start Server ----
-    TRACE0("   BleServer_g->startAdvertising()\n");
-    pBleServer_g->startAdvertising();
-
-    TRACE0("- 'ProfileSetup()'\n");
-
-    return (1);
-
-};
-
-
-
-//---------------------------------------------------------------------------
-//  ProfileLoop()
-//---------------------------------------------------------------------------
-
-bool  ESP32BleCfgProfile::ProfileLoop ()
-{
-
-unsigned long  ulCurrTick;
-bool           fBleNotify;
-
-    fBleNotify = false;
-
-    if ( fBleClientConnected_g )
-    {
-        ulCurrTick = millis();
-        if ((ulCurrTick - ui32DevMntSysTickCnt_g) >= 1000)
-        {
-            ui32DevMntSysTickCnt_g = ulCurrTick;
-            pBleCharacDevMntSysTickCnt_g->setValue(ui32DevMntSysTickCnt_g);
-            pBleCharacDevMntSysTickCnt_g->notify();
-
-            fBleNotify = true;
-        }
-    }
-
-    return (fBleNotify);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  IsBleClientConnected()
-//---------------------------------------------------------------------------
-
-bool  ESP32BleCfgProfile::IsBleClientConnected ()
-{
-
-    return ( fBleClientConnected_g );
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  STATIC: ReadDataFromBleCharacterisics
-//---------------------------------------------------------------------------
-
-bool  ESP32BleCfgProfile::ReadDataFromBleCharacterisics ()
-{
-
-std::string  stdstrData;
-String       strData;
-uint8_t*     pui8Data;
-int          iRes;
-bool         fSuccess;
-
-
-    TRACE0("+ 'ReadDataFromBleCharacterisics()...'\n");
-
-    fSuccess = true;
-
-
-    // ---- [DevMnt/DevName] ----
-    stdstrData = pBleCharacDevMntDevName_g->getValue();
-    strData = String(stdstrData.c_str());
-    strncpy(szDevMntDevName_g, strData.c_str(), sizeof(szDevMntDevName_g));
-
-
-    // ---- [Wifi/SSID] ----
-    stdstrData = pBleCharacWifiSSID_g->getValue();
-    strData = String(stdstrData.c_str());
-    strncpy(szWifiSSID_g, strData.c_str(), sizeof(szWifiSSID_g));
-
-    // ---- [Wifi/Passwd] ----
-    stdstrData = pBleCharacWifiPasswd_g->getValue();
-    strData = String(stdstrData.c_str());
-    strncpy(szWifiPasswd_g, strData.c_str(), sizeof(szWifiPasswd_g));
-
-    // ---- [Wifi/OwnAddr] ----
-    stdstrData = pBleCharacWifiOwnAddr_g->getValue();
-    strData = String(stdstrData.c_str());
-    strncpy(szWifiOwnAddr_g, strData.c_str(), sizeof(szWifiOwnAddr_g));
-
-    // ---- [Wifi/OwnMode] ----
-    pui8Data = pBleCharacWifiOwnMode_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16WifiOwnMode_g = (uint16_t)(*pui8Data);
-    }
-
-
-    // ---- [AppRt/Opt1] ----
-    pui8Data = pBleCharacAppRtOpt1_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt1_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt2] ----
-    pui8Data = pBleCharacAppRtOpt2_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt2_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt3] ----
-    pui8Data = pBleCharacAppRtOpt3_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt3_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt4] ----
-    pui8Data = pBleCharacAppRtOpt4_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt4_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt5] ----
-    pui8Data = pBleCharacAppRtOpt5_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt5_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt6] ----
-    pui8Data = pBleCharacAppRtOpt6_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt6_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt7] ----
-    pui8Data = pBleCharacAppRtOpt7_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt7_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/Opt8] ----
-    pui8Data = pBleCharacAppRtOpt8_g->getData();
-    if (pui8Data != NULL)
-    {
-        ui16AppRtOpt8_g = (*pui8Data > 0) ? 1 : 0;
-    }
-
-    // ---- [AppRt/PeerAddr] ----
-    stdstrData = pBleCharacAppRtPeerAddr_g->getValue();
-    strData = String(stdstrData.c_str());
-    strncpy(szAppRtPeerAddr_g, strData.c_str(), sizeof(szAppRtPeerAddr_g));
-
-    TRACE0("- 'ReadDataFromBleCharacterisics()'\n");
-
-    return (fSuccess);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  STATIC: ImportInstanceWorkspace()
-//---------------------------------------------------------------------------
-
-int  ESP32BleCfgProfile::ImportInstanceWorkspace (
-        const tAppCfgData* pAppCfgData_p)
-{
-
-    TRACE0("+ 'ImportInstanceWorkspace()...'\n");
-
-    if (pAppCfgData_p == NULL)
-    {
-        return (-1);
-    }
-
-    if (sizeof(szDevMntDevName_g) < sizeof(pAppCfgData_p->m_szDevMntDevName))
-    {
-        return (-2);
-    }
-    memcpy(szDevMntDevName_g, pAppCfgData_p->m_szDevMntDevName, sizeof(pAppCfgData_p->m_szDevMntDevName));
-
-    if (sizeof(szWifiSSID_g) < sizeof(pAppCfgData_p->m_szWifiSSID))
-    {
-        return (-3);
-    }
-    memcpy(szWifiSSID_g, pAppCfgData_p->m_szWifiSSID, sizeof(pAppCfgData_p->m_szWifiSSID));
-
-    if (sizeof(szWifiPasswd_g) < sizeof(pAppCfgData_p->m_szWifiPasswd))
-    {
-        return (-4);
-    }
-    memcpy(szWifiPasswd_g, pAppCfgData_p->m_szWifiPasswd, sizeof(pAppCfgData_p->m_szWifiPasswd));
-
-    if (sizeof(szWifiOwnAddr_g) < sizeof(pAppCfgData_p->m_szWifiOwnAddr))
-    {
-        return (-5);
-    }
-    memcpy(szWifiOwnAddr_g, pAppCfgData_p->m_szWifiOwnAddr, sizeof(pAppCfgData_p->m_szWifiOwnAddr));
-
-    ui16WifiOwnMode_g = (uint16_t) pAppCfgData_p->m_ui8WifiOwnMode;
-
-    ui16AppRtOpt1_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt1 ? 1 : 0);
-    ui16AppRtOpt2_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt2 ? 1 : 0);
-    ui16AppRtOpt3_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt3 ? 1 : 0);
-    ui16AppRtOpt4_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt4 ? 1 : 0);
-    ui16AppRtOpt5_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt5 ? 1 : 0);
-    ui16AppRtOpt6_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt6 ? 1 : 0);
-    ui16AppRtOpt7_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt7 ? 1 : 0);
-    ui16AppRtOpt8_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt8 ? 1 : 0);
-
-    if (sizeof(szAppRtPeerAddr_g) < sizeof(pAppCfgData_p->m_szAppRtPeerAddr))
-    {
-        return (-6);
-    }
-    memcpy(szAppRtPeerAddr_g, pAppCfgData_p->m_szAppRtPeerAddr, sizeof(pAppCfgData_p->m_szAppRtPeerAddr));
-
-    TRACE0("- 'ImportInstanceWorkspace()'\n");
-
-    return (1);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  STATIC: ExportInstanceWorkspace()
-//---------------------------------------------------------------------------
-
-int  ESP32BleCfgProfile::ExportInstanceWorkspace (
-        tAppCfgData* pAppCfgData_p)
-{
-
-    TRACE0("+ 'ExportInstanceWorkspace()...'\n");
-
-    if (pAppCfgData_p == NULL)
-    {
-        return (-1);
-    }
-
-    memset(pAppCfgData_p, 0x00, sizeof(pAppCfgData_p));
-
-    if (sizeof(pAppCfgData_p->m_szDevMntDevName) < sizeof(szDevMntDevName_g))
-    {
-        return (-2);
-    }
-    memcpy(pAppCfgData_p->m_szDevMntDevName, szDevMntDevName_g, sizeof(pAppCfgData_p->m_szDevMntDevName));
-
-    if (sizeof(pAppCfgData_p->m_szWifiSSID) < sizeof(szWifiSSID_g))
-    {
-        return (-3);
-    }
-    memcpy(pAppCfgData_p->m_szWifiSSID, szWifiSSID_g, sizeof(pAppCfgData_p->m_szWifiSSID));
-
-    if (sizeof(pAppCfgData_p->m_szWifiPasswd) < sizeof(szWifiPasswd_g))
-    {
-        return (-4);
-    }
-    memcpy(pAppCfgData_p->m_szWifiPasswd, szWifiPasswd_g, sizeof(pAppCfgData_p->m_szWifiPasswd));
-
-    if (sizeof(pAppCfgData_p->m_szWifiOwnAddr) < sizeof(szWifiOwnAddr_g))
-    {
-        return (-5);
-    }
-    memcpy(pAppCfgData_p->m_szWifiOwnAddr, szWifiOwnAddr_g, sizeof(pAppCfgData_p->m_szWifiOwnAddr));
-
-    pAppCfgData_p->m_ui8WifiOwnMode = (uint8_t)ui16WifiOwnMode_g;
-
-    pAppCfgData_p->m_fAppRtOpt1 = (ui16AppRtOpt1_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt2 = (ui16AppRtOpt2_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt3 = (ui16AppRtOpt3_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt4 = (ui16AppRtOpt4_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt5 = (ui16AppRtOpt5_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt6 = (ui16AppRtOpt6_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt7 = (ui16AppRtOpt7_g == 0) ? false : true;
-    pAppCfgData_p->m_fAppRtOpt8 = (ui16AppRtOpt8_g == 0) ? false : true;
-
-    if (sizeof(pAppCfgData_p->m_szAppRtPeerAddr) < sizeof(szAppRtPeerAddr_g))
-    {
-        return (-6);
-    }
-    memcpy(pAppCfgData_p->m_szAppRtPeerAddr, szAppRtPeerAddr_g, sizeof(pAppCfgData_p->m_szAppRtPeerAddr));
-
-    TRACE0("- 'ExportInstanceWorkspace()'\n");
-
-    return (1);
-
-}
-
-
-
-
-
-/////////////////////////////////////////////////////////////////////////////
-//                                                                         //
-//          P R I V A T E    M E T H O D E S                               //
-//                                                                         //
-/////////////////////////////////////////////////////////////////////////////
-
-
-
-
-//  EOF
+/****************************************************************************
+
+  Copyright (c) 2021 Ronald Sieber
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgProfile> Implementation
+
+  -------------------------------------------------------------------------
+
+    Calculation of Handles required for function <BLEServer::createService>:
+        1 Handle for the Service itself
+      + 2 Handles for each Characteristic
+      + 1 Handle for each Despcription
+
+    (see: https://esp32.com/viewtopic.php?t=7452)
+
+  -------------------------------------------------------------------------
+
+    Stable Attribute Handles / GATT Caching:
+
+    The Bluedroid stack assigns the attribute handles strictly sequential
+    in the order in which services, characteristics and descriptors are
+    created. Since <ProfileSetup()> always creates the services in the same
+    order and with a fixed number of handles per service, the resulting
+    handles are identical for each boot of the same firmware. Only the
+    number of handles of [AppRt] depends on the labels of the application
+    (options labeled with '#' are not created at all), which are constant
+    for a given firmware too. The GATT Service (0x1801) including the
+    'Service Changed' characteristic is created by the Bluedroid stack
+    itself in front of the profile services.
+
+    To allow a client to skip the full service discovery, the characteristic
+    [DevMnt/ProfileHash] provides a 32bit hash value calculated over the
+    complete profile layout (UUIDs, number of handles, descriptor labels
+    and feature lists). A client can cache the handles discovered at the
+    first connection together with this hash value. At reconnect, it only
+    has to read the hash value (which itself is always located at the same
+    handle) and can reuse its cached handles as long as the value remains
+    unchanged.
+
+    Optional services (e.g. [Stream], [OTA]) are always created behind the three
+    core services, so they never shift the handles of the core services.
+
+  -------------------------------------------------------------------------
+
+    Config Mode Idle Timeout:
+
+    With <SetCfgModeTimeout()>, the time without any connect, disconnect
+    or write request of a client is supervised by <ProfileLoop()>. After
+    the timeout, <IsCfgModeTimedOut()> returns true and the application
+    is expected to leave the BLE Config Mode (<ProfileShutdown()>), so a
+    device which was left in configuration mode doesn't advertise forever.
+    The time spent advertising, connected and with BLE off is accounted
+    by ESP32BleCfgStats (STATS_RADIO_xxx).
+
+  -------------------------------------------------------------------------
+
+    Telemetry:
+
+    Reading [DevMnt/Diagnostics] returns the blob of ESP32BleCfgStats.
+    If the application sets a telemetry source (<SetTelemetrySource()>),
+    <ProfileLoop()> additionally notifies the record provided by this
+    source once per second on [DevMnt/Diagnostics], together with the
+    System Tick Count. The first byte of a record must differ from the
+    version of the Diagnostics Blob (e.g. LOOPPROF_RECORD_ID).
+
+  -------------------------------------------------------------------------
+
+    Remote Log:
+
+    With <EnableLog()>, [DevMnt] gets the additional characteristic
+    [DevMnt/Log] as its last entry. A client starts the log stream by
+    writing 1 (and stops it by writing 0), the stream also stops at
+    disconnect. While started, <ProfileLoop()> notifies the packets
+    provided by the log source (e.g. ESP32BleCfgLog::GetPacket), each
+    filled up to ATT_MTU-3 Bytes. Log packets are only sent in loop
+    iterations without any other notification and at most once every
+    BLE_LOG_NOTIFY_INTERVAL, so the log can not starve the config
+    transfer. The characteristic shifts the handles of the following
+    services, which is reflected by the Profile Hash.
+
+  -------------------------------------------------------------------------
+
+    Attribute Table Backend (BLE_GATT_BACKEND_ATTR_TABLE):
+
+    Instead of one stack call per attribute, each core service is
+    registered by <esp_ble_gatts_create_attr_tab()> from a constant table.
+    The number of handles of a service is the number of its table entries,
+    so labels left out by the application reduce the handles of [AppRt].
+    All values are marked with ESP_GATT_RSP_BY_APP and are answered from
+    the instance workspace, which therefore is always up to date. Values
+    written by the client are checked before the write response is sent.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2021/07/06 -rs:   V1.00 Initial version
+  2026/10/18:       V1.10 Characteristic [DevMnt/ProfHash] for GATT caching
+  2026/10/18:       V1.20 Connection parameters and MTU of config sessions
+  2026/10/18:       V1.30 Latency histograms and event counters ([DevMnt/Diag])
+  2026/10/18:       V1.40 Optional services [Stream] and [OTA]
+  2026/10/18:       V1.50 Characteristics [DevMnt/ConfigPatch] and [DevMnt/ConfigImage]
+  2026/10/18:       V1.60 Coalesced notification of changed config values
+  2026/10/18:       V1.70 Validation of values written by the client
+  2026/10/18:       V1.80 ProfileShutdown() and ProfileEnterNormalMode()
+  2026/10/18:       V1.90 GATT backend BLE_GATT_BACKEND_ATTR_TABLE, options omitted by '#' label
+  2026/10/18:       V2.00 Radio time accounting, telemetry and [DevMnt/Log]
+  2026/10/18:       V2.01 Advertising restarted after a disconnect
+  2026/10/18:       V2.02 Values written by the client published to ESP32BleCfgView
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <BLEDevice.h>
+#include <BLEServer.h>
+#include <esp_gap_ble_api.h>
+#include <esp_bt.h>
+#include <esp_bt_main.h>
+#include <esp_rom_crc.h>
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgStats.h"
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleCfgView.h"
+#include "ESP32BleCfgStream.h"
+#include "ESP32BleCfgOta.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgProfile                                      */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  BLE specific Definitions
+//---------------------------------------------------------------------------
+//
+// CONVENTION:
+//
+// In a GUID of a Characteristic the 1st group specifies the Characteristic purpose,
+// while the 2nd group is always '0000'. A Descriptor uses in its 1st group the same
+// value as it's assoziated Characteristic, but with a value unequal '0000' in the
+// 2nd group. For the first Descriptor the value '0001' is used. This scheme allows
+// multiple Descriptors for one Characteristic in the future by continue numbering
+// with '0002' etc. However, this implementation always uses only the first descriptor
+// ('001').
+//
+// Sample:
+// GUID Characteristic:         "00003100-0000-1000-8000-E776CC14FE69"
+// GUID Offset Descriptor:      "00000000-0001-0000-0000-000000000000"
+//                              --------------------------------------
+// Resulting Descriptor GUID:   "00003100-0001-1000-8000-E776CC14FE69"
+//
+
+static  const int    NUM_HANDLES_DEVMNT_SERVICE             = 28;               // = (1*Service + 2*Characteristics + 1*Descriptions)
+static  const char*  BLE_UUID_DEVMNT_SERVICE                = "00001000-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_DEVTYPE_CHARACTRSTC    = "00001100-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_DEVTYPE_DSCRPT         = "00001100-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_SYSTICKCNT_CHARACTRSTC = "00001200-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_SYSTICKCNT_DSCRPT      = "00001200-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_DEVNAME_CHARACTRSTC    = "00001300-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_DEVNAME_DSCRPT         = "00001300-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_SAVE_CFG_CHARACTRSTC   = "00001400-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_SAVE_CFG_DSCRPT        = "00001400-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_RST_DEV_CHARACTRSTC    = "00001500-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_RST_DEV_DSCRPT         = "00001500-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_PROFHASH_CHARACTRSTC   = "00001600-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_PROFHASH_DSCRPT        = "00001600-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_DIAG_CHARACTRSTC       = "00001700-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_DIAG_DSCRPT            = "00001700-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_CFGPATCH_CHARACTRSTC   = "00001800-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_CFGPATCH_DSCRPT        = "00001800-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_CFGIMAGE_CHARACTRSTC   = "00001900-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_CFGIMAGE_DSCRPT        = "00001900-0001-1000-8000-E776CC14FE69";
+
+static  const int    NUM_HANDLES_DEVMNT_LOG                 = 3;                // optional [DevMnt/Log] (see <EnableLog()>)
+static  const char*  BLE_UUID_DEVMNT_LOG_CHARACTRSTC        = "00001A00-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_DEVMNT_LOG_DSCRPT             = "00001A00-0001-1000-8000-E776CC14FE69";
+
+static  const int    NUM_HANDLES_WIFI_SERVICE               = 14;               // = (1*Service + 2*Characteristics + 1*Descriptions)
+static  const char*  BLE_UUID_WIFI_SERVICE                  = "00002000-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_SSID_CHARACTRSTC         = "00002100-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_SSID_DSCRPT              = "00002100-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_PASSWD_CHARACTRSTC       = "00002200-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_PASSWD_DSCRPT            = "00002200-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_OWNADDR_CHARACTRSTC      = "00002300-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_OWNADDR_DSCRPT           = "00002300-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_OWNMODE_CHARACTRSTC      = "00002400-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_OWNMODE_DSCRPT           = "00002400-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_WIFI_OWNMODE_DSCRPT_FEATLIST  = "00002400-0002-1000-8000-E776CC14FE69";
+
+// NUM_HANDLES of [AppRt] depends on the labels given by the application (see <CalcAppRtLayout()>)
+static  const char*  BLE_UUID_APP_RT_SERVICE                = "00003000-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT1_CHARACTRSTC       = "00003100-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT1_DSCRPT            = "00003100-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT2_CHARACTRSTC       = "00003200-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT2_DSCRPT            = "00003200-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT3_CHARACTRSTC       = "00003300-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT3_DSCRPT            = "00003300-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT4_CHARACTRSTC       = "00003400-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT4_DSCRPT            = "00003400-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT5_CHARACTRSTC       = "00003500-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT5_DSCRPT            = "00003500-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT6_CHARACTRSTC       = "00003600-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT6_DSCRPT            = "00003600-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT7_CHARACTRSTC       = "00003700-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT7_DSCRPT            = "00003700-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT8_CHARACTRSTC       = "00003800-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_OPT8_DSCRPT            = "00003800-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_PEERADDR_CHARACTRSTC   = "00003900-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_APP_RT_PEERADDR_DSCRPT        = "00003900-0001-1000-8000-E776CC14FE69";
+
+static  const int    NUM_HANDLES_STREAM_SERVICE             = 7;                // = (1*Service + 2*Characteristics + 1*Descriptions)
+static  const char*  BLE_UUID_STREAM_SERVICE                = "00004000-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_STREAM_CTRL_CHARACTRSTC       = "00004100-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_STREAM_CTRL_DSCRPT            = "00004100-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_STREAM_DATA_CHARACTRSTC       = "00004200-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_STREAM_DATA_DSCRPT            = "00004200-0001-1000-8000-E776CC14FE69";
+
+static  const int    NUM_HANDLES_OTA_SERVICE                = 7;                // = (1*Service + 2*Characteristics + 1*Descriptions)
+static  const char*  BLE_UUID_OTA_SERVICE                   = "00005000-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_OTA_CTRL_CHARACTRSTC          = "00005100-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_OTA_CTRL_DSCRPT               = "00005100-0001-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_OTA_DATA_CHARACTRSTC          = "00005200-0000-1000-8000-E776CC14FE69";
+static  const char*  BLE_UUID_OTA_DATA_DSCRPT               = "00005200-0001-1000-8000-E776CC14FE69";
+
+
+// 128bit UUIDs of the core services used by the Attribute Table Backend
+// (BLE_GATT_BACKEND_ATTR_TABLE): same values as the strings above, but in
+// the little endian byte order expected by <esp_ble_gatts_create_attr_tab()>
+#define BLE_UUID128(ui16Charac_p, ui16Dscrpt_p)                                                 \
+    { 0x69, 0xFE, 0x14, 0xCC, 0x76, 0xE7, 0x00, 0x80, 0x00, 0x10,                             \
+      (uint8_t)(ui16Dscrpt_p), (uint8_t)((ui16Dscrpt_p) >> 8),                                  \
+      (uint8_t)(ui16Charac_p), (uint8_t)((ui16Charac_p) >> 8), 0x00, 0x00 }
+
+static  const uint8_t  BLE_UUID128_DEVMNT_SERVICE[]                 = BLE_UUID128(0x1000, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_DEVTYPE_CHARACTRSTC[]     = BLE_UUID128(0x1100, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_DEVTYPE_DSCRPT[]          = BLE_UUID128(0x1100, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_SYSTICKCNT_CHARACTRSTC[]  = BLE_UUID128(0x1200, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_SYSTICKCNT_DSCRPT[]       = BLE_UUID128(0x1200, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_DEVNAME_CHARACTRSTC[]     = BLE_UUID128(0x1300, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_DEVNAME_DSCRPT[]          = BLE_UUID128(0x1300, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_SAVE_CFG_CHARACTRSTC[]    = BLE_UUID128(0x1400, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_SAVE_CFG_DSCRPT[]         = BLE_UUID128(0x1400, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_RST_DEV_CHARACTRSTC[]     = BLE_UUID128(0x1500, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_RST_DEV_DSCRPT[]          = BLE_UUID128(0x1500, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_PROFHASH_CHARACTRSTC[]    = BLE_UUID128(0x1600, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_PROFHASH_DSCRPT[]         = BLE_UUID128(0x1600, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_DIAG_CHARACTRSTC[]        = BLE_UUID128(0x1700, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_DIAG_DSCRPT[]             = BLE_UUID128(0x1700, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_CFGPATCH_CHARACTRSTC[]    = BLE_UUID128(0x1800, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_CFGPATCH_DSCRPT[]         = BLE_UUID128(0x1800, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_CFGIMAGE_CHARACTRSTC[]    = BLE_UUID128(0x1900, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_CFGIMAGE_DSCRPT[]         = BLE_UUID128(0x1900, 0x0001);
+static  const uint8_t  BLE_UUID128_DEVMNT_LOG_CHARACTRSTC[]         = BLE_UUID128(0x1A00, 0x0000);
+static  const uint8_t  BLE_UUID128_DEVMNT_LOG_DSCRPT[]              = BLE_UUID128(0x1A00, 0x0001);
+
+static  const uint8_t  BLE_UUID128_WIFI_SERVICE[]                   = BLE_UUID128(0x2000, 0x0000);
+static  const uint8_t  BLE_UUID128_WIFI_SSID_CHARACTRSTC[]          = BLE_UUID128(0x2100, 0x0000);
+static  const uint8_t  BLE_UUID128_WIFI_SSID_DSCRPT[]               = BLE_UUID128(0x2100, 0x0001);
+static  const uint8_t  BLE_UUID128_WIFI_PASSWD_CHARACTRSTC[]        = BLE_UUID128(0x2200, 0x0000);
+static  const uint8_t  BLE_UUID128_WIFI_PASSWD_DSCRPT[]             = BLE_UUID128(0x2200, 0x0001);
+static  const uint8_t  BLE_UUID128_WIFI_OWNADDR_CHARACTRSTC[]       = BLE_UUID128(0x2300, 0x0000);
+static  const uint8_t  BLE_UUID128_WIFI_OWNADDR_DSCRPT[]            = BLE_UUID128(0x2300, 0x0001);
+static  const uint8_t  BLE_UUID128_WIFI_OWNMODE_CHARACTRSTC[]       = BLE_UUID128(0x2400, 0x0000);
+static  const uint8_t  BLE_UUID128_WIFI_OWNMODE_DSCRPT[]            = BLE_UUID128(0x2400, 0x0001);
+static  const uint8_t  BLE_UUID128_WIFI_OWNMODE_DSCRPT_FEATLIST[]   = BLE_UUID128(0x2400, 0x0002);
+
+static  const uint8_t  BLE_UUID128_APP_RT_SERVICE[]                 = BLE_UUID128(0x3000, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT1_CHARACTRSTC[]        = BLE_UUID128(0x3100, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT1_DSCRPT[]             = BLE_UUID128(0x3100, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT2_CHARACTRSTC[]        = BLE_UUID128(0x3200, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT2_DSCRPT[]             = BLE_UUID128(0x3200, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT3_CHARACTRSTC[]        = BLE_UUID128(0x3300, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT3_DSCRPT[]             = BLE_UUID128(0x3300, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT4_CHARACTRSTC[]        = BLE_UUID128(0x3400, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT4_DSCRPT[]             = BLE_UUID128(0x3400, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT5_CHARACTRSTC[]        = BLE_UUID128(0x3500, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT5_DSCRPT[]             = BLE_UUID128(0x3500, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT6_CHARACTRSTC[]        = BLE_UUID128(0x3600, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT6_DSCRPT[]             = BLE_UUID128(0x3600, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT7_CHARACTRSTC[]        = BLE_UUID128(0x3700, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT7_DSCRPT[]             = BLE_UUID128(0x3700, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT8_CHARACTRSTC[]        = BLE_UUID128(0x3800, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_OPT8_DSCRPT[]             = BLE_UUID128(0x3800, 0x0001);
+static  const uint8_t  BLE_UUID128_APP_RT_PEERADDR_CHARACTRSTC[]    = BLE_UUID128(0x3900, 0x0000);
+static  const uint8_t  BLE_UUID128_APP_RT_PEERADDR_DSCRPT[]         = BLE_UUID128(0x3900, 0x0001);
+
+
+// Default Connection Parameters requested during active config transfer (short interval)
+// and after the idle timeout (power-friendly interval)
+static  const tBleConnParams    BLE_DEF_FAST_CONN_PARAMS    = {   6,  12, 0, 400 };     // 7.5..15ms,  Latency 0, Timeout 4s
+static  const tBleConnParams    BLE_DEF_IDLE_CONN_PARAMS    = {  80, 160, 4, 600 };     // 100..200ms, Latency 4, Timeout 6s
+static  const uint32_t          BLE_DEF_IDLE_TIMEOUT        = 10000;                    // [ms]
+static  const uint16_t          BLE_DEF_LOCAL_MTU           = 517;                      // max. MTU supported by Bluedroid
+static  const uint16_t          BLE_DEF_ATT_MTU             = 23;                       // MTU before MTU Exchange
+static  const uint32_t          BLE_DISCONNECT_TIMEOUT      = 500;                      // [ms] wait for disconnect in <ProfileShutdown()>
+static  const uint32_t          BLE_ATTR_TAB_TIMEOUT        = 1000;                     // [ms] wait for creation/start of an attribute table
+static  const unsigned int      BLE_MAX_DESCRIPTORS         = 32;                       // descriptors of all services (currently max. 28)
+static  const unsigned int      BLE_TELEMETRY_MAX_SIZE      = 64;                       // max. size of a telemetry record (limited by MTU too)
+static  const unsigned int      BLE_LOG_MAX_SIZE            = 244;                      // max. size of a log packet (= one LL Data PDU with DLE, limited by MTU too)
+static  const uint32_t          BLE_LOG_NOTIFY_INTERVAL     = 100;                      // [ms] min. interval between two log packets
+
+
+// Revision of the Profile Layout, included in the calculation of the Profile Hash.
+// Must be incremented for each change in the profile which is not reflected by the
+// UUID list below (e.g. changing the properties of a characteristic).
+static  const uint32_t  PROFILE_LAYOUT_REVISION             = 2;               // 2: [DevMnt/Diagnostics] with NOTIFY
+
+// List of all UUIDs in the order of their creation by <ProfileSetup()>
+static  const char*  BLE_PROFILE_UUID_LIST[] =
+{
+    BLE_UUID_DEVMNT_SERVICE,
+    BLE_UUID_DEVMNT_DEVTYPE_CHARACTRSTC,    BLE_UUID_DEVMNT_DEVTYPE_DSCRPT,
+    BLE_UUID_DEVMNT_SYSTICKCNT_CHARACTRSTC, BLE_UUID_DEVMNT_SYSTICKCNT_DSCRPT,
+    BLE_UUID_DEVMNT_DEVNAME_CHARACTRSTC,    BLE_UUID_DEVMNT_DEVNAME_DSCRPT,
+    BLE_UUID_DEVMNT_SAVE_CFG_CHARACTRSTC,   BLE_UUID_DEVMNT_SAVE_CFG_DSCRPT,
+    BLE_UUID_DEVMNT_RST_DEV_CHARACTRSTC,    BLE_UUID_DEVMNT_RST_DEV_DSCRPT,
+    BLE_UUID_DEVMNT_PROFHASH_CHARACTRSTC,   BLE_UUID_DEVMNT_PROFHASH_DSCRPT,
+    BLE_UUID_DEVMNT_DIAG_CHARACTRSTC,       BLE_UUID_DEVMNT_DIAG_DSCRPT,
+    BLE_UUID_DEVMNT_CFGPATCH_CHARACTRSTC,   BLE_UUID_DEVMNT_CFGPATCH_DSCRPT,
+    BLE_UUID_DEVMNT_CFGIMAGE_CHARACTRSTC,   BLE_UUID_DEVMNT_CFGIMAGE_DSCRPT,
+
+    BLE_UUID_WIFI_SERVICE,
+    BLE_UUID_WIFI_SSID_CHARACTRSTC,         BLE_UUID_WIFI_SSID_DSCRPT,
+    BLE_UUID_WIFI_PASSWD_CHARACTRSTC,       BLE_UUID_WIFI_PASSWD_DSCRPT,
+    BLE_UUID_WIFI_OWNADDR_CHARACTRSTC,      BLE_UUID_WIFI_OWNADDR_DSCRPT,
+    BLE_UUID_WIFI_OWNMODE_CHARACTRSTC,      BLE_UUID_WIFI_OWNMODE_DSCRPT,   BLE_UUID_WIFI_OWNMODE_DSCRPT_FEATLIST,
+
+    BLE_UUID_APP_RT_SERVICE,
+    BLE_UUID_APP_RT_OPT1_CHARACTRSTC,       BLE_UUID_APP_RT_OPT1_DSCRPT,
+    BLE_UUID_APP_RT_OPT2_CHARACTRSTC,       BLE_UUID_APP_RT_OPT2_DSCRPT,
+    BLE_UUID_APP_RT_OPT3_CHARACTRSTC,       BLE_UUID_APP_RT_OPT3_DSCRPT,
+    BLE_UUID_APP_RT_OPT4_CHARACTRSTC,       BLE_UUID_APP_RT_OPT4_DSCRPT,
+    BLE_UUID_APP_RT_OPT5_CHARACTRSTC,       BLE_UUID_APP_RT_OPT5_DSCRPT,
+    BLE_UUID_APP_RT_OPT6_CHARACTRSTC,       BLE_UUID_APP_RT_OPT6_DSCRPT,
+    BLE_UUID_APP_RT_OPT7_CHARACTRSTC,       BLE_UUID_APP_RT_OPT7_DSCRPT,
+    BLE_UUID_APP_RT_OPT8_CHARACTRSTC,       BLE_UUID_APP_RT_OPT8_DSCRPT,
+    BLE_UUID_APP_RT_PEERADDR_CHARACTRSTC,   BLE_UUID_APP_RT_PEERADDR_DSCRPT
+};
+
+// List of all UUIDs of the optional service [Stream]
+static  const char*  BLE_PROFILE_STREAM_UUID_LIST[] =
+{
+    BLE_UUID_STREAM_SERVICE,
+    BLE_UUID_STREAM_CTRL_CHARACTRSTC,       BLE_UUID_STREAM_CTRL_DSCRPT,
+    BLE_UUID_STREAM_DATA_CHARACTRSTC,       BLE_UUID_STREAM_DATA_DSCRPT
+};
+
+// List of all UUIDs of the optional characteristic [DevMnt/Log]
+static  const char*  BLE_PROFILE_LOG_UUID_LIST[] =
+{
+    BLE_UUID_DEVMNT_LOG_CHARACTRSTC,        BLE_UUID_DEVMNT_LOG_DSCRPT
+};
+
+// List of all UUIDs of the optional service [OTA]
+static  const char*  BLE_PROFILE_OTA_UUID_LIST[] =
+{
+    BLE_UUID_OTA_SERVICE,
+    BLE_UUID_OTA_CTRL_CHARACTRSTC,          BLE_UUID_OTA_CTRL_DSCRPT,
+    BLE_UUID_OTA_DATA_CHARACTRSTC,          BLE_UUID_OTA_DATA_DSCRPT
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+// The main class ESP32BleCfgProfile and the local callback classes declared
+// below require common access to the variables created here. For this reason,
+// the variables cannot be declared as members of the class ESP32BleCfgProfile,
+// but must be created as module local variables.
+
+static  bool                fBleClientConnected_g           = false;
+
+static  tBleConnParams      BleFastConnParams_g             = BLE_DEF_FAST_CONN_PARAMS;
+static  tBleConnParams      BleIdleConnParams_g             = BLE_DEF_IDLE_CONN_PARAMS;
+static  uint32_t            ui32BleIdleTimeout_g            = BLE_DEF_IDLE_TIMEOUT;
+static  uint16_t            ui16BleLocalMtu_g               = BLE_DEF_LOCAL_MTU;
+static  esp_bd_addr_t       abBleRemoteBda_g                = { 0 };
+static  tBleConnInfo        BleConnInfo_g                   = { 0 };
+static  unsigned long       ulBleConnectTick_g              = 0;
+static  volatile unsigned long  ulBleLastActivityTick_g     = 0;
+static  uint32_t            ui32BleCfgModeTimeout_g         = 0;            // [ms] 0 -> Config Mode never times out
+static  volatile unsigned long  ulBleCfgModeActivityTick_g  = 0;            // last connect, disconnect or write
+static  bool                fBleCfgModeTimedOut_g           = false;
+
+static  tCbHdlrSaveConfig   pfnAppCbHdlrSaveConfig_g        = NULL;
+static  tCbHdlrRestartDev   pfnAppCbHdlrRestartDev_g        = NULL;
+static  tCbHdlrConStatChg   pfnAppCbHdlrConStatChg_g        = NULL;
+static  tCbHdlrStreamDone   pfnAppCbHdlrStreamDone_g        = NULL;
+static  tCbHdlrOtaDone      pfnAppCbHdlrOtaDone_g           = NULL;
+static  tCbHdlrTelemetry    pfnAppCbHdlrTelemetry_g         = NULL;         // NULL -> no telemetry notifications
+static  tCbHdlrLogSource    pfnAppCbHdlrLogSource_g         = NULL;         // NULL -> [DevMnt/Log] disabled
+static  volatile bool       fBleLogStarted_g                = false;        // log stream started by the client
+static  unsigned long       ulBleLogNotifyTick_g            = 0;
+
+static  const char*         pszStreamPartLabel_g            = NULL;         // NULL -> service [Stream] disabled
+static  bool                fOtaEnabled_g                   = false;
+static  uint8_t             ui8BleGattBackend_g             = BLE_GATT_BACKEND_OBJECTS;
+static  uint32_t            ui32BleGattSetupTime_g          = 0;            // [us] creation of the core services
+
+static  BLEServer*          pBleServer_g                    = NULL;
+static  volatile bool       fBleShutdownActive_g            = false;        // <ProfileShutdown()> running -> no restart of advertising
+static  bool                fBleMemReleased_g               = false;        // BT Controller (and Host) memory released -> no further BLEDevice::init()
+
+static  BLEService*         pBleServiceDevMnt_g             = NULL;
+static  BLECharacteristic*  pBleCharacDevMntDevType_g       = NULL;
+static  BLECharacteristic*  pBleCharacDevMntSysTickCnt_g    = NULL;
+static  BLECharacteristic*  pBleCharacDevMntDevName_g       = NULL;
+static  BLECharacteristic*  pBleCharacDevMntSaveCfg_g       = NULL;
+static  BLECharacteristic*  pBleCharacDevMntRstDev_g        = NULL;
+static  BLECharacteristic*  pBleCharacDevMntProfHash_g      = NULL;
+static  BLECharacteristic*  pBleCharacDevMntDiag_g          = NULL;
+static  BLECharacteristic*  pBleCharacDevMntCfgPatch_g      = NULL;
+static  BLECharacteristic*  pBleCharacDevMntCfgImage_g      = NULL;
+static  BLECharacteristic*  pBleCharacDevMntLog_g           = NULL;
+
+static  BLEService*         pBleServiceWifi_g               = NULL;
+static  BLECharacteristic*  pBleCharacWifiSSID_g            = NULL;
+static  BLECharacteristic*  pBleCharacWifiPasswd_g          = NULL;
+static  BLECharacteristic*  pBleCharacWifiOwnAddr_g         = NULL;
+static  BLECharacteristic*  pBleCharacWifiOwnMode_g         = NULL;
+
+static  BLEService*         pBleServiceAppRt_g              = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt1_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt2_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt3_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt4_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt5_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt6_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt7_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtOpt8_g           = NULL;
+static  BLECharacteristic*  pBleCharacAppRtPeerAddr_g       = NULL;
+
+static  BLEService*         pBleServiceStream_g             = NULL;
+static  BLECharacteristic*  pBleCharacStreamCtrl_g          = NULL;
+static  BLECharacteristic*  pBleCharacStreamData_g          = NULL;
+
+static  BLEService*         pBleServiceOta_g                = NULL;
+static  BLECharacteristic*  pBleCharacOtaCtrl_g             = NULL;
+static  BLECharacteristic*  pBleCharacOtaData_g             = NULL;
+
+// Descriptors are neither deleted nor accessible by the BLE library, so they are recorded for <DeleteBleObjects()>
+static  BLEDescriptor*      apBleDescriptor_g[BLE_MAX_DESCRIPTORS];
+static  unsigned int        uiBleDescriptorCnt_g            = 0;
+
+// Attribute Handles of the core services, only used by BLE_GATT_BACKEND_ATTR_TABLE
+static  esp_gatt_if_t       BleGattsIf_g                    = ESP_GATT_IF_NONE;
+static  uint16_t            aui16AttrHdlService_g[3]        = { 0 };        // DevMnt, Wifi, AppRt
+static  uint16_t            aui16AttrNumHdl_g[3]            = { 0 };
+static  uint16_t            ui16AttrHdlDevMntSysTickCnt_g   = 0;
+static  uint16_t            ui16AttrHdlDevMntDevName_g      = 0;
+static  uint16_t            ui16AttrHdlDevMntSaveCfg_g      = 0;
+static  uint16_t            ui16AttrHdlDevMntRstDev_g       = 0;
+static  uint16_t            ui16AttrHdlDevMntDiag_g         = 0;
+static  uint16_t            ui16AttrHdlDevMntCfgPatch_g     = 0;
+static  uint16_t            ui16AttrHdlDevMntCfgImage_g     = 0;
+static  uint16_t            ui16AttrHdlDevMntLog_g          = 0;
+static  uint16_t            ui16AttrHdlWifiSSID_g           = 0;
+static  uint16_t            ui16AttrHdlWifiPasswd_g         = 0;
+static  uint16_t            ui16AttrHdlWifiOwnAddr_g        = 0;
+static  uint16_t            ui16AttrHdlWifiOwnMode_g        = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt1_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt2_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt3_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt4_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt5_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt6_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt7_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtOpt8_g          = 0;
+static  uint16_t            ui16AttrHdlAppRtPeerAddr_g      = 0;
+static  SemaphoreHandle_t   hBleAttrTabEvent_g              = NULL;         // signals CREAT_ATTR_TAB_EVT / START_EVT
+
+
+static  uint32_t            ui32DevMntDevType_g             = 0;
+static  uint32_t            ui32DevMntSysTickCnt_g          = 0;
+static  char                szDevMntDevName_g[32]           = { '\0' };     // "{ESP32_BLE_DEVICE}"
+static  uint32_t            ui32DevMntProfHash_g            = 0;
+static  uint8_t             abDevMntDiag_g[STATS_BLOB_SIZE];
+static  uint8_t             abDevMntTelemetry_g[BLE_TELEMETRY_MAX_SIZE];
+static  uint8_t             abDevMntLog_g[BLE_LOG_MAX_SIZE];
+static  uint8_t             abDevMntCfgPatchRsp_g[CFG_PATCH_RSP_SIZE];
+static  uint8_t             abDevMntCfgImage_g[CFG_IMAGE_MAX_SIZE];
+static  uint16_t            ui16DevMntDiagLen_g             = 0;            // length of the values above (BLE_GATT_BACKEND_ATTR_TABLE only)
+static  uint16_t            ui16DevMntCfgPatchRspLen_g      = 0;
+static  uint16_t            ui16DevMntCfgImageLen_g         = 0;
+
+static  char                szWifiSSID_g[32]                = { '\0' };     // "{Enter WIFI SSID Name}"
+static  char                szWifiPasswd_g[64]              = { '\0' };     // "{Enter WIFI Password}"
+static  char                szWifiOwnAddr_g[24]             = { '\0' };     // "{0.0.0.0:0}"
+static  uint16_t            ui16WifiOwnMode_g               = 0;            // WIFI_OPMODE_STA / WIFI_OPMODE_AP
+static  uint16_t            ui16WifiOwnModeFeatList_g       = 0;
+
+static  uint16_t            ui16AppRtCharacMask_g           = 0x01FF;       // Bit[n] = 1 -> characteristic #n+1 of [AppRt] is created
+static  uint16_t            ui16AppRtNumHandles_g           = 0;            // handles of [AppRt] for the current labels
+
+static  uint16_t            ui16AppRtOpt1_g                 = 0;
+static  uint16_t            ui16AppRtOpt2_g                 = 0;
+static  uint16_t            ui16AppRtOpt3_g                 = 0;
+static  uint16_t            ui16AppRtOpt4_g                 = 0;
+static  uint16_t            ui16AppRtOpt5_g                 = 0;
+static  uint16_t            ui16AppRtOpt6_g                 = 0;
+static  uint16_t            ui16AppRtOpt7_g                 = 0;
+static  uint16_t            ui16AppRtOpt8_g                 = 0;
+static  char                szAppRtPeerAddr_g[24]           = { '\0' };     // "{0.0.0.0:0}"
+
+static  uint8_t             abStreamRsp_g[STREAM_RSP_SIZE];
+
+// Prepared Write (Long Write) of a value answered by the application (BLE_GATT_BACKEND_ATTR_TABLE only)
+static  uint8_t             abBlePrepWriteBuff_g[CFG_IMAGE_MAX_SIZE];
+static  uint16_t            ui16BlePrepWriteHdl_g           = 0;            // 0 -> no Prepared Write pending
+static  uint16_t            ui16BlePrepWriteLen_g           = 0;
+static  esp_gatt_status_t   BlePrepWriteStatus_g            = ESP_GATT_OK;
+static  esp_gatt_rsp_t      BleGattRsp_g;                                   // too large for the stack of the BTC task
+
+
+// Characteristics holding configuration values: a value written by the client is
+// validated in <BleCharacteristicCfgValueCallbacks::onWrite()>, a value changed by
+// the server (see <WriteDataToBleCharacterisics()>) is notified by <ProfileLoop()>
+typedef struct
+{
+
+    BLECharacteristic**     m_ppBleCharac;              // BLE_GATT_BACKEND_OBJECTS
+    uint16_t*               m_pui16AttrHdl;             // BLE_GATT_BACKEND_ATTR_TABLE
+    uint8_t                 m_ui8FieldId;               // CFG_FIELD_xxx
+    void*                   m_pvWorkspace;              // value in the instance workspace
+    uint8_t                 m_ui8WorkspaceSize;
+
+} tBleCfgCharac;
+
+#define BLE_CFG_CHARAC_IDX_DEVMNT_DEVNAME   0
+#define BLE_CFG_CHARAC_IDX_WIFI_SSID        1
+#define BLE_CFG_CHARAC_IDX_WIFI_PASSWD      2
+#define BLE_CFG_CHARAC_IDX_WIFI_OWNADDR     3
+#define BLE_CFG_CHARAC_IDX_WIFI_OWNMODE     4
+#define BLE_CFG_CHARAC_IDX_APP_RT_OPT1      5       // Opt1..8 -> 5..12
+#define BLE_CFG_CHARAC_IDX_APP_RT_PEERADDR  13
+
+static  const tBleCfgCharac  BLE_CFG_CHARAC_LIST[] =
+{
+    { &pBleCharacDevMntDevName_g,    &ui16AttrHdlDevMntDevName_g,  CFG_FIELD_DEVMNT_DEVNAME,     szDevMntDevName_g,        sizeof(szDevMntDevName_g) },
+    { &pBleCharacWifiSSID_g,         &ui16AttrHdlWifiSSID_g,       CFG_FIELD_WIFI_SSID,          szWifiSSID_g,             sizeof(szWifiSSID_g) },
+    { &pBleCharacWifiPasswd_g,       &ui16AttrHdlWifiPasswd_g,     CFG_FIELD_WIFI_PASSWD,        szWifiPasswd_g,           sizeof(szWifiPasswd_g) },
+    { &pBleCharacWifiOwnAddr_g,      &ui16AttrHdlWifiOwnAddr_g,    CFG_FIELD_WIFI_OWNADDR,       szWifiOwnAddr_g,          sizeof(szWifiOwnAddr_g) },
+    { &pBleCharacWifiOwnMode_g,      &ui16AttrHdlWifiOwnMode_g,    CFG_FIELD_WIFI_OWNMODE,       &ui16WifiOwnMode_g,       sizeof(ui16WifiOwnMode_g) },
+    { &pBleCharacAppRtOpt1_g,        &ui16AttrHdlAppRtOpt1_g,      CFG_FIELD_APP_RT_OPT1,        &ui16AppRtOpt1_g,         sizeof(ui16AppRtOpt1_g) },
+    { &pBleCharacAppRtOpt2_g,        &ui16AttrHdlAppRtOpt2_g,      CFG_FIELD_APP_RT_OPT2,        &ui16AppRtOpt2_g,         sizeof(ui16AppRtOpt2_g) },
+    { &pBleCharacAppRtOpt3_g,        &ui16AttrHdlAppRtOpt3_g,      CFG_FIELD_APP_RT_OPT3,        &ui16AppRtOpt3_g,         sizeof(ui16AppRtOpt3_g) },
+    { &pBleCharacAppRtOpt4_g,        &ui16AttrHdlAppRtOpt4_g,      CFG_FIELD_APP_RT_OPT4,        &ui16AppRtOpt4_g,         sizeof(ui16AppRtOpt4_g) },
+    { &pBleCharacAppRtOpt5_g,        &ui16AttrHdlAppRtOpt5_g,      CFG_FIELD_APP_RT_OPT5,        &ui16AppRtOpt5_g,         sizeof(ui16AppRtOpt5_g) },
+    { &pBleCharacAppRtOpt6_g,        &ui16AttrHdlAppRtOpt6_g,      CFG_FIELD_APP_RT_OPT6,        &ui16AppRtOpt6_g,         sizeof(ui16AppRtOpt6_g) },
+    { &pBleCharacAppRtOpt7_g,        &ui16AttrHdlAppRtOpt7_g,      CFG_FIELD_APP_RT_OPT7,        &ui16AppRtOpt7_g,         sizeof(ui16AppRtOpt7_g) },
+    { &pBleCharacAppRtOpt8_g,        &ui16AttrHdlAppRtOpt8_g,      CFG_FIELD_APP_RT_OPT8,        &ui16AppRtOpt8_g,         sizeof(ui16AppRtOpt8_g) },
+    { &pBleCharacAppRtPeerAddr_g,    &ui16AttrHdlAppRtPeerAddr_g,  CFG_FIELD_APP_RT_PEERADDR,    szAppRtPeerAddr_g,        sizeof(szAppRtPeerAddr_g) }
+};
+
+#define BLE_CFG_CHARAC_LIST_LEN         (sizeof(BLE_CFG_CHARAC_LIST) / sizeof(BLE_CFG_CHARAC_LIST[0]))
+
+static  volatile uint32_t   ui32BleNotifyPending_g          = 0;            // Bit[BLE_CFG_CHARAC_IDX_xxx] = 1 -> notify pending
+static  uint32_t            aui32BleCfgCharacCrc_g[BLE_CFG_CHARAC_LIST_LEN];    // last value set (BLE_GATT_BACKEND_ATTR_TABLE only)
+
+
+
+//---------------------------------------------------------------------------
+//  Attribute Tables of the core services (BLE_GATT_BACKEND_ATTR_TABLE)
+//---------------------------------------------------------------------------
+//
+// Each service is described by a constant table, which is registered with one
+// single call of <esp_ble_gatts_create_attr_tab()> instead of one call per
+// attribute. The tables contain exactly the same attributes in the same order
+// as created by the object based backend, so the resulting layout (and with
+// it the Profile Hash) does not depend on the backend.
+//
+// Each characteristic consists of 3 entries: declaration, value and label
+// descriptor. Values which are constant during the session are answered by the
+// stack itself (ESP_GATT_AUTO_RSP). All other values are answered from the
+// instance workspace by <BleAttrTabEventHandler()> (ESP_GATT_RSP_BY_APP), so
+// the stack holds no copy of them.
+//
+// The table of [APP RT Config] is only a template: its labels are provided by
+// the application at runtime, so the table is completed on the stack of
+// <CreateAttrTables()> before it is registered.
+//
+
+static  const uint16_t  BLE_ATTR_UUID_PRI_SERVICE           = ESP_GATT_UUID_PRI_SERVICE;
+static  const uint16_t  BLE_ATTR_UUID_CHARAC_DECL           = ESP_GATT_UUID_CHAR_DECLARE;
+static  const uint8_t   BLE_ATTR_PROP_READ                  = ESP_GATT_CHAR_PROP_BIT_READ;
+static  const uint8_t   BLE_ATTR_PROP_READ_NOTIFY           = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static  const uint8_t   BLE_ATTR_PROP_WRITE                 = ESP_GATT_CHAR_PROP_BIT_WRITE;
+static  const uint8_t   BLE_ATTR_PROP_WRITE_NOTIFY          = ESP_GATT_CHAR_PROP_BIT_WRITE | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static  const uint8_t   BLE_ATTR_PROP_READ_WRITE_NOTIFY     = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+
+#define BLE_ATTR_SERVICE(pabUuid_p)                                                             \
+    { { ESP_GATT_AUTO_RSP  }, { ESP_UUID_LEN_16,  (uint8_t*)&BLE_ATTR_UUID_PRI_SERVICE, ESP_GATT_PERM_READ, ESP_UUID_LEN_128, ESP_UUID_LEN_128, (uint8_t*)(pabUuid_p) } }
+
+#define BLE_ATTR_CHARAC(pui8Prop_p)                                                             \
+    { { ESP_GATT_AUTO_RSP  }, { ESP_UUID_LEN_16,  (uint8_t*)&BLE_ATTR_UUID_CHARAC_DECL, ESP_GATT_PERM_READ, sizeof(uint8_t), sizeof(uint8_t), (uint8_t*)(pui8Prop_p) } }
+
+#define BLE_ATTR_CONST(pabUuid_p, pValue_p, Size_p)                                             \
+    { { ESP_GATT_AUTO_RSP  }, { ESP_UUID_LEN_128, (uint8_t*)(pabUuid_p), ESP_GATT_PERM_READ, (Size_p), (Size_p), (uint8_t*)(pValue_p) } }
+
+#define BLE_ATTR_LABEL(pabUuid_p, pszLabel_p)                                                   \
+    BLE_ATTR_CONST(pabUuid_p, pszLabel_p, sizeof(pszLabel_p) - 1)
+
+#define BLE_ATTR_BY_APP(pabUuid_p, ui16Perm_p)                                                  \
+    { { ESP_GATT_RSP_BY_APP }, { ESP_UUID_LEN_128, (uint8_t*)(pabUuid_p), (ui16Perm_p), 0, 0, NULL } }
+
+#define BLE_ATTR_PERM_RW                    (ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE)
+
+#define BLE_ATTR_TAB_IDX_DEVMNT             0       // index in aui16AttrHdlService_g[] and service instance id
+#define BLE_ATTR_TAB_IDX_WIFI               1
+#define BLE_ATTR_TAB_IDX_APP_RT             2
+#define BLE_ATTR_TAB_NUM                    3
+
+static  const esp_gatts_attr_db_t  BLE_ATTR_TAB_DEVMNT[] =
+{
+    BLE_ATTR_SERVICE (BLE_UUID128_DEVMNT_SERVICE),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ),
+    BLE_ATTR_CONST   (BLE_UUID128_DEVMNT_DEVTYPE_CHARACTRSTC, &ui32DevMntDevType_g, sizeof(ui32DevMntDevType_g)),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_DEVTYPE_DSCRPT, "Device Type"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_SYSTICKCNT_CHARACTRSTC, ESP_GATT_PERM_READ),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_SYSTICKCNT_DSCRPT, "System Tick Count"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_DEVNAME_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_DEVNAME_DSCRPT, "Device Name"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_WRITE),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_SAVE_CFG_CHARACTRSTC, ESP_GATT_PERM_WRITE),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_SAVE_CFG_DSCRPT, "Save Conig"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_WRITE),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_RST_DEV_CHARACTRSTC, ESP_GATT_PERM_WRITE),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_RST_DEV_DSCRPT, "Restart Device"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ),
+    BLE_ATTR_CONST   (BLE_UUID128_DEVMNT_PROFHASH_CHARACTRSTC, &ui32DevMntProfHash_g, sizeof(ui32DevMntProfHash_g)),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_PROFHASH_DSCRPT, "Profile Hash"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_DIAG_CHARACTRSTC, ESP_GATT_PERM_READ),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_DIAG_DSCRPT, "Diagnostics"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_CFGPATCH_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_CFGPATCH_DSCRPT, "Config Patch"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_CFGIMAGE_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_CFGIMAGE_DSCRPT, "Config Image"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_WRITE_NOTIFY),                                 // must be the last 3 entries (omitted without <EnableLog()>)
+    BLE_ATTR_BY_APP  (BLE_UUID128_DEVMNT_LOG_CHARACTRSTC, ESP_GATT_PERM_WRITE),
+    BLE_ATTR_LABEL   (BLE_UUID128_DEVMNT_LOG_DSCRPT, "Log")
+};
+
+static  const esp_gatts_attr_db_t  BLE_ATTR_TAB_WIFI[] =
+{
+    BLE_ATTR_SERVICE (BLE_UUID128_WIFI_SERVICE),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_WIFI_SSID_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_WIFI_SSID_DSCRPT, "WIFI SSID"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_WIFI_PASSWD_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_WIFI_PASSWD_DSCRPT, "WIFI PASSWD"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_WIFI_OWNADDR_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_WIFI_OWNADDR_DSCRPT, "Own Address"),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_WIFI_OWNMODE_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_LABEL   (BLE_UUID128_WIFI_OWNMODE_DSCRPT, "Own Mode"),
+    BLE_ATTR_CONST   (BLE_UUID128_WIFI_OWNMODE_DSCRPT_FEATLIST, &ui16WifiOwnModeFeatList_g, sizeof(ui16WifiOwnModeFeatList_g))     // must be the last entry (omitted without <tAppDescriptData>)
+};
+
+static  const esp_gatts_attr_db_t  BLE_ATTR_TAB_APP_RT[] =
+{
+    BLE_ATTR_SERVICE (BLE_UUID128_APP_RT_SERVICE),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT1_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT1_DSCRPT, NULL, 0),                     // label set at runtime
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT2_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT2_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT3_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT3_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT4_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT4_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT5_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT5_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT6_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT6_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT7_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT7_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_OPT8_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_OPT8_DSCRPT, NULL, 0),
+
+    BLE_ATTR_CHARAC  (&BLE_ATTR_PROP_READ_WRITE_NOTIFY),
+    BLE_ATTR_BY_APP  (BLE_UUID128_APP_RT_PEERADDR_CHARACTRSTC, BLE_ATTR_PERM_RW),
+    BLE_ATTR_CONST   (BLE_UUID128_APP_RT_PEERADDR_DSCRPT, NULL, 0)
+};
+
+#define BLE_ATTR_TAB_LEN(Tab_p)             (sizeof(Tab_p) / sizeof(Tab_p[0]))
+
+// Handles resolved from the value entries of the tables after their creation
+typedef struct
+{
+
+    const uint8_t*          m_pabUuid;
+    uint16_t*               m_pui16AttrHdl;
+
+} tBleAttrHdlRef;
+
+static  const tBleAttrHdlRef  BLE_ATTR_HDL_REF_LIST[] =
+{
+    { BLE_UUID128_DEVMNT_SYSTICKCNT_CHARACTRSTC,    &ui16AttrHdlDevMntSysTickCnt_g  },
+    { BLE_UUID128_DEVMNT_DEVNAME_CHARACTRSTC,       &ui16AttrHdlDevMntDevName_g     },
+    { BLE_UUID128_DEVMNT_SAVE_CFG_CHARACTRSTC,      &ui16AttrHdlDevMntSaveCfg_g     },
+    { BLE_UUID128_DEVMNT_RST_DEV_CHARACTRSTC,       &ui16AttrHdlDevMntRstDev_g      },
+    { BLE_UUID128_DEVMNT_DIAG_CHARACTRSTC,          &ui16AttrHdlDevMntDiag_g        },
+    { BLE_UUID128_DEVMNT_CFGPATCH_CHARACTRSTC,      &ui16AttrHdlDevMntCfgPatch_g    },
+    { BLE_UUID128_DEVMNT_CFGIMAGE_CHARACTRSTC,      &ui16AttrHdlDevMntCfgImage_g    },
+    { BLE_UUID128_DEVMNT_LOG_CHARACTRSTC,           &ui16AttrHdlDevMntLog_g         },
+    { BLE_UUID128_WIFI_SSID_CHARACTRSTC,            &ui16AttrHdlWifiSSID_g          },
+    { BLE_UUID128_WIFI_PASSWD_CHARACTRSTC,          &ui16AttrHdlWifiPasswd_g        },
+    { BLE_UUID128_WIFI_OWNADDR_CHARACTRSTC,         &ui16AttrHdlWifiOwnAddr_g       },
+    { BLE_UUID128_WIFI_OWNMODE_CHARACTRSTC,         &ui16AttrHdlWifiOwnMode_g       },
+    { BLE_UUID128_APP_RT_OPT1_CHARACTRSTC,          &ui16AttrHdlAppRtOpt1_g         },
+    { BLE_UUID128_APP_RT_OPT2_CHARACTRSTC,          &ui16AttrHdlAppRtOpt2_g         },
+    { BLE_UUID128_APP_RT_OPT3_CHARACTRSTC,          &ui16AttrHdlAppRtOpt3_g         },
+    { BLE_UUID128_APP_RT_OPT4_CHARACTRSTC,          &ui16AttrHdlAppRtOpt4_g         },
+    { BLE_UUID128_APP_RT_OPT5_CHARACTRSTC,          &ui16AttrHdlAppRtOpt5_g         },
+    { BLE_UUID128_APP_RT_OPT6_CHARACTRSTC,          &ui16AttrHdlAppRtOpt6_g         },
+    { BLE_UUID128_APP_RT_OPT7_CHARACTRSTC,          &ui16AttrHdlAppRtOpt7_g         },
+    { BLE_UUID128_APP_RT_OPT8_CHARACTRSTC,          &ui16AttrHdlAppRtOpt8_g         },
+    { BLE_UUID128_APP_RT_PEERADDR_CHARACTRSTC,      &ui16AttrHdlAppRtPeerAddr_g     }
+};
+
+// Table of [AppRt] as registered, completed by <CreateAttrTables()> with the labels of the
+// application (static, so it stays valid even for an ESP_GATTS_CREAT_ATTR_TAB_EVT after a timeout)
+static_assert(BLE_ATTR_TAB_LEN(BLE_ATTR_TAB_APP_RT) == (1 + (9 * 3)), "[AppRt]: service + 9 * (declaration, value, label)");
+static  esp_gatts_attr_db_t         aBleAttrTabAppRt_g[BLE_ATTR_TAB_LEN(BLE_ATTR_TAB_APP_RT)];
+
+// Tables given to <esp_ble_gatts_create_attr_tab()>, set only while <CreateAttrTables()> waits for ESP_GATTS_CREAT_ATTR_TAB_EVT
+static  const esp_gatts_attr_db_t*  apBleAttrTab_g[BLE_ATTR_TAB_NUM];
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Functions
+//---------------------------------------------------------------------------
+
+static  void  BleRequestConnParams (const tBleConnParams* pConnParams_p);
+static  void  BleGetCharacString (BLECharacteristic* pBleCharac_p, char* pszBuff_p, size_t BuffSize_p);
+static  void  BleUpdateCharacValue (unsigned int uiNotifyIdx_p, const void* pData_p, size_t DataLen_p);
+static  void  BleNotifyCharacValue (BLECharacteristic* pBleCharac_p, uint16_t ui16AttrHdl_p, const void* pData_p, size_t DataLen_p);
+static  const uint8_t*  BleGetCfgValue (unsigned int uiCfgIdx_p, size_t* pDataLen_p);
+static  int   BleCheckCfgValue (unsigned int uiCfgIdx_p, const uint8_t* pabData_p, size_t DataLen_p);
+static  void  BleOnCfgValueWritten ();
+static  void  BleOnSaveConfig ();
+static  void  BleOnRestartDev ();
+static  int   BleOnDiagRead ();
+static  int   BleOnCfgPatchWrite (const uint8_t* pabPatch_p, unsigned int uiPatchLen_p);
+static  int   BleOnCfgImageRead ();
+static  int   BleOnCfgImageWrite (const uint8_t* pabImage_p, unsigned int uiImageLen_p);
+static  void  BleOnLogWrite (const uint8_t* pabData_p, unsigned int uiDataLen_p);
+static  void  BleOtaSendRsp (const uint8_t* pabRsp_p, unsigned int uiRspLen_p);
+static  void  BleGapEventHandler (esp_gap_ble_cb_event_t Event_p, esp_ble_gap_cb_param_t* pParam_p);
+static  void  BleGattsEventHandler (esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p);
+static  void  BleAttrTabEventHandler (esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p);
+static  void  BleAttrTabRead (esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p);
+static  esp_gatt_status_t  BleAttrTabCheckWrite (uint16_t ui16AttrHdl_p, const uint8_t* pabData_p, uint16_t ui16DataLen_p);
+static  void  BleAttrTabWrite (uint16_t ui16AttrHdl_p, const uint8_t* pabData_p, uint16_t ui16DataLen_p);
+static  bool  BleAttrTabIsOwnHandle (uint16_t ui16AttrHdl_p);
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          B L E   C A L L B A C K   C L A S S E S                        //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  Class BleServerAppCallbacks
+//---------------------------------------------------------------------------
+
+class  BleServerAppCallbacks : public BLEServerCallbacks
+{
+
+    void onConnect(BLEServer* pBleServer_p)
+    {
+        unsigned long  ulStartTime = micros();
+
+        fBleClientConnected_g = true;
+        ulBleCfgModeActivityTick_g = millis();
+        ESP32BleCfgStats::IncCounter(STATS_CNT_CONNECT);
+        ESP32BleCfgStats::SetRadioState(STATS_RADIO_CONNECTED);
+
+        if (pfnAppCbHdlrConStatChg_g != NULL)
+        {
+            pfnAppCbHdlrConStatChg_g(fBleClientConnected_g);
+        }
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_CONNECT, (uint32_t)(micros() - ulStartTime));
+        return;
+    };
+
+    //-------------------------------------------------------------------
+    void onConnect(BLEServer* pBleServer_p, esp_ble_gatts_cb_param_t* pParam_p)
+    {
+        memcpy(abBleRemoteBda_g, pParam_p->connect.remote_bda, sizeof(abBleRemoteBda_g));
+
+        ulBleConnectTick_g      = millis();
+        ulBleLastActivityTick_g = ulBleConnectTick_g;
+
+        BleConnInfo_g.m_fClientConnected    = true;
+        BleConnInfo_g.m_ui16Mtu             = BLE_DEF_ATT_MTU;
+        BleConnInfo_g.m_ui16ConnInterval    = pParam_p->connect.conn_params.interval;
+        BleConnInfo_g.m_ui16SlaveLatency    = pParam_p->connect.conn_params.latency;
+        BleConnInfo_g.m_ui16SupervTimeout   = pParam_p->connect.conn_params.timeout;
+        BleConnInfo_g.m_ui32SessionDuration = 0;
+        TRACE3("BLE Connect: ConnInterval=%u, Latency=%u, Timeout=%u\n", BleConnInfo_g.m_ui16ConnInterval, BleConnInfo_g.m_ui16SlaveLatency, BleConnInfo_g.m_ui16SupervTimeout);
+
+        // request short Connection Interval for the config transfer
+        BleRequestConnParams(&BleFastConnParams_g);
+        BleConnInfo_g.m_fFastParamsActive = true;
+        return;
+    };
+
+    //-------------------------------------------------------------------
+    void onDisconnect(BLEServer* pBleServer_p)
+    {
+        unsigned long  ulStartTime = micros();
+
+        fBleClientConnected_g = false;
+        fBleLogStarted_g      = false;
+        ulBleCfgModeActivityTick_g = millis();
+
+        // the BLE library doesn't restart advertising after a disconnect (not wanted during <ProfileShutdown()>)
+        if (!fBleShutdownActive_g && (pBleServer_g != NULL))
+        {
+            pBleServer_g->startAdvertising();
+            ESP32BleCfgStats::SetRadioState(STATS_RADIO_ADVERTISING);
+        }
+
+        BleConnInfo_g.m_fClientConnected    = false;
+        BleConnInfo_g.m_fFastParamsActive   = false;
+        BleConnInfo_g.m_ui32SessionDuration = (uint32_t)(millis() - ulBleConnectTick_g);
+        TRACE4("BLE Disconnect: SessionDuration=%lu ms, MTU=%u, ConnInterval=%u, Latency=%u\n", (unsigned long)BleConnInfo_g.m_ui32SessionDuration, BleConnInfo_g.m_ui16Mtu, BleConnInfo_g.m_ui16ConnInterval, BleConnInfo_g.m_ui16SlaveLatency);
+
+        if (pfnAppCbHdlrConStatChg_g != NULL)
+        {
+            pfnAppCbHdlrConStatChg_g(fBleClientConnected_g);
+        }
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_DISCONNECT, (uint32_t)(micros() - ulStartTime));
+        return;
+    };
+
+    //-------------------------------------------------------------------
+    void onMtuChanged(BLEServer* pBleServer_p, esp_ble_gatts_cb_param_t* pParam_p)
+    {
+        unsigned long  ulStartTime = micros();
+
+        BleConnInfo_g.m_ui16Mtu = pParam_p->mtu.mtu;
+        TRACE1("BLE MTU Changed: MTU=%u\n", BleConnInfo_g.m_ui16Mtu);
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_MTU_CHANGED, (uint32_t)(micros() - ulStartTime));
+        return;
+    };
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicCfgValueCallbacks
+//---------------------------------------------------------------------------
+//  Validates a value written by the client to a configuration characteristic
+//  (see ESP32BleCfgFields::CheckField). A valid value is taken over into the
+//  instance workspace immediately. An invalid value is replaced by the last
+//  valid value, which is notified back to the client. So an invalid value is
+//  never saved, and the client sees the rejection within the same connection
+//  event instead of a failed WiFi join after the next restart.
+//
+//  NOTE: The BLE library sends the write response before calling onWrite(),
+//  so an ATT Application Error can not be returned from here. The reverted
+//  value notified by <ProfileLoop()> signals the rejection instead.
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicCfgValueCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        unsigned long  ulStartTime = micros();
+        unsigned int   uiIdx;
+        int            iStatus;
+
+        for (uiIdx=0; uiIdx<BLE_CFG_CHARAC_LIST_LEN; uiIdx++)
+        {
+            if (*BLE_CFG_CHARAC_LIST[uiIdx].m_ppBleCharac == pBleCharacteristic_p)
+            {
+                break;
+            }
+        }
+        if (uiIdx >= BLE_CFG_CHARAC_LIST_LEN)
+        {
+            return;
+        }
+
+        iStatus = BleCheckCfgValue(uiIdx, pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength());
+        if (iStatus == CFG_STATUS_OK)
+        {
+            ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
+            BleOnCfgValueWritten();
+        }
+        else
+        {
+            TRACE2("Write to Field 0x%02X rejected (Status=%d) -> revert to last valid value\n", BLE_CFG_CHARAC_LIST[uiIdx].m_ui8FieldId, iStatus);
+            ESP32BleCfgProfile::WriteDataToBleCharacterisics();
+        }
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_CFG_VALUE, (uint32_t)(micros() - ulStartTime));
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicDevMntSaveConfigCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicDevMntSaveConfigCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        BleOnSaveConfig();
+
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicDevMntRestartDevCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicDevMntRestartDevCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        BleOnRestartDev();
+
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicDevMntDiagCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicDevMntDiagCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onRead(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        int  iBlobSize;
+
+        // provide a current snapshot of the Diagnostics Data
+        iBlobSize = BleOnDiagRead();
+        if (iBlobSize > 0)
+        {
+            pBleCharacteristic_p->setValue(abDevMntDiag_g, iBlobSize);
+        }
+
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicDevMntCfgPatchCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicDevMntCfgPatchCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        int  iRspLen;
+
+        iRspLen = BleOnCfgPatchWrite(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength());
+
+        pBleCharacteristic_p->setValue(abDevMntCfgPatchRsp_g, iRspLen);
+        pBleCharacteristic_p->notify();
+
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicDevMntCfgImageCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicDevMntCfgImageCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onRead(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        int  iImageLen;
+
+        // provide Config Image of the current workspace (incl. values not saved yet)
+        iImageLen = BleOnCfgImageRead();
+        if (iImageLen > 0)
+        {
+            pBleCharacteristic_p->setValue(abDevMntCfgImage_g, iImageLen);
+        }
+
+        return;
+
+    }
+
+    //-------------------------------------------------------------------
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        int  iRspLen;
+
+        iRspLen = BleOnCfgImageWrite(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength());
+
+        pBleCharacteristic_p->setValue(abDevMntCfgPatchRsp_g, iRspLen);
+        pBleCharacteristic_p->notify();
+
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicDevMntLogCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicDevMntLogCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        BleOnLogWrite(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength());
+
+        return;
+
+    }
+
+};
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicStreamCtrlCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicStreamCtrlCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        unsigned long  ulStartTime = micros();
+        tStreamStatus  StreamStatus;
+        unsigned int   uiMaxChunkSize;
+        int            iRspLen;
+
+        // max. chunk payload: ATT_MTU - 3 Bytes ATT Header - Chunk Header
+        uiMaxChunkSize = BleConnInfo_g.m_ui16Mtu - 3 - STREAM_DATA_HDR_SIZE;
+
+        iRspLen = ESP32BleCfgStream::ProcessCtrl(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength(), uiMaxChunkSize, abStreamRsp_g);
+        if (iRspLen > 0)
+        {
+            pBleCharacteristic_p->setValue(abStreamRsp_g, iRspLen);
+            pBleCharacteristic_p->notify();
+        }
+
+        if ((iRspLen > 0) && (abStreamRsp_g[0] == STREAM_RSP_DONE) && (pfnAppCbHdlrStreamDone_g != NULL))
+        {
+            ESP32BleCfgStream::GetStatus(&StreamStatus);
+            pfnAppCbHdlrStreamDone_g(StreamStatus.m_ui32TotalSize, StreamStatus.m_ui32RunningCrc, StreamStatus.m_ui32Throughput);
+        }
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_STREAM_CTRL, (uint32_t)(micros() - ulStartTime));
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicStreamDataCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicStreamDataCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        unsigned long  ulStartTime = micros();
+        int            iRspLen;
+
+        // chunk is written to flash directly from the characteristic buffer
+        iRspLen = ESP32BleCfgStream::ProcessData(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength(), abStreamRsp_g);
+        if (iRspLen > 0)
+        {
+            pBleCharacStreamCtrl_g->setValue(abStreamRsp_g, iRspLen);
+            pBleCharacStreamCtrl_g->notify();
+        }
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_STREAM_DATA, (uint32_t)(micros() - ulStartTime));
+        return;
+
+    }
+
+};
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicOtaCtrlCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicOtaCtrlCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        unsigned long  ulStartTime = micros();
+        unsigned int   uiMaxPacketSize;
+
+        // max. image packet: ATT_MTU - 3 Bytes ATT Header
+        // (response is notified asynchronously by the flash writer task)
+        uiMaxPacketSize = BleConnInfo_g.m_ui16Mtu - 3;
+        ESP32BleCfgOta::ProcessCtrl(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength(), uiMaxPacketSize);
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_OTA_CTRL, (uint32_t)(micros() - ulStartTime));
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BleCharacteristicOtaDataCallbacks
+//---------------------------------------------------------------------------
+
+class  BleCharacteristicOtaDataCallbacks : public BLECharacteristicCallbacks
+{
+
+    void onWrite(BLECharacteristic* pBleCharacteristic_p)
+    {
+
+        unsigned long  ulStartTime = micros();
+
+        // packet is only copied into the write buffer, flash is written by the writer task
+        ESP32BleCfgOta::ProcessData(pBleCharacteristic_p->getData(), pBleCharacteristic_p->getLength());
+
+        ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_OTA_DATA, (uint32_t)(micros() - ulStartTime));
+        return;
+
+    }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Callback Instances
+//---------------------------------------------------------------------------
+//  The callback classes have no state, so one instance of each class is
+//  shared by all characteristics and reused by every <ProfileSetup()>.
+
+static  BleServerAppCallbacks                           BleServerAppCallbacks_g;
+static  BleCharacteristicCfgValueCallbacks              BleCharacteristicCfgValueCallbacks_g;
+static  BleCharacteristicDevMntSaveConfigCallbacks      BleCharacteristicDevMntSaveConfigCallbacks_g;
+static  BleCharacteristicDevMntRestartDevCallbacks      BleCharacteristicDevMntRestartDevCallbacks_g;
+static  BleCharacteristicDevMntDiagCallbacks            BleCharacteristicDevMntDiagCallbacks_g;
+static  BleCharacteristicDevMntCfgPatchCallbacks        BleCharacteristicDevMntCfgPatchCallbacks_g;
+static  BleCharacteristicDevMntCfgImageCallbacks        BleCharacteristicDevMntCfgImageCallbacks_g;
+static  BleCharacteristicDevMntLogCallbacks             BleCharacteristicDevMntLogCallbacks_g;
+static  BleCharacteristicStreamCtrlCallbacks            BleCharacteristicStreamCtrlCallbacks_g;
+static  BleCharacteristicStreamDataCallbacks            BleCharacteristicStreamDataCallbacks_g;
+static  BleCharacteristicOtaCtrlCallbacks               BleCharacteristicOtaCtrlCallbacks_g;
+static  BleCharacteristicOtaDataCallbacks               BleCharacteristicOtaDataCallbacks_g;
+
+
+
+//---------------------------------------------------------------------------
+//  Create Descriptor (recorded for <DeleteBleObjects()>)
+//---------------------------------------------------------------------------
+
+static  BLEDescriptor*  NewBleDescriptor (
+        const char* pszUuid_p)
+{
+
+BLEDescriptor*  pBleDescriptor;
+
+    pBleDescriptor = new BLEDescriptor(pszUuid_p);
+    if (uiBleDescriptorCnt_g < BLE_MAX_DESCRIPTORS)
+    {
+        apBleDescriptor_g[uiBleDescriptorCnt_g++] = pBleDescriptor;
+    }
+    else
+    {
+        TRACE0("WARNING: BLE_MAX_DESCRIPTORS exceeded, descriptor is not deleted by <ProfileShutdown()>\n");
+    }
+
+    return (pBleDescriptor);
+
+}
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          B L E   A C C E S S   H A N D L E R                            //
+//                                                                         //
+//=========================================================================//
+
+//  The processing of client accesses is shared by both GATT backends: the
+//  callback classes above (BLE_GATT_BACKEND_OBJECTS) as well as the event
+//  handler <BleAttrTabEventHandler()> (BLE_GATT_BACKEND_ATTR_TABLE) only
+//  provide the data and return the result to the client.
+
+//---------------------------------------------------------------------------
+//  Check Value written to a Configuration Characteristic
+//---------------------------------------------------------------------------
+
+static  int  BleCheckCfgValue (
+        unsigned int uiCfgIdx_p,
+        const uint8_t* pabData_p,
+        size_t DataLen_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+
+    if (pabData_p == NULL)
+    {
+        return (CFG_STATUS_LENGTH_ERROR);
+    }
+
+    pFieldDescr = ESP32BleCfgFields::GetFieldDescr(BLE_CFG_CHARAC_LIST[uiCfgIdx_p].m_ui8FieldId);
+    if (pFieldDescr->m_ui8Type == CFG_FIELD_TYPE_STRING)
+    {
+        // trailing zeros are ignored (same as <BleGetCharacString()>)
+        DataLen_p = strnlen((const char*)pabData_p, DataLen_p);
+    }
+    else if ((DataLen_p == sizeof(uint16_t)) && (pabData_p[1] == 0))
+    {
+        // numeric characteristics hold an uint16 value (little endian)
+        DataLen_p = 1;
+    }
+
+    return ( ESP32BleCfgFields::CheckField(pFieldDescr->m_ui8FieldId, pabData_p, DataLen_p) );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Valid Value taken over into the Workspace
+//---------------------------------------------------------------------------
+//  The workspace is published to <ESP32BleCfgView> right away, so its
+//  subscribers learn about a value written by the client with the next
+//  loop tick and not only after [DevMnt/SaveConfig]. The view holds the
+//  values of the workspace until they are saved (published again with the
+//  same values) resp. until the sketch publishes the saved configuration
+//  again when leaving the BLE Config Mode.
+//---------------------------------------------------------------------------
+
+static  void  BleOnCfgValueWritten ()
+{
+
+tAppCfgData  AppCfgData;
+
+    if (ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData) >= 0)
+    {
+        ESP32BleCfgView::Publish(&AppCfgData);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Write to [DevMnt/SaveConfig]
+//---------------------------------------------------------------------------
+
+static  void  BleOnSaveConfig ()
+{
+
+tAppCfgData    AppCfgData;
+uint8_t        ui8FieldId;
+bool           fSuccess;
+int            iRes;
+unsigned long  ulStartTime;
+
+    ulStartTime = micros();
+    ESP32BleCfgStats::IncCounter(STATS_CNT_SAVE_CFG);
+
+    fSuccess = ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
+    if ( fSuccess )
+    {
+        if (pfnAppCbHdlrSaveConfig_g != NULL)
+        {
+            iRes = ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData);
+            if ((iRes >= 0) && (ESP32BleCfgFields::CheckData(&AppCfgData, &ui8FieldId) != CFG_STATUS_OK))
+            {
+                TRACE1("Save Config rejected: invalid value of Field 0x%02X\n", ui8FieldId);
+                iRes = -1;
+            }
+            if (iRes >= 0)
+            {
+                pfnAppCbHdlrSaveConfig_g(&AppCfgData);
+            }
+            else
+            {
+                pfnAppCbHdlrSaveConfig_g(NULL);
+            }
+        }
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_SAVE_CFG, (uint32_t)(micros() - ulStartTime));
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Write to [DevMnt/RstDev]
+//---------------------------------------------------------------------------
+
+static  void  BleOnRestartDev ()
+{
+
+unsigned long  ulStartTime;
+
+    ulStartTime = micros();
+    ESP32BleCfgStats::IncCounter(STATS_CNT_RESTART);
+
+    // recorded in advance, the application handler usually doesn't return
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_RESTART_DEV, (uint32_t)(micros() - ulStartTime));
+
+    if (pfnAppCbHdlrRestartDev_g != NULL)
+    {
+        pfnAppCbHdlrRestartDev_g();
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Read of [DevMnt/Diagnostics]
+//---------------------------------------------------------------------------
+//  Return:    Size of the snapshot in <abDevMntDiag_g> (<= 0 -> error)
+//---------------------------------------------------------------------------
+
+static  int  BleOnDiagRead ()
+{
+
+unsigned long  ulStartTime;
+int            iBlobSize;
+
+    ulStartTime = micros();
+
+    // provide a current snapshot of the Diagnostics Data
+    iBlobSize = ESP32BleCfgStats::GetBlob(abDevMntDiag_g, sizeof(abDevMntDiag_g));
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_DIAG_READ, (uint32_t)(micros() - ulStartTime));
+
+    return (iBlobSize);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Write to [DevMnt/ConfigPatch]
+//---------------------------------------------------------------------------
+//  Return:    Size of the response in <abDevMntCfgPatchRsp_g>
+//---------------------------------------------------------------------------
+
+static  int  BleOnCfgPatchWrite (
+        const uint8_t* pabPatch_p,
+        unsigned int uiPatchLen_p)
+{
+
+tAppCfgData    AppCfgData;
+int            iRspLen;
+int            iRes;
+unsigned long  ulStartTime;
+
+    ulStartTime = micros();
+
+    // take over values written separately to the characteristics before
+    ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
+    iRes = ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData);
+    if (iRes < 0)
+    {
+        abDevMntCfgPatchRsp_g[0] = CFG_STATUS_INTERNAL_ERROR;
+        abDevMntCfgPatchRsp_g[1] = CFG_PATCH_NO_ENTRY_IDX;
+        abDevMntCfgPatchRsp_g[2] = 0;
+        iRspLen = CFG_PATCH_RSP_SIZE;
+    }
+    else
+    {
+        // patch is applied completely or not at all
+        iRspLen = ESP32BleCfgFields::ApplyPatch(pabPatch_p, uiPatchLen_p, &AppCfgData, abDevMntCfgPatchRsp_g);
+    }
+
+    if (abDevMntCfgPatchRsp_g[0] == CFG_STATUS_OK)
+    {
+        ESP32BleCfgProfile::ImportInstanceWorkspace(&AppCfgData);
+        ESP32BleCfgProfile::WriteDataToBleCharacterisics();
+        ESP32BleCfgView::Publish(&AppCfgData);
+
+        // optional commit: same as a write to [DevMnt/SaveConfig], a failed save is reported to the Client
+        if ((pabPatch_p[0] & CFG_PATCH_FLAG_COMMIT) && (pfnAppCbHdlrSaveConfig_g != NULL))
+        {
+            ESP32BleCfgStats::IncCounter(STATS_CNT_SAVE_CFG);
+            if (pfnAppCbHdlrSaveConfig_g(&AppCfgData) < 0)
+            {
+                TRACE0("Config Patch: saving configuration failed\n");
+                abDevMntCfgPatchRsp_g[0] = CFG_STATUS_SAVE_ERROR;
+            }
+        }
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_CFG_PATCH, (uint32_t)(micros() - ulStartTime));
+
+    return (iRspLen);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Read of [DevMnt/ConfigImage]
+//---------------------------------------------------------------------------
+//  Return:    Size of the image in <abDevMntCfgImage_g> (<= 0 -> error)
+//---------------------------------------------------------------------------
+
+static  int  BleOnCfgImageRead ()
+{
+
+tAppCfgData    AppCfgData;
+int            iImageLen;
+unsigned long  ulStartTime;
+
+    ulStartTime = micros();
+
+    // provide Config Image of the current workspace (incl. values not saved yet)
+    iImageLen = 0;
+    ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
+    if (ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData) >= 0)
+    {
+        iImageLen = ESP32BleCfgFields::EncodeImage(&AppCfgData, abDevMntCfgImage_g, sizeof(abDevMntCfgImage_g));
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_CFG_IMAGE_READ, (uint32_t)(micros() - ulStartTime));
+
+    return (iImageLen);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Write to [DevMnt/ConfigImage]
+//---------------------------------------------------------------------------
+//  Return:    Size of the response in <abDevMntCfgPatchRsp_g>
+//---------------------------------------------------------------------------
+
+static  int  BleOnCfgImageWrite (
+        const uint8_t* pabImage_p,
+        unsigned int uiImageLen_p)
+{
+
+tAppCfgData    AppCfgData;
+int            iRspLen;
+unsigned long  ulStartTime;
+
+    ulStartTime = micros();
+
+    // image is applied completely or not at all, a valid image is saved immediately
+    ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
+    if (ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData) < 0)
+    {
+        abDevMntCfgPatchRsp_g[0] = CFG_STATUS_INTERNAL_ERROR;
+        abDevMntCfgPatchRsp_g[1] = CFG_PATCH_NO_ENTRY_IDX;
+        abDevMntCfgPatchRsp_g[2] = 0;
+        iRspLen = CFG_PATCH_RSP_SIZE;
+    }
+    else
+    {
+        iRspLen = ESP32BleCfgFields::DecodeImage(pabImage_p, uiImageLen_p, &AppCfgData, abDevMntCfgPatchRsp_g);
+    }
+
+    if (abDevMntCfgPatchRsp_g[0] == CFG_STATUS_OK)
+    {
+        ESP32BleCfgProfile::ImportInstanceWorkspace(&AppCfgData);
+        ESP32BleCfgProfile::WriteDataToBleCharacterisics();
+        ESP32BleCfgView::Publish(&AppCfgData);
+
+        if (pfnAppCbHdlrSaveConfig_g != NULL)
+        {
+            ESP32BleCfgStats::IncCounter(STATS_CNT_SAVE_CFG);
+            if (pfnAppCbHdlrSaveConfig_g(&AppCfgData) < 0)
+            {
+                TRACE0("Config Image: saving configuration failed\n");
+                abDevMntCfgPatchRsp_g[0] = CFG_STATUS_SAVE_ERROR;
+            }
+        }
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_CFG_IMAGE_WRITE, (uint32_t)(micros() - ulStartTime));
+
+    return (iRspLen);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Write to [DevMnt/Log]
+//---------------------------------------------------------------------------
+//  1 -> start log stream, 0 -> stop log stream
+//---------------------------------------------------------------------------
+
+static  void  BleOnLogWrite (
+        const uint8_t* pabData_p,
+        unsigned int uiDataLen_p)
+{
+
+unsigned long  ulStartTime;
+
+    if (uiDataLen_p < 1)
+    {
+        return;
+    }
+
+    ulStartTime = micros();
+
+    fBleLogStarted_g = (pabData_p[0] != 0);
+    TRACE1("BLE Log Stream %s\n", (fBleLogStarted_g) ? "started" : "stopped");
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_LOG, (uint32_t)(micros() - ulStartTime));
+
+    return;
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          B L E   E V E N T   H A N D L E R                              //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  Request Connection Parameter Update
+//---------------------------------------------------------------------------
+
+static  void  BleRequestConnParams (
+        const tBleConnParams* pConnParams_p)
+{
+
+esp_ble_conn_update_params_t  ConnUpdateParams;
+esp_err_t                     EspRes;
+
+    memcpy(ConnUpdateParams.bda, abBleRemoteBda_g, sizeof(ConnUpdateParams.bda));
+    ConnUpdateParams.min_int = pConnParams_p->m_ui16ConnIntervalMin;
+    ConnUpdateParams.max_int = pConnParams_p->m_ui16ConnIntervalMax;
+    ConnUpdateParams.latency = pConnParams_p->m_ui16SlaveLatency;
+    ConnUpdateParams.timeout = pConnParams_p->m_ui16SupervTimeout;
+
+    EspRes = esp_ble_gap_update_conn_params(&ConnUpdateParams);
+    if (EspRes != ESP_OK)
+    {
+        TRACE1("ERROR: esp_ble_gap_update_conn_params() failed (EspRes=%d)\n", EspRes);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Get String Value of Characteristic
+//---------------------------------------------------------------------------
+//  Copies the value directly from the characteristic into the workspace
+//  buffer (same semantic as 'strncpy'), without any temporary copy on the
+//  heap as it would be created by <getValue()>.
+//---------------------------------------------------------------------------
+
+static  void  BleGetCharacString (
+        BLECharacteristic* pBleCharac_p,
+        char* pszBuff_p,
+        size_t BuffSize_p)
+{
+
+const char*  pszData;
+size_t       DataLen;
+
+    // characteristic not created (disabled option) -> keep workspace value
+    if (pBleCharac_p == NULL)
+    {
+        return;
+    }
+
+    pszData = (const char*)pBleCharac_p->getData();
+    DataLen = 0;
+    if (pszData != NULL)
+    {
+        DataLen = pBleCharac_p->getLength();
+        DataLen = strnlen(pszData, (DataLen < BuffSize_p) ? DataLen : BuffSize_p);
+        memcpy(pszBuff_p, pszData, DataLen);
+    }
+    memset(pszBuff_p + DataLen, 0x00, BuffSize_p - DataLen);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Get Value of a Configuration Characteristic from the Instance Workspace
+//---------------------------------------------------------------------------
+
+static  const uint8_t*  BleGetCfgValue (
+        unsigned int uiCfgIdx_p,
+        size_t* pDataLen_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+const tBleCfgCharac*   pCfgCharac;
+
+    pCfgCharac  = &BLE_CFG_CHARAC_LIST[uiCfgIdx_p];
+    pFieldDescr = ESP32BleCfgFields::GetFieldDescr(pCfgCharac->m_ui8FieldId);
+    if (pFieldDescr->m_ui8Type == CFG_FIELD_TYPE_STRING)
+    {
+        *pDataLen_p = strnlen((const char*)pCfgCharac->m_pvWorkspace, pCfgCharac->m_ui8WorkspaceSize);
+    }
+    else
+    {
+        *pDataLen_p = pCfgCharac->m_ui8WorkspaceSize;
+    }
+
+    return ( (const uint8_t*)pCfgCharac->m_pvWorkspace );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Update Value of a Configuration Characteristic
+//---------------------------------------------------------------------------
+//  Sets the value only if it really differs from the current one and marks
+//  the characteristic for notification. Several updates until the next
+//  <ProfileLoop()> result in one notification with the latest value.
+//
+//  With BLE_GATT_BACKEND_ATTR_TABLE the value is read directly from the
+//  instance workspace, so only a CRC of the last value is kept to detect
+//  a change.
+//
+//  Characteristics of disabled options are not created, their values are
+//  kept in the instance workspace only.
+//---------------------------------------------------------------------------
+
+static  void  BleUpdateCharacValue (
+        unsigned int uiNotifyIdx_p,
+        const void* pData_p,
+        size_t DataLen_p)
+{
+
+BLECharacteristic*  pBleCharac;
+const uint8_t*      pabCurrData;
+uint32_t            ui32Crc;
+
+    if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        if (*BLE_CFG_CHARAC_LIST[uiNotifyIdx_p].m_pui16AttrHdl == 0)
+        {
+            return;
+        }
+        ui32Crc = esp_rom_crc32_le(0, (const uint8_t*)pData_p, DataLen_p);
+        if (ui32Crc != aui32BleCfgCharacCrc_g[uiNotifyIdx_p])
+        {
+            aui32BleCfgCharacCrc_g[uiNotifyIdx_p] = ui32Crc;
+            __atomic_fetch_or(&ui32BleNotifyPending_g, (1UL << uiNotifyIdx_p), __ATOMIC_SEQ_CST);
+        }
+        return;
+    }
+
+    pBleCharac  = *BLE_CFG_CHARAC_LIST[uiNotifyIdx_p].m_ppBleCharac;
+    if (pBleCharac == NULL)
+    {
+        return;
+    }
+    pabCurrData = pBleCharac->getData();
+    if ((pabCurrData != NULL) && (pBleCharac->getLength() == DataLen_p) && (memcmp(pabCurrData, pData_p, DataLen_p) == 0))
+    {
+        return;
+    }
+
+    pBleCharac->setValue((uint8_t*)pData_p, DataLen_p);
+    __atomic_fetch_or(&ui32BleNotifyPending_g, (1UL << uiNotifyIdx_p), __ATOMIC_SEQ_CST);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Set and Notify Value of a Characteristic
+//---------------------------------------------------------------------------
+
+static  void  BleNotifyCharacValue (
+        BLECharacteristic* pBleCharac_p,
+        uint16_t ui16AttrHdl_p,
+        const void* pData_p,
+        size_t DataLen_p)
+{
+
+esp_err_t  EspRes;
+
+    if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        // value is not stored by the stack, reads are answered from the workspace
+        EspRes = esp_ble_gatts_send_indicate(BleGattsIf_g, pBleServer_g->getConnId(), ui16AttrHdl_p, DataLen_p, (uint8_t*)pData_p, false);
+        if (EspRes != ESP_OK)
+        {
+            TRACE2("ERROR: esp_ble_gatts_send_indicate() failed (Hdl=%u, EspRes=%d)\n", ui16AttrHdl_p, EspRes);
+        }
+        return;
+    }
+
+    pBleCharac_p->setValue((uint8_t*)pData_p, DataLen_p);
+    pBleCharac_p->notify();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Send OTA Response (called by OTA Flash Writer Task)
+//---------------------------------------------------------------------------
+
+static  void  BleOtaSendRsp (
+        const uint8_t* pabRsp_p,
+        unsigned int uiRspLen_p)
+{
+
+tOtaStatus  OtaStatus;
+
+    if (pBleCharacOtaCtrl_g == NULL)
+    {
+        return;
+    }
+
+    pBleCharacOtaCtrl_g->setValue((uint8_t*)pabRsp_p, uiRspLen_p);
+    if ( fBleClientConnected_g )
+    {
+        pBleCharacOtaCtrl_g->notify();
+    }
+
+    if ((pabRsp_p[0] == OTA_RSP_DONE) && (pfnAppCbHdlrOtaDone_g != NULL))
+    {
+        ESP32BleCfgOta::GetStatus(&OtaStatus);
+        pfnAppCbHdlrOtaDone_g(OtaStatus.m_ui32ImageSize, OtaStatus.m_ui32Throughput);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GAP Event Handler
+//---------------------------------------------------------------------------
+
+static  void  BleGapEventHandler (
+        esp_gap_ble_cb_event_t Event_p,
+        esp_ble_gap_cb_param_t* pParam_p)
+{
+
+    if (Event_p == ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT)
+    {
+        if (pParam_p->update_conn_params.status == ESP_BT_STATUS_SUCCESS)
+        {
+            // save Connection Parameters negotiated with the Client
+            BleConnInfo_g.m_ui16ConnInterval  = pParam_p->update_conn_params.conn_int;
+            BleConnInfo_g.m_ui16SlaveLatency  = pParam_p->update_conn_params.latency;
+            BleConnInfo_g.m_ui16SupervTimeout = pParam_p->update_conn_params.timeout;
+        }
+        TRACE4("BLE ConnParams Update: Status=%d, ConnInterval=%u, Latency=%u, Timeout=%u\n", pParam_p->update_conn_params.status, pParam_p->update_conn_params.conn_int, pParam_p->update_conn_params.latency, pParam_p->update_conn_params.timeout);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GATT Server Event Handler
+//---------------------------------------------------------------------------
+//  Each access of the Client to the profile is considered as activity of
+//  a config transfer. If the Connection Parameters were already relaxed,
+//  the short Connection Interval is requested again.
+//
+//  With BLE_GATT_BACKEND_ATTR_TABLE, the accesses to the core services are
+//  processed by <BleAttrTabEventHandler()>. The GATT Interface required for
+//  this is the one registered by <BLEDevice::createServer()>.
+//---------------------------------------------------------------------------
+
+static  void  BleGattsEventHandler (
+        esp_gatts_cb_event_t Event_p,
+        esp_gatt_if_t GattsIf_p,
+        esp_ble_gatts_cb_param_t* pParam_p)
+{
+
+    if ((Event_p == ESP_GATTS_REG_EVT) && (pParam_p->reg.status == ESP_GATT_OK))
+    {
+        BleGattsIf_g = GattsIf_p;
+    }
+
+    if (Event_p == ESP_GATTS_WRITE_EVT)
+    {
+        ulBleCfgModeActivityTick_g = millis();
+    }
+
+    if ((Event_p == ESP_GATTS_READ_EVT) || (Event_p == ESP_GATTS_WRITE_EVT))
+    {
+        ulBleLastActivityTick_g = millis();
+
+        if (BleConnInfo_g.m_fClientConnected && !BleConnInfo_g.m_fFastParamsActive)
+        {
+            BleRequestConnParams(&BleFastConnParams_g);
+            BleConnInfo_g.m_fFastParamsActive = true;
+        }
+    }
+
+    if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        BleAttrTabEventHandler(Event_p, GattsIf_p, pParam_p);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GATT Server Event Handler for the Attribute Tables
+//---------------------------------------------------------------------------
+//  Signals the creation and the start of the tables to <CreateAttrTables()>
+//  and answers all accesses to values marked with ESP_GATT_RSP_BY_APP.
+//  A Prepared Write (Long Write) is collected in <abBlePrepWriteBuff_g>
+//  and checked and applied as a whole by the Execute Write.
+//---------------------------------------------------------------------------
+
+static  void  BleAttrTabEventHandler (
+        esp_gatts_cb_event_t Event_p,
+        esp_gatt_if_t GattsIf_p,
+        esp_ble_gatts_cb_param_t* pParam_p)
+{
+
+const esp_gatts_attr_db_t*  pAttrTab;
+esp_gatt_status_t           Status;
+unsigned int                uiTabIdx;
+unsigned int                uiAttrIdx;
+unsigned int                uiRefIdx;
+
+    switch (Event_p)
+    {
+        case ESP_GATTS_CREAT_ATTR_TAB_EVT:
+        {
+            uiTabIdx = pParam_p->add_attr_tab.svc_inst_id;
+            if (uiTabIdx >= BLE_ATTR_TAB_NUM)
+            {
+                break;
+            }
+            if (pParam_p->add_attr_tab.status == ESP_GATT_OK)
+            {
+                aui16AttrHdlService_g[uiTabIdx] = pParam_p->add_attr_tab.handles[0];
+                aui16AttrNumHdl_g[uiTabIdx]     = pParam_p->add_attr_tab.num_handle;
+
+                // resolve the handles of the values processed by the application
+                pAttrTab = apBleAttrTab_g[uiTabIdx];
+                for (uiAttrIdx=0; (pAttrTab != NULL) && (uiAttrIdx < pParam_p->add_attr_tab.num_handle); uiAttrIdx++)
+                {
+                    for (uiRefIdx=0; uiRefIdx<(sizeof(BLE_ATTR_HDL_REF_LIST)/sizeof(BLE_ATTR_HDL_REF_LIST[0])); uiRefIdx++)
+                    {
+                        if (pAttrTab[uiAttrIdx].att_desc.uuid_p == BLE_ATTR_HDL_REF_LIST[uiRefIdx].m_pabUuid)
+                        {
+                            *BLE_ATTR_HDL_REF_LIST[uiRefIdx].m_pui16AttrHdl = pParam_p->add_attr_tab.handles[uiAttrIdx];
+                            break;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                TRACE2("ERROR: Creation of Attribute Table #%u failed (Status=%d)\n", uiTabIdx, pParam_p->add_attr_tab.status);
+            }
+            xSemaphoreGive(hBleAttrTabEvent_g);
+            break;
+        }
+
+        case ESP_GATTS_START_EVT:
+        {
+            for (uiTabIdx=0; uiTabIdx<BLE_ATTR_TAB_NUM; uiTabIdx++)
+            {
+                if ((aui16AttrNumHdl_g[uiTabIdx] != 0) && (pParam_p->start.service_handle == aui16AttrHdlService_g[uiTabIdx]))
+                {
+                    xSemaphoreGive(hBleAttrTabEvent_g);
+                    break;
+                }
+            }
+            break;
+        }
+
+        case ESP_GATTS_READ_EVT:
+        {
+            if (pParam_p->read.need_rsp && BleAttrTabIsOwnHandle(pParam_p->read.handle))
+            {
+                BleAttrTabRead(GattsIf_p, pParam_p);
+            }
+            break;
+        }
+
+        case ESP_GATTS_WRITE_EVT:
+        {
+            if ( !BleAttrTabIsOwnHandle(pParam_p->write.handle) )
+            {
+                break;
+            }
+
+            if ( pParam_p->write.is_prep )
+            {
+                if (ui16BlePrepWriteHdl_g == 0)
+                {
+                    ui16BlePrepWriteHdl_g = pParam_p->write.handle;
+                    ui16BlePrepWriteLen_g = 0;
+                    BlePrepWriteStatus_g  = ESP_GATT_OK;
+                }
+
+                Status = ESP_GATT_OK;
+                if (pParam_p->write.handle != ui16BlePrepWriteHdl_g)
+                {
+                    Status = ESP_GATT_PREPARE_Q_FULL;                   // only one value per Long Write
+                }
+                else if (pParam_p->write.offset != ui16BlePrepWriteLen_g)
+                {
+                    Status = ESP_GATT_INVALID_OFFSET;
+                }
+                else if ((pParam_p->write.offset + pParam_p->write.len) > sizeof(abBlePrepWriteBuff_g))
+                {
+                    Status = ESP_GATT_INVALID_ATTR_LEN;
+                }
+                else
+                {
+                    memcpy(&abBlePrepWriteBuff_g[pParam_p->write.offset], pParam_p->write.value, pParam_p->write.len);
+                    ui16BlePrepWriteLen_g += pParam_p->write.len;
+                }
+                if (Status != ESP_GATT_OK)
+                {
+                    BlePrepWriteStatus_g = Status;
+                }
+
+                if ( pParam_p->write.need_rsp )
+                {
+                    // the response to a Prepare Write echoes the received part
+                    BleGattRsp_g.attr_value.handle   = pParam_p->write.handle;
+                    BleGattRsp_g.attr_value.offset   = pParam_p->write.offset;
+                    BleGattRsp_g.attr_value.len      = pParam_p->write.len;
+                    BleGattRsp_g.attr_value.auth_req = 0;
+                    memcpy(BleGattRsp_g.attr_value.value, pParam_p->write.value, pParam_p->write.len);
+                    esp_ble_gatts_send_response(GattsIf_p, pParam_p->write.conn_id, pParam_p->write.trans_id, Status, &BleGattRsp_g);
+                }
+                break;
+            }
+
+            Status = BleAttrTabCheckWrite(pParam_p->write.handle, pParam_p->write.value, pParam_p->write.len);
+            if ( pParam_p->write.need_rsp )
+            {
+                esp_ble_gatts_send_response(GattsIf_p, pParam_p->write.conn_id, pParam_p->write.trans_id, Status, NULL);
+            }
+            if (Status == ESP_GATT_OK)
+            {
+                BleAttrTabWrite(pParam_p->write.handle, pParam_p->write.value, pParam_p->write.len);
+            }
+            break;
+        }
+
+        case ESP_GATTS_EXEC_WRITE_EVT:
+        {
+            // Long Write to a characteristic of an optional service is processed by its object
+            if (ui16BlePrepWriteHdl_g == 0)
+            {
+                break;
+            }
+
+            Status = BlePrepWriteStatus_g;
+            if ((Status == ESP_GATT_OK) && (pParam_p->exec_write.exec_write_flag == ESP_GATT_PREP_WRITE_EXEC))
+            {
+                Status = BleAttrTabCheckWrite(ui16BlePrepWriteHdl_g, abBlePrepWriteBuff_g, ui16BlePrepWriteLen_g);
+            }
+            esp_ble_gatts_send_response(GattsIf_p, pParam_p->exec_write.conn_id, pParam_p->exec_write.trans_id, Status, NULL);
+            if ((Status == ESP_GATT_OK) && (pParam_p->exec_write.exec_write_flag == ESP_GATT_PREP_WRITE_EXEC))
+            {
+                BleAttrTabWrite(ui16BlePrepWriteHdl_g, abBlePrepWriteBuff_g, ui16BlePrepWriteLen_g);
+            }
+            ui16BlePrepWriteHdl_g = 0;
+            break;
+        }
+
+        case ESP_GATTS_DISCONNECT_EVT:
+        {
+            ui16BlePrepWriteHdl_g = 0;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Answer Read Access to a Value of the Attribute Tables
+//---------------------------------------------------------------------------
+//  Generated values ([DevMnt/Diagnostics], [DevMnt/ConfigImage]) are built
+//  at offset 0 only, so a Long Read returns a consistent snapshot.
+//---------------------------------------------------------------------------
+
+static  void  BleAttrTabRead (
+        esp_gatt_if_t GattsIf_p,
+        esp_ble_gatts_cb_param_t* pParam_p)
+{
+
+const uint8_t*     pabData;
+size_t             DataLen;
+uint16_t           ui16AttrHdl;
+uint16_t           ui16Offset;
+esp_gatt_status_t  Status;
+unsigned int       uiIdx;
+int                iLen;
+
+    ui16AttrHdl = pParam_p->read.handle;
+    ui16Offset  = pParam_p->read.offset;
+    pabData = NULL;
+    DataLen = 0;
+
+    if (ui16AttrHdl == ui16AttrHdlDevMntSysTickCnt_g)
+    {
+        pabData = (const uint8_t*)&ui32DevMntSysTickCnt_g;
+        DataLen = sizeof(ui32DevMntSysTickCnt_g);
+    }
+    else if (ui16AttrHdl == ui16AttrHdlDevMntDiag_g)
+    {
+        if (ui16Offset == 0)
+        {
+            iLen = BleOnDiagRead();
+            ui16DevMntDiagLen_g = (iLen > 0) ? (uint16_t)iLen : 0;
+        }
+        pabData = abDevMntDiag_g;
+        DataLen = ui16DevMntDiagLen_g;
+    }
+    else if (ui16AttrHdl == ui16AttrHdlDevMntCfgPatch_g)
+    {
+        pabData = abDevMntCfgPatchRsp_g;
+        DataLen = ui16DevMntCfgPatchRspLen_g;
+    }
+    else if (ui16AttrHdl == ui16AttrHdlDevMntCfgImage_g)
+    {
+        if (ui16Offset == 0)
+        {
+            iLen = BleOnCfgImageRead();
+            ui16DevMntCfgImageLen_g = (iLen > 0) ? (uint16_t)iLen : 0;
+        }
+        pabData = abDevMntCfgImage_g;
+        DataLen = ui16DevMntCfgImageLen_g;
+    }
+    else
+    {
+        for (uiIdx=0; uiIdx<BLE_CFG_CHARAC_LIST_LEN; uiIdx++)
+        {
+            if (ui16AttrHdl == *BLE_CFG_CHARAC_LIST[uiIdx].m_pui16AttrHdl)
+            {
+                pabData = BleGetCfgValue(uiIdx, &DataLen);
+                break;
+            }
+        }
+    }
+
+    Status = ESP_GATT_OK;
+    if (ui16Offset > DataLen)
+    {
+        Status  = ESP_GATT_INVALID_OFFSET;
+        DataLen = 0;
+    }
+    else
+    {
+        // max. ATT_MTU - 1 Bytes per Read resp. Read Blob Response
+        DataLen -= ui16Offset;
+        if (DataLen > (size_t)(BleConnInfo_g.m_ui16Mtu - 1))
+        {
+            DataLen = BleConnInfo_g.m_ui16Mtu - 1;
+        }
+        if (DataLen > sizeof(BleGattRsp_g.attr_value.value))
+        {
+            DataLen = sizeof(BleGattRsp_g.attr_value.value);
+        }
+    }
+
+    BleGattRsp_g.attr_value.handle   = ui16AttrHdl;
+    BleGattRsp_g.attr_value.offset   = ui16Offset;
+    BleGattRsp_g.attr_value.len      = (uint16_t)DataLen;
+    BleGattRsp_g.attr_value.auth_req = 0;
+    if (DataLen > 0)
+    {
+        memcpy(BleGattRsp_g.attr_value.value, &pabData[ui16Offset], DataLen);
+    }
+
+    esp_ble_gatts_send_response(GattsIf_p, pParam_p->read.conn_id, pParam_p->read.trans_id, Status, &BleGattRsp_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Check Write Access to a Value of the Attribute Tables
+//---------------------------------------------------------------------------
+//  Unlike the object based backend, the value is checked before the write
+//  response is sent, so an invalid configuration value is rejected with an
+//  ATT Error instead of being reverted afterwards.
+//---------------------------------------------------------------------------
+
+static  esp_gatt_status_t  BleAttrTabCheckWrite (
+        uint16_t ui16AttrHdl_p,
+        const uint8_t* pabData_p,
+        uint16_t ui16DataLen_p)
+{
+
+unsigned int  uiIdx;
+int           iStatus;
+
+    for (uiIdx=0; uiIdx<BLE_CFG_CHARAC_LIST_LEN; uiIdx++)
+    {
+        if (ui16AttrHdl_p == *BLE_CFG_CHARAC_LIST[uiIdx].m_pui16AttrHdl)
+        {
+            iStatus = BleCheckCfgValue(uiIdx, pabData_p, ui16DataLen_p);
+            if (iStatus != CFG_STATUS_OK)
+            {
+                TRACE2("Write to Field 0x%02X rejected (Status=%d)\n", BLE_CFG_CHARAC_LIST[uiIdx].m_ui8FieldId, iStatus);
+                return (ESP_GATT_OUT_OF_RANGE);
+            }
+            return (ESP_GATT_OK);
+        }
+    }
+
+    if ((ui16AttrHdl_p == ui16AttrHdlDevMntSaveCfg_g)  ||
+        (ui16AttrHdl_p == ui16AttrHdlDevMntRstDev_g)   ||
+        (ui16AttrHdl_p == ui16AttrHdlDevMntCfgPatch_g) ||
+        (ui16AttrHdl_p == ui16AttrHdlDevMntCfgImage_g))
+    {
+        return (ESP_GATT_OK);
+    }
+
+    if (ui16AttrHdl_p == ui16AttrHdlDevMntLog_g)
+    {
+        return ((ui16DataLen_p >= 1) ? ESP_GATT_OK : ESP_GATT_INVALID_ATTR_LEN);
+    }
+
+    return (ESP_GATT_WRITE_NOT_PERMIT);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Process Write Access to a Value of the Attribute Tables
+//---------------------------------------------------------------------------
+//  Called after <BleAttrTabCheckWrite()> has accepted the value and the
+//  write response was sent.
+//---------------------------------------------------------------------------
+
+static  void  BleAttrTabWrite (
+        uint16_t ui16AttrHdl_p,
+        const uint8_t* pabData_p,
+        uint16_t ui16DataLen_p)
+{
+
+const tBleCfgCharac*  pCfgCharac;
+const uint8_t*        pabValue;
+size_t                ValueLen;
+unsigned int          uiIdx;
+int                   iRspLen;
+unsigned long         ulStartTime;
+
+    ulStartTime = micros();
+
+    for (uiIdx=0; uiIdx<BLE_CFG_CHARAC_LIST_LEN; uiIdx++)
+    {
+        pCfgCharac = &BLE_CFG_CHARAC_LIST[uiIdx];
+        if (ui16AttrHdl_p == *pCfgCharac->m_pui16AttrHdl)
+        {
+            // take over the checked value into the workspace (without notification back to the client)
+            if (ESP32BleCfgFields::GetFieldDescr(pCfgCharac->m_ui8FieldId)->m_ui8Type == CFG_FIELD_TYPE_STRING)
+            {
+                ValueLen = strnlen((const char*)pabData_p, ui16DataLen_p);
+                memset(pCfgCharac->m_pvWorkspace, 0x00, pCfgCharac->m_ui8WorkspaceSize);
+                memcpy(pCfgCharac->m_pvWorkspace, pabData_p, ValueLen);
+            }
+            else
+            {
+                *(uint16_t*)pCfgCharac->m_pvWorkspace = (uint16_t)pabData_p[0];
+            }
+            pabValue = BleGetCfgValue(uiIdx, &ValueLen);
+            aui32BleCfgCharacCrc_g[uiIdx] = esp_rom_crc32_le(0, pabValue, ValueLen);
+            BleOnCfgValueWritten();
+            ESP32BleCfgStats::RecordLatency(STATS_HIST_CB_CFG_VALUE, (uint32_t)(micros() - ulStartTime));
+            return;
+        }
+    }
+
+    if (ui16AttrHdl_p == ui16AttrHdlDevMntSaveCfg_g)
+    {
+        BleOnSaveConfig();
+    }
+    else if (ui16AttrHdl_p == ui16AttrHdlDevMntRstDev_g)
+    {
+        BleOnRestartDev();
+    }
+    else if (ui16AttrHdl_p == ui16AttrHdlDevMntLog_g)
+    {
+        BleOnLogWrite(pabData_p, ui16DataLen_p);
+    }
+    else if ((ui16AttrHdl_p == ui16AttrHdlDevMntCfgPatch_g) || (ui16AttrHdl_p == ui16AttrHdlDevMntCfgImage_g))
+    {
+        if (ui16AttrHdl_p == ui16AttrHdlDevMntCfgPatch_g)
+        {
+            iRspLen = BleOnCfgPatchWrite(pabData_p, ui16DataLen_p);
+        }
+        else
+        {
+            iRspLen = BleOnCfgImageWrite(pabData_p, ui16DataLen_p);
+        }
+        ui16DevMntCfgPatchRspLen_g = (uint16_t)iRspLen;
+        BleNotifyCharacValue(NULL, ui16AttrHdl_p, abDevMntCfgPatchRsp_g, iRspLen);
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Check if Handle belongs to one of the Attribute Tables
+//---------------------------------------------------------------------------
+
+static  bool  BleAttrTabIsOwnHandle (
+        uint16_t ui16AttrHdl_p)
+{
+
+unsigned int  uiTabIdx;
+
+    for (uiTabIdx=0; uiTabIdx<BLE_ATTR_TAB_NUM; uiTabIdx++)
+    {
+        if ((ui16AttrHdl_p >= aui16AttrHdlService_g[uiTabIdx]) && (ui16AttrHdl_p < (aui16AttrHdlService_g[uiTabIdx] + aui16AttrNumHdl_g[uiTabIdx])))
+        {
+            return (true);
+        }
+    }
+
+    return (false);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          C O N S T R U C T O R   /   D E S T R U C T O R                //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Constructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgProfile::ESP32BleCfgProfile ()
+{
+
+    fBleClientConnected_g           = false;
+
+    pfnAppCbHdlrSaveConfig_g        = NULL;
+    pfnAppCbHdlrRestartDev_g        = NULL;
+
+    ClearBleObjectRefs();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Destructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgProfile::~ESP32BleCfgProfile()
+{
+
+    return;
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  ProfileSetup()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ProfileSetup (
+        uint32_t ui32DeviceType_p,
+        const tAppCfgData* pAppCfgData_p,
+        const tAppDescriptData* pAppDescriptData_p,
+        tCbHdlrSaveConfig pfnAppCbHdlrSaveConfig_p,
+        tCbHdlrRestartDev pfnAppCbHdlrRestartDev_p,
+        tCbHdlrConStatChg pfnAppCbHdlrConStatChg_p)
+{
+
+BLEDescriptor*  pBleDescriptor;
+unsigned long   ulStartTime;
+int             iRes;
+
+
+    TRACE1("+ 'ProfileSetup()': ui32DeviceType_p=%d\n", ui32DeviceType_p);
+
+    // profile already running resp. BT memory already released by <ProfileShutdown()> or <ProfileEnterNormalMode()>
+    if ((pBleServer_g != NULL) || fBleMemReleased_g)
+    {
+        return (-5);
+    }
+
+    // Import configuration data given by Application into class instance workspace
+    ui32DevMntDevType_g = ui32DeviceType_p;
+    iRes = ImportInstanceWorkspace(pAppCfgData_p);
+    if (iRes < 0)
+    {
+        return (-1);
+    }
+
+    fBleLogStarted_g = false;
+
+    // Save Pointer to Application Callback Handlers for 'SaveCfg' and 'RestartDev' as well as optional Handler 'ConnectionStatusChanged'
+    pfnAppCbHdlrSaveConfig_g = pfnAppCbHdlrSaveConfig_p;
+    pfnAppCbHdlrRestartDev_g = pfnAppCbHdlrRestartDev_p;
+    pfnAppCbHdlrConStatChg_g = pfnAppCbHdlrConStatChg_p;
+    if ((pfnAppCbHdlrSaveConfig_g == NULL) || (pfnAppCbHdlrRestartDev_g == NULL))
+    {
+        return (-2);
+    }
+
+    // Prepare flash partition for optional service [Stream]
+    if (pszStreamPartLabel_g != NULL)
+    {
+        iRes = ESP32BleCfgStream::Setup(pszStreamPartLabel_g);
+        if (iRes < 0)
+        {
+            return (-3);
+        }
+    }
+
+    // Prepare update partition and flash writer task for optional service [OTA]
+    if ( fOtaEnabled_g )
+    {
+        iRes = ESP32BleCfgOta::Setup(BleOtaSendRsp);
+        if (iRes < 0)
+        {
+            return (-4);
+        }
+    }
+
+    // Options labeled with '#' are disabled, no characteristic is created for them
+    CalcAppRtLayout(pAppDescriptData_p);
+
+    // Calculate Profile Hash over the complete profile layout
+    ui32DevMntProfHash_g = CalcProfileHash(pAppDescriptData_p);
+    TRACE1("   ProfileHash=0x%08lX\n", (unsigned long)ui32DevMntProfHash_g);
+
+
+    //****************[ SERVER ]****************
+    BLEDevice::init(szDevMntDevName_g);             // e.g. "ESP32-BEACON" (no-op if already done by <ProfileInitHost()>)
+    BLEDevice::setMTU(ui16BleLocalMtu_g);
+    BLEDevice::setCustomGapHandler(BleGapEventHandler);
+    BLEDevice::setCustomGattsHandler(BleGattsEventHandler);
+    pBleServer_g = BLEDevice::createServer();
+    pBleServer_g->setCallbacks(&BleServerAppCallbacks_g);
+
+
+    // ======= [ SERVICES #1..#3 (Core Services) ] =======
+    if (pAppDescriptData_p != NULL)
+    {
+        // supported WIFI modes (Station/Client, AccessPoint), checked on write and published as descriptor
+        ui16WifiOwnModeFeatList_g = (uint16_t) pAppDescriptData_p->m_ui8OwnModeFeatList;
+        ESP32BleCfgFields::SetOwnModeFeatList(pAppDescriptData_p->m_ui8OwnModeFeatList);
+    }
+    ulStartTime = micros();
+    if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        iRes = CreateAttrTables(pAppDescriptData_p);
+    }
+    else
+    {
+        iRes = CreateObjServices(pAppDescriptData_p);
+    }
+    ui32BleGattSetupTime_g = (uint32_t)(micros() - ulStartTime);
+    TRACE2("   Core Services created (Backend=%u, SetupTime=%lu us)\n", ui8BleGattBackend_g, (unsigned long)ui32BleGattSetupTime_g);
+    if (iRes < 0)
+    {
+        return (-6);
+    }
+
+
+    // ======= [ SERVICE #4 [Stream] (optional) ] =======
+    if (pszStreamPartLabel_g != NULL)
+    {
+        TRACE0("   SERVICE #4 [Stream]\n");
+        pBleServiceStream_g = pBleServer_g->createService(BLEUUID(BLE_UUID_STREAM_SERVICE), NUM_HANDLES_STREAM_SERVICE, 0);
+
+        // ---- [ CHARACTERISTIC #1 [Stream/Control] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #1 [Stream/Control]\n");
+            pBleCharacStreamCtrl_g = pBleServiceStream_g->createCharacteristic(
+                                                            BLE_UUID_STREAM_CTRL_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_STREAM_CTRL_DSCRPT);
+            pBleDescriptor->setValue("Stream Control");
+            pBleCharacStreamCtrl_g->addDescriptor(pBleDescriptor);
+            pBleCharacStreamCtrl_g->setCallbacks(&BleCharacteristicStreamCtrlCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #2 [Stream/Data] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #2 [Stream/Data]\n");
+            pBleCharacStreamData_g = pBleServiceStream_g->createCharacteristic(
+                                                            BLE_UUID_STREAM_DATA_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_WRITE_NR
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_STREAM_DATA_DSCRPT);
+            pBleDescriptor->setValue("Stream Data");
+            pBleCharacStreamData_g->addDescriptor(pBleDescriptor);
+            pBleCharacStreamData_g->setCallbacks(&BleCharacteristicStreamDataCallbacks_g);
+        }
+
+        pBleServiceStream_g->start();
+    }
+
+
+    // ======= [ SERVICE #5 [OTA] (optional) ] =======
+    if ( fOtaEnabled_g )
+    {
+        TRACE0("   SERVICE #5 [OTA]\n");
+        pBleServiceOta_g = pBleServer_g->createService(BLEUUID(BLE_UUID_OTA_SERVICE), NUM_HANDLES_OTA_SERVICE, 0);
+
+        // ---- [ CHARACTERISTIC #1 [OTA/Control] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #1 [OTA/Control]\n");
+            pBleCharacOtaCtrl_g = pBleServiceOta_g->createCharacteristic(
+                                                            BLE_UUID_OTA_CTRL_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_OTA_CTRL_DSCRPT);
+            pBleDescriptor->setValue("OTA Control");
+            pBleCharacOtaCtrl_g->addDescriptor(pBleDescriptor);
+            pBleCharacOtaCtrl_g->setCallbacks(&BleCharacteristicOtaCtrlCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #2 [OTA/Data] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #2 [OTA/Data]\n");
+            pBleCharacOtaData_g = pBleServiceOta_g->createCharacteristic(
+                                                            BLE_UUID_OTA_DATA_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_WRITE_NR
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_OTA_DATA_DSCRPT);
+            pBleDescriptor->setValue("OTA Data");
+            pBleCharacOtaData_g->addDescriptor(pBleDescriptor);
+            pBleCharacOtaData_g->setCallbacks(&BleCharacteristicOtaDataCallbacks_g);
+        }
+
+        pBleServiceOta_g->start();
+    }
+
+
+    //---- Start Server ----
+    TRACE0("   BleServer_g->startAdvertising()\n");
+    pBleServer_g->startAdvertising();
+    ESP32BleCfgStats::SetRadioState(STATS_RADIO_ADVERTISING);
+
+    // start supervision of the Config Mode Idle Timeout
+    ulBleCfgModeActivityTick_g = millis();
+    fBleCfgModeTimedOut_g      = false;
+
+    TRACE0("- 'ProfileSetup()'\n");
+
+    return (1);
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  ProfileLoop()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::ProfileLoop ()
+{
+
+unsigned long   ulCurrTick;
+unsigned long   ulStartTime;
+uint32_t        ui32NotifyMask;
+const uint8_t*  pabValue;
+size_t          ValueLen;
+unsigned int    uiIdx;
+unsigned int    uiMaxLen;
+int             iLen;
+bool            fBleNotify;
+
+    fBleNotify = false;
+
+    // take over changed configuration values (notified only if a client is connected)
+    ui32NotifyMask = 0;
+    if (ui32BleNotifyPending_g != 0)
+    {
+        ui32NotifyMask = __atomic_exchange_n(&ui32BleNotifyPending_g, 0, __ATOMIC_SEQ_CST);
+    }
+
+    if ( fBleClientConnected_g )
+    {
+        ulCurrTick = millis();
+        if ((ulCurrTick - ui32DevMntSysTickCnt_g) >= 1000)
+        {
+            ulStartTime = micros();
+            ui32DevMntSysTickCnt_g = ulCurrTick;
+            BleNotifyCharacValue(pBleCharacDevMntSysTickCnt_g, ui16AttrHdlDevMntSysTickCnt_g, &ui32DevMntSysTickCnt_g, sizeof(ui32DevMntSysTickCnt_g));
+            ESP32BleCfgStats::RecordLatency(STATS_HIST_NOTIFY, (uint32_t)(micros() - ulStartTime));
+            ESP32BleCfgStats::IncCounter(STATS_CNT_NOTIFY);
+
+            // optional telemetry record of the application (e.g. loop profile)
+            if (pfnAppCbHdlrTelemetry_g != NULL)
+            {
+                uiMaxLen = BleConnInfo_g.m_ui16Mtu - 3;
+                if (uiMaxLen > sizeof(abDevMntTelemetry_g))
+                {
+                    uiMaxLen = sizeof(abDevMntTelemetry_g);
+                }
+                iLen = pfnAppCbHdlrTelemetry_g(abDevMntTelemetry_g, uiMaxLen);
+                if (iLen > 0)
+                {
+                    ulStartTime = micros();
+                    BleNotifyCharacValue(pBleCharacDevMntDiag_g, ui16AttrHdlDevMntDiag_g, abDevMntTelemetry_g, iLen);
+                    ESP32BleCfgStats::RecordLatency(STATS_HIST_NOTIFY, (uint32_t)(micros() - ulStartTime));
+                    ESP32BleCfgStats::IncCounter(STATS_CNT_NOTIFY);
+                }
+            }
+
+            fBleNotify = true;
+        }
+
+        // coalesced notification of configuration values changed by the server
+        for (uiIdx=0; ui32NotifyMask != 0; uiIdx++)
+        {
+            if (ui32NotifyMask & (1UL << uiIdx))
+            {
+                ui32NotifyMask &= ~(1UL << uiIdx);
+                ulStartTime = micros();
+                if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+                {
+                    pabValue = BleGetCfgValue(uiIdx, &ValueLen);
+                    BleNotifyCharacValue(NULL, *BLE_CFG_CHARAC_LIST[uiIdx].m_pui16AttrHdl, pabValue, ValueLen);
+                }
+                else
+                {
+                    // value already set by <BleUpdateCharacValue()>
+                    (*BLE_CFG_CHARAC_LIST[uiIdx].m_ppBleCharac)->notify();
+                }
+                ESP32BleCfgStats::RecordLatency(STATS_HIST_NOTIFY, (uint32_t)(micros() - ulStartTime));
+                ESP32BleCfgStats::IncCounter(STATS_CNT_NOTIFY);
+
+                fBleNotify = true;
+            }
+        }
+
+        // remote log, only in iterations without other notifications (config transfer has priority)
+        if (fBleLogStarted_g && !fBleNotify && ((ulCurrTick - ulBleLogNotifyTick_g) >= BLE_LOG_NOTIFY_INTERVAL))
+        {
+            uiMaxLen = BleConnInfo_g.m_ui16Mtu - 3;
+            if (uiMaxLen > sizeof(abDevMntLog_g))
+            {
+                uiMaxLen = sizeof(abDevMntLog_g);
+            }
+            iLen = pfnAppCbHdlrLogSource_g(abDevMntLog_g, uiMaxLen);
+            if (iLen > 0)
+            {
+                ulStartTime = micros();
+                BleNotifyCharacValue(pBleCharacDevMntLog_g, ui16AttrHdlDevMntLog_g, abDevMntLog_g, iLen);
+                ESP32BleCfgStats::RecordLatency(STATS_HIST_NOTIFY, (uint32_t)(micros() - ulStartTime));
+                ESP32BleCfgStats::IncCounter(STATS_CNT_NOTIFY);
+                ulBleLogNotifyTick_g = ulCurrTick;
+                fBleNotify = true;
+            }
+        }
+
+        // relax Connection Parameters if config transfer is idle
+        if (BleConnInfo_g.m_fFastParamsActive && (ui32BleIdleTimeout_g > 0))
+        {
+            if ((ulCurrTick - ulBleLastActivityTick_g) >= ui32BleIdleTimeout_g)
+            {
+                TRACE0("BLE Config Transfer idle -> relax Connection Parameters\n");
+                BleRequestConnParams(&BleIdleConnParams_g);
+                BleConnInfo_g.m_fFastParamsActive = false;
+            }
+        }
+    }
+
+    // leave Config Mode if there was no client activity for the configured time
+    if ((ui32BleCfgModeTimeout_g > 0) && !fBleCfgModeTimedOut_g && (pBleServer_g != NULL))
+    {
+        if ((millis() - ulBleCfgModeActivityTick_g) >= ui32BleCfgModeTimeout_g)
+        {
+            TRACE1("BLE Config Mode idle for %lu ms -> timeout\n", (unsigned long)ui32BleCfgModeTimeout_g);
+            ESP32BleCfgStats::IncCounter(STATS_CNT_CFG_TIMEOUT);
+            fBleCfgModeTimedOut_g = true;
+        }
+    }
+
+    return (fBleNotify);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ProfileShutdown()
+//---------------------------------------------------------------------------
+//  Counterpart of <ProfileSetup()>: stops advertising, disconnects the
+//  client, deletes all services and deinitializes the Bluetooth stack and
+//  controller. Afterwards all BLE objects created by <ProfileSetup()> are
+//  deleted, so leaving and entering the BLE Config Mode doesn't leak heap
+//  memory. With <fReleaseMemory_p> = true, the memory of the BT
+//  Controller is released to the heap too. This is not reversible, so
+//  afterwards <ProfileSetup()> is refused until the next restart.
+//
+//  Return:     1 -> Profile shut down
+//              0 -> Profile was not running
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ProfileShutdown (
+        bool fReleaseMemory_p)
+{
+
+BLEService*    apBleServiceList[] = { pBleServiceDevMnt_g, pBleServiceWifi_g, pBleServiceAppRt_g, pBleServiceStream_g, pBleServiceOta_g };
+unsigned long  ulStartTick;
+unsigned int   uiIdx;
+
+    if (pBleServer_g == NULL)
+    {
+        return (0);
+    }
+
+    TRACE1("+ 'ProfileShutdown()': fReleaseMemory_p=%d\n", fReleaseMemory_p);
+
+    // no new connections during the teardown (also not by <onDisconnect()>)
+    fBleShutdownActive_g = true;
+    BLEDevice::stopAdvertising();
+
+    // disconnect client and wait (limited) for the disconnect event
+    if ( fBleClientConnected_g )
+    {
+        pBleServer_g->disconnect(pBleServer_g->getConnId());
+        ulStartTick = millis();
+        while (fBleClientConnected_g && ((millis() - ulStartTick) < BLE_DISCONNECT_TIMEOUT))
+        {
+            delay(10);
+        }
+    }
+
+    for (uiIdx=0; uiIdx<(sizeof(apBleServiceList)/sizeof(apBleServiceList[0])); uiIdx++)
+    {
+        if (apBleServiceList[uiIdx] != NULL)
+        {
+            pBleServer_g->removeService(apBleServiceList[uiIdx]);
+        }
+    }
+    for (uiIdx=0; uiIdx<BLE_ATTR_TAB_NUM; uiIdx++)
+    {
+        if (aui16AttrNumHdl_g[uiIdx] != 0)
+        {
+            esp_ble_gatts_delete_service(aui16AttrHdlService_g[uiIdx]);
+        }
+    }
+
+    BLEDevice::deinit(fReleaseMemory_p);
+    fBleMemReleased_g = fReleaseMemory_p;
+
+    DeleteBleObjects();
+    ClearBleObjectRefs();
+    fBleClientConnected_g = false;
+    BleConnInfo_g.m_fClientConnected  = false;
+    BleConnInfo_g.m_fFastParamsActive = false;
+    ui32BleNotifyPending_g = 0;
+    ESP32BleCfgStats::SetRadioState(STATS_RADIO_OFF);
+    fBleShutdownActive_g = false;
+
+    TRACE0("- 'ProfileShutdown()'\n");
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ProfileEnterNormalMode()
+//---------------------------------------------------------------------------
+//  Entry point for Normal Operation Mode, where BLE is not used at all.
+//  Releases the memory reserved for the BT Controller and the Bluedroid
+//  Host stack back to the heap. This must be called before any BLE
+//  initialization and is not reversible, so afterwards <ProfileSetup()>
+//  is refused until the next restart.
+//
+//  Return:    >=0 -> Number of bytes reclaimed for the heap
+//              -1 -> Profile is running (use <ProfileShutdown()> instead)
+//              -2 -> BT Controller is not idle
+//              -3 -> Releasing the memory failed
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ProfileEnterNormalMode ()
+{
+
+uint32_t   ui32FreeHeapBefore;
+uint32_t   ui32FreeHeapAfter;
+esp_err_t  EspRes;
+
+    if (pBleServer_g != NULL)
+    {
+        return (-1);
+    }
+
+    // memory already released (by a previous call or by <ProfileShutdown()>)
+    if ( fBleMemReleased_g )
+    {
+        return (0);
+    }
+
+    if (esp_bt_controller_get_status() != ESP_BT_CONTROLLER_STATUS_IDLE)
+    {
+        return (-2);
+    }
+
+    ui32FreeHeapBefore = ESP.getFreeHeap();
+    EspRes = esp_bt_mem_release(ESP_BT_MODE_BTDM);
+    if (EspRes != ESP_OK)
+    {
+        TRACE1("'ProfileEnterNormalMode()': esp_bt_mem_release failed (EspRes=%d)\n", (int)EspRes);
+        return (-3);
+    }
+    ui32FreeHeapAfter = ESP.getFreeHeap();
+    fBleMemReleased_g = true;
+
+    TRACE2("'ProfileEnterNormalMode()': Free Heap %u -> %u\n", ui32FreeHeapBefore, ui32FreeHeapAfter);
+
+    return ( (ui32FreeHeapAfter > ui32FreeHeapBefore) ? (int)(ui32FreeHeapAfter - ui32FreeHeapBefore) : 0 );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ProfileInitStack()
+//---------------------------------------------------------------------------
+//  Starts the BT Controller and the Bluedroid Host stack in advance of
+//  <ProfileSetup()>. This (slow) part of the bring-up doesn't need any
+//  configuration value, so the application can run it right from the
+//  start of its startup, e.g. as a boot stage without dependencies on the
+//  other core. The configuration dependent part follows by
+//  <ProfileInitHost()> resp. <ProfileSetup()>, which skip the steps
+//  already done (as <BLEDevice::init()> does for a running stack).
+//
+//  Return:     1 -> Stack started
+//              0 -> Stack was already running
+//             -2 -> Starting the BT Controller failed
+//             -3 -> Starting the Bluedroid stack failed
+//             -5 -> BT memory already released
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ProfileInitStack ()
+{
+
+esp_bt_controller_config_t  BtCfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
+
+    if ( fBleMemReleased_g )
+    {
+        return (-5);
+    }
+
+    if (BLEDevice::getInitialized() || (esp_bluedroid_get_status() == ESP_BLUEDROID_STATUS_ENABLED))
+    {
+        return (0);
+    }
+
+    if (esp_bt_controller_get_status() == ESP_BT_CONTROLLER_STATUS_IDLE)
+    {
+        if (esp_bt_controller_init(&BtCfg) != ESP_OK)
+        {
+            return (-2);
+        }
+    }
+    if (esp_bt_controller_get_status() == ESP_BT_CONTROLLER_STATUS_INITED)
+    {
+        if (esp_bt_controller_enable((esp_bt_mode_t)BtCfg.mode) != ESP_OK)
+        {
+            return (-2);
+        }
+    }
+
+    if (esp_bluedroid_get_status() == ESP_BLUEDROID_STATUS_UNINITIALIZED)
+    {
+        if (esp_bluedroid_init() != ESP_OK)
+        {
+            return (-3);
+        }
+    }
+    if (esp_bluedroid_get_status() != ESP_BLUEDROID_STATUS_ENABLED)
+    {
+        if (esp_bluedroid_enable() != ESP_OK)
+        {
+            return (-3);
+        }
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ProfileInitHost()
+//---------------------------------------------------------------------------
+//  Configuration dependent part of the bring-up in advance of
+//  <ProfileSetup()>: initializes the BLE library on top of the stack
+//  started by <ProfileInitStack()> (GAP/GATTS registration) and sets the
+//  device name (esp_ble_gap_set_device_name()) from the configuration
+//  data. If the stack is not running yet, it is started here too.
+//
+//  Return:     1 -> BLE library initialized
+//              0 -> BLE library was already initialized
+//             -1 -> Error (invalid parameter)
+//             -5 -> BT memory already released
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ProfileInitHost (
+        const tAppCfgData* pAppCfgData_p)
+{
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    if ( fBleMemReleased_g )
+    {
+        return (-5);
+    }
+
+    if ( BLEDevice::getInitialized() )
+    {
+        return (0);
+    }
+
+    BLEDevice::init(std::string(pAppCfgData_p->m_szDevMntDevName, strnlen(pAppCfgData_p->m_szDevMntDevName, sizeof(pAppCfgData_p->m_szDevMntDevName))));
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  IsProfileActive()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::IsProfileActive ()
+{
+
+    return ( pBleServer_g != NULL );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  IsBleClientConnected()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::IsBleClientConnected ()
+{
+
+    return ( fBleClientConnected_g );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GetProfileHash()
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgProfile::GetProfileHash ()
+{
+
+    return ( ui32DevMntProfHash_g );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  SetConnParams()
+//---------------------------------------------------------------------------
+//  Must be called before <ProfileSetup()>. Parameters given as NULL resp. 0
+//  keep the default values untouched. An Idle Timeout of 0 disables the
+//  relaxing of the Connection Parameters.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::SetConnParams (
+        const tBleConnParams* pFastConnParams_p,
+        const tBleConnParams* pIdleConnParams_p,
+        uint32_t ui32IdleTimeout_p,
+        uint16_t ui16Mtu_p)
+{
+
+    if (pFastConnParams_p != NULL)
+    {
+        BleFastConnParams_g = *pFastConnParams_p;
+    }
+
+    if (pIdleConnParams_p != NULL)
+    {
+        BleIdleConnParams_g = *pIdleConnParams_p;
+    }
+
+    ui32BleIdleTimeout_g = ui32IdleTimeout_p;
+
+    if (ui16Mtu_p != 0)
+    {
+        ui16BleLocalMtu_g = ui16Mtu_p;
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  SetCfgModeTimeout()
+//---------------------------------------------------------------------------
+//  Time without connect, disconnect or write request of a client, after
+//  which <IsCfgModeTimedOut()> signals that the BLE Config Mode should be
+//  left [ms]. A Timeout of 0 disables the supervision (default). Can be
+//  changed at any time, the timeout refers to the last client activity.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::SetCfgModeTimeout (
+        uint32_t ui32Timeout_p)
+{
+
+    ui32BleCfgModeTimeout_g = ui32Timeout_p;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  IsCfgModeTimedOut()
+//---------------------------------------------------------------------------
+//  Return:     true  -> Config Mode Idle Timeout elapsed (checked by
+//                       <ProfileLoop()>, reset by <ProfileSetup()>)
+//              false -> client activity within timeout resp. disabled
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::IsCfgModeTimedOut ()
+{
+
+    return ( fBleCfgModeTimedOut_g );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  SetTelemetrySource()
+//---------------------------------------------------------------------------
+//  Sets the source of the telemetry record, which is notified once per
+//  second on [DevMnt/Diagnostics] while a client is connected. The handler
+//  is called by <ProfileLoop()> and returns the size of the record (<= 0
+//  -> nothing to send). NULL stops the telemetry notifications.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::SetTelemetrySource (
+        tCbHdlrTelemetry pfnAppCbHdlrTelemetry_p)
+{
+
+    pfnAppCbHdlrTelemetry_g = pfnAppCbHdlrTelemetry_p;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  EnableStream()
+//---------------------------------------------------------------------------
+//  Must be called before <ProfileSetup()>. Enables the optional service
+//  [Stream], which writes the received blob into the data partition with
+//  the given label. The previous content of this partition gets lost.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::EnableStream (
+        const char* pszPartLabel_p,
+        tCbHdlrStreamDone pfnAppCbHdlrStreamDone_p)
+{
+
+    pszStreamPartLabel_g     = pszPartLabel_p;
+    pfnAppCbHdlrStreamDone_g = pfnAppCbHdlrStreamDone_p;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  EnableOta()
+//---------------------------------------------------------------------------
+//  Must be called before <ProfileSetup()>. Enables the optional service
+//  [OTA] for firmware updates via BLE. Requires a partition scheme with
+//  two OTA app partitions.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::EnableOta (
+        tCbHdlrOtaDone pfnAppCbHdlrOtaDone_p)
+{
+
+    fOtaEnabled_g         = true;
+    pfnAppCbHdlrOtaDone_g = pfnAppCbHdlrOtaDone_p;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  EnableLog()
+//---------------------------------------------------------------------------
+//  Must be called before <ProfileSetup()>. Enables the optional
+//  characteristic [DevMnt/Log], which streams the packets provided by the
+//  given source (e.g. ESP32BleCfgLog::GetPacket) to a client that has
+//  started the log stream. The source returns the size of the next packet
+//  (<= 0 -> nothing to send).
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::EnableLog (
+        tCbHdlrLogSource pfnAppCbHdlrLogSource_p)
+{
+
+    pfnAppCbHdlrLogSource_g = pfnAppCbHdlrLogSource_p;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  SetGattBackend()
+//---------------------------------------------------------------------------
+//  Must be called before <ProfileSetup()>. Selects how the GATT Database
+//  of the core services [DevMnt], [Wifi] and [AppRt] is built:
+//
+//  BLE_GATT_BACKEND_OBJECTS:     BLEService/BLECharacteristic objects of
+//                                the BLE library (default)
+//  BLE_GATT_BACKEND_ATTR_TABLE:  one constant attribute table per service,
+//                                registered by a single call each
+//
+//  The optional services [Stream] and [OTA] are always object based.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::SetGattBackend (
+        uint8_t ui8GattBackend_p)
+{
+
+    // backend can't be changed while the profile is running
+    if (pBleServer_g != NULL)
+    {
+        return;
+    }
+
+    if (ui8GattBackend_p == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        ui8BleGattBackend_g = BLE_GATT_BACKEND_ATTR_TABLE;
+    }
+    else
+    {
+        ui8BleGattBackend_g = BLE_GATT_BACKEND_OBJECTS;
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GetGattSetupTime()
+//---------------------------------------------------------------------------
+//  Time needed by the last <ProfileSetup()> to build the GATT Database of
+//  the core services [us].
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgProfile::GetGattSetupTime ()
+{
+
+    return ( ui32BleGattSetupTime_g );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GetConnInfo()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::GetConnInfo (
+        tBleConnInfo* pConnInfo_p)
+{
+
+    if (pConnInfo_p == NULL)
+    {
+        return (false);
+    }
+
+    if ( BleConnInfo_g.m_fClientConnected )
+    {
+        BleConnInfo_g.m_ui32SessionDuration = (uint32_t)(millis() - ulBleConnectTick_g);
+    }
+
+    *pConnInfo_p = BleConnInfo_g;
+
+    return ( BleConnInfo_g.m_fClientConnected );
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ReadDataFromBleCharacterisics
+//---------------------------------------------------------------------------
+//  With BLE_GATT_BACKEND_ATTR_TABLE all values written by the client are
+//  taken over directly into the instance workspace, so nothing is to do.
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::ReadDataFromBleCharacterisics ()
+{
+
+uint8_t*  pui8Data;
+bool      fSuccess;
+
+
+    if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        return (true);
+    }
+
+    TRACE0("+ 'ReadDataFromBleCharacterisics()...'\n");
+
+    fSuccess = true;
+
+
+    // ---- [DevMnt/DevName] ----
+    BleGetCharacString(pBleCharacDevMntDevName_g, szDevMntDevName_g, sizeof(szDevMntDevName_g));
+
+
+    // ---- [Wifi/SSID] ----
+    BleGetCharacString(pBleCharacWifiSSID_g, szWifiSSID_g, sizeof(szWifiSSID_g));
+
+    // ---- [Wifi/Passwd] ----
+    BleGetCharacString(pBleCharacWifiPasswd_g, szWifiPasswd_g, sizeof(szWifiPasswd_g));
+
+    // ---- [Wifi/OwnAddr] ----
+    BleGetCharacString(pBleCharacWifiOwnAddr_g, szWifiOwnAddr_g, sizeof(szWifiOwnAddr_g));
+
+    // ---- [Wifi/OwnMode] ----
+    pui8Data = pBleCharacWifiOwnMode_g->getData();
+    if (pui8Data != NULL)
+    {
+        ui16WifiOwnMode_g = (uint16_t)(*pui8Data);
+    }
+
+
+    // ---- [AppRt/Opt1] ----
+    pui8Data = (pBleCharacAppRtOpt1_g != NULL) ? pBleCharacAppRtOpt1_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt1_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt2] ----
+    pui8Data = (pBleCharacAppRtOpt2_g != NULL) ? pBleCharacAppRtOpt2_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt2_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt3] ----
+    pui8Data = (pBleCharacAppRtOpt3_g != NULL) ? pBleCharacAppRtOpt3_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt3_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt4] ----
+    pui8Data = (pBleCharacAppRtOpt4_g != NULL) ? pBleCharacAppRtOpt4_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt4_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt5] ----
+    pui8Data = (pBleCharacAppRtOpt5_g != NULL) ? pBleCharacAppRtOpt5_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt5_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt6] ----
+    pui8Data = (pBleCharacAppRtOpt6_g != NULL) ? pBleCharacAppRtOpt6_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt6_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt7] ----
+    pui8Data = (pBleCharacAppRtOpt7_g != NULL) ? pBleCharacAppRtOpt7_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt7_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/Opt8] ----
+    pui8Data = (pBleCharacAppRtOpt8_g != NULL) ? pBleCharacAppRtOpt8_g->getData() : NULL;
+    if (pui8Data != NULL)
+    {
+        ui16AppRtOpt8_g = (*pui8Data > 0) ? 1 : 0;
+    }
+
+    // ---- [AppRt/PeerAddr] ----
+    BleGetCharacString(pBleCharacAppRtPeerAddr_g, szAppRtPeerAddr_g, sizeof(szAppRtPeerAddr_g));
+
+    TRACE0("- 'ReadDataFromBleCharacterisics()'\n");
+
+    return (fSuccess);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: WriteDataToBleCharacterisics
+//---------------------------------------------------------------------------
+//  Counterpart of <ReadDataFromBleCharacterisics()>: sets the values of all
+//  characteristics from the instance workspace, in the same way as it is
+//  done by a write access of the client.
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgProfile::WriteDataToBleCharacterisics ()
+{
+
+const uint16_t*  apui16AppRtOpt[] = { &ui16AppRtOpt1_g, &ui16AppRtOpt2_g, &ui16AppRtOpt3_g, &ui16AppRtOpt4_g,
+                                      &ui16AppRtOpt5_g, &ui16AppRtOpt6_g, &ui16AppRtOpt7_g, &ui16AppRtOpt8_g };
+unsigned int     uiIdx;
+
+    if (pBleServer_g == NULL)
+    {
+        return (false);
+    }
+
+    // ---- [DevMnt/DevName] ----
+    BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_DEVMNT_DEVNAME, szDevMntDevName_g, strnlen(szDevMntDevName_g, sizeof(szDevMntDevName_g)));
+
+
+    // ---- [Wifi/SSID] ----
+    BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_WIFI_SSID, szWifiSSID_g, strnlen(szWifiSSID_g, sizeof(szWifiSSID_g)));
+
+    // ---- [Wifi/Passwd] ----
+    BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_WIFI_PASSWD, szWifiPasswd_g, strnlen(szWifiPasswd_g, sizeof(szWifiPasswd_g)));
+
+    // ---- [Wifi/OwnAddr] ----
+    BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_WIFI_OWNADDR, szWifiOwnAddr_g, strnlen(szWifiOwnAddr_g, sizeof(szWifiOwnAddr_g)));
+
+    // ---- [Wifi/OwnMode] ----
+    BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_WIFI_OWNMODE, &ui16WifiOwnMode_g, sizeof(ui16WifiOwnMode_g));
+
+
+    // ---- [AppRt/Opt1..8] ----
+    for (uiIdx=0; uiIdx<8; uiIdx++)
+    {
+        BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_APP_RT_OPT1 + uiIdx, apui16AppRtOpt[uiIdx], sizeof(uint16_t));
+    }
+
+    // ---- [AppRt/PeerAddr] ----
+    BleUpdateCharacValue(BLE_CFG_CHARAC_IDX_APP_RT_PEERADDR, szAppRtPeerAddr_g, strnlen(szAppRtPeerAddr_g, sizeof(szAppRtPeerAddr_g)));
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ImportInstanceWorkspace()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ImportInstanceWorkspace (
+        const tAppCfgData* pAppCfgData_p)
+{
+
+    TRACE0("+ 'ImportInstanceWorkspace()...'\n");
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    if (sizeof(szDevMntDevName_g) < sizeof(pAppCfgData_p->m_szDevMntDevName))
+    {
+        return (-2);
+    }
+    memcpy(szDevMntDevName_g, pAppCfgData_p->m_szDevMntDevName, sizeof(pAppCfgData_p->m_szDevMntDevName));
+
+    if (sizeof(szWifiSSID_g) < sizeof(pAppCfgData_p->m_szWifiSSID))
+    {
+        return (-3);
+    }
+    memcpy(szWifiSSID_g, pAppCfgData_p->m_szWifiSSID, sizeof(pAppCfgData_p->m_szWifiSSID));
+
+    if (sizeof(szWifiPasswd_g) < sizeof(pAppCfgData_p->m_szWifiPasswd))
+    {
+        return (-4);
+    }
+    memcpy(szWifiPasswd_g, pAppCfgData_p->m_szWifiPasswd, sizeof(pAppCfgData_p->m_szWifiPasswd));
+
+    if (sizeof(szWifiOwnAddr_g) < sizeof(pAppCfgData_p->m_szWifiOwnAddr))
+    {
+        return (-5);
+    }
+    memcpy(szWifiOwnAddr_g, pAppCfgData_p->m_szWifiOwnAddr, sizeof(pAppCfgData_p->m_szWifiOwnAddr));
+
+    ui16WifiOwnMode_g = (uint16_t) pAppCfgData_p->m_ui8WifiOwnMode;
+
+    ui16AppRtOpt1_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt1 ? 1 : 0);
+    ui16AppRtOpt2_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt2 ? 1 : 0);
+    ui16AppRtOpt3_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt3 ? 1 : 0);
+    ui16AppRtOpt4_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt4 ? 1 : 0);
+    ui16AppRtOpt5_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt5 ? 1 : 0);
+    ui16AppRtOpt6_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt6 ? 1 : 0);
+    ui16AppRtOpt7_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt7 ? 1 : 0);
+    ui16AppRtOpt8_g = (uint16_t) (pAppCfgData_p->m_fAppRtOpt8 ? 1 : 0);
+
+    if (sizeof(szAppRtPeerAddr_g) < sizeof(pAppCfgData_p->m_szAppRtPeerAddr))
+    {
+        return (-6);
+    }
+    memcpy(szAppRtPeerAddr_g, pAppCfgData_p->m_szAppRtPeerAddr, sizeof(pAppCfgData_p->m_szAppRtPeerAddr));
+
+    TRACE0("- 'ImportInstanceWorkspace()'\n");
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ExportInstanceWorkspace()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::ExportInstanceWorkspace (
+        tAppCfgData* pAppCfgData_p)
+{
+
+    TRACE0("+ 'ExportInstanceWorkspace()...'\n");
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    memset(pAppCfgData_p, 0x00, sizeof(*pAppCfgData_p));
+
+    if (sizeof(pAppCfgData_p->m_szDevMntDevName) < sizeof(szDevMntDevName_g))
+    {
+        return (-2);
+    }
+    memcpy(pAppCfgData_p->m_szDevMntDevName, szDevMntDevName_g, sizeof(pAppCfgData_p->m_szDevMntDevName));
+
+    if (sizeof(pAppCfgData_p->m_szWifiSSID) < sizeof(szWifiSSID_g))
+    {
+        return (-3);
+    }
+    memcpy(pAppCfgData_p->m_szWifiSSID, szWifiSSID_g, sizeof(pAppCfgData_p->m_szWifiSSID));
+
+    if (sizeof(pAppCfgData_p->m_szWifiPasswd) < sizeof(szWifiPasswd_g))
+    {
+        return (-4);
+    }
+    memcpy(pAppCfgData_p->m_szWifiPasswd, szWifiPasswd_g, sizeof(pAppCfgData_p->m_szWifiPasswd));
+
+    if (sizeof(pAppCfgData_p->m_szWifiOwnAddr) < sizeof(szWifiOwnAddr_g))
+    {
+        return (-5);
+    }
+    memcpy(pAppCfgData_p->m_szWifiOwnAddr, szWifiOwnAddr_g, sizeof(pAppCfgData_p->m_szWifiOwnAddr));
+
+    pAppCfgData_p->m_ui8WifiOwnMode = (uint8_t)ui16WifiOwnMode_g;
+
+    pAppCfgData_p->m_fAppRtOpt1 = (ui16AppRtOpt1_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt2 = (ui16AppRtOpt2_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt3 = (ui16AppRtOpt3_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt4 = (ui16AppRtOpt4_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt5 = (ui16AppRtOpt5_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt6 = (ui16AppRtOpt6_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt7 = (ui16AppRtOpt7_g == 0) ? false : true;
+    pAppCfgData_p->m_fAppRtOpt8 = (ui16AppRtOpt8_g == 0) ? false : true;
+
+    if (sizeof(pAppCfgData_p->m_szAppRtPeerAddr) < sizeof(szAppRtPeerAddr_g))
+    {
+        return (-6);
+    }
+    memcpy(pAppCfgData_p->m_szAppRtPeerAddr, szAppRtPeerAddr_g, sizeof(pAppCfgData_p->m_szAppRtPeerAddr));
+
+    TRACE0("- 'ExportInstanceWorkspace()'\n");
+
+    return (1);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: DeleteBleObjects()
+//---------------------------------------------------------------------------
+//  The BLE library doesn't delete the server, services, characteristics and
+//  descriptors (neither by <removeService()> nor by <BLEDevice::deinit()>),
+//  they are owned by the application. Only called after <BLEDevice::deinit()>,
+//  so no event can access the objects anymore. The callback objects are
+//  static and not deleted.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::DeleteBleObjects ()
+{
+
+BLECharacteristic*  apBleCharacList[] = { pBleCharacDevMntDevType_g, pBleCharacDevMntSysTickCnt_g, pBleCharacDevMntDevName_g,
+                                          pBleCharacDevMntSaveCfg_g, pBleCharacDevMntRstDev_g, pBleCharacDevMntProfHash_g,
+                                          pBleCharacDevMntDiag_g, pBleCharacDevMntCfgPatch_g, pBleCharacDevMntCfgImage_g,
+                                          pBleCharacDevMntLog_g,
+                                          pBleCharacWifiSSID_g, pBleCharacWifiPasswd_g, pBleCharacWifiOwnAddr_g, pBleCharacWifiOwnMode_g,
+                                          pBleCharacAppRtOpt1_g, pBleCharacAppRtOpt2_g, pBleCharacAppRtOpt3_g, pBleCharacAppRtOpt4_g,
+                                          pBleCharacAppRtOpt5_g, pBleCharacAppRtOpt6_g, pBleCharacAppRtOpt7_g, pBleCharacAppRtOpt8_g,
+                                          pBleCharacAppRtPeerAddr_g,
+                                          pBleCharacStreamCtrl_g, pBleCharacStreamData_g,
+                                          pBleCharacOtaCtrl_g, pBleCharacOtaData_g };
+BLEService*         apBleServiceList[] = { pBleServiceDevMnt_g, pBleServiceWifi_g, pBleServiceAppRt_g, pBleServiceStream_g, pBleServiceOta_g };
+unsigned int        uiIdx;
+
+    for (uiIdx=0; uiIdx<(sizeof(apBleCharacList)/sizeof(apBleCharacList[0])); uiIdx++)
+    {
+        delete apBleCharacList[uiIdx];
+    }
+    for (uiIdx=0; uiIdx<(sizeof(apBleServiceList)/sizeof(apBleServiceList[0])); uiIdx++)
+    {
+        delete apBleServiceList[uiIdx];
+    }
+    for (uiIdx=0; uiIdx<uiBleDescriptorCnt_g; uiIdx++)
+    {
+        delete apBleDescriptor_g[uiIdx];
+        apBleDescriptor_g[uiIdx] = NULL;
+    }
+    uiBleDescriptorCnt_g = 0;
+
+    delete pBleServer_g;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ClearBleObjectRefs()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::ClearBleObjectRefs ()
+{
+
+unsigned int  uiIdx;
+
+    pBleServer_g                    = NULL;
+
+    pBleServiceDevMnt_g             = NULL;
+    pBleCharacDevMntDevType_g       = NULL;
+    pBleCharacDevMntSysTickCnt_g    = NULL;
+    pBleCharacDevMntDevName_g       = NULL;
+    pBleCharacDevMntSaveCfg_g       = NULL;
+    pBleCharacDevMntRstDev_g        = NULL;
+    pBleCharacDevMntProfHash_g      = NULL;
+    pBleCharacDevMntDiag_g          = NULL;
+    pBleCharacDevMntCfgPatch_g      = NULL;
+    pBleCharacDevMntCfgImage_g      = NULL;
+    pBleCharacDevMntLog_g           = NULL;
+
+    pBleServiceWifi_g               = NULL;
+    pBleCharacWifiSSID_g            = NULL;
+    pBleCharacWifiPasswd_g          = NULL;
+    pBleCharacWifiOwnAddr_g         = NULL;
+    pBleCharacWifiOwnMode_g         = NULL;
+
+    pBleServiceAppRt_g              = NULL;
+    pBleCharacAppRtOpt1_g           = NULL;
+    pBleCharacAppRtOpt2_g           = NULL;
+    pBleCharacAppRtOpt3_g           = NULL;
+    pBleCharacAppRtOpt4_g           = NULL;
+    pBleCharacAppRtOpt5_g           = NULL;
+    pBleCharacAppRtOpt6_g           = NULL;
+    pBleCharacAppRtOpt7_g           = NULL;
+    pBleCharacAppRtOpt8_g           = NULL;
+    pBleCharacAppRtPeerAddr_g       = NULL;
+
+    pBleServiceStream_g             = NULL;
+    pBleCharacStreamCtrl_g          = NULL;
+    pBleCharacStreamData_g          = NULL;
+
+    pBleServiceOta_g                = NULL;
+    pBleCharacOtaCtrl_g             = NULL;
+    pBleCharacOtaData_g             = NULL;
+
+    BleGattsIf_g                    = ESP_GATT_IF_NONE;
+    memset(aui16AttrHdlService_g, 0, sizeof(aui16AttrHdlService_g));
+    memset(aui16AttrNumHdl_g, 0, sizeof(aui16AttrNumHdl_g));
+    memset(apBleAttrTab_g, 0, sizeof(apBleAttrTab_g));
+    for (uiIdx=0; uiIdx<(sizeof(BLE_ATTR_HDL_REF_LIST)/sizeof(BLE_ATTR_HDL_REF_LIST[0])); uiIdx++)
+    {
+        *BLE_ATTR_HDL_REF_LIST[uiIdx].m_pui16AttrHdl = 0;
+    }
+    ui16BlePrepWriteHdl_g           = 0;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CreateObjServices()
+//---------------------------------------------------------------------------
+//  Builds the core services [DevMnt], [Wifi] and [AppRt] from objects of
+//  the BLE library (BLE_GATT_BACKEND_OBJECTS).
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::CreateObjServices (
+        const tAppDescriptData* pAppDescriptData_p)
+{
+
+BLEDescriptor*  pBleDescriptor;
+
+
+    // ======= [ SERVICE #1 [Device Management] ] =======
+    {
+        TRACE0("   SERVICE #1 [Device Management]\n");
+        pBleServiceDevMnt_g = pBleServer_g->createService(BLEUUID(BLE_UUID_DEVMNT_SERVICE), NUM_HANDLES_DEVMNT_SERVICE + ((pfnAppCbHdlrLogSource_g != NULL) ? NUM_HANDLES_DEVMNT_LOG : 0), 0);
+
+        // ---- [ CHARACTERISTIC #1 [DevMnt/DevType] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #1 [DevMnt/DevType]\n");
+            pBleCharacDevMntDevType_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_DEVTYPE_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ
+                                                        );
+            pBleCharacDevMntDevType_g->setValue(ui32DevMntDevType_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_DEVTYPE_DSCRPT);
+            pBleDescriptor->setValue("Device Type");
+            pBleCharacDevMntDevType_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #2 [DevMnt/SysTickCnt] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #2 [DevMnt/SysTickCnt]\n");
+            pBleCharacDevMntSysTickCnt_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_SYSTICKCNT_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacDevMntSysTickCnt_g->setValue(ui32DevMntSysTickCnt_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_SYSTICKCNT_DSCRPT);
+            pBleDescriptor->setValue("System Tick Count");
+            pBleCharacDevMntSysTickCnt_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #3 [DevMnt/DevName] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #3 [DevMnt/DevName]\n");
+            pBleCharacDevMntDevName_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_DEVNAME_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacDevMntDevName_g->setValue(szDevMntDevName_g);
+            pBleCharacDevMntDevName_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_DEVNAME_DSCRPT);
+            pBleDescriptor->setValue("Device Name");
+            pBleCharacDevMntDevName_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #4 [DevMnt/SaveConfig] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #4 [DevMnt/SaveConfig]\n");
+            pBleCharacDevMntSaveCfg_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_SAVE_CFG_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_WRITE
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_SAVE_CFG_DSCRPT);
+            pBleDescriptor->setValue("Save Conig");
+            pBleCharacDevMntSaveCfg_g->addDescriptor(pBleDescriptor);
+            pBleCharacDevMntSaveCfg_g->setCallbacks(&BleCharacteristicDevMntSaveConfigCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #5 [DevMnt/RstDev] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #5 [DevMnt/RstDev]\n");
+            pBleCharacDevMntRstDev_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_RST_DEV_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_WRITE
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_RST_DEV_DSCRPT);
+            pBleDescriptor->setValue("Restart Device");
+            pBleCharacDevMntRstDev_g->addDescriptor(pBleDescriptor);
+            pBleCharacDevMntRstDev_g->setCallbacks(&BleCharacteristicDevMntRestartDevCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #6 [DevMnt/ProfileHash] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #6 [DevMnt/ProfileHash]\n");
+            pBleCharacDevMntProfHash_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_PROFHASH_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ
+                                                        );
+            pBleCharacDevMntProfHash_g->setValue(ui32DevMntProfHash_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_PROFHASH_DSCRPT);
+            pBleDescriptor->setValue("Profile Hash");
+            pBleCharacDevMntProfHash_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #7 [DevMnt/Diagnostics] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #7 [DevMnt/Diagnostics]\n");
+            pBleCharacDevMntDiag_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_DIAG_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_DIAG_DSCRPT);
+            pBleDescriptor->setValue("Diagnostics");
+            pBleCharacDevMntDiag_g->addDescriptor(pBleDescriptor);
+            pBleCharacDevMntDiag_g->setCallbacks(&BleCharacteristicDevMntDiagCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #8 [DevMnt/ConfigPatch] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #8 [DevMnt/ConfigPatch]\n");
+            pBleCharacDevMntCfgPatch_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_CFGPATCH_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_CFGPATCH_DSCRPT);
+            pBleDescriptor->setValue("Config Patch");
+            pBleCharacDevMntCfgPatch_g->addDescriptor(pBleDescriptor);
+            pBleCharacDevMntCfgPatch_g->setCallbacks(&BleCharacteristicDevMntCfgPatchCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #9 [DevMnt/ConfigImage] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #9 [DevMnt/ConfigImage]\n");
+            pBleCharacDevMntCfgImage_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_CFGIMAGE_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_CFGIMAGE_DSCRPT);
+            pBleDescriptor->setValue("Config Image");
+            pBleCharacDevMntCfgImage_g->addDescriptor(pBleDescriptor);
+            pBleCharacDevMntCfgImage_g->setCallbacks(&BleCharacteristicDevMntCfgImageCallbacks_g);
+        }
+
+        // ---- [ CHARACTERISTIC #10 [DevMnt/Log] ] ---- (optional, must be the last one)
+        if (pfnAppCbHdlrLogSource_g != NULL)
+        {
+            TRACE0("     CHARACTERISTIC #10 [DevMnt/Log]\n");
+            pBleCharacDevMntLog_g = pBleServiceDevMnt_g->createCharacteristic(
+                                                            BLE_UUID_DEVMNT_LOG_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_DEVMNT_LOG_DSCRPT);
+            pBleDescriptor->setValue("Log");
+            pBleCharacDevMntLog_g->addDescriptor(pBleDescriptor);
+            pBleCharacDevMntLog_g->setCallbacks(&BleCharacteristicDevMntLogCallbacks_g);
+        }
+
+        pBleServiceDevMnt_g->start();
+    }
+
+
+    // ======= [ SERVICE #2 [WIFI Config] ] =======
+    {
+        TRACE0("   SERVICE #2 [WIFI Config]\n");
+        pBleServiceWifi_g = pBleServer_g->createService(BLEUUID(BLE_UUID_WIFI_SERVICE), NUM_HANDLES_WIFI_SERVICE, 0);
+
+        // ---- [ CHARACTERISTIC #1 [Wifi/SSID] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #1 [Wifi/SSID]\n");
+            pBleCharacWifiSSID_g = pBleServiceWifi_g->createCharacteristic(
+                                                            BLE_UUID_WIFI_SSID_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacWifiSSID_g->setValue(szWifiSSID_g);
+            pBleCharacWifiSSID_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_WIFI_SSID_DSCRPT);
+            pBleDescriptor->setValue("WIFI SSID");
+            pBleCharacWifiSSID_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #2 [Wifi/Passwd] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #2 [Wifi/Passwd]\n");
+            pBleCharacWifiPasswd_g = pBleServiceWifi_g->createCharacteristic(
+                                                            BLE_UUID_WIFI_PASSWD_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacWifiPasswd_g->setValue(szWifiPasswd_g);
+            pBleCharacWifiPasswd_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_WIFI_PASSWD_DSCRPT);
+            pBleDescriptor->setValue("WIFI PASSWD");
+            pBleCharacWifiPasswd_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #3 [Wifi/OwnAddr] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #3 [Wifi/OwnAddr]\n");
+            pBleCharacWifiOwnAddr_g = pBleServiceWifi_g->createCharacteristic(
+                                                            BLE_UUID_WIFI_OWNADDR_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacWifiOwnAddr_g->setValue(szWifiOwnAddr_g);
+            pBleCharacWifiOwnAddr_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_WIFI_OWNADDR_DSCRPT);
+            pBleDescriptor->setValue("Own Address");
+            pBleCharacWifiOwnAddr_g->addDescriptor(pBleDescriptor);
+        }
+
+        // ---- [ CHARACTERISTIC #4 [Wifi/OwnMode] ] ----
+        {
+            TRACE0("     CHARACTERISTIC #4 [Wifi/OwnMode]\n");
+            pBleCharacWifiOwnMode_g = pBleServiceWifi_g->createCharacteristic(
+                                                            BLE_UUID_WIFI_OWNMODE_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacWifiOwnMode_g->setValue((uint16_t&)ui16WifiOwnMode_g);
+            pBleCharacWifiOwnMode_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            pBleDescriptor = NewBleDescriptor(BLE_UUID_WIFI_OWNMODE_DSCRPT);
+            pBleDescriptor->setValue("Own Mode");
+            pBleCharacWifiOwnMode_g->addDescriptor(pBleDescriptor);
+            if (pAppDescriptData_p != NULL)
+            {
+                // set descriptor with supported WIFI modes (Station/Client, AccessPoint)
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_WIFI_OWNMODE_DSCRPT_FEATLIST);
+                pBleDescriptor->setValue((uint8_t*)&ui16WifiOwnModeFeatList_g, sizeof(ui16WifiOwnModeFeatList_g));
+                pBleCharacWifiOwnMode_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        pBleServiceWifi_g->start();
+    }
+
+
+    // ======= [ SERVICE #3 [APP RT Config] ] =======
+    {
+        TRACE0("   SERVICE #3 [APP RT Config]\n");
+        pBleServiceAppRt_g = pBleServer_g->createService(BLEUUID(BLE_UUID_APP_RT_SERVICE), ui16AppRtNumHandles_g, 0);
+
+        // ---- [ CHARACTERISTIC #1 [AppRt/Opt1] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 0))
+        {
+            TRACE0("     CHARACTERISTIC #1 [AppRt/Opt1]\n");
+            pBleCharacAppRtOpt1_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT1_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt1_g->setValue((uint16_t&)ui16AppRtOpt1_g);
+            pBleCharacAppRtOpt1_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt1 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT1_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt1);
+                pBleCharacAppRtOpt1_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #2 [AppRt/Opt2] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 1))
+        {
+            TRACE0("     CHARACTERISTIC #2 [AppRt/Opt2]\n");
+            pBleCharacAppRtOpt2_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT2_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt2_g->setValue((uint16_t&)ui16AppRtOpt2_g);
+            pBleCharacAppRtOpt2_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt2 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT2_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt2);
+                pBleCharacAppRtOpt2_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #3 [AppRt/Opt3] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 2))
+        {
+            TRACE0("     CHARACTERISTIC #3 [AppRt/Opt3]\n");
+            pBleCharacAppRtOpt3_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT3_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt3_g->setValue((uint16_t&)ui16AppRtOpt3_g);
+            pBleCharacAppRtOpt3_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt3 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT3_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt3);
+                pBleCharacAppRtOpt3_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #4 [AppRt/Opt4] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 3))
+        {
+            TRACE0("     CHARACTERISTIC #4 [AppRt/Opt4]\n");
+            pBleCharacAppRtOpt4_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT4_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt4_g->setValue((uint16_t&)ui16AppRtOpt4_g);
+            pBleCharacAppRtOpt4_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt4 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT4_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt4);
+                pBleCharacAppRtOpt4_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #5[AppRt/Opt5] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 4))
+        {
+            TRACE0("     CHARACTERISTIC #5 [AppRt/Opt5]\n");
+            pBleCharacAppRtOpt5_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT5_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt5_g->setValue((uint16_t&)ui16AppRtOpt5_g);
+            pBleCharacAppRtOpt5_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt5 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT5_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt5);
+                pBleCharacAppRtOpt5_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #6 [AppRt/Opt6] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 5))
+        {
+            TRACE0("     CHARACTERISTIC #6 [AppRt/Opt6]\n");
+            pBleCharacAppRtOpt6_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT6_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt6_g->setValue((uint16_t&)ui16AppRtOpt6_g);
+            pBleCharacAppRtOpt6_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt6 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT6_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt6);
+                pBleCharacAppRtOpt6_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #7 [AppRt/Opt7] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 6))
+        {
+            TRACE0("     CHARACTERISTIC #7 [AppRt/Opt7]\n");
+            pBleCharacAppRtOpt7_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT7_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt7_g->setValue((uint16_t&)ui16AppRtOpt7_g);
+            pBleCharacAppRtOpt7_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt7 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT7_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt7);
+                pBleCharacAppRtOpt7_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #8 [AppRt/Opt8] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 7))
+        {
+            TRACE0("     CHARACTERISTIC #8 [AppRt/Opt8]\n");
+            pBleCharacAppRtOpt8_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_OPT8_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtOpt8_g->setValue((uint16_t&)ui16AppRtOpt8_g);
+            pBleCharacAppRtOpt8_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelOpt8 != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_OPT8_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelOpt8);
+                pBleCharacAppRtOpt8_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        // ---- [ CHARACTERISTIC #9 [AppRt/PeerAddr] ] ----
+        if (ui16AppRtCharacMask_g & (1 << 8))
+        {
+            TRACE0("     CHARACTERISTIC #9 [AppRt/PeerAddr]\n");
+            pBleCharacAppRtPeerAddr_g = pBleServiceAppRt_g->createCharacteristic(
+                                                            BLE_UUID_APP_RT_PEERADDR_CHARACTRSTC,
+                                                            BLECharacteristic::PROPERTY_READ  |
+                                                            BLECharacteristic::PROPERTY_WRITE |
+                                                            BLECharacteristic::PROPERTY_NOTIFY
+                                                        );
+            pBleCharacAppRtPeerAddr_g->setValue(szAppRtPeerAddr_g);
+            pBleCharacAppRtPeerAddr_g->setCallbacks(&BleCharacteristicCfgValueCallbacks_g);
+            if ( (pAppDescriptData_p != NULL) && (pAppDescriptData_p->m_pszLabelPeerAddr != NULL) )
+            {
+                pBleDescriptor = NewBleDescriptor(BLE_UUID_APP_RT_PEERADDR_DSCRPT);
+                pBleDescriptor->setValue(pAppDescriptData_p->m_pszLabelPeerAddr);
+                pBleCharacAppRtPeerAddr_g->addDescriptor(pBleDescriptor);
+            }
+        }
+
+        pBleServiceAppRt_g->start();
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CreateAttrTables()
+//---------------------------------------------------------------------------
+//  Builds the core services [DevMnt], [Wifi] and [AppRt] from the attribute
+//  tables (BLE_GATT_BACKEND_ATTR_TABLE). Each table is registered by one
+//  call, the handles are resolved in <BleAttrTabEventHandler()>. The table
+//  of [AppRt] is completed in <aBleAttrTabAppRt_g> with the labels of the
+//  application, entries without label are left out. Each wait for an event
+//  of the BLE task is limited to BLE_ATTR_TAB_TIMEOUT, the first timeout
+//  ends the setup with an error.
+//
+//  Return:     1 -> Services created and started
+//             -1 -> Semaphore could not be created
+//             -2 -> GATT Interface not registered
+//             -3 -> Creation of an attribute table failed (or timed out)
+//             -4 -> Start of a service failed (or timed out)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgProfile::CreateAttrTables (
+        const tAppDescriptData* pAppDescriptData_p)
+{
+
+const char*                 apszLabelList[9];
+const esp_gatts_attr_db_t*  pTmplEntry;
+unsigned int                auiAttrTabLen[BLE_ATTR_TAB_NUM];
+unsigned int                uiAppRtLen;
+unsigned long               ulStartTick;
+unsigned int                uiIdx;
+esp_err_t                   EspRes;
+int                         iRes;
+
+
+    if (hBleAttrTabEvent_g == NULL)
+    {
+        hBleAttrTabEvent_g = xSemaphoreCreateCounting(BLE_ATTR_TAB_NUM, 0);
+        if (hBleAttrTabEvent_g == NULL)
+        {
+            return (-1);
+        }
+    }
+    while (xSemaphoreTake(hBleAttrTabEvent_g, 0) == pdTRUE)
+    {
+        // drop events left over from a previous (failed) setup
+    }
+
+    // ESP_GATTS_REG_EVT is processed by the BLE task, maybe after <createServer()> has returned
+    ulStartTick = millis();
+    while ((BleGattsIf_g == ESP_GATT_IF_NONE) && ((millis() - ulStartTick) < BLE_ATTR_TAB_TIMEOUT))
+    {
+        delay(1);
+    }
+    if (BleGattsIf_g == ESP_GATT_IF_NONE)
+    {
+        return (-2);
+    }
+
+    // ---- [AppRt]: take over labels of the application ----
+    apszLabelList[0] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt1     : NULL;
+    apszLabelList[1] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt2     : NULL;
+    apszLabelList[2] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt3     : NULL;
+    apszLabelList[3] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt4     : NULL;
+    apszLabelList[4] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt5     : NULL;
+    apszLabelList[5] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt6     : NULL;
+    apszLabelList[6] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt7     : NULL;
+    apszLabelList[7] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelOpt8     : NULL;
+    apszLabelList[8] = (pAppDescriptData_p != NULL) ? pAppDescriptData_p->m_pszLabelPeerAddr : NULL;
+
+    aBleAttrTabAppRt_g[0] = BLE_ATTR_TAB_APP_RT[0];              // service declaration
+    uiAppRtLen = 1;
+    for (uiIdx=0; uiIdx<(sizeof(apszLabelList)/sizeof(apszLabelList[0])); uiIdx++)
+    {
+        if ((ui16AppRtCharacMask_g & (1 << uiIdx)) == 0)
+        {
+            continue;                                       // disabled by '#' label
+        }
+        pTmplEntry = &BLE_ATTR_TAB_APP_RT[1 + (uiIdx * 3)];  // declaration, value, label
+        aBleAttrTabAppRt_g[uiAppRtLen++] = pTmplEntry[0];
+        aBleAttrTabAppRt_g[uiAppRtLen++] = pTmplEntry[1];
+        if (apszLabelList[uiIdx] != NULL)
+        {
+            aBleAttrTabAppRt_g[uiAppRtLen] = pTmplEntry[2];
+            aBleAttrTabAppRt_g[uiAppRtLen].att_desc.value   = (uint8_t*)apszLabelList[uiIdx];
+            aBleAttrTabAppRt_g[uiAppRtLen].att_desc.length  = strlen(apszLabelList[uiIdx]);
+            aBleAttrTabAppRt_g[uiAppRtLen].att_desc.max_length = aBleAttrTabAppRt_g[uiAppRtLen].att_desc.length;
+            uiAppRtLen++;
+        }
+    }
+
+    // ---- create all tables ----
+    apBleAttrTab_g[BLE_ATTR_TAB_IDX_DEVMNT] = BLE_ATTR_TAB_DEVMNT;
+    apBleAttrTab_g[BLE_ATTR_TAB_IDX_WIFI]   = BLE_ATTR_TAB_WIFI;
+    apBleAttrTab_g[BLE_ATTR_TAB_IDX_APP_RT] = aBleAttrTabAppRt_g;
+    auiAttrTabLen[BLE_ATTR_TAB_IDX_DEVMNT]  = BLE_ATTR_TAB_LEN(BLE_ATTR_TAB_DEVMNT);
+    auiAttrTabLen[BLE_ATTR_TAB_IDX_WIFI]    = BLE_ATTR_TAB_LEN(BLE_ATTR_TAB_WIFI);
+    auiAttrTabLen[BLE_ATTR_TAB_IDX_APP_RT]  = uiAppRtLen;
+    if (pAppDescriptData_p == NULL)
+    {
+        auiAttrTabLen[BLE_ATTR_TAB_IDX_WIFI]--;             // without [Wifi/OwnMode] feature list (last entry)
+    }
+    if (pfnAppCbHdlrLogSource_g == NULL)
+    {
+        auiAttrTabLen[BLE_ATTR_TAB_IDX_DEVMNT] -= NUM_HANDLES_DEVMNT_LOG;   // without [DevMnt/Log] (last 3 entries)
+    }
+
+    iRes = 1;
+    for (uiIdx=0; uiIdx<BLE_ATTR_TAB_NUM; uiIdx++)
+    {
+        TRACE2("   Attribute Table #%u (%u entries)\n", uiIdx, auiAttrTabLen[uiIdx]);
+        EspRes = esp_ble_gatts_create_attr_tab(apBleAttrTab_g[uiIdx], BleGattsIf_g, auiAttrTabLen[uiIdx], uiIdx);
+        if (EspRes != ESP_OK)
+        {
+            TRACE1("ERROR: esp_ble_gatts_create_attr_tab() failed (EspRes=%d)\n", EspRes);
+            iRes = -3;
+            break;
+        }
+    }
+
+    // table pointers are needed by <BleAttrTabEventHandler()> until all tables are created
+    for (uiIdx=0; (iRes > 0) && (uiIdx < BLE_ATTR_TAB_NUM); uiIdx++)
+    {
+        if (xSemaphoreTake(hBleAttrTabEvent_g, pdMS_TO_TICKS(BLE_ATTR_TAB_TIMEOUT)) != pdTRUE)
+        {
+            TRACE1("ERROR: Timeout creating Attribute Table #%u\n", uiIdx);
+            iRes = -3;
+        }
+    }
+    memset(apBleAttrTab_g, 0, sizeof(apBleAttrTab_g));
+    if (iRes < 0)
+    {
+        return (iRes);
+    }
+    for (uiIdx=0; uiIdx<BLE_ATTR_TAB_NUM; uiIdx++)
+    {
+        if (aui16AttrNumHdl_g[uiIdx] != auiAttrTabLen[uiIdx])
+        {
+            return (-3);
+        }
+    }
+
+    // ---- start all services ----
+    for (uiIdx=0; uiIdx<BLE_ATTR_TAB_NUM; uiIdx++)
+    {
+        EspRes = esp_ble_gatts_start_service(aui16AttrHdlService_g[uiIdx]);
+        if (EspRes != ESP_OK)
+        {
+            TRACE1("ERROR: esp_ble_gatts_start_service() failed (EspRes=%d)\n", EspRes);
+            return (-4);
+        }
+    }
+    for (uiIdx=0; uiIdx<BLE_ATTR_TAB_NUM; uiIdx++)
+    {
+        if (xSemaphoreTake(hBleAttrTabEvent_g, pdMS_TO_TICKS(BLE_ATTR_TAB_TIMEOUT)) != pdTRUE)
+        {
+            TRACE1("ERROR: Timeout starting Service #%u\n", uiIdx);
+            return (-4);
+        }
+    }
+
+    // current values are the reference for detecting changes by the server
+    WriteDataToBleCharacterisics();
+    ui32BleNotifyPending_g = 0;
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CalcAppRtLayout()
+//---------------------------------------------------------------------------
+//  Options with a label starting with '#' are disabled: neither their
+//  characteristic nor their descriptor is created, so they need no
+//  handles, no memory and no discovery time. Their values are still part
+//  of the configuration data, so the stored layout remains unchanged.
+//  The number of handles of [AppRt] results from the remaining entries.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgProfile::CalcAppRtLayout (
+        const tAppDescriptData* pAppDescriptData_p)
+{
+
+const char*  apszLabelList[9];
+unsigned     uiIdx;
+
+
+    ui16AppRtCharacMask_g = 0;
+    ui16AppRtNumHandles_g = 1;                                      // Service
+
+    if (pAppDescriptData_p != NULL)
+    {
+        apszLabelList[0] = pAppDescriptData_p->m_pszLabelOpt1;
+        apszLabelList[1] = pAppDescriptData_p->m_pszLabelOpt2;
+        apszLabelList[2] = pAppDescriptData_p->m_pszLabelOpt3;
+        apszLabelList[3] = pAppDescriptData_p->m_pszLabelOpt4;
+        apszLabelList[4] = pAppDescriptData_p->m_pszLabelOpt5;
+        apszLabelList[5] = pAppDescriptData_p->m_pszLabelOpt6;
+        apszLabelList[6] = pAppDescriptData_p->m_pszLabelOpt7;
+        apszLabelList[7] = pAppDescriptData_p->m_pszLabelOpt8;
+        apszLabelList[8] = pAppDescriptData_p->m_pszLabelPeerAddr;
+    }
+    else
+    {
+        memset(apszLabelList, 0, sizeof(apszLabelList));
+    }
+
+    for (uiIdx=0; uiIdx<(sizeof(apszLabelList)/sizeof(apszLabelList[0])); uiIdx++)
+    {
+        if ((apszLabelList[uiIdx] != NULL) && (apszLabelList[uiIdx][0] == '#'))
+        {
+            TRACE1("   [AppRt] Characteristic #%u disabled by label\n", uiIdx + 1);
+            continue;
+        }
+
+        ui16AppRtCharacMask_g |= (1 << uiIdx);
+        ui16AppRtNumHandles_g += 2;                                 // Characteristic Declaration + Value
+        if (apszLabelList[uiIdx] != NULL)
+        {
+            ui16AppRtNumHandles_g += 1;                             // Description
+        }
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CalcProfileHash()
+//---------------------------------------------------------------------------
+//  The hash value covers all information a client usually caches after the
+//  service discovery: UUIDs and their order, number of handles per service,
+//  descriptor labels and feature lists. Any change of these data results
+//  in a different hash value and forces the client to a new discovery.
+//  The hash is the standard CRC32 (as ESP32BleAppCfgData::CalulateCrc32)
+//  chained over all parts by the ROM function <esp_rom_crc32_le()>.
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgProfile::CalcProfileHash (
+        const tAppDescriptData* pAppDescriptData_p)
+{
+
+const char*  apszLabelList[9];
+uint32_t     ui32Crc;
+uint32_t     ui32Value;
+unsigned     uiIdx;
+
+
+    ui32Crc = 0;
+
+    ui32Value = PROFILE_LAYOUT_REVISION;
+    ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+
+    ui32Value = sizeof(tAppCfgData);
+    ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+
+    // number of handles per service (determines the handle assignment)
+    ui32Value = NUM_HANDLES_DEVMNT_SERVICE;
+    ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+    ui32Value = NUM_HANDLES_WIFI_SERVICE;
+    ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+    ui32Value = ui16AppRtNumHandles_g;
+    ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+
+    // attribute tables assign the handles differently (no hash change for the default backend)
+    if (ui8BleGattBackend_g == BLE_GATT_BACKEND_ATTR_TABLE)
+    {
+        ui32Value = ui8BleGattBackend_g;
+        ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+    }
+
+    // UUIDs in the order of their creation
+    for (uiIdx=0; uiIdx<(sizeof(BLE_PROFILE_UUID_LIST)/sizeof(BLE_PROFILE_UUID_LIST[0])); uiIdx++)
+    {
+        ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)BLE_PROFILE_UUID_LIST[uiIdx], strlen(BLE_PROFILE_UUID_LIST[uiIdx]));
+    }
+
+    // optional characteristics and services
+    if (pfnAppCbHdlrLogSource_g != NULL)
+    {
+        ui32Value = NUM_HANDLES_DEVMNT_LOG;
+        ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+        for (uiIdx=0; uiIdx<(sizeof(BLE_PROFILE_LOG_UUID_LIST)/sizeof(BLE_PROFILE_LOG_UUID_LIST[0])); uiIdx++)
+        {
+            ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)BLE_PROFILE_LOG_UUID_LIST[uiIdx], strlen(BLE_PROFILE_LOG_UUID_LIST[uiIdx]));
+        }
+    }
+    if (pszStreamPartLabel_g != NULL)
+    {
+        ui32Value = NUM_HANDLES_STREAM_SERVICE;
+        ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+        for (uiIdx=0; uiIdx<(sizeof(BLE_PROFILE_STREAM_UUID_LIST)/sizeof(BLE_PROFILE_STREAM_UUID_LIST[0])); uiIdx++)
+        {
+            ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)BLE_PROFILE_STREAM_UUID_LIST[uiIdx], strlen(BLE_PROFILE_STREAM_UUID_LIST[uiIdx]));
+        }
+    }
+    if ( fOtaEnabled_g )
+    {
+        ui32Value = NUM_HANDLES_OTA_SERVICE;
+        ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+        for (uiIdx=0; uiIdx<(sizeof(BLE_PROFILE_OTA_UUID_LIST)/sizeof(BLE_PROFILE_OTA_UUID_LIST[0])); uiIdx++)
+        {
+            ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)BLE_PROFILE_OTA_UUID_LIST[uiIdx], strlen(BLE_PROFILE_OTA_UUID_LIST[uiIdx]));
+        }
+    }
+
+    // application specific labels and feature lists
+    if (pAppDescriptData_p != NULL)
+    {
+        ui32Value = pAppDescriptData_p->m_ui8OwnModeFeatList;
+        ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, sizeof(ui32Value));
+
+        apszLabelList[0] = pAppDescriptData_p->m_pszLabelOpt1;
+        apszLabelList[1] = pAppDescriptData_p->m_pszLabelOpt2;
+        apszLabelList[2] = pAppDescriptData_p->m_pszLabelOpt3;
+        apszLabelList[3] = pAppDescriptData_p->m_pszLabelOpt4;
+        apszLabelList[4] = pAppDescriptData_p->m_pszLabelOpt5;
+        apszLabelList[5] = pAppDescriptData_p->m_pszLabelOpt6;
+        apszLabelList[6] = pAppDescriptData_p->m_pszLabelOpt7;
+        apszLabelList[7] = pAppDescriptData_p->m_pszLabelOpt8;
+        apszLabelList[8] = pAppDescriptData_p->m_pszLabelPeerAddr;
+
+        for (uiIdx=0; uiIdx<(sizeof(apszLabelList)/sizeof(apszLabelList[0])); uiIdx++)
+        {
+            if (apszLabelList[uiIdx] != NULL)
+            {
+                // include terminating zero to separate consecutive labels
+                ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)apszLabelList[uiIdx], strlen(apszLabelList[uiIdx]) + 1);
+            }
+            else
+            {
+                ui32Value = 0;
+                ui32Crc = esp_rom_crc32_le(ui32Crc, (const uint8_t*)&ui32Value, 1);
+            }
+        }
+    }
+
+    return (ui32Crc);
+
+}
+
+
+
+
+//  EOF
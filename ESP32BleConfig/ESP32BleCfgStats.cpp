@@ -0,0 +1,570 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgStats> Implementation
+
+  -------------------------------------------------------------------------
+
+    Fixed memory instrumentation for the BLE Config Framework:
+
+    - Latency Histograms with log2 scaled buckets for each BLE callback,
+      the EEPROM access and the notify path of <ProfileLoop()>
+    - Event Counters for saves, restarts, connects and flash commits
+    - Radio Time accounting: time spent with BLE off, advertising and
+      connected since boot, as a basis for the power budget of a device
+
+    All data are held in statically allocated module variables, so the
+    instrumentation itself never allocates memory at runtime. Recording
+    is protected by a spinlock, since the BLE callbacks are running in
+    the context of the Bluedroid task while <ProfileLoop()> and the EEPROM
+    access are running in the context of the Arduino loop task.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+  2026/10/18:       V1.10 Histograms for all BLE callbacks, blob version 3
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include "ESP32BleCfgStats.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStats                                        */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  const char*     STATS_HIST_NAME[STATS_HIST_NUM] =
+{
+    "CbConnect",                                // STATS_HIST_CB_CONNECT
+    "CbDisconnect",                             // STATS_HIST_CB_DISCONNECT
+    "CbMtuChanged",                             // STATS_HIST_CB_MTU_CHANGED
+    "CbCfgValue",                               // STATS_HIST_CB_CFG_VALUE
+    "CbSaveCfg",                                // STATS_HIST_CB_SAVE_CFG
+    "CbRestartDev",                             // STATS_HIST_CB_RESTART_DEV
+    "CbDiagRead",                               // STATS_HIST_CB_DIAG_READ
+    "CbCfgPatch",                               // STATS_HIST_CB_CFG_PATCH
+    "CbCfgImageRd",                             // STATS_HIST_CB_CFG_IMAGE_READ
+    "CbCfgImageWr",                             // STATS_HIST_CB_CFG_IMAGE_WRITE
+    "CbLog",                                    // STATS_HIST_CB_LOG
+    "CbStreamCtrl",                             // STATS_HIST_CB_STREAM_CTRL
+    "CbStreamData",                             // STATS_HIST_CB_STREAM_DATA
+    "CbOtaCtrl",                                // STATS_HIST_CB_OTA_CTRL
+    "CbOtaData",                                // STATS_HIST_CB_OTA_DATA
+    "EepromLoad",                               // STATS_HIST_EEPROM_LOAD
+    "EepromSave",                               // STATS_HIST_EEPROM_SAVE
+    "EepromClear",                              // STATS_HIST_EEPROM_CLEAR
+    "EepromCommit",                             // STATS_HIST_EEPROM_COMMIT
+    "Notify"                                    // STATS_HIST_NOTIFY
+};
+
+static  const char*     STATS_CNT_NAME[STATS_CNT_NUM] =
+{
+    "SaveCfg",                                  // STATS_CNT_SAVE_CFG
+    "Restart",                                  // STATS_CNT_RESTART
+    "Connect",                                  // STATS_CNT_CONNECT
+    "FlashCommit",                              // STATS_CNT_FLASH_COMMIT
+    "Notify",                                   // STATS_CNT_NOTIFY
+    "CfgTimeout"                                // STATS_CNT_CFG_TIMEOUT
+};
+
+static  const char*     STATS_RADIO_NAME[STATS_RADIO_NUM] =
+{
+    "Off",                                      // STATS_RADIO_OFF
+    "Advertising",                              // STATS_RADIO_ADVERTISING
+    "Connected"                                 // STATS_RADIO_CONNECTED
+};
+
+static  tStatsHist      aStatsHist_g[STATS_HIST_NUM];
+static  uint32_t        aui32StatsCnt_g[STATS_CNT_NUM];
+static  uint32_t        aui32StatsRadioTime_g[STATS_RADIO_NUM];             // [ms], completed periods only
+static  unsigned int    uiStatsRadioState_g             = STATS_RADIO_OFF;  // BLE is off after boot
+static  unsigned long   ulStatsRadioStateTick_g         = 0;                // start of current period (millis() = 0 at boot)
+
+static  portMUX_TYPE    StatsLock_g                     = portMUX_INITIALIZER_UNLOCKED;
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: RecordLatency()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStats::RecordLatency (
+        unsigned int uiHistID_p,
+        uint32_t ui32LatencyUs_p)
+{
+
+tStatsHist*   pStatsHist;
+unsigned int  uiBucketIdx;
+uint32_t      ui32SumUs;
+
+    if (uiHistID_p >= STATS_HIST_NUM)
+    {
+        return;
+    }
+
+    uiBucketIdx = GetBucketIdx(ui32LatencyUs_p);
+
+    portENTER_CRITICAL(&StatsLock_g);
+    {
+        pStatsHist = &aStatsHist_g[uiHistID_p];
+
+        pStatsHist->m_ui32Count++;
+        if (ui32LatencyUs_p > pStatsHist->m_ui32MaxUs)
+        {
+            pStatsHist->m_ui32MaxUs = ui32LatencyUs_p;
+        }
+
+        // accumulate sum in [ms] with separate remainder to avoid overflow
+        ui32SumUs = pStatsHist->m_ui32SumRemUs + (ui32LatencyUs_p % 1000);
+        if (pStatsHist->m_ui32SumMs < (0xFFFFFFFF - (ui32LatencyUs_p / 1000) - 1))
+        {
+            pStatsHist->m_ui32SumMs += (ui32LatencyUs_p / 1000) + (ui32SumUs / 1000);
+        }
+        pStatsHist->m_ui32SumRemUs = ui32SumUs % 1000;
+
+        if (pStatsHist->m_aui16Bucket[uiBucketIdx] < 0xFFFF)
+        {
+            pStatsHist->m_aui16Bucket[uiBucketIdx]++;
+        }
+    }
+    portEXIT_CRITICAL(&StatsLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: IncCounter()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStats::IncCounter (
+        unsigned int uiCntID_p)
+{
+
+    if (uiCntID_p >= STATS_CNT_NUM)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&StatsLock_g);
+    {
+        aui32StatsCnt_g[uiCntID_p]++;
+    }
+    portEXIT_CRITICAL(&StatsLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: SetRadioState()
+//---------------------------------------------------------------------------
+//  Closes the period of the current Radio State and starts a new period
+//  for <uiRadioState_p>. Setting the current state again has no effect.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStats::SetRadioState (
+        unsigned int uiRadioState_p)
+{
+
+unsigned long  ulCurrTick;
+
+    if (uiRadioState_p >= STATS_RADIO_NUM)
+    {
+        return;
+    }
+
+    ulCurrTick = millis();
+
+    portENTER_CRITICAL(&StatsLock_g);
+    {
+        if (uiRadioState_p != uiStatsRadioState_g)
+        {
+            aui32StatsRadioTime_g[uiStatsRadioState_g] = AddSaturated(aui32StatsRadioTime_g[uiStatsRadioState_g], (uint32_t)(ulCurrTick - ulStatsRadioStateTick_g));
+            uiStatsRadioState_g     = uiRadioState_p;
+            ulStatsRadioStateTick_g = ulCurrTick;
+        }
+    }
+    portEXIT_CRITICAL(&StatsLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetRadioTime()
+//---------------------------------------------------------------------------
+//  Return:    Time spent in <uiRadioState_p> incl. the running period [ms]
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgStats::GetRadioTime (
+        unsigned int uiRadioState_p)
+{
+
+unsigned long  ulCurrTick;
+uint32_t       ui32TimeMs;
+
+    if (uiRadioState_p >= STATS_RADIO_NUM)
+    {
+        return (0);
+    }
+
+    ulCurrTick = millis();
+
+    portENTER_CRITICAL(&StatsLock_g);
+    {
+        ui32TimeMs = aui32StatsRadioTime_g[uiRadioState_p];
+        if (uiRadioState_p == uiStatsRadioState_g)
+        {
+            ui32TimeMs = AddSaturated(ui32TimeMs, (uint32_t)(ulCurrTick - ulStatsRadioStateTick_g));
+        }
+    }
+    portEXIT_CRITICAL(&StatsLock_g);
+
+    return (ui32TimeMs);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Reset()
+//---------------------------------------------------------------------------
+//  The current Radio State is kept, its period restarts now.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStats::Reset ()
+{
+
+unsigned long  ulCurrTick;
+
+    ulCurrTick = millis();
+
+    portENTER_CRITICAL(&StatsLock_g);
+    {
+        memset(aStatsHist_g, 0x00, sizeof(aStatsHist_g));
+        memset(aui32StatsCnt_g, 0x00, sizeof(aui32StatsCnt_g));
+        memset(aui32StatsRadioTime_g, 0x00, sizeof(aui32StatsRadioTime_g));
+        ulStatsRadioStateTick_g = ulCurrTick;
+    }
+    portEXIT_CRITICAL(&StatsLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: DumpToSerial()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStats::DumpToSerial ()
+{
+
+tStatsHist    StatsHist;
+uint32_t      ui32Cnt;
+uint32_t      ui32AvgUs;
+char          szTextBuff[96];
+unsigned int  uiHistIdx;
+unsigned int  uiBucketIdx;
+unsigned int  uiCntIdx;
+uint32_t      aui32RadioTime[STATS_RADIO_NUM];
+uint32_t      ui32RadioTimeSum;
+unsigned int  uiRadioIdx;
+
+    Serial.println("Latency Histograms [us]:");
+    for (uiHistIdx=0; uiHistIdx<STATS_HIST_NUM; uiHistIdx++)
+    {
+        // take a consistent snapshot before printing
+        portENTER_CRITICAL(&StatsLock_g);
+        StatsHist = aStatsHist_g[uiHistIdx];
+        portEXIT_CRITICAL(&StatsLock_g);
+
+        if (StatsHist.m_ui32Count == 0)
+        {
+            continue;
+        }
+
+        ui32AvgUs = (uint32_t)((((uint64_t)StatsHist.m_ui32SumMs * 1000) + StatsHist.m_ui32SumRemUs) / StatsHist.m_ui32Count);
+        snprintf(szTextBuff, sizeof(szTextBuff), "  %-14s Cnt=%lu, Avg=%lu, Max=%lu",
+                 STATS_HIST_NAME[uiHistIdx], (unsigned long)StatsHist.m_ui32Count,
+                 (unsigned long)ui32AvgUs, (unsigned long)StatsHist.m_ui32MaxUs);
+        Serial.println(szTextBuff);
+
+        Serial.print("                 ");
+        for (uiBucketIdx=0; uiBucketIdx<STATS_HIST_BUCKETS; uiBucketIdx++)
+        {
+            if (StatsHist.m_aui16Bucket[uiBucketIdx] == 0)
+            {
+                continue;
+            }
+            if (uiBucketIdx < (STATS_HIST_BUCKETS - 1))
+            {
+                snprintf(szTextBuff, sizeof(szTextBuff), " <%lu:%u", (unsigned long)(1UL << (uiBucketIdx + STATS_HIST_BUCKET_SHIFT)), StatsHist.m_aui16Bucket[uiBucketIdx]);
+            }
+            else
+            {
+                // overflow bucket
+                snprintf(szTextBuff, sizeof(szTextBuff), " >=%lu:%u", (unsigned long)(1UL << (uiBucketIdx + STATS_HIST_BUCKET_SHIFT - 1)), StatsHist.m_aui16Bucket[uiBucketIdx]);
+            }
+            Serial.print(szTextBuff);
+        }
+        Serial.println();
+        Serial.flush();
+    }
+
+    Serial.println("Event Counters:");
+    for (uiCntIdx=0; uiCntIdx<STATS_CNT_NUM; uiCntIdx++)
+    {
+        portENTER_CRITICAL(&StatsLock_g);
+        ui32Cnt = aui32StatsCnt_g[uiCntIdx];
+        portEXIT_CRITICAL(&StatsLock_g);
+
+        snprintf(szTextBuff, sizeof(szTextBuff), "  %-14s %lu", STATS_CNT_NAME[uiCntIdx], (unsigned long)ui32Cnt);
+        Serial.println(szTextBuff);
+    }
+
+    Serial.println("Radio Time [ms]:");
+    ui32RadioTimeSum = 0;
+    for (uiRadioIdx=0; uiRadioIdx<STATS_RADIO_NUM; uiRadioIdx++)
+    {
+        aui32RadioTime[uiRadioIdx] = GetRadioTime(uiRadioIdx);
+        ui32RadioTimeSum = AddSaturated(ui32RadioTimeSum, aui32RadioTime[uiRadioIdx]);
+    }
+    for (uiRadioIdx=0; uiRadioIdx<STATS_RADIO_NUM; uiRadioIdx++)
+    {
+        snprintf(szTextBuff, sizeof(szTextBuff), "  %-14s %lu (%lu%%)", STATS_RADIO_NAME[uiRadioIdx], (unsigned long)aui32RadioTime[uiRadioIdx],
+                 (unsigned long)((ui32RadioTimeSum > 0) ? (((uint64_t)aui32RadioTime[uiRadioIdx] * 100) / ui32RadioTimeSum) : 0));
+        Serial.println(szTextBuff);
+    }
+    Serial.flush();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetBlob()
+//---------------------------------------------------------------------------
+//  Binary layout (little endian), see STATS_BLOB_SIZE:
+//    [0]   Version
+//    [1]   Number of Histograms contained
+//    [2]   Number of Buckets per Histogram
+//    [3]   Number of Counters
+//    [4]   Number of Radio States
+//    [5]   Number of Histograms omitted (no space left)
+//    per Counter:    uint32 Value
+//    per Radio State: uint32 Time [ms]
+//    per recorded Histogram (Count > 0, ascending IDs):
+//                    uint8 ID, uint32 Count, uint32 MaxUs, uint32 SumMs, uint16 Bucket[n]
+//---------------------------------------------------------------------------
+//  Return:     >0 -> size of blob
+//              -1 -> Error (invalid parameter, buffer too small)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStats::GetBlob (
+        uint8_t* pabBuff_p,
+        unsigned int uiBuffSize_p)
+{
+
+tStatsHist    aStatsHist[STATS_HIST_NUM];
+uint32_t      aui32StatsCnt[STATS_CNT_NUM];
+uint8_t*      pabData;
+uint8_t*      pabEnd;
+unsigned int  uiHistIdx;
+unsigned int  uiBucketIdx;
+unsigned int  uiCntIdx;
+unsigned int  uiRadioIdx;
+
+    if ((pabBuff_p == NULL) || (uiBuffSize_p < STATS_BLOB_SIZE))
+    {
+        return (-1);
+    }
+
+    portENTER_CRITICAL(&StatsLock_g);
+    {
+        memcpy(aStatsHist, aStatsHist_g, sizeof(aStatsHist));
+        memcpy(aui32StatsCnt, aui32StatsCnt_g, sizeof(aui32StatsCnt));
+    }
+    portEXIT_CRITICAL(&StatsLock_g);
+
+    pabData = pabBuff_p;
+    pabEnd  = pabBuff_p + STATS_BLOB_SIZE;
+    *pabData++ = STATS_BLOB_VERSION;
+    *pabData++ = 0;                                                     // histograms contained, counted below
+    *pabData++ = STATS_HIST_BUCKETS;
+    *pabData++ = STATS_CNT_NUM;
+    *pabData++ = STATS_RADIO_NUM;
+    *pabData++ = 0;                                                     // histograms omitted, counted below
+
+    for (uiCntIdx=0; uiCntIdx<STATS_CNT_NUM; uiCntIdx++)
+    {
+        pabData = PutUint32(pabData, aui32StatsCnt[uiCntIdx]);
+    }
+
+    for (uiRadioIdx=0; uiRadioIdx<STATS_RADIO_NUM; uiRadioIdx++)
+    {
+        pabData = PutUint32(pabData, GetRadioTime(uiRadioIdx));
+    }
+
+    for (uiHistIdx=0; uiHistIdx<STATS_HIST_NUM; uiHistIdx++)
+    {
+        if (aStatsHist[uiHistIdx].m_ui32Count == 0)
+        {
+            continue;
+        }
+        if ((pabEnd - pabData) < STATS_BLOB_HIST_SIZE)
+        {
+            pabBuff_p[5]++;
+            continue;
+        }
+
+        *pabData++ = (uint8_t)uiHistIdx;
+        pabData = PutUint32(pabData, aStatsHist[uiHistIdx].m_ui32Count);
+        pabData = PutUint32(pabData, aStatsHist[uiHistIdx].m_ui32MaxUs);
+        pabData = PutUint32(pabData, aStatsHist[uiHistIdx].m_ui32SumMs);
+        for (uiBucketIdx=0; uiBucketIdx<STATS_HIST_BUCKETS; uiBucketIdx++)
+        {
+            pabData = PutUint16(pabData, aStatsHist[uiHistIdx].m_aui16Bucket[uiBucketIdx]);
+        }
+        pabBuff_p[1]++;
+    }
+
+    return ((int)(pabData - pabBuff_p));
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: GetBucketIdx()
+//---------------------------------------------------------------------------
+
+unsigned int  ESP32BleCfgStats::GetBucketIdx (
+        uint32_t ui32LatencyUs_p)
+{
+
+unsigned int  uiBucketIdx;
+
+    ui32LatencyUs_p >>= STATS_HIST_BUCKET_SHIFT;
+    uiBucketIdx = 0;
+    while ((ui32LatencyUs_p != 0) && (uiBucketIdx < (STATS_HIST_BUCKETS - 1)))
+    {
+        ui32LatencyUs_p >>= 1;
+        uiBucketIdx++;
+    }
+
+    return (uiBucketIdx);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: AddSaturated()
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgStats::AddSaturated (
+        uint32_t ui32Value_p,
+        uint32_t ui32Add_p)
+{
+
+    if (ui32Value_p > (0xFFFFFFFF - ui32Add_p))
+    {
+        return (0xFFFFFFFF);
+    }
+
+    return (ui32Value_p + ui32Add_p);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: PutUint32()
+//---------------------------------------------------------------------------
+
+uint8_t*  ESP32BleCfgStats::PutUint32 (
+        uint8_t* pabBuff_p,
+        uint32_t ui32Value_p)
+{
+
+    pabBuff_p[0] = (uint8_t)(ui32Value_p);
+    pabBuff_p[1] = (uint8_t)(ui32Value_p >> 8);
+    pabBuff_p[2] = (uint8_t)(ui32Value_p >> 16);
+    pabBuff_p[3] = (uint8_t)(ui32Value_p >> 24);
+
+    return (pabBuff_p + 4);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: PutUint16()
+//---------------------------------------------------------------------------
+
+uint8_t*  ESP32BleCfgStats::PutUint16 (
+        uint8_t* pabBuff_p,
+        uint16_t ui16Value_p)
+{
+
+    pabBuff_p[0] = (uint8_t)(ui16Value_p);
+    pabBuff_p[1] = (uint8_t)(ui16Value_p >> 8);
+
+    return (pabBuff_p + 2);
+
+}
+
+
+
+
+//  EOF
@@ -0,0 +1,168 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgStats> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+  2026/10/18:       V1.10 Histograms for all BLE callbacks, blob version 3
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGSTATS_H_
+#define _ESP32BLECFGSTATS_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Latency Histograms
+#define STATS_HIST_CB_CONNECT           0       // BLE Callback: Client connected
+#define STATS_HIST_CB_DISCONNECT        1       // BLE Callback: Client disconnected
+#define STATS_HIST_CB_MTU_CHANGED       2       // BLE Callback: MTU changed
+#define STATS_HIST_CB_CFG_VALUE         3       // BLE Callback: Write to a configuration value
+#define STATS_HIST_CB_SAVE_CFG          4       // BLE Callback: Write [DevMnt/SaveConfig]
+#define STATS_HIST_CB_RESTART_DEV       5       // BLE Callback: Write [DevMnt/RstDev] (up to the application handler)
+#define STATS_HIST_CB_DIAG_READ         6       // BLE Callback: Read [DevMnt/Diagnostics]
+#define STATS_HIST_CB_CFG_PATCH         7       // BLE Callback: Write [DevMnt/ConfigPatch]
+#define STATS_HIST_CB_CFG_IMAGE_READ    8       // BLE Callback: Read [DevMnt/ConfigImage]
+#define STATS_HIST_CB_CFG_IMAGE_WRITE   9       // BLE Callback: Write [DevMnt/ConfigImage]
+#define STATS_HIST_CB_LOG               10      // BLE Callback: Write [DevMnt/Log]
+#define STATS_HIST_CB_STREAM_CTRL       11      // BLE Callback: Write [Stream/Ctrl]
+#define STATS_HIST_CB_STREAM_DATA       12      // BLE Callback: Write [Stream/Data]
+#define STATS_HIST_CB_OTA_CTRL          13      // BLE Callback: Write [OTA/Ctrl]
+#define STATS_HIST_CB_OTA_DATA          14      // BLE Callback: Write [OTA/Data]
+#define STATS_HIST_EEPROM_LOAD          15      // LoadAppCfgDataFromEeprom()
+#define STATS_HIST_EEPROM_SAVE          16      // SaveAppCfgDataToEeprom()
+#define STATS_HIST_EEPROM_CLEAR         17      // ClearAppCfgDataInEeprom()
+#define STATS_HIST_EEPROM_COMMIT        18      // EEPROM.commit() only
+#define STATS_HIST_NOTIFY               19      // ProfileLoop(): setValue() + notify()
+#define STATS_HIST_NUM                  20
+
+// Event Counters
+#define STATS_CNT_SAVE_CFG              0       // SaveConfig requests
+#define STATS_CNT_RESTART               1       // Restart requests
+#define STATS_CNT_CONNECT               2       // Client connects
+#define STATS_CNT_FLASH_COMMIT          3       // EEPROM.commit() calls
+#define STATS_CNT_NOTIFY                4       // notifications sent by ProfileLoop()
+#define STATS_CNT_CFG_TIMEOUT           5       // BLE Config Mode left by idle timeout
+#define STATS_CNT_NUM                   6
+
+// Radio States (time accounting, see <SetRadioState()>)
+#define STATS_RADIO_OFF                 0       // BLE stack not running (Normal Operation Mode)
+#define STATS_RADIO_ADVERTISING         1       // BLE Config Mode, advertising, no client connected
+#define STATS_RADIO_CONNECTED           2       // BLE Config Mode, client connected
+#define STATS_RADIO_NUM                 3
+
+// Histogram Buckets (log2 scale):
+//   Bucket[0]  ->  0us ... 15us
+//   Bucket[n]  ->  2^(n+3)us ... 2^(n+4)-1us
+//   Bucket[15] ->  >= 262144us
+#define STATS_HIST_BUCKETS              16
+#define STATS_HIST_BUCKET_SHIFT         4
+
+#define STATS_BLOB_VERSION              3
+
+
+// Data structure of a Latency Histogram
+typedef struct
+{
+
+    uint32_t        m_ui32Count;                // number of recorded values
+    uint32_t        m_ui32MaxUs;                // max. recorded value                      [us]
+    uint32_t        m_ui32SumMs;                // sum of recorded values (saturated)       [ms]
+    uint32_t        m_ui32SumRemUs;             // remainder of sum below 1ms               [us]
+    uint16_t        m_aui16Bucket[STATS_HIST_BUCKETS];  // number of values per bucket (saturated)
+
+} tStatsHist;
+
+
+// Size of the binary Diagnostics Blob:
+//   Header:     1 Byte Version, 1 Byte Number of Histograms contained, 1 Byte Number of Buckets, 1 Byte Number of Counters,
+//               1 Byte Number of Radio States, 1 Byte Number of Histograms omitted (no space left)
+//   Counters:   per Counter 1 x uint32
+//   Radio Time: per Radio State 1 x uint32 [ms]
+//   Histograms: per recorded Histogram 1 Byte ID + 3 x uint32 (Count, MaxUs, SumMs) + Buckets x uint16
+// An attribute value is limited to 512 Bytes, so not all histograms fit
+// into the blob at once. Empty histograms are left out, the remaining
+// histograms are included in the order of their IDs as long as they fit.
+#define STATS_BLOB_HIST_SIZE            (1 + (3 * 4) + (STATS_HIST_BUCKETS * 2))
+#define STATS_BLOB_FIXED_SIZE           (6 + (STATS_CNT_NUM * 4) + (STATS_RADIO_NUM * 4))
+#define STATS_BLOB_FULL_SIZE            (STATS_BLOB_FIXED_SIZE + (STATS_HIST_NUM * STATS_BLOB_HIST_SIZE))
+#define STATS_BLOB_MAX_SIZE             512     // max. length of an attribute value (ESP_GATT_MAX_ATTR_LEN)
+#define STATS_BLOB_SIZE                 ((STATS_BLOB_FULL_SIZE < STATS_BLOB_MAX_SIZE) ? STATS_BLOB_FULL_SIZE : STATS_BLOB_MAX_SIZE)
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStats                                        */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStats
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  void      RecordLatency(unsigned int uiHistID_p, uint32_t ui32LatencyUs_p);
+        static  void      IncCounter(unsigned int uiCntID_p);
+        static  void      SetRadioState(unsigned int uiRadioState_p);
+        static  uint32_t  GetRadioTime(unsigned int uiRadioState_p);
+        static  void      Reset();
+
+        static  void      DumpToSerial();
+        static  int       GetBlob(uint8_t* pabBuff_p, unsigned int uiBuffSize_p);
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  unsigned int  GetBucketIdx(uint32_t ui32LatencyUs_p);
+        static  uint32_t      AddSaturated(uint32_t ui32Value_p, uint32_t ui32Add_p);
+        static  uint8_t*      PutUint32(uint8_t* pabBuff_p, uint32_t ui32Value_p);
+        static  uint8_t*      PutUint16(uint8_t* pabBuff_p, uint16_t ui16Value_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGSTATS_H_
@@ -0,0 +1,1217 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgStorage> Implementation
+
+  -------------------------------------------------------------------------
+
+    Storage Backends for the Configuration Data <tAppCfgData>:
+
+    ESP32BleCfgStorageEeprom:
+      Complete image in the emulated EEPROM (A/B slots, trial run and
+      rollback, layout migration), see class <ESP32BleAppCfgData>.
+
+    ESP32BleCfgStorageNvs:
+      One NVS key per field (key name = "f" + Field ID in hex, e.g. "f28"
+      for CFG_FIELD_APP_RT_PEERADDR). The NVS handle is opened once and
+      kept open. Keys are read lazily on first access, so LoadField() only
+      reads the requested key. Save() writes only keys whose value differs
+      from the NVS content and commits once. Missing keys keep the default
+      values of the application, so new fields need no migration.
+
+    ESP32BleCfgStorageRtcCache:
+      Write-through cache in front of one of the backends above, holding a
+      validated copy (CRC32, generation) in RTC slow memory. After a wake
+      from deep sleep, Load() is served from RTC memory without accessing
+      the flash, as long as the data has passed its trial run. Unconfirmed
+      data is always read from the backend, so the rollback of a failed
+      trial run is not bypassed by deep sleep. After any other reset, or if
+      the generation given by the application has changed (e.g. new
+      firmware), the data is read from the backend and the cache is refilled.
+
+    ESP32BleCfgStorageRam:
+      Volatile copy in RAM, used for host tests and as a template for
+      further backends.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+  2026/10/18:       V1.10 RTC memory cache
+  2026/10/18:       V1.11 RTC memory cache serves confirmed data only
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include "nvs.h"
+#include "esp_system.h"
+#include "ESP32BleCfgProfile.h"         // -> typedef struct tAppCfgData
+#include "ESP32BleAppCfgData.h"
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleCfgStorage.h"
+#include "ESP32BleCfgStats.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Local Types
+//---------------------------------------------------------------------------
+
+// the NVS handle is kept as uint32_t in the class declaration
+static_assert(sizeof(nvs_handle_t) == sizeof(uint32_t), "nvs_handle_t does not fit into m_ui32NvsHandle");
+
+// Cache Record in RTC slow memory (survives deep sleep)
+typedef struct
+{
+
+    uint32_t        m_ui32Magic;                // CFG_RTC_CACHE_MAGIC
+    uint32_t        m_ui32Generation;           // generation given by the application
+    uint32_t        m_ui32FlashLoadTime;        // duration of the last Load() from flash       [us]
+    uint8_t         m_fStored;                  // backend holds saved data (otherwise defaults)
+    uint8_t         m_fConfirmed;               // trial run of the backend data confirmed
+    uint8_t         m_aui8Reserved[2];
+    tAppCfgData     m_AppCfgData;
+    uint32_t        m_ui32Crc32;                // CRC32 over the preceding members
+
+} tCfgRtcCache;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Variables
+//---------------------------------------------------------------------------
+
+static  RTC_DATA_ATTR  tCfgRtcCache  CfgRtcCache_g;
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------
+//  CopyField()
+//---------------------------------------------------------------------------
+
+static  int  CopyField (
+        tAppCfgData* pDstAppCfgData_p,
+        const tAppCfgData* pSrcAppCfgData_p,
+        uint8_t ui8FieldId_p)
+{
+
+uint8_t  abValue[UINT8_MAX];
+int      iValueLen;
+
+    iValueLen = ESP32BleCfgFields::GetField(pSrcAppCfgData_p, ui8FieldId_p, abValue, sizeof(abValue));
+    if (iValueLen < 0)
+    {
+        return (-1);
+    }
+
+    return (ESP32BleCfgFields::SetField(pDstAppCfgData_p, ui8FieldId_p, abValue, (unsigned int)iValueLen));
+
+}
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorage  (Interface)                         */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  Destructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgStorage::~ESP32BleCfgStorage ()
+{
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  BeginTrialRun()
+//---------------------------------------------------------------------------
+//  Default for backends without trial run support.
+//---------------------------------------------------------------------------
+//  Return:      0 -> data already confirmed (nothing to do)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorage::BeginTrialRun ()
+{
+
+    return (0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ConfirmAppCfgData()
+//---------------------------------------------------------------------------
+//  Default for backends without trial run support.
+//---------------------------------------------------------------------------
+//  Return:      0 -> data already confirmed (nothing to do)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorage::ConfirmAppCfgData ()
+{
+
+    return (0);
+
+}
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageEeprom                                */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  Constructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgStorageEeprom::ESP32BleCfgStorageEeprom (
+        ESP32BleAppCfgData* pAppCfgData_p)
+{
+
+    m_pAppCfgData = pAppCfgData_p;
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Load()
+//---------------------------------------------------------------------------
+//  Return:     see ESP32BleAppCfgData::LoadAppCfgDataFromEeprom()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageEeprom::Load (
+        tAppCfgData* pAppCfgData_p)
+{
+
+    return (m_pAppCfgData->LoadAppCfgDataFromEeprom(pAppCfgData_p));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  LoadField()
+//---------------------------------------------------------------------------
+//  The EEPROM image can only be read as a whole, only the requested field
+//  is copied to <pAppCfgData_p>.
+//---------------------------------------------------------------------------
+//  Return:      1 -> field loaded
+//               0 -> keep default value untouched
+//              -1 -> Error (unknown field, EEPROM access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageEeprom::LoadField (
+        uint8_t ui8FieldId_p,
+        tAppCfgData* pAppCfgData_p)
+{
+
+tAppCfgData  AppCfgData;
+int          iRes;
+
+    if ((pAppCfgData_p == NULL) || (ESP32BleCfgFields::GetFieldDescr(ui8FieldId_p) == NULL))
+    {
+        return (-1);
+    }
+
+    memcpy(&AppCfgData, pAppCfgData_p, sizeof(AppCfgData));
+    iRes = m_pAppCfgData->LoadAppCfgDataFromEeprom(&AppCfgData);
+    if (iRes <= 0)
+    {
+        return (iRes);
+    }
+
+    iRes = CopyField(pAppCfgData_p, &AppCfgData, ui8FieldId_p);
+    if (iRes < 0)
+    {
+        return (-1);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Save()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageEeprom::Save (
+        tAppCfgData* pAppCfgData_p)
+{
+
+    return (m_pAppCfgData->SaveAppCfgDataToEeprom(pAppCfgData_p));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Clear()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageEeprom::Clear ()
+{
+
+    return (m_pAppCfgData->ClearAppCfgDataInEeprom());
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  BeginTrialRun()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageEeprom::BeginTrialRun ()
+{
+
+    return (m_pAppCfgData->BeginTrialRun());
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ConfirmAppCfgData()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageEeprom::ConfirmAppCfgData ()
+{
+
+    return (m_pAppCfgData->ConfirmAppCfgData());
+
+}
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageNvs                                   */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  Constructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgStorageNvs::ESP32BleCfgStorageNvs (
+        const char* pszNamespace_p)
+{
+
+    m_pszNamespace    = pszNamespace_p;
+    m_ui32NvsHandle   = 0;
+    m_fNvsOpen        = false;
+    m_ui32FetchedMask = 0;
+    m_ui32StoredMask  = 0;
+    memset(&m_ShadowData, 0x00, sizeof(m_ShadowData));
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Destructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgStorageNvs::~ESP32BleCfgStorageNvs ()
+{
+
+    if ( m_fNvsOpen )
+    {
+        nvs_close(m_ui32NvsHandle);
+        m_fNvsOpen = false;
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Load()
+//---------------------------------------------------------------------------
+//  Return:      1 -> return the previously saved user data (fields without
+//                    key in NVS keep their default values)
+//               0 -> keep default data untouched
+//              -1 -> Error (NVS access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageNvs::Load (
+        tAppCfgData* pAppCfgData_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+unsigned int           uiFieldIdx;
+int                    iRes;
+int                    iResult;
+unsigned long          ulStartTime;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    ulStartTime = micros();
+
+    iResult = 0;
+    for (uiFieldIdx=0; (pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx)) != NULL; uiFieldIdx++)
+    {
+        iRes = LoadField(pFieldDescr->m_ui8FieldId, pAppCfgData_p);
+        if (iRes < 0)
+        {
+            return (-1);
+        }
+        if (iRes > 0)
+        {
+            iResult = 1;
+        }
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_LOAD, (uint32_t)(micros() - ulStartTime));
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  LoadField()
+//---------------------------------------------------------------------------
+//  Reads only the key of the requested field (once, later calls are served
+//  from the shadow copy).
+//---------------------------------------------------------------------------
+//  Return:      1 -> field loaded
+//               0 -> keep default value untouched (no key in NVS)
+//              -1 -> Error (unknown field, NVS access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageNvs::LoadField (
+        uint8_t ui8FieldId_p,
+        tAppCfgData* pAppCfgData_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+unsigned int           uiFieldIdx;
+int                    iRes;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    for (uiFieldIdx=0; (pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx)) != NULL; uiFieldIdx++)
+    {
+        if (pFieldDescr->m_ui8FieldId == ui8FieldId_p)
+        {
+            break;
+        }
+    }
+    if (pFieldDescr == NULL)
+    {
+        return (-1);
+    }
+
+    iRes = FetchKey(uiFieldIdx);
+    if (iRes <= 0)
+    {
+        return (iRes);
+    }
+
+    iRes = CopyField(pAppCfgData_p, &m_ShadowData, ui8FieldId_p);
+    if (iRes < 0)
+    {
+        return (-1);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Save()
+//---------------------------------------------------------------------------
+//  Return:      1 -> user data saved
+//              -1 -> Error (invalid parameter, NVS access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageNvs::Save (
+        tAppCfgData* pAppCfgData_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+uint8_t                abValue[UINT8_MAX];
+uint8_t                abShadowValue[UINT8_MAX];
+char                   szKeyName[CFG_STORAGE_NVS_KEY_LEN];
+unsigned int           uiFieldIdx;
+unsigned int           uiWrittenKeys;
+int                    iValueLen;
+int                    iShadowValueLen;
+int                    iRes;
+esp_err_t              EspRes;
+unsigned long          ulStartTime;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    ulStartTime = micros();
+
+    uiWrittenKeys = 0;
+    for (uiFieldIdx=0; (pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx)) != NULL; uiFieldIdx++)
+    {
+        iValueLen = ESP32BleCfgFields::GetField(pAppCfgData_p, pFieldDescr->m_ui8FieldId, abValue, sizeof(abValue));
+        if (iValueLen < 0)
+        {
+            return (-1);
+        }
+
+        // skip keys whose value is unchanged
+        iRes = FetchKey(uiFieldIdx);
+        if (iRes < 0)
+        {
+            return (-1);
+        }
+        if (iRes > 0)
+        {
+            iShadowValueLen = ESP32BleCfgFields::GetField(&m_ShadowData, pFieldDescr->m_ui8FieldId, abShadowValue, sizeof(abShadowValue));
+            if ((iShadowValueLen == iValueLen) && (memcmp(abShadowValue, abValue, iValueLen) == 0))
+            {
+                continue;
+            }
+        }
+
+        BuildKeyName(pFieldDescr->m_ui8FieldId, szKeyName);
+        EspRes = nvs_set_blob(m_ui32NvsHandle, szKeyName, abValue, iValueLen);
+        if (EspRes != ESP_OK)
+        {
+            TRACE2("ESP32BleCfgStorageNvs: writing key '%s' failed (0x%X)\n", szKeyName, EspRes);
+            return (-1);
+        }
+
+        ESP32BleCfgFields::SetField(&m_ShadowData, pFieldDescr->m_ui8FieldId, abValue, iValueLen);
+        m_ui32StoredMask |= (1UL << uiFieldIdx);
+        uiWrittenKeys++;
+    }
+
+    if (uiWrittenKeys > 0)
+    {
+        EspRes = nvs_commit(m_ui32NvsHandle);
+        ESP32BleCfgStats::IncCounter(STATS_CNT_FLASH_COMMIT);
+        if (EspRes != ESP_OK)
+        {
+            return (-1);
+        }
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_SAVE, (uint32_t)(micros() - ulStartTime));
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Clear()
+//---------------------------------------------------------------------------
+//  Return:      1 -> user data cleared
+//              -1 -> Error (NVS access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageNvs::Clear ()
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+unsigned int           uiFieldIdx;
+esp_err_t              EspRes;
+unsigned long          ulStartTime;
+
+    ulStartTime = micros();
+
+    if ( !OpenNvs() )
+    {
+        return (-1);
+    }
+
+    EspRes = nvs_erase_all(m_ui32NvsHandle);
+    if (EspRes == ESP_OK)
+    {
+        EspRes = nvs_commit(m_ui32NvsHandle);
+        ESP32BleCfgStats::IncCounter(STATS_CNT_FLASH_COMMIT);
+    }
+    if (EspRes != ESP_OK)
+    {
+        return (-1);
+    }
+
+    // all keys are known to be missing now
+    m_ui32StoredMask  = 0;
+    m_ui32FetchedMask = 0;
+    for (uiFieldIdx=0; (pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx)) != NULL; uiFieldIdx++)
+    {
+        m_ui32FetchedMask |= (1UL << uiFieldIdx);
+    }
+
+    ESP32BleCfgStats::RecordLatency(STATS_HIST_EEPROM_CLEAR, (uint32_t)(micros() - ulStartTime));
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  PRIVATE: OpenNvs()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStorageNvs::OpenNvs ()
+{
+
+nvs_handle_t  NvsHandle;
+esp_err_t     EspRes;
+
+    if ( m_fNvsOpen )
+    {
+        return (true);
+    }
+
+    EspRes = nvs_open(m_pszNamespace, NVS_READWRITE, &NvsHandle);
+    if (EspRes != ESP_OK)
+    {
+        TRACE2("ESP32BleCfgStorageNvs: opening namespace '%s' failed (0x%X)\n", m_pszNamespace, EspRes);
+        return (false);
+    }
+
+    m_ui32NvsHandle = NvsHandle;
+    m_fNvsOpen = true;
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  PRIVATE: FetchKey()
+//---------------------------------------------------------------------------
+//  Reads the key of field [uiFieldIdx_p] into the shadow copy (only on
+//  first access).
+//---------------------------------------------------------------------------
+//  Return:      1 -> key exists, value in <m_ShadowData>
+//               0 -> no key in NVS
+//              -1 -> Error (NVS access error)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageNvs::FetchKey (
+        unsigned int uiFieldIdx_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+uint8_t                abValue[UINT8_MAX];
+char                   szKeyName[CFG_STORAGE_NVS_KEY_LEN];
+size_t                 ValueLen;
+esp_err_t              EspRes;
+int                    iRes;
+
+    if ((m_ui32FetchedMask & (1UL << uiFieldIdx_p)) == 0)
+    {
+        if ( !OpenNvs() )
+        {
+            return (-1);
+        }
+
+        pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx_p);
+        BuildKeyName(pFieldDescr->m_ui8FieldId, szKeyName);
+        ValueLen = sizeof(abValue);
+        EspRes = nvs_get_blob(m_ui32NvsHandle, szKeyName, abValue, &ValueLen);
+        if (EspRes == ESP_OK)
+        {
+            // a key not matching the field description (e.g. written by another
+            // firmware) is ignored and overwritten by the next Save()
+            iRes = ESP32BleCfgFields::CheckField(pFieldDescr->m_ui8FieldId, abValue, ValueLen);
+            if (iRes == CFG_STATUS_OK)
+            {
+                ESP32BleCfgFields::SetField(&m_ShadowData, pFieldDescr->m_ui8FieldId, abValue, ValueLen);
+                m_ui32StoredMask |= (1UL << uiFieldIdx_p);
+            }
+        }
+        else if (EspRes != ESP_ERR_NVS_NOT_FOUND)
+        {
+            TRACE2("ESP32BleCfgStorageNvs: reading key '%s' failed (0x%X)\n", szKeyName, EspRes);
+            return (-1);
+        }
+
+        m_ui32FetchedMask |= (1UL << uiFieldIdx_p);
+    }
+
+    return ((m_ui32StoredMask & (1UL << uiFieldIdx_p)) ? 1 : 0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  PRIVATE: BuildKeyName()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStorageNvs::BuildKeyName (
+        uint8_t ui8FieldId_p,
+        char* pszKeyName_p)
+{
+
+    snprintf(pszKeyName_p, CFG_STORAGE_NVS_KEY_LEN, "f%02X", ui8FieldId_p);
+
+    return;
+
+}
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageRtcCache                              */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  Constructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgStorageRtcCache::ESP32BleCfgStorageRtcCache ()
+{
+
+    m_pBackend = NULL;
+    m_ui32Generation = 0;
+    memset(&m_CacheInfo, 0x00, sizeof(m_CacheInfo));
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  SetBackend()
+//---------------------------------------------------------------------------
+//  <ui32Generation_p> identifies the producer of the cached data (e.g. a
+//  hash of firmware build and layout version). A cache record with another
+//  generation is ignored.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStorageRtcCache::SetBackend (
+        ESP32BleCfgStorage* pBackend_p,
+        uint32_t ui32Generation_p)
+{
+
+    m_pBackend = pBackend_p;
+    m_ui32Generation = ui32Generation_p;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  GetCacheInfo()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStorageRtcCache::GetCacheInfo (
+        tCfgRtcCacheInfo* pCacheInfo_p)
+{
+
+    if (pCacheInfo_p == NULL)
+    {
+        return (false);
+    }
+
+    memcpy(pCacheInfo_p, &m_CacheInfo, sizeof(m_CacheInfo));
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Invalidate()
+//---------------------------------------------------------------------------
+//  Has to be called if the backend is modified bypassing the cache.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStorageRtcCache::Invalidate ()
+{
+
+    CfgRtcCache_g.m_ui32Magic = 0;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Load()
+//---------------------------------------------------------------------------
+//  Data on trial is never served from the cache: only the backend knows
+//  the number of trial runs and can roll back to the previous data.
+//---------------------------------------------------------------------------
+//  Return:     see backend, on cache hit:
+//               1 -> return the previously saved user data
+//               0 -> keep default data untouched
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRtcCache::Load (
+        tAppCfgData* pAppCfgData_p)
+{
+
+int            iResult;
+unsigned long  ulStartTime;
+
+    if ((pAppCfgData_p == NULL) || (m_pBackend == NULL))
+    {
+        return (-1);
+    }
+
+    ulStartTime = micros();
+
+    // wake from deep sleep with confirmed data -> use data from RTC memory
+    if ( IsCacheHit() )
+    {
+        if ( CfgRtcCache_g.m_fStored )
+        {
+            memcpy(pAppCfgData_p, &CfgRtcCache_g.m_AppCfgData, sizeof(CfgRtcCache_g.m_AppCfgData));
+        }
+        iResult = (CfgRtcCache_g.m_fStored) ? 1 : 0;
+
+        m_CacheInfo.m_fCacheHit = true;
+        m_CacheInfo.m_ui32LoadTime = (uint32_t)(micros() - ulStartTime);
+        m_CacheInfo.m_ui32FlashLoadTime = CfgRtcCache_g.m_ui32FlashLoadTime;
+        m_CacheInfo.m_ui32Generation = CfgRtcCache_g.m_ui32Generation;
+        return (iResult);
+    }
+
+    // cold boot or cache outdated -> read from flash and refill cache
+    iResult = m_pBackend->Load(pAppCfgData_p);
+    if (iResult >= 0)
+    {
+        CfgRtcCache_g.m_fConfirmed = false;
+        CfgRtcCache_g.m_ui32FlashLoadTime = (uint32_t)(micros() - ulStartTime);
+        UpdateCache(pAppCfgData_p, (iResult > 0));
+    }
+    else
+    {
+        Invalidate();
+    }
+
+    m_CacheInfo.m_fCacheHit = false;
+    m_CacheInfo.m_ui32LoadTime = (uint32_t)(micros() - ulStartTime);
+    m_CacheInfo.m_ui32FlashLoadTime = m_CacheInfo.m_ui32LoadTime;
+    m_CacheInfo.m_ui32Generation = m_ui32Generation;
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  LoadField()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRtcCache::LoadField (
+        uint8_t ui8FieldId_p,
+        tAppCfgData* pAppCfgData_p)
+{
+
+int  iRes;
+
+    if ((pAppCfgData_p == NULL) || (m_pBackend == NULL))
+    {
+        return (-1);
+    }
+
+    if ( IsCacheHit() )
+    {
+        if ( !CfgRtcCache_g.m_fStored )
+        {
+            return (0);
+        }
+        iRes = CopyField(pAppCfgData_p, &CfgRtcCache_g.m_AppCfgData, ui8FieldId_p);
+        return ((iRes < 0) ? -1 : 1);
+    }
+
+    return (m_pBackend->LoadField(ui8FieldId_p, pAppCfgData_p));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Save()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRtcCache::Save (
+        tAppCfgData* pAppCfgData_p)
+{
+
+int  iResult;
+
+    if (m_pBackend == NULL)
+    {
+        return (-1);
+    }
+
+    // write-through, the new data is unconfirmed until the next trial run
+    Invalidate();
+    iResult = m_pBackend->Save(pAppCfgData_p);
+    if (iResult >= 0)
+    {
+        CfgRtcCache_g.m_fConfirmed = false;
+        UpdateCache(pAppCfgData_p, true);
+    }
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Clear()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRtcCache::Clear ()
+{
+
+    if (m_pBackend == NULL)
+    {
+        return (-1);
+    }
+
+    Invalidate();
+
+    return (m_pBackend->Clear());
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  BeginTrialRun()
+//---------------------------------------------------------------------------
+//  Once confirmed, further runs after wake from deep sleep do not need any
+//  access to the backend.
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRtcCache::BeginTrialRun ()
+{
+
+int  iResult;
+
+    if (m_pBackend == NULL)
+    {
+        return (-1);
+    }
+
+    if ( IsCacheValid() && CfgRtcCache_g.m_fConfirmed )
+    {
+        return (0);
+    }
+
+    iResult = m_pBackend->BeginTrialRun();
+    if ( (iResult == 0) && IsCacheValid() )
+    {
+        CfgRtcCache_g.m_fConfirmed = true;
+        UpdateCache(&CfgRtcCache_g.m_AppCfgData, CfgRtcCache_g.m_fStored);
+    }
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  ConfirmAppCfgData()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRtcCache::ConfirmAppCfgData ()
+{
+
+int  iResult;
+
+    if (m_pBackend == NULL)
+    {
+        return (-1);
+    }
+
+    iResult = m_pBackend->ConfirmAppCfgData();
+    if ( (iResult >= 0) && IsCacheValid() )
+    {
+        CfgRtcCache_g.m_fConfirmed = true;
+        UpdateCache(&CfgRtcCache_g.m_AppCfgData, CfgRtcCache_g.m_fStored);
+    }
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  PRIVATE: IsCacheValid()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStorageRtcCache::IsCacheValid ()
+{
+
+uint32_t  ui32Crc;
+
+    if ( (CfgRtcCache_g.m_ui32Magic != CFG_RTC_CACHE_MAGIC) ||
+         (CfgRtcCache_g.m_ui32Generation != m_ui32Generation) )
+    {
+        return (false);
+    }
+
+    ui32Crc = ESP32BleAppCfgData::CalulateCrc32(&CfgRtcCache_g, offsetof(tCfgRtcCache, m_ui32Crc32));
+    if (CfgRtcCache_g.m_ui32Crc32 != ui32Crc)
+    {
+        return (false);
+    }
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  PRIVATE: IsCacheHit()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStorageRtcCache::IsCacheHit ()
+{
+
+    if (esp_reset_reason() != ESP_RST_DEEPSLEEP)
+    {
+        return (false);
+    }
+
+    if ( !IsCacheValid() || !CfgRtcCache_g.m_fConfirmed )
+    {
+        return (false);
+    }
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  PRIVATE: UpdateCache()
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgStorageRtcCache::UpdateCache (
+        const tAppCfgData* pAppCfgData_p,
+        bool fStored_p)
+{
+
+    if (pAppCfgData_p != &CfgRtcCache_g.m_AppCfgData)
+    {
+        memcpy(&CfgRtcCache_g.m_AppCfgData, pAppCfgData_p, sizeof(CfgRtcCache_g.m_AppCfgData));
+    }
+
+    CfgRtcCache_g.m_ui32Magic = CFG_RTC_CACHE_MAGIC;
+    CfgRtcCache_g.m_ui32Generation = m_ui32Generation;
+    CfgRtcCache_g.m_fStored = (fStored_p) ? 1 : 0;
+    CfgRtcCache_g.m_fConfirmed = (CfgRtcCache_g.m_fConfirmed) ? 1 : 0;
+    memset(CfgRtcCache_g.m_aui8Reserved, 0x00, sizeof(CfgRtcCache_g.m_aui8Reserved));
+    CfgRtcCache_g.m_ui32Crc32 = ESP32BleAppCfgData::CalulateCrc32(&CfgRtcCache_g, offsetof(tCfgRtcCache, m_ui32Crc32));
+
+    return;
+
+}
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageRam                                   */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  Constructor
+//---------------------------------------------------------------------------
+
+ESP32BleCfgStorageRam::ESP32BleCfgStorageRam ()
+{
+
+    memset(&m_AppCfgData, 0x00, sizeof(m_AppCfgData));
+    m_fValid = false;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Load()
+//---------------------------------------------------------------------------
+//  Return:      1 -> return the previously saved user data
+//               0 -> keep default data untouched
+//              -1 -> Error (invalid parameter)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRam::Load (
+        tAppCfgData* pAppCfgData_p)
+{
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    if ( !m_fValid )
+    {
+        return (0);
+    }
+
+    memcpy(pAppCfgData_p, &m_AppCfgData, sizeof(m_AppCfgData));
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  LoadField()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRam::LoadField (
+        uint8_t ui8FieldId_p,
+        tAppCfgData* pAppCfgData_p)
+{
+
+int  iRes;
+
+    if ((pAppCfgData_p == NULL) || (ESP32BleCfgFields::GetFieldDescr(ui8FieldId_p) == NULL))
+    {
+        return (-1);
+    }
+
+    if ( !m_fValid )
+    {
+        return (0);
+    }
+
+    iRes = CopyField(pAppCfgData_p, &m_AppCfgData, ui8FieldId_p);
+    if (iRes < 0)
+    {
+        return (-1);
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Save()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRam::Save (
+        tAppCfgData* pAppCfgData_p)
+{
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (-1);
+    }
+
+    memcpy(&m_AppCfgData, pAppCfgData_p, sizeof(m_AppCfgData));
+    m_fValid = true;
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Clear()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStorageRam::Clear ()
+{
+
+    memset(&m_AppCfgData, 0xFF, sizeof(m_AppCfgData));
+    m_fValid = false;
+
+    return (1);
+
+}
+
+
+
+
+//  EOF
@@ -0,0 +1,289 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgStorage> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGSTORAGE_H_
+#define _ESP32BLECFGSTORAGE_H_
+
+#include "ESP32BleAppCfgData.h"
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Max. length of NVS Key Names ("f" + 2 hex digits of the Field ID)
+#define CFG_STORAGE_NVS_KEY_LEN         4
+
+#define CFG_RTC_CACHE_MAGIC             0x43527443  // ASCII 'CtRC' = [C]onfig [R]TC [C]ache
+
+
+// Information about the last Load() via the RTC Cache
+typedef struct
+{
+
+    bool            m_fCacheHit;                // data taken from RTC memory (wake from deep sleep)
+    uint32_t        m_ui32LoadTime;             // duration of the last Load()                  [us]
+    uint32_t        m_ui32FlashLoadTime;        // duration of the last Load() from flash       [us]
+    uint32_t        m_ui32Generation;           // generation of the cached data
+
+} tCfgRtcCacheInfo;
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorage  (Interface)                         */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStorage
+{
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        virtual  ~ESP32BleCfgStorage();
+
+        virtual  int   Load(tAppCfgData* pAppCfgData_p) = 0;
+        virtual  int   LoadField(uint8_t ui8FieldId_p, tAppCfgData* pAppCfgData_p) = 0;
+        virtual  int   Save(tAppCfgData* pAppCfgData_p) = 0;
+        virtual  int   Clear() = 0;
+
+        virtual  int   BeginTrialRun();
+        virtual  int   ConfirmAppCfgData();
+
+
+};
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageEeprom                                */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStorageEeprom : public ESP32BleCfgStorage
+{
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        ESP32BleAppCfgData*  m_pAppCfgData;
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        ESP32BleCfgStorageEeprom(ESP32BleAppCfgData* pAppCfgData_p);
+
+        int   Load(tAppCfgData* pAppCfgData_p);
+        int   LoadField(uint8_t ui8FieldId_p, tAppCfgData* pAppCfgData_p);
+        int   Save(tAppCfgData* pAppCfgData_p);
+        int   Clear();
+
+        int   BeginTrialRun();
+        int   ConfirmAppCfgData();
+
+
+};
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageNvs                                   */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStorageNvs : public ESP32BleCfgStorage
+{
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        const char*     m_pszNamespace;
+        uint32_t        m_ui32NvsHandle;            // nvs_handle_t (nvs.h is only needed by the implementation)
+        bool            m_fNvsOpen;
+        uint32_t        m_ui32FetchedMask;          // Bit[FieldIdx] = 1 -> <m_ShadowData> holds the NVS content of the key
+        uint32_t        m_ui32StoredMask;           // Bit[FieldIdx] = 1 -> key exists in NVS
+        tAppCfgData     m_ShadowData;
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        ESP32BleCfgStorageNvs(const char* pszNamespace_p);
+        ~ESP32BleCfgStorageNvs();
+
+        int   Load(tAppCfgData* pAppCfgData_p);
+        int   LoadField(uint8_t ui8FieldId_p, tAppCfgData* pAppCfgData_p);
+        int   Save(tAppCfgData* pAppCfgData_p);
+        int   Clear();
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        bool  OpenNvs();
+        int   FetchKey(unsigned int uiFieldIdx_p);
+        static  void  BuildKeyName(uint8_t ui8FieldId_p, char* pszKeyName_p);
+
+
+};
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageRtcCache                              */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStorageRtcCache : public ESP32BleCfgStorage
+{
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        ESP32BleCfgStorage*  m_pBackend;
+        uint32_t             m_ui32Generation;
+        tCfgRtcCacheInfo     m_CacheInfo;
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        ESP32BleCfgStorageRtcCache();
+
+        void  SetBackend(ESP32BleCfgStorage* pBackend_p, uint32_t ui32Generation_p);
+        bool  GetCacheInfo(tCfgRtcCacheInfo* pCacheInfo_p);
+        void  Invalidate();
+
+        int   Load(tAppCfgData* pAppCfgData_p);
+        int   LoadField(uint8_t ui8FieldId_p, tAppCfgData* pAppCfgData_p);
+        int   Save(tAppCfgData* pAppCfgData_p);
+        int   Clear();
+
+        int   BeginTrialRun();
+        int   ConfirmAppCfgData();
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        bool  IsCacheValid();
+        bool  IsCacheHit();
+        void  UpdateCache(const tAppCfgData* pAppCfgData_p, bool fStored_p);
+
+
+};
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStorageRam                                   */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStorageRam : public ESP32BleCfgStorage
+{
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        tAppCfgData     m_AppCfgData;
+        bool            m_fValid;
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        ESP32BleCfgStorageRam();
+
+        int   Load(tAppCfgData* pAppCfgData_p);
+        int   LoadField(uint8_t ui8FieldId_p, tAppCfgData* pAppCfgData_p);
+        int   Save(tAppCfgData* pAppCfgData_p);
+        int   Clear();
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGSTORAGE_H_
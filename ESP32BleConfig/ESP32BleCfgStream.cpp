@@ -0,0 +1,599 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgStream> Implementation
+
+  -------------------------------------------------------------------------
+
+    Chunked Streaming Transfer of large Configuration Blobs (certificates,
+    keys, JSON settings) which do not fit into <tAppCfgData>:
+
+    - The Client announces the transfer by STREAM_CMD_START (chunk size,
+      total size, CRC32 of the complete blob, acknowledge window) and then
+      writes numbered chunks to [Stream/Data] using Write Without Response.
+    - Every <Window> chunks the Server notifies an ACK with the next
+      expected sequence number. A sequence gap is answered once by a NAK,
+      the Client has to resend starting with the given sequence number.
+    - Each chunk is written directly into the flash partition, the flash
+      sectors are erased step by step just before they are used. There is
+      no RAM buffer for the blob data.
+    - A running CRC32 is calculated over the received data. STREAM_CMD_FINISH
+      compares it with the CRC given by STREAM_CMD_START; only if both are
+      matching, the blob header is written and the blob becomes valid.
+    - The transfer state is kept in RAM. After a disconnect, the Client
+      sends the same STREAM_CMD_START again and gets STREAM_STATUS_RESUMED
+      together with the sequence number to continue with.
+
+    Partition Layout:
+
+        Offset 0:   tStreamBlobHdr (written at the end of a valid transfer)
+        Offset 16:  Blob Data
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include "ESP32BleCfgStream.h"
+
+#define DEBUG                                                           // Enable/Disable TRACE
+#include "Trace.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStream                                       */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Local Definitions
+//---------------------------------------------------------------------------
+
+#define STREAM_FLASH_SECTOR_SIZE        4096
+#define STREAM_BLOB_MAGIC_ID            0x53426C42          // ASCII 'BlBS' = [Bl]e [B]lob [S]tream
+
+
+// Header in front of the Blob Data in the flash partition
+typedef struct
+{
+
+    uint32_t        m_ui32MagicID;
+    uint32_t        m_ui32Size;
+    uint32_t        m_ui32Crc32;
+    uint32_t        m_ui32Reserved;
+
+} tStreamBlobHdr;
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  const esp_partition_t*  pStreamPart_g               = NULL;
+
+static  tStreamStatus       StreamStatus_g                  = { 0 };
+static  uint32_t            ui32StreamErasedEnd_g           = 0;        // partition offset up to which the flash is erased
+static  bool                fStreamNakSent_g                = false;    // NAK already sent for current gap
+static  uint16_t            ui16StreamChunksSinceAck_g      = 0;
+static  unsigned long       ulStreamSessionStartTick_g      = 0;
+static  uint32_t            ui32StreamSessionStartOffs_g    = 0;
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: Setup()
+//---------------------------------------------------------------------------
+//  Return:      1 -> partition found
+//              -1 -> Error (invalid parameter, partition not found)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStream::Setup (
+        const char* pszPartLabel_p)
+{
+
+    if (pszPartLabel_p == NULL)
+    {
+        return (-1);
+    }
+
+    pStreamPart_g = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, pszPartLabel_p);
+    if (pStreamPart_g == NULL)
+    {
+        TRACE1("ESP32BleCfgStream: partition '%s' not found\n", pszPartLabel_p);
+        return (-1);
+    }
+
+    TRACE2("ESP32BleCfgStream: partition '%s', size=%lu\n", pszPartLabel_p, (unsigned long)pStreamPart_g->size);
+
+    memset(&StreamStatus_g, 0x00, sizeof(StreamStatus_g));
+    StreamStatus_g.m_ui8State = STREAM_STATE_IDLE;
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ProcessCtrl()
+//---------------------------------------------------------------------------
+//  Processes a command written to [Stream/Control].
+//
+//  Return:     >0 -> size of the response in <pabRsp_p> to be notified
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStream::ProcessCtrl (
+        const uint8_t* pabData_p,
+        unsigned int uiDataLen_p,
+        unsigned int uiMaxChunkSize_p,
+        uint8_t* pabRsp_p)
+{
+
+uint16_t       ui16ChunkSize;
+uint32_t       ui32TotalSize;
+uint32_t       ui32Crc32;
+uint16_t       ui16Window;
+unsigned long  ulElapsedTime;
+
+    if ((pabData_p == NULL) || (uiDataLen_p < 1) || (pStreamPart_g == NULL))
+    {
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_PARAM_ERROR));
+    }
+
+    switch (pabData_p[0])
+    {
+        // ---- start new or resume pending transfer ----
+        case STREAM_CMD_START:
+        {
+            if (uiDataLen_p < STREAM_CMD_START_SIZE)
+            {
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_PARAM_ERROR));
+            }
+
+            ui16ChunkSize = (uint16_t)pabData_p[2]  | ((uint16_t)pabData_p[3] << 8);
+            ui32TotalSize = (uint32_t)pabData_p[4]  | ((uint32_t)pabData_p[5] << 8)  | ((uint32_t)pabData_p[6] << 16)  | ((uint32_t)pabData_p[7] << 24);
+            ui32Crc32     = (uint32_t)pabData_p[8]  | ((uint32_t)pabData_p[9] << 8)  | ((uint32_t)pabData_p[10] << 16) | ((uint32_t)pabData_p[11] << 24);
+            ui16Window    = (uint16_t)pabData_p[12] | ((uint16_t)pabData_p[13] << 8);
+
+            if ((ui16ChunkSize == 0) || (ui16ChunkSize > uiMaxChunkSize_p) || (ui16Window == 0))
+            {
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_PARAM_ERROR));
+            }
+            if ((ui32TotalSize == 0) || (ui32TotalSize > (pStreamPart_g->size - sizeof(tStreamBlobHdr))))
+            {
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_SIZE_ERROR));
+            }
+
+            ulStreamSessionStartTick_g = millis();
+            ui16StreamChunksSinceAck_g = 0;
+            fStreamNakSent_g           = false;
+
+            // same transfer as the pending one? -> resume
+            if ((StreamStatus_g.m_ui8State     == STREAM_STATE_ACTIVE) &&
+                (StreamStatus_g.m_ui16ChunkSize == ui16ChunkSize)      &&
+                (StreamStatus_g.m_ui32TotalSize == ui32TotalSize)      &&
+                (StreamStatus_g.m_ui32ExpectedCrc == ui32Crc32))
+            {
+                StreamStatus_g.m_ui16Window = ui16Window;
+                StreamStatus_g.m_ui32ResumeCnt++;
+                ui32StreamSessionStartOffs_g = StreamStatus_g.m_ui32Offset;
+                TRACE2("ESP32BleCfgStream: resume at Seq=%u, Offset=%lu\n", StreamStatus_g.m_ui16NextSeq, (unsigned long)StreamStatus_g.m_ui32Offset);
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ACK, STREAM_STATUS_RESUMED));
+            }
+
+            StreamStatus_g.m_ui8State        = STREAM_STATE_ACTIVE;
+            StreamStatus_g.m_ui16ChunkSize   = ui16ChunkSize;
+            StreamStatus_g.m_ui16Window      = ui16Window;
+            StreamStatus_g.m_ui16NextSeq     = 0;
+            StreamStatus_g.m_ui32TotalSize   = ui32TotalSize;
+            StreamStatus_g.m_ui32ExpectedCrc = ui32Crc32;
+            StreamStatus_g.m_ui32Offset      = 0;
+            StreamStatus_g.m_ui32RunningCrc  = 0;
+            StreamStatus_g.m_ui32Throughput  = 0;
+            ui32StreamSessionStartOffs_g     = 0;
+
+            // erasing the first sector invalidates the header of a previous blob
+            ui32StreamErasedEnd_g = 0;
+            if ( !EraseUpTo(sizeof(tStreamBlobHdr)) )
+            {
+                StreamStatus_g.m_ui8State = STREAM_STATE_ERROR;
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_FLASH_ERROR));
+            }
+
+            TRACE3("ESP32BleCfgStream: start, TotalSize=%lu, ChunkSize=%u, Window=%u\n", (unsigned long)ui32TotalSize, ui16ChunkSize, ui16Window);
+            return (BuildRsp(pabRsp_p, STREAM_RSP_ACK, STREAM_STATUS_OK));
+        }
+
+        // ---- verify and finish transfer ----
+        case STREAM_CMD_FINISH:
+        {
+            if ((StreamStatus_g.m_ui8State != STREAM_STATE_ACTIVE) || (StreamStatus_g.m_ui32Offset != StreamStatus_g.m_ui32TotalSize))
+            {
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_STATE_ERROR));
+            }
+
+            if (StreamStatus_g.m_ui32RunningCrc != StreamStatus_g.m_ui32ExpectedCrc)
+            {
+                StreamStatus_g.m_ui8State = STREAM_STATE_ERROR;
+                TRACE2("ESP32BleCfgStream: CRC mismatch (0x%08lX / 0x%08lX)\n", (unsigned long)StreamStatus_g.m_ui32RunningCrc, (unsigned long)StreamStatus_g.m_ui32ExpectedCrc);
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_CRC_ERROR));
+            }
+
+            if ( !WriteBlobHdr() )
+            {
+                StreamStatus_g.m_ui8State = STREAM_STATE_ERROR;
+                return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_FLASH_ERROR));
+            }
+
+            ulElapsedTime = millis() - ulStreamSessionStartTick_g;
+            if (ulElapsedTime == 0)
+            {
+                ulElapsedTime = 1;
+            }
+            StreamStatus_g.m_ui32Throughput = (uint32_t)(((uint64_t)(StreamStatus_g.m_ui32Offset - ui32StreamSessionStartOffs_g) * 1000) / ulElapsedTime);
+            StreamStatus_g.m_ui8State = STREAM_STATE_DONE;
+
+            TRACE2("ESP32BleCfgStream: done, Size=%lu, Throughput=%lu Bytes/s\n", (unsigned long)StreamStatus_g.m_ui32TotalSize, (unsigned long)StreamStatus_g.m_ui32Throughput);
+            return (BuildRsp(pabRsp_p, STREAM_RSP_DONE, STREAM_STATUS_OK));
+        }
+
+        // ---- discard pending transfer ----
+        case STREAM_CMD_ABORT:
+        {
+            StreamStatus_g.m_ui8State = STREAM_STATE_IDLE;
+            return (BuildRsp(pabRsp_p, STREAM_RSP_ACK, STREAM_STATUS_OK));
+        }
+
+        // ---- report current state ----
+        case STREAM_CMD_QUERY:
+        {
+            return (BuildRsp(pabRsp_p, STREAM_RSP_STATUS, STREAM_STATUS_OK));
+        }
+
+        default:
+        {
+            return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_PARAM_ERROR));
+        }
+    }
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ProcessData()
+//---------------------------------------------------------------------------
+//  Processes a chunk written to [Stream/Data].
+//
+//  Return:     >0 -> size of the response in <pabRsp_p> to be notified
+//               0 -> no response required
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStream::ProcessData (
+        const uint8_t* pabData_p,
+        unsigned int uiDataLen_p,
+        uint8_t* pabRsp_p)
+{
+
+uint16_t   ui16Seq;
+uint32_t   ui32PayloadLen;
+uint32_t   ui32ExpectedLen;
+uint32_t   ui32FlashOffs;
+esp_err_t  EspRes;
+
+    if (StreamStatus_g.m_ui8State != STREAM_STATE_ACTIVE)
+    {
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_STATE_ERROR));
+    }
+    if ((pabData_p == NULL) || (uiDataLen_p <= STREAM_DATA_HDR_SIZE))
+    {
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_PARAM_ERROR));
+    }
+
+    ui16Seq = (uint16_t)pabData_p[0] | ((uint16_t)pabData_p[1] << 8);
+    if (ui16Seq != StreamStatus_g.m_ui16NextSeq)
+    {
+        // chunks already received (e.g. retransmission after NAK) are ignored silently,
+        // a gap is reported only once until the expected chunk arrives
+        if (((int16_t)(ui16Seq - StreamStatus_g.m_ui16NextSeq) < 0) || fStreamNakSent_g)
+        {
+            return (0);
+        }
+        fStreamNakSent_g = true;
+        ui16StreamChunksSinceAck_g = 0;
+        StreamStatus_g.m_ui32SeqGapCnt++;
+        return (BuildRsp(pabRsp_p, STREAM_RSP_NAK, STREAM_STATUS_SEQ_GAP));
+    }
+
+    ui32PayloadLen  = uiDataLen_p - STREAM_DATA_HDR_SIZE;
+    ui32ExpectedLen = StreamStatus_g.m_ui32TotalSize - StreamStatus_g.m_ui32Offset;
+    if (ui32ExpectedLen > StreamStatus_g.m_ui16ChunkSize)
+    {
+        ui32ExpectedLen = StreamStatus_g.m_ui16ChunkSize;
+    }
+    if (ui32PayloadLen != ui32ExpectedLen)
+    {
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_PARAM_ERROR));
+    }
+
+    // write chunk directly into flash
+    ui32FlashOffs = sizeof(tStreamBlobHdr) + StreamStatus_g.m_ui32Offset;
+    if ( !EraseUpTo(ui32FlashOffs + ui32PayloadLen) )
+    {
+        StreamStatus_g.m_ui8State = STREAM_STATE_ERROR;
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_FLASH_ERROR));
+    }
+    EspRes = esp_partition_write(pStreamPart_g, ui32FlashOffs, &pabData_p[STREAM_DATA_HDR_SIZE], ui32PayloadLen);
+    if (EspRes != ESP_OK)
+    {
+        StreamStatus_g.m_ui8State = STREAM_STATE_ERROR;
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ERROR, STREAM_STATUS_FLASH_ERROR));
+    }
+
+    StreamStatus_g.m_ui32RunningCrc = esp_rom_crc32_le(StreamStatus_g.m_ui32RunningCrc, &pabData_p[STREAM_DATA_HDR_SIZE], ui32PayloadLen);
+    StreamStatus_g.m_ui32Offset += ui32PayloadLen;
+    StreamStatus_g.m_ui16NextSeq++;
+    fStreamNakSent_g = false;
+    ui16StreamChunksSinceAck_g++;
+
+    // acknowledge each full window as well as the last chunk
+    if ((ui16StreamChunksSinceAck_g >= StreamStatus_g.m_ui16Window) ||
+        (StreamStatus_g.m_ui32Offset == StreamStatus_g.m_ui32TotalSize))
+    {
+        ui16StreamChunksSinceAck_g = 0;
+        return (BuildRsp(pabRsp_p, STREAM_RSP_ACK, STREAM_STATUS_OK));
+    }
+
+    return (0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetStatus()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStream::GetStatus (
+        tStreamStatus* pStreamStatus_p)
+{
+
+    if (pStreamStatus_p == NULL)
+    {
+        return (false);
+    }
+
+    memcpy(pStreamStatus_p, &StreamStatus_g, sizeof(tStreamStatus));
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetBlobInfo()
+//---------------------------------------------------------------------------
+//  Return:      1 -> valid blob available
+//               0 -> no valid blob
+//              -1 -> Error (partition not available)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStream::GetBlobInfo (
+        uint32_t* pui32Size_p,
+        uint32_t* pui32Crc32_p)
+{
+
+tStreamBlobHdr  BlobHdr;
+esp_err_t       EspRes;
+
+    if (pStreamPart_g == NULL)
+    {
+        return (-1);
+    }
+
+    EspRes = esp_partition_read(pStreamPart_g, 0, &BlobHdr, sizeof(BlobHdr));
+    if (EspRes != ESP_OK)
+    {
+        return (-1);
+    }
+
+    if ((BlobHdr.m_ui32MagicID != STREAM_BLOB_MAGIC_ID) ||
+        (BlobHdr.m_ui32Size > (pStreamPart_g->size - sizeof(tStreamBlobHdr))))
+    {
+        return (0);
+    }
+
+    if (pui32Size_p != NULL)
+    {
+        *pui32Size_p = BlobHdr.m_ui32Size;
+    }
+    if (pui32Crc32_p != NULL)
+    {
+        *pui32Crc32_p = BlobHdr.m_ui32Crc32;
+    }
+
+    return (1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ReadBlob()
+//---------------------------------------------------------------------------
+//  Return:    >=0 -> number of bytes read
+//              -1 -> Error (invalid parameter, no valid blob)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStream::ReadBlob (
+        uint32_t ui32Offset_p,
+        void* pBuff_p,
+        uint32_t ui32Len_p)
+{
+
+uint32_t   ui32BlobSize;
+esp_err_t  EspRes;
+int        iRes;
+
+    if (pBuff_p == NULL)
+    {
+        return (-1);
+    }
+
+    iRes = GetBlobInfo(&ui32BlobSize, NULL);
+    if (iRes != 1)
+    {
+        return (-1);
+    }
+
+    if (ui32Offset_p >= ui32BlobSize)
+    {
+        return (0);
+    }
+    if (ui32Len_p > (ui32BlobSize - ui32Offset_p))
+    {
+        ui32Len_p = ui32BlobSize - ui32Offset_p;
+    }
+
+    EspRes = esp_partition_read(pStreamPart_g, sizeof(tStreamBlobHdr) + ui32Offset_p, pBuff_p, ui32Len_p);
+    if (EspRes != ESP_OK)
+    {
+        return (-1);
+    }
+
+    return ((int)ui32Len_p);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: BuildRsp()
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgStream::BuildRsp (
+        uint8_t* pabRsp_p,
+        uint8_t ui8Rsp_p,
+        uint8_t ui8Status_p)
+{
+
+    if (pabRsp_p == NULL)
+    {
+        return (0);
+    }
+
+    pabRsp_p[0]  = ui8Rsp_p;
+    pabRsp_p[1]  = ui8Status_p;
+    pabRsp_p[2]  = (uint8_t)(StreamStatus_g.m_ui16NextSeq);
+    pabRsp_p[3]  = (uint8_t)(StreamStatus_g.m_ui16NextSeq >> 8);
+    pabRsp_p[4]  = (uint8_t)(StreamStatus_g.m_ui32Offset);
+    pabRsp_p[5]  = (uint8_t)(StreamStatus_g.m_ui32Offset >> 8);
+    pabRsp_p[6]  = (uint8_t)(StreamStatus_g.m_ui32Offset >> 16);
+    pabRsp_p[7]  = (uint8_t)(StreamStatus_g.m_ui32Offset >> 24);
+    pabRsp_p[8]  = (uint8_t)(StreamStatus_g.m_ui32RunningCrc);
+    pabRsp_p[9]  = (uint8_t)(StreamStatus_g.m_ui32RunningCrc >> 8);
+    pabRsp_p[10] = (uint8_t)(StreamStatus_g.m_ui32RunningCrc >> 16);
+    pabRsp_p[11] = (uint8_t)(StreamStatus_g.m_ui32RunningCrc >> 24);
+
+    return (STREAM_RSP_SIZE);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: EraseUpTo()
+//---------------------------------------------------------------------------
+//  Erases the flash sectors up to the given partition offset (exclusive).
+//  Sectors already erased during the current transfer are not touched
+//  again, so each sector is erased once just before it is written first.
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStream::EraseUpTo (
+        uint32_t ui32EndOffset_p)
+{
+
+esp_err_t  EspRes;
+
+    while (ui32StreamErasedEnd_g < ui32EndOffset_p)
+    {
+        EspRes = esp_partition_erase_range(pStreamPart_g, ui32StreamErasedEnd_g, STREAM_FLASH_SECTOR_SIZE);
+        if (EspRes != ESP_OK)
+        {
+            TRACE1("ESP32BleCfgStream: erase failed at 0x%08lX\n", (unsigned long)ui32StreamErasedEnd_g);
+            return (false);
+        }
+        ui32StreamErasedEnd_g += STREAM_FLASH_SECTOR_SIZE;
+    }
+
+    return (true);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: WriteBlobHdr()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgStream::WriteBlobHdr ()
+{
+
+tStreamBlobHdr  BlobHdr;
+esp_err_t       EspRes;
+
+    BlobHdr.m_ui32MagicID  = STREAM_BLOB_MAGIC_ID;
+    BlobHdr.m_ui32Size     = StreamStatus_g.m_ui32TotalSize;
+    BlobHdr.m_ui32Crc32    = StreamStatus_g.m_ui32RunningCrc;
+    BlobHdr.m_ui32Reserved = 0xFFFFFFFF;
+
+    // header area was erased by STREAM_CMD_START and is still untouched
+    EspRes = esp_partition_write(pStreamPart_g, 0, &BlobHdr, sizeof(BlobHdr));
+
+    return ((EspRes == ESP_OK) ? true : false);
+
+}
+
+
+
+
+//  EOF
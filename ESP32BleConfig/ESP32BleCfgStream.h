@@ -0,0 +1,147 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgStream> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGSTREAM_H_
+#define _ESP32BLECFGSTREAM_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Stream Control Commands, written by the Client to [Stream/Control]
+// (all values little endian)
+#define STREAM_CMD_START                0x01    // [Cmd:8][Rsvd:8][ChunkSize:16][TotalSize:32][Crc32:32][Window:16]
+#define STREAM_CMD_FINISH               0x02    // [Cmd:8]
+#define STREAM_CMD_ABORT                0x03    // [Cmd:8]
+#define STREAM_CMD_QUERY                0x04    // [Cmd:8]
+
+#define STREAM_CMD_START_SIZE           14
+
+// Stream Responses, notified by the Server via [Stream/Control]:
+//   [Rsp:8][Status:8][NextSeq:16][Offset:32][RunningCrc32:32]
+#define STREAM_RSP_ACK                  0x81    // window acknowledged, next expected chunk
+#define STREAM_RSP_NAK                  0x82    // sequence gap, resend starting with NextSeq
+#define STREAM_RSP_DONE                 0x83    // transfer completed and verified
+#define STREAM_RSP_ERROR                0x84    // transfer failed (see Status)
+#define STREAM_RSP_STATUS               0x85    // answer to STREAM_CMD_QUERY
+
+#define STREAM_RSP_SIZE                 12
+
+// Data Chunks, written by the Client to [Stream/Data] (Write Without Response):
+//   [Seq:16][Payload:ChunkSize]  (last chunk may be shorter)
+#define STREAM_DATA_HDR_SIZE            2
+
+// Status Codes
+#define STREAM_STATUS_OK                0
+#define STREAM_STATUS_RESUMED           1       // START matched pending transfer -> continue with NextSeq
+#define STREAM_STATUS_SEQ_GAP           2
+#define STREAM_STATUS_CRC_ERROR         3
+#define STREAM_STATUS_SIZE_ERROR        4
+#define STREAM_STATUS_FLASH_ERROR       5
+#define STREAM_STATUS_STATE_ERROR       6
+#define STREAM_STATUS_PARAM_ERROR       7
+
+// Transfer States
+#define STREAM_STATE_IDLE               0
+#define STREAM_STATE_ACTIVE             1
+#define STREAM_STATE_DONE               2
+#define STREAM_STATE_ERROR              3
+
+
+// Data structure with the state of the current/last transfer
+typedef struct
+{
+
+    uint8_t         m_ui8State;                 // STREAM_STATE_xxx
+    uint16_t        m_ui16ChunkSize;            // payload size per chunk                       [Bytes]
+    uint16_t        m_ui16Window;               // number of chunks per acknowledge
+    uint16_t        m_ui16NextSeq;              // next expected chunk sequence number
+    uint32_t        m_ui32TotalSize;            // size of the complete blob                    [Bytes]
+    uint32_t        m_ui32ExpectedCrc;          // CRC32 of the complete blob given by Client
+    uint32_t        m_ui32Offset;               // number of bytes received so far              [Bytes]
+    uint32_t        m_ui32RunningCrc;           // CRC32 over the bytes received so far
+    uint32_t        m_ui32Throughput;           // throughput of the last session               [Bytes/s]
+    uint32_t        m_ui32SeqGapCnt;            // number of sequence gaps (NAK)
+    uint32_t        m_ui32ResumeCnt;            // number of resumed transfers
+
+} tStreamStatus;
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgStream                                       */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgStream
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  int   Setup(const char* pszPartLabel_p);
+        static  int   ProcessCtrl(const uint8_t* pabData_p, unsigned int uiDataLen_p, unsigned int uiMaxChunkSize_p, uint8_t* pabRsp_p);
+        static  int   ProcessData(const uint8_t* pabData_p, unsigned int uiDataLen_p, uint8_t* pabRsp_p);
+        static  bool  GetStatus(tStreamStatus* pStreamStatus_p);
+
+        static  int   GetBlobInfo(uint32_t* pui32Size_p, uint32_t* pui32Crc32_p);
+        static  int   ReadBlob(uint32_t ui32Offset_p, void* pBuff_p, uint32_t ui32Len_p);
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  int   BuildRsp(uint8_t* pabRsp_p, uint8_t ui8Rsp_p, uint8_t ui8Status_p);
+        static  bool  EraseUpTo(uint32_t ui32EndOffset_p);
+        static  bool  WriteBlobHdr();
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGSTREAM_H_
@@ -0,0 +1,641 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgView> Implementation
+
+  -------------------------------------------------------------------------
+
+    Typed read access to the Configuration Data for the application code
+    (e.g. in Normal Operation Mode), independent of the BLE task writing
+    the configuration.
+
+    The data is published as a snapshot protected by a sequence lock:
+    Publish() increments the sequence counter to an odd value, updates the
+    snapshot and increments the counter to an even value again. Readers
+    copy the requested data and retry if the counter was odd or has
+    changed meanwhile. So readers on both cores never take a lock and never
+    see a partially written snapshot. Writers are serialized by a spinlock
+    (short critical section, only the memcpy of the snapshot).
+
+    Option bits and WiFi mode are additionally held in a single 32 bit
+    word, so that their getters are a plain load without any retry.
+
+    Change Subscription: Publish() compares the new data field by field
+    with the previous snapshot and collects the changed fields in a pending
+    mask. DispatchChanges() is called once per loop tick by the application
+    and calls each matching subscriber once per changed field. So several
+    changes within one tick (e.g. a Config Patch followed by SaveConfig)
+    are coalesced to a single call per field, and the subscribers always
+    run in the context of the loop task, never inside a BLE callback.
+
+    Besides the sketch (after loading and saving), the BLE Profile
+    publishes its workspace whenever the client has written a valid value
+    (single characteristic, Config Patch, Config Image). So subscribers
+    see a value written by the client with the next loop tick, without
+    waiting for [DevMnt/SaveConfig]. Values not saved until the BLE Config
+    Mode is left are reverted by the sketch publishing the saved
+    configuration again.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+  2026/10/18:       V1.10 Published by the BLE Profile on each valid client write
+
+****************************************************************************/
+
+
+#include "Arduino.h"
+#include <freertos/FreeRTOS.h>
+#include "ESP32BleCfgProfile.h"         // -> typedef struct tAppCfgData
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleCfgView.h"
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgView                                         */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E   A T T R I B U T E S                            //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  Local Types
+//---------------------------------------------------------------------------
+
+// Snapshot published to the readers
+typedef struct
+{
+
+    tAppCfgData         m_AppCfgData;
+    tCfgViewEndpoint    m_WifiOwnEndpoint;
+    tCfgViewEndpoint    m_AppRtPeerEndpoint;
+
+} tCfgViewData;
+
+
+// Entry of the Subscriber List
+typedef struct
+{
+
+    uint8_t             m_ui8FieldId;               // CFG_FIELD_xxx / CFG_VIEW_FIELD_ALL
+    tCbHdlrCfgChanged   m_pfnCbHdlrCfgChanged;      // NULL -> entry unused
+
+} tCfgViewSubscriber;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Definitions
+//---------------------------------------------------------------------------
+
+#define CFG_VIEW_FLAG_VALID             0x80000000      // snapshot has been published
+#define CFG_VIEW_FLAG_OWNMODE_SHIFT     8               // Bit[15..8] = m_ui8WifiOwnMode
+#define CFG_VIEW_FLAG_OPT_MASK          0x000000FF      // Bit[7..0]  = m_fAppRtOpt1..8
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+static  portMUX_TYPE        ViewLock_g                      = portMUX_INITIALIZER_UNLOCKED;     // serializes writers only
+static  volatile uint32_t   ui32ViewSeq_g                   = 0;        // odd while the snapshot is updated
+static  volatile uint32_t   ui32ViewFlags_g                 = 0;        // CFG_VIEW_FLAG_xxx
+static  tCfgViewData        ViewData_g;                                 // protected by ui32ViewSeq_g
+
+static  volatile uint32_t   ui32ViewPendingMask_g           = 0;        // Bit[FieldIdx] = 1 -> field changed since last dispatch
+static  tCfgViewSubscriber  aViewSubscriberList_g[CFG_VIEW_MAX_SUBSCRIBERS];
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P U B L I C    M E T H O D E S                                 //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: Publish()
+//---------------------------------------------------------------------------
+//  Has to be called after the Configuration Data has been loaded or
+//  changed (may be called from any task).
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgView::Publish (
+        const tAppCfgData* pAppCfgData_p)
+{
+
+tAppCfgData       PrevCfgData;
+tCfgViewEndpoint  WifiOwnEndpoint;
+tCfgViewEndpoint  AppRtPeerEndpoint;
+uint32_t          ui32Flags;
+
+    if (pAppCfgData_p == NULL)
+    {
+        return;
+    }
+
+    // collect changed fields (the initial Publish() only sets the baseline);
+    // concurrent writers may mark a field twice, but never miss a change
+    if ( GetSnapshot(&PrevCfgData) )
+    {
+        __atomic_fetch_or(&ui32ViewPendingMask_g, CalcChangedMask(&PrevCfgData, pAppCfgData_p), __ATOMIC_SEQ_CST);
+    }
+
+    // parse outside the critical section
+    ParseEndpoint(pAppCfgData_p->m_szWifiOwnAddr, sizeof(pAppCfgData_p->m_szWifiOwnAddr), &WifiOwnEndpoint);
+    ParseEndpoint(pAppCfgData_p->m_szAppRtPeerAddr, sizeof(pAppCfgData_p->m_szAppRtPeerAddr), &AppRtPeerEndpoint);
+
+    ui32Flags  = CFG_VIEW_FLAG_VALID;
+    ui32Flags |= (uint32_t)pAppCfgData_p->m_ui8WifiOwnMode << CFG_VIEW_FLAG_OWNMODE_SHIFT;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt1) ? 0x01 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt2) ? 0x02 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt3) ? 0x04 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt4) ? 0x08 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt5) ? 0x10 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt6) ? 0x20 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt7) ? 0x40 : 0x00;
+    ui32Flags |= (pAppCfgData_p->m_fAppRtOpt8) ? 0x80 : 0x00;
+
+    portENTER_CRITICAL(&ViewLock_g);
+    {
+        ui32ViewSeq_g = ui32ViewSeq_g + 1;                              // odd -> update in progress
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        memcpy(&ViewData_g.m_AppCfgData, pAppCfgData_p, sizeof(ViewData_g.m_AppCfgData));
+        memcpy(&ViewData_g.m_WifiOwnEndpoint, &WifiOwnEndpoint, sizeof(ViewData_g.m_WifiOwnEndpoint));
+        memcpy(&ViewData_g.m_AppRtPeerEndpoint, &AppRtPeerEndpoint, sizeof(ViewData_g.m_AppRtPeerEndpoint));
+
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        ui32ViewSeq_g = ui32ViewSeq_g + 1;                              // even -> snapshot consistent
+        ui32ViewFlags_g = ui32Flags;
+    }
+    portEXIT_CRITICAL(&ViewLock_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: IsValid()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgView::IsValid ()
+{
+
+    return ((ui32ViewFlags_g & CFG_VIEW_FLAG_VALID) ? true : false);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetSequence()
+//---------------------------------------------------------------------------
+//  Changes with each Publish(), so readers can detect a new configuration.
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgView::GetSequence ()
+{
+
+    return (ui32ViewSeq_g & ~1UL);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetAppRtOptBits()
+//---------------------------------------------------------------------------
+//  Return:     Bit[0] = m_fAppRtOpt1 ... Bit[7] = m_fAppRtOpt8
+//---------------------------------------------------------------------------
+
+uint8_t  ESP32BleCfgView::GetAppRtOptBits ()
+{
+
+    return ((uint8_t)(ui32ViewFlags_g & CFG_VIEW_FLAG_OPT_MASK));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetAppRtOpt()
+//---------------------------------------------------------------------------
+//  <uiOptNum_p> = 1..8
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgView::GetAppRtOpt (
+        unsigned int uiOptNum_p)
+{
+
+    if ((uiOptNum_p < 1) || (uiOptNum_p > 8))
+    {
+        return (false);
+    }
+
+    return ((ui32ViewFlags_g & (1UL << (uiOptNum_p - 1))) ? true : false);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetWifiOwnMode()
+//---------------------------------------------------------------------------
+//  Return:     WIFI_OPMODE_STA / WIFI_OPMODE_AP
+//---------------------------------------------------------------------------
+
+uint8_t  ESP32BleCfgView::GetWifiOwnMode ()
+{
+
+    return ((uint8_t)(ui32ViewFlags_g >> CFG_VIEW_FLAG_OWNMODE_SHIFT));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetWifiOwnEndpoint()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgView::GetWifiOwnEndpoint (
+        tCfgViewEndpoint* pEndpoint_p)
+{
+
+    if (pEndpoint_p == NULL)
+    {
+        return (false);
+    }
+
+    ReadConsistent(offsetof(tCfgViewData, m_WifiOwnEndpoint), pEndpoint_p, sizeof(*pEndpoint_p));
+
+    return (pEndpoint_p->m_fValid);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetAppRtPeerEndpoint()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgView::GetAppRtPeerEndpoint (
+        tCfgViewEndpoint* pEndpoint_p)
+{
+
+    if (pEndpoint_p == NULL)
+    {
+        return (false);
+    }
+
+    ReadConsistent(offsetof(tCfgViewData, m_AppRtPeerEndpoint), pEndpoint_p, sizeof(*pEndpoint_p));
+
+    return (pEndpoint_p->m_fValid);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetString()
+//---------------------------------------------------------------------------
+//  Copies a string field (CFG_FIELD_xxx) as zero terminated string into
+//  <pszBuff_p>. The string can not be returned as pointer into the
+//  snapshot, since the snapshot may be overwritten at any time.
+//
+//  Return:     >= 0 -> Length of the string
+//              <  0 -> Error (unknown/no string field, buffer too small)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgView::GetString (
+        uint8_t ui8FieldId_p,
+        char* pszBuff_p,
+        unsigned int uiBuffSize_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+tAppCfgData            AppCfgData;
+int                    iLen;
+
+    pFieldDescr = ESP32BleCfgFields::GetFieldDescr(ui8FieldId_p);
+    if ((pFieldDescr == NULL) || (pFieldDescr->m_ui8Type != CFG_FIELD_TYPE_STRING) || (pszBuff_p == NULL))
+    {
+        return (-1);
+    }
+    if (uiBuffSize_p < (unsigned int)(pFieldDescr->m_ui8MaxLen + 1))
+    {
+        return (-2);
+    }
+
+    ReadConsistent(offsetof(tCfgViewData, m_AppCfgData), &AppCfgData, sizeof(AppCfgData));
+    iLen = ESP32BleCfgFields::GetField(&AppCfgData, ui8FieldId_p, (uint8_t*)pszBuff_p, uiBuffSize_p - 1);
+    if (iLen < 0)
+    {
+        return (iLen);
+    }
+    pszBuff_p[iLen] = '\0';
+
+    return (iLen);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetSnapshot()
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgView::GetSnapshot (
+        tAppCfgData* pAppCfgData_p)
+{
+
+    if (pAppCfgData_p == NULL)
+    {
+        return (false);
+    }
+
+    ReadConsistent(offsetof(tCfgViewData, m_AppCfgData), pAppCfgData_p, sizeof(*pAppCfgData_p));
+
+    return (IsValid());
+
+}
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Subscribe()
+//---------------------------------------------------------------------------
+//  Registers a callback handler for changes of the field <ui8FieldId_p>
+//  (CFG_FIELD_xxx) or of any field (CFG_VIEW_FIELD_ALL). The same handler
+//  may be registered for several fields. Subscribe(), Unsubscribe() and
+//  DispatchChanges() have to be called from the same task.
+//
+//  Return:     >= 0 -> Index of the subscriber entry
+//              <  0 -> Error (unknown field, no free entry)
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgView::Subscribe (
+        uint8_t ui8FieldId_p,
+        tCbHdlrCfgChanged pfnCbHdlrCfgChanged_p)
+{
+
+unsigned int  uiIdx;
+
+    if (pfnCbHdlrCfgChanged_p == NULL)
+    {
+        return (-1);
+    }
+    if ((ui8FieldId_p != CFG_VIEW_FIELD_ALL) && (ESP32BleCfgFields::GetFieldDescr(ui8FieldId_p) == NULL))
+    {
+        return (-2);
+    }
+
+    for (uiIdx=0; uiIdx<CFG_VIEW_MAX_SUBSCRIBERS; uiIdx++)
+    {
+        if (aViewSubscriberList_g[uiIdx].m_pfnCbHdlrCfgChanged == NULL)
+        {
+            aViewSubscriberList_g[uiIdx].m_ui8FieldId = ui8FieldId_p;
+            aViewSubscriberList_g[uiIdx].m_pfnCbHdlrCfgChanged = pfnCbHdlrCfgChanged_p;
+            return ((int)uiIdx);
+        }
+    }
+
+    return (-3);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: Unsubscribe()
+//---------------------------------------------------------------------------
+//  Removes all entries of the given callback handler.
+//
+//  Return:     Number of removed entries
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgView::Unsubscribe (
+        tCbHdlrCfgChanged pfnCbHdlrCfgChanged_p)
+{
+
+unsigned int  uiIdx;
+int           iCount;
+
+    iCount = 0;
+    for (uiIdx=0; uiIdx<CFG_VIEW_MAX_SUBSCRIBERS; uiIdx++)
+    {
+        if ((pfnCbHdlrCfgChanged_p != NULL) && (aViewSubscriberList_g[uiIdx].m_pfnCbHdlrCfgChanged == pfnCbHdlrCfgChanged_p))
+        {
+            aViewSubscriberList_g[uiIdx].m_pfnCbHdlrCfgChanged = NULL;
+            iCount++;
+        }
+    }
+
+    return (iCount);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: GetPendingChanges()
+//---------------------------------------------------------------------------
+//  Return:     Bit[FieldIdx] = 1 -> field changed since last dispatch
+//              (FieldIdx as used by ESP32BleCfgFields::GetFieldDescrByIdx)
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgView::GetPendingChanges ()
+{
+
+    return (ui32ViewPendingMask_g);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: DispatchChanges()
+//---------------------------------------------------------------------------
+//  Has to be called once per loop tick. Takes over all changes collected
+//  since the last call and calls each matching subscriber once per changed
+//  field. The new values can be read via the getters of this class.
+//
+//  Return:     Number of changed fields
+//---------------------------------------------------------------------------
+
+int  ESP32BleCfgView::DispatchChanges ()
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+uint32_t               ui32ChangedMask;
+unsigned int           uiFieldIdx;
+unsigned int           uiIdx;
+int                    iCount;
+
+    if (ui32ViewPendingMask_g == 0)
+    {
+        return (0);
+    }
+
+    ui32ChangedMask = __atomic_exchange_n(&ui32ViewPendingMask_g, 0, __ATOMIC_SEQ_CST);
+
+    iCount = 0;
+    for (uiFieldIdx=0; ui32ChangedMask != 0; uiFieldIdx++)
+    {
+        if ( !(ui32ChangedMask & (1UL << uiFieldIdx)) )
+        {
+            continue;
+        }
+        ui32ChangedMask &= ~(1UL << uiFieldIdx);
+
+        pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx);
+        if (pFieldDescr == NULL)
+        {
+            break;
+        }
+        iCount++;
+
+        for (uiIdx=0; uiIdx<CFG_VIEW_MAX_SUBSCRIBERS; uiIdx++)
+        {
+            if ( (aViewSubscriberList_g[uiIdx].m_pfnCbHdlrCfgChanged != NULL) &&
+                 ((aViewSubscriberList_g[uiIdx].m_ui8FieldId == pFieldDescr->m_ui8FieldId) ||
+                  (aViewSubscriberList_g[uiIdx].m_ui8FieldId == CFG_VIEW_FIELD_ALL)) )
+            {
+                aViewSubscriberList_g[uiIdx].m_pfnCbHdlrCfgChanged(pFieldDescr->m_ui8FieldId);
+            }
+        }
+    }
+
+    return (iCount);
+
+}
+
+
+
+
+
+/////////////////////////////////////////////////////////////////////////////
+//                                                                         //
+//          P R I V A T E    M E T H O D E S                               //
+//                                                                         //
+/////////////////////////////////////////////////////////////////////////////
+
+//---------------------------------------------------------------------------
+//  STATIC: ReadConsistent()
+//---------------------------------------------------------------------------
+//  Reader side of the sequence lock: copy and retry, if a writer has been
+//  active during the copy.
+//---------------------------------------------------------------------------
+
+void  ESP32BleCfgView::ReadConsistent (
+        unsigned int uiOffset_p,
+        void* pDest_p,
+        unsigned int uiLen_p)
+{
+
+uint32_t  ui32Seq;
+
+    do
+    {
+        ui32Seq = ui32ViewSeq_g;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+        memcpy(pDest_p, ((const uint8_t*)&ViewData_g) + uiOffset_p, uiLen_p);
+
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    }
+    while ((ui32Seq & 1) || (ui32Seq != ui32ViewSeq_g));
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: ParseEndpoint()
+//---------------------------------------------------------------------------
+//  Format: "a.b.c.d[:port]"
+//---------------------------------------------------------------------------
+
+bool  ESP32BleCfgView::ParseEndpoint (
+        const char* pszNetAddr_p,
+        unsigned int uiMaxLen_p,
+        tCfgViewEndpoint* pEndpoint_p)
+{
+
+    memset(pEndpoint_p, 0x00, sizeof(*pEndpoint_p));
+
+    pEndpoint_p->m_fValid = ESP32BleCfgFields::ParseEndpoint(pszNetAddr_p, uiMaxLen_p, pEndpoint_p->m_abIpAddr, &pEndpoint_p->m_ui16PortNum);
+
+    return (pEndpoint_p->m_fValid);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  STATIC: CalcChangedMask()
+//---------------------------------------------------------------------------
+//  Return:     Bit[FieldIdx] = 1 -> value of the field differs
+//---------------------------------------------------------------------------
+
+uint32_t  ESP32BleCfgView::CalcChangedMask (
+        const tAppCfgData* pOldCfgData_p,
+        const tAppCfgData* pNewCfgData_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+uint8_t                abOldValue[64];
+uint8_t                abNewValue[64];
+int                    iOldLen;
+int                    iNewLen;
+unsigned int           uiFieldIdx;
+uint32_t               ui32ChangedMask;
+
+    ui32ChangedMask = 0;
+    for (uiFieldIdx=0; uiFieldIdx<32; uiFieldIdx++)
+    {
+        pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx);
+        if (pFieldDescr == NULL)
+        {
+            break;
+        }
+
+        iOldLen = ESP32BleCfgFields::GetField(pOldCfgData_p, pFieldDescr->m_ui8FieldId, abOldValue, sizeof(abOldValue));
+        iNewLen = ESP32BleCfgFields::GetField(pNewCfgData_p, pFieldDescr->m_ui8FieldId, abNewValue, sizeof(abNewValue));
+        if ((iOldLen != iNewLen) || ((iNewLen > 0) && (memcmp(abOldValue, abNewValue, iNewLen) != 0)))
+        {
+            ui32ChangedMask |= (1UL << uiFieldIdx);
+        }
+    }
+
+    return (ui32ChangedMask);
+
+}
+
+
+
+
+//  EOF
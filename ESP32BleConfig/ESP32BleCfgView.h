@@ -0,0 +1,116 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      Project independend / Standard class
+  Description:  Class <ESP32BleCfgView> Declaration
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _ESP32BLECFGVIEW_H_
+#define _ESP32BLECFGVIEW_H_
+
+
+
+
+
+//---------------------------------------------------------------------------
+//  Type Definitions
+//---------------------------------------------------------------------------
+
+// Parsed Network Endpoint ("a.b.c.d:port")
+typedef struct
+{
+
+    uint8_t         m_abIpAddr[4];              // a, b, c, d
+    uint16_t        m_ui16PortNum;
+    bool            m_fValid;                   // string could be parsed
+
+} tCfgViewEndpoint;
+
+
+// Subscription of Configuration Changes
+#define CFG_VIEW_FIELD_ALL              0xFF    // subscribe to changes of any field
+#define CFG_VIEW_MAX_SUBSCRIBERS        8
+
+// Subscriber Callback Handler, called by <DispatchChanges()> once per changed field
+typedef  void  (*tCbHdlrCfgChanged) (uint8_t ui8FieldId_p);
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          CLASS  ESP32BleCfgView                                         */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+class  ESP32BleCfgView
+{
+
+    //-----------------------------------------------------------------------
+    //  Definitions
+    //-----------------------------------------------------------------------
+
+    public:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Attributes
+    //-----------------------------------------------------------------------
+
+    private:
+
+
+
+    //-----------------------------------------------------------------------
+    //  Public Methodes
+    //-----------------------------------------------------------------------
+
+    public:
+
+        static  void      Publish(const tAppCfgData* pAppCfgData_p);
+        static  bool      IsValid();
+        static  uint32_t  GetSequence();
+
+        static  uint8_t   GetAppRtOptBits();
+        static  bool      GetAppRtOpt(unsigned int uiOptNum_p);
+        static  uint8_t   GetWifiOwnMode();
+        static  bool      GetWifiOwnEndpoint(tCfgViewEndpoint* pEndpoint_p);
+        static  bool      GetAppRtPeerEndpoint(tCfgViewEndpoint* pEndpoint_p);
+        static  int       GetString(uint8_t ui8FieldId_p, char* pszBuff_p, unsigned int uiBuffSize_p);
+        static  bool      GetSnapshot(tAppCfgData* pAppCfgData_p);
+
+        static  int       Subscribe(uint8_t ui8FieldId_p, tCbHdlrCfgChanged pfnCbHdlrCfgChanged_p);
+        static  int       Unsubscribe(tCbHdlrCfgChanged pfnCbHdlrCfgChanged_p);
+        static  uint32_t  GetPendingChanges();
+        static  int       DispatchChanges();
+
+
+
+    //-----------------------------------------------------------------------
+    //  Private Methodes
+    //-----------------------------------------------------------------------
+
+    private:
+
+        static  void  ReadConsistent(unsigned int uiOffset_p, void* pDest_p, unsigned int uiLen_p);
+        static  bool  ParseEndpoint(const char* pszNetAddr_p, unsigned int uiMaxLen_p, tCfgViewEndpoint* pEndpoint_p);
+        static  uint32_t  CalcChangedMask(const tAppCfgData* pOldCfgData_p, const tAppCfgData* pNewCfgData_p);
+
+
+};
+
+
+
+#endif  // _ESP32BLECFGVIEW_H_
@@ -1,800 +1,2198 @@
-/****************************************************************************
-
-  Copyright (c) 2021 Ronald Sieber
-
-  Project:      ESP32 BLE Config
-  Description:  ESP32 Arduino BLE Config Framework
-
-  -------------------------------------------------------------------------
-
-    Arduino IDE Settings:
-
-    Board:              "ESP32 Dev Module"
-    Upload Speed:       "115200"
-    CPU Frequency:      "240MHz (WiFi/BT)"
-    Flash Frequency:    "80Mhz"
-    Flash Mode:         "QIO"
-    Flash Size:         "4MB (32Mb)"
-    Partition Scheme:   "No OTA (2MB APP/2MB SPIFFS)"
-    PSRAM:              "Disabled"
-
-  -------------------------------------------------------------------------
-
-  Revision History:
-
-  2021/07/13 -rs:   V1.00 Initial version
-
-****************************************************************************/
-
-// #define DEBUG_DUMP_BUFFER
-
-
-#include "ESP32BleCfgProfile.h"
-#include "ESP32BleAppCfgData.h"
-
-
-
-
-
-/***************************************************************************/
-/*                                                                         */
-/*                                                                         */
-/*          G L O B A L   D E F I N I T I O N S                            */
-/*                                                                         */
-/*                                                                         */
-/***************************************************************************/
-
-//---------------------------------------------------------------------------
-//  Application Configuration
-//---------------------------------------------------------------------------
-
-const int       APP_VERSION                         = 1;                // 1.xx
-const int       APP_REVISION                        = 0;                // x.00
-const char      APP_BUILD_TIMESTAMP[]               = __DATE__ " " __TIME__;
-
-const int       CFG_ENABLE_STATUS_LED               = 1;
-
-// EEPROM Size
-#define         APP_EEPROM_SIZE                     512
-
-// Application specific Device Type
-#define         APP_DEVICE_TYPE                     1000000             // DeviceType associated with the BLE Profile
-
-// Default/initial values for Application Configuration <tAppCfgData>
-#define         APP_CFGDATA_MAGIC_ID                0x45735243          // ASCII 'EsRC' = [Es]p32[R]emote[C]onfig
-#define         APP_DEFAULT_DEVICE_NAME             "{ESP32_BLE_DEVICE}"
-#define         APP_DEFAULT_WIFI_SSID               "{WIFI SSID Name}"
-#define         APP_DEFAULT_WIFI_PASSWD             "{WIFI Password}"
-#define         APP_DEFAULT_WIFI_OWNADDR            "0.0.0.0:0"
-#define         APP_DEFAULT_WIFI_OWNMODE            WIFI_OPMODE_STA     // WIFI_OPMODE_STA / WIFI_OPMODE_AP
-#define         APP_DEFAULT_APP_RT_OPT1             true
-#define         APP_DEFAULT_APP_RT_OPT2             false
-#define         APP_DEFAULT_APP_RT_OPT3             true
-#define         APP_DEFAULT_APP_RT_OPT4             false
-#define         APP_DEFAULT_APP_RT_OPT5             false
-#define         APP_DEFAULT_APP_RT_OPT6             true
-#define         APP_DEFAULT_APP_RT_OPT7             false
-#define         APP_DEFAULT_APP_RT_OPT8             true
-#define         APP_DEFAULT_APP_RT_PEERADDR         "0.0.0.0:0"
-
-// Application specific Descriptor Text ('Labels') resp. FeatureLists for BLE Characteristics <tAppDescriptData>
-#define         APP_DESCRPT_WIFI_OWNMODE_FEATLIST   (WIFI_OPMODE_STA | WIFI_OPMODE_AP)
-
-#define         APP_LABEL_APP_RT_OPT1               "APP Runtime Opt#1"
-#define         APP_LABEL_APP_RT_OPT2               "APP Runtime Opt#2"
-#define         APP_LABEL_APP_RT_OPT3               "APP Runtime Opt#3"
-#define         APP_LABEL_APP_RT_OPT4               "APP Runtime Opt#4"
-#define         APP_LABEL_APP_RT_OPT5               "APP Runtime Opt#5"
-#define         APP_LABEL_APP_RT_OPT6               "APP Runtime Opt#6"
-#define         APP_LABEL_APP_RT_OPT7               "# (not used)"      // Start with '#' -> disable in GUI Config Tool
-#define         APP_LABEL_APP_RT_OPT8               "# (not used)"      // Start with '#' -> disable in GUI Config Tool
-#define         APP_LABEL_APP_RT_PEERADDR           "Peer Address"
-
-
-
-//---------------------------------------------------------------------------
-//  Hardware/Pin Configuration
-//---------------------------------------------------------------------------
-
-const int       PIN_KEY_BLE_CFG                     = 36;               // PIN_KEY_BLE_CFG      (GPIO36 -> Pin02)
-const int       PIN_STATUS_LED                      =  2;               // On-board LED (blue)  (GPIO02 -> Pin19)
-
-
-
-//---------------------------------------------------------------------------
-//  Local Variables
-//---------------------------------------------------------------------------
-
-static tAppCfgData  AppCfgData_g =
-{
-
-    APP_CFGDATA_MAGIC_ID,                           // .m_ui32MagicID
-
-    APP_DEFAULT_DEVICE_NAME,                        // .m_szDevMntDevName
-
-    APP_DEFAULT_WIFI_SSID,                          // .m_szWifiSSID
-    APP_DEFAULT_WIFI_PASSWD,                        // .m_szWifiPasswd
-    APP_DEFAULT_WIFI_OWNADDR,                       // .m_szWifiOwnAddr
-    APP_DEFAULT_WIFI_OWNMODE,                       // .m_ui8WifiOwnMode
-
-    APP_DEFAULT_APP_RT_OPT1,                        // .m_fAppRtOpt1 : 1
-    APP_DEFAULT_APP_RT_OPT2,                        // .m_fAppRtOpt2 : 1
-    APP_DEFAULT_APP_RT_OPT3,                        // .m_fAppRtOpt3 : 1
-    APP_DEFAULT_APP_RT_OPT4,                        // .m_fAppRtOpt4 : 1
-    APP_DEFAULT_APP_RT_OPT5,                        // .m_fAppRtOpt5 : 1
-    APP_DEFAULT_APP_RT_OPT6,                        // .m_fAppRtOpt6 : 1
-    APP_DEFAULT_APP_RT_OPT7,                        // .m_fAppRtOpt7 : 1
-    APP_DEFAULT_APP_RT_OPT8,                        // .m_fAppRtOpt8 : 1
-    APP_DEFAULT_APP_RT_PEERADDR                     // .m_szAppRtPeerAddr
-
-};
-
-static tAppDescriptData  AppDescriptData_g =
-{
-
-    APP_DESCRPT_WIFI_OWNMODE_FEATLIST,              // .m_ui16OwnModeFeatList
-
-    APP_LABEL_APP_RT_OPT1,                          // .m_pszLabelOpt1
-    APP_LABEL_APP_RT_OPT2,                          // .m_pszLabelOpt2
-    APP_LABEL_APP_RT_OPT3,                          // .m_pszLabelOpt3
-    APP_LABEL_APP_RT_OPT4,                          // .m_pszLabelOpt4
-    APP_LABEL_APP_RT_OPT5,                          // .m_pszLabelOpt5
-    APP_LABEL_APP_RT_OPT6,                          // .m_pszLabelOpt6
-    APP_LABEL_APP_RT_OPT7,                          // .m_pszLabelOpt7
-    APP_LABEL_APP_RT_OPT8,                          // .m_pszLabelOpt8
-
-    APP_LABEL_APP_RT_PEERADDR                       // .m_pszLabelPeerAddr
-
-};
-
-
-static  ESP32BleCfgProfile  ESP32BleCfgProfile_g;
-static  ESP32BleAppCfgData  ESP32BleAppCfgData_g(APP_EEPROM_SIZE);
-
-static  IPAddress       WifiOwnIpAddress_g          = IPAddress(0,0,0,0);
-static  char            szWifiOwnIpAddress_g[16]    = "";
-static  uint16_t        ui16WifiOwnPortNum_g        = 0;
-
-static  IPAddress       AppRtPeerIpAddress_g        = IPAddress(0,0,0,0);
-static  char            szAppRtPeerIpAddress_g[16]  = "";
-static  uint16_t        ui16AppRtPeerPortNum_g      = 0;
-
-static  bool            fStateBleCfg_g;
-static  bool            fBleClientConnected_g       = false;
-
-static  String          strChipID_g;
-static  unsigned int    uiMainLoopProcStep_g        = 0;
-
-
-
-//---------------------------------------------------------------------------
-//  Local Functions
-//---------------------------------------------------------------------------
-
-
-
-
-
-
-
-
-
-
-
-//=========================================================================//
-//                                                                         //
-//          S K E T C H   P U B L I C   F U N C T I O N S                  //
-//                                                                         //
-//=========================================================================//
-
-//---------------------------------------------------------------------------
-//  Application Setup
-//---------------------------------------------------------------------------
-
-void setup()
-{
-
-char  szTextBuff[64];
-int   iResult;
-
-
-    // Serial console
-    Serial.begin(115200);
-    Serial.println();
-    Serial.println();
-    Serial.println("======== APPLICATION START ========");
-    Serial.println();
-    Serial.flush();
-
-
-    // Application Version Information
-    snprintf(szTextBuff, sizeof(szTextBuff), "App Version:      %u.%02u", APP_VERSION, APP_REVISION);
-    Serial.println(szTextBuff);
-    snprintf(szTextBuff, sizeof(szTextBuff), "Build Timestamp:  %s", APP_BUILD_TIMESTAMP);
-    Serial.println(szTextBuff);
-    Serial.println();
-    Serial.flush();
-
-
-    // Device Identification
-    strChipID_g = GetChipID();
-    Serial.print("Unique ChipID:    ");
-    Serial.println(strChipID_g);
-    Serial.println();
-    Serial.flush();
-
-
-    // Initialize Workspace
-    fBleClientConnected_g = false;
-
-
-    //-------------------------------------------------------------------
-    //  Step(1): Get Configuration Data
-    //-------------------------------------------------------------------
-    //           Try to get Data from EEPROM, otherwise keep default
-    //           values untouched.
-    //-------------------------------------------------------------------
-    Serial.println("Configuration Data Block Size: " + String(sizeof(tAppCfgData)) + " Bytes");
-    Serial.println("Get Configuration Data...");
-    iResult = ESP32BleAppCfgData_g.LoadAppCfgDataFromEeprom(&AppCfgData_g);
-    if (iResult == 1)
-    {
-        Serial.print("-> Use saved Data read from EEPROM");
-    }
-    else if (iResult == 0)
-    {
-        Serial.println("-> Keep default data untouched");
-    }
-    else
-    {
-        Serial.print("-> ERROR: Access to EEPROM failed! (ErrorCode=");
-        Serial.print(iResult);
-        Serial.println(")");
-    }
-    Serial.println("Configuration Data Setup:");
-    AppPrintConfigData(&AppCfgData_g);
-
-    iResult = AppSplitNetAddress (AppCfgData_g.m_szWifiOwnAddr, &WifiOwnIpAddress_g, &ui16WifiOwnPortNum_g);
-    if (iResult >= 0)
-    {
-        strncpy(szWifiOwnIpAddress_g, WifiOwnIpAddress_g.toString().c_str(), WifiOwnIpAddress_g.toString().length());
-        Serial.print("WifiOwnIpAddr:    ");     Serial.println(szWifiOwnIpAddress_g);
-        Serial.print("WifiOwnPortNum:   ");     Serial.println(ui16WifiOwnPortNum_g);
-    }
-    else
-    {
-        Serial.print("-> ERROR: SplitNetAddress for 'WifiOwnIpAddress' failed! (ErrorCode=");
-        Serial.print(iResult);
-        Serial.println(")");
-    }
-
-    iResult = AppSplitNetAddress (AppCfgData_g.m_szAppRtPeerAddr, &AppRtPeerIpAddress_g, &ui16AppRtPeerPortNum_g);
-    if (iResult >= 0)
-    {
-        strncpy(szAppRtPeerIpAddress_g, AppRtPeerIpAddress_g.toString().c_str(), AppRtPeerIpAddress_g.toString().length());
-        Serial.print("AppRtPeerIpAddr:  ");     Serial.println(szAppRtPeerIpAddress_g);
-        Serial.print("AppRtPeerPortNum: ");     Serial.println(ui16AppRtPeerPortNum_g);
-    }
-    else
-    {
-        Serial.print("-> ERROR: SplitNetAddress for 'AppRtPeerIpAddress' failed! (ErrorCode=");
-        Serial.print(iResult);
-        Serial.println(")");
-    }
-
-
-    //-------------------------------------------------------------------
-    //  Step(2): Setup BLE Profile
-    //-------------------------------------------------------------------
-    // Determine Working Mode (BLE Config or Normal Operation)
-    pinMode(PIN_KEY_BLE_CFG, INPUT);
-    delay(10);
-    fStateBleCfg_g = !digitalRead(PIN_KEY_BLE_CFG);                         // Keys are inverted (1=off, 0=on)
-    if ( fStateBleCfg_g )
-    {
-        //-----------------------------------------------------------
-        // BLE Config Mode -> Setup BLE Profile
-        //-----------------------------------------------------------
-        if ( CFG_ENABLE_STATUS_LED )
-        {
-            pinMode(PIN_STATUS_LED, OUTPUT);
-        }
-
-        Serial.println("Setup BLE Profile...");
-        iResult = ESP32BleCfgProfile_g.ProfileSetup(APP_DEVICE_TYPE, &AppCfgData_g, &AppDescriptData_g, AppCbHdlrSaveConfig, AppCbHdlrRestartDev, AppCbHdlrConStatChg);
-        if (iResult >= 0)
-        {
-            Serial.println("-> BLE Server started successfully");
-        }
-        else
-        {
-            Serial.print("-> ERROR: BLE Server start failed! (ErrorCode=");
-            Serial.print(iResult);
-            Serial.println(")");
-        }
-    }
-    else
-    {
-        //-----------------------------------------------------------
-        // Normal Operation Mode -> User/Application specific Setup
-        //-----------------------------------------------------------
-        //
-        //  ...
-        //  <User/Application specific Startup Code here>
-        //  ...
-        //
-    }
-
-
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Application Main Loop
-//---------------------------------------------------------------------------
-
-void loop()
-{
-
-unsigned int  uiProcStep;
-
-
-    // Determine Working Mode (BLE Config or Normal Operation)
-    if ( fStateBleCfg_g )
-    {
-        //-----------------------------------------------------------
-        // BLE Config Mode -> Run BLE Profile specific Loop Code
-        //-----------------------------------------------------------
-        ESP32BleCfgProfile_g.ProfileLoop();
-
-        // signal BLE Config Mode on Status LED
-        if ( CFG_ENABLE_STATUS_LED )
-        {
-            uiProcStep = (fBleClientConnected_g) ? (uiMainLoopProcStep_g++ % 15) : (uiMainLoopProcStep_g++ % 45);
-            switch (uiProcStep)
-            {
-                case 0:
-                case 1:
-                {
-                    digitalWrite(PIN_STATUS_LED, HIGH);
-                    break;
-                }
-    
-                default:
-                {
-                    digitalWrite(PIN_STATUS_LED, LOW);
-                    break;
-                }
-            }
-        }
-    }
-    else
-    {
-        //-----------------------------------------------------------
-        // Normal Operation Mode -> User/Application specific Loop
-        //-----------------------------------------------------------
-        //
-        //  ...
-        //  <User/Application specific Loop Code here>
-        //  ...
-        //
-    }
-
-
-    delay(50);
-
-
-    return;
-
-}
-
-
-
-
-
-//=========================================================================//
-//                                                                         //
-//          S K E T C H   P R I V A T E   F U N C T I O N S                //
-//                                                                         //
-//=========================================================================//
-
-//---------------------------------------------------------------------------
-//  Application Callback Handler: Save Configuration Data Block
-//---------------------------------------------------------------------------
-
-void  AppCbHdlrSaveConfig(const tAppCfgData* pAppCfgData_p)
-{
-
-int  iResult;
-
-    Serial.println();
-    Serial.println("Save Configuration Data:");
-
-    if (pAppCfgData_p != NULL)
-    {
-        memcpy(&AppCfgData_g, pAppCfgData_p, sizeof(AppCfgData_g));
-        AppPrintConfigData(&AppCfgData_g);
-
-        iResult = ESP32BleAppCfgData_g.SaveAppCfgDataToEeprom(&AppCfgData_g);
-        if (iResult >= 0)
-        {
-            Serial.println("-> Configuration Data saved successfully");
-        }
-        else
-        {
-            Serial.print("ERROR: Saving Configuration Data failed! (ErrorCode=");
-            Serial.print(iResult);
-            Serial.println(")");
-        }
-    }
-    else
-    {
-        Serial.println("ERROR: Configuration Failed!");
-    }
-
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Application Callback Handler: Restart Device
-//---------------------------------------------------------------------------
-
-void  AppCbHdlrRestartDev()
-{
-
-    Serial.println();
-    Serial.println("Restart Device:");
-    Serial.println("-> REBOOT System now...");
-    Serial.println();
-
-    ESP.restart();
-
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Application Callback Handler: Inform about BLE Client Connect Status
-//---------------------------------------------------------------------------
-
-void  AppCbHdlrConStatChg (bool fBleClientConnected_p)
-{
-
-    fBleClientConnected_g = fBleClientConnected_p;
-
-    if ( fBleClientConnected_g )
-    {
-        Serial.println();
-        Serial.println("Client connected");
-        Serial.println();
-    }
-    else
-    {
-        Serial.println();
-        Serial.println("Client disconnected");
-        Serial.println();
-    }
-
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Print Configuration Data Block
-//---------------------------------------------------------------------------
-
-void  AppPrintConfigData (const tAppCfgData* pAppCfgData_p)
-{
-
-    if (pAppCfgData_p != NULL)
-    {
-        Serial.print("  DevMntDevName:  ");     Serial.println(pAppCfgData_p->m_szDevMntDevName);   Serial.flush();
-        Serial.print("  WifiSSID:       ");     Serial.println(pAppCfgData_p->m_szWifiSSID);        Serial.flush();
-        Serial.print("  WifiPasswd:     ");     Serial.println(pAppCfgData_p->m_szWifiPasswd);      Serial.flush();
-        Serial.print("  WifiOwnAddr:    ");     Serial.println(pAppCfgData_p->m_szWifiOwnAddr);     Serial.flush();
-        Serial.print("  WifiOwnMode:    ");     Serial.println(pAppCfgData_p->m_ui8WifiOwnMode);    Serial.flush();
-        Serial.print("  AppRtOpt1:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt1);        Serial.flush();
-        Serial.print("  AppRtOpt2:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt2);        Serial.flush();
-        Serial.print("  AppRtOpt3:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt3);        Serial.flush();
-        Serial.print("  AppRtOpt4:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt4);        Serial.flush();
-        Serial.print("  AppRtOpt5:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt5);        Serial.flush();
-        Serial.print("  AppRtOpt6:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt6);        Serial.flush();
-        Serial.print("  AppRtOpt7:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt7);        Serial.flush();
-        Serial.print("  AppRtOpt8:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt8);        Serial.flush();
-        Serial.print("  AppRtPeerAddr:  ");     Serial.println(pAppCfgData_p->m_szAppRtPeerAddr);   Serial.flush();
-    }
-
-    return;
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Split Network Address String into IpAddress and PortNumber
-//---------------------------------------------------------------------------
-
-int  AppSplitNetAddress (const char* pszNetAddr_p, IPAddress* pIpAddress_p, uint16_t* pui16PortNum_p)
-{
-
-String     strNetAddr;
-String     strIpAddr;
-String     strPortNum;
-IPAddress  IpAddr;
-long       lPortNum;
-int        iIdx;
-bool       fSuccess;
-
-    // process IPAddress
-    strNetAddr = pszNetAddr_p;
-    iIdx = strNetAddr.indexOf(':');
-    if (iIdx > 0)
-    {
-        strIpAddr = strNetAddr.substring(0, iIdx);
-    }
-    else
-    {
-        strIpAddr = strNetAddr;
-    }
-
-    fSuccess = IpAddr.fromString(strIpAddr);
-    if ( fSuccess )
-    {
-        if (pIpAddress_p != NULL)
-        {
-            *pIpAddress_p = IpAddr;
-        }
-    }
-    else
-    {
-        return (-1);
-    }
-
-    // process PortNumber
-    if (iIdx > 0)
-    {
-        strPortNum = strNetAddr.substring(iIdx+1);
-        lPortNum = strPortNum.toInt();
-        if ((lPortNum >= 0) && (lPortNum <= 0xFFFF))
-        {
-            if (pui16PortNum_p != NULL)
-            {
-                *pui16PortNum_p = (uint16_t)lPortNum;
-            }
-        }
-        else
-        {
-            return (-2);
-        }
-    }
-
-    return (0);
-
-}
-
-
-
-
-
-//=========================================================================//
-//                                                                         //
-//          P R I V A T E   G E N E R I C   F U N C T I O N S              //
-//                                                                         //
-//=========================================================================//
-
-//---------------------------------------------------------------------------
-//  Get Unique Client Name
-//---------------------------------------------------------------------------
-
-String  GetUniqueClientName (const char* pszClientPrefix_p)
-{
-
-String  strChipID;
-String  strClientName;
-
-
-    // Create a unique client name, based on ChipID (the ChipID is essentially its 6byte MAC address)
-    strChipID = GetChipID();
-    strClientName  = pszClientPrefix_p;
-    strClientName += strChipID;
-
-    return (strClientName);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Get ChipID as String
-//---------------------------------------------------------------------------
-
-String  GetChipID()
-{
-
-String  strChipID;
-
-
-    strChipID = GetEsp32MacId(false);
-
-    return (strChipID);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Get ChipMAC as String
-//---------------------------------------------------------------------------
-
-String  GetChipMAC()
-{
-
-String  strChipMAC;
-
-
-    strChipMAC = GetEsp32MacId(true);
-
-    return (strChipMAC);
-
-}
-
-
-
-//---------------------------------------------------------------------------
-//  Get GetEsp32MacId as String
-//---------------------------------------------------------------------------
-
-String  GetEsp32MacId (bool fUseMacFormat_p)
-{
-
-uint64_t  ui64MacID;
-String    strMacID;
-byte      bDigit;
-char      acDigit[2];
-int       iIdx;
-
-
-    ui64MacID = ESP.getEfuseMac();
-    strMacID = "";
-    for (iIdx=0; iIdx<6; iIdx++)
-    {
-        bDigit = (byte) (ui64MacID >> (iIdx * 8));
-        sprintf(acDigit, "%02X", bDigit);
-        strMacID += String(acDigit);
-
-        if (fUseMacFormat_p && (iIdx<5))
-        {
-            strMacID += ":";
-        }
-    }
-
-    strMacID.toUpperCase();
-
-    return (strMacID);
-
-}
-
-
-
-
-
-//=========================================================================//
-//                                                                         //
-//          D E B U G   F U N C T I O N S                                  //
-//                                                                         //
-//=========================================================================//
-
-//---------------------------------------------------------------------------
-//  DEBUG: Dump Buffer
-//---------------------------------------------------------------------------
-
-#ifdef DEBUG_DUMP_BUFFER
-
-void  DebugDumpBuffer (String strBuffer_p)
-{
-
-int            iBufferLen = strBuffer_p.length();
-unsigned char  abDataBuff[iBufferLen];
-
-    strBuffer_p.getBytes(abDataBuff, iBufferLen);
-    DebugDumpBuffer(abDataBuff, strBuffer_p.length());
-
-    return;
-
-}
-
-//---------------------------------------------------------------------------
-
-void  DebugDumpBuffer (const void* pabDataBuff_p, unsigned int uiDataBuffLen_p)
-{
-
-#define COLUMNS_PER_LINE    16
-
-const unsigned char*  pabBuffData;
-unsigned int          uiBuffSize;
-char                  szLineBuff[128];
-unsigned char         bData;
-int                   nRow;
-int                   nCol;
-
-    // get pointer to buffer and length of buffer
-    pabBuffData = (const unsigned char*)pabDataBuff_p;
-    uiBuffSize  = (unsigned int)uiDataBuffLen_p;
-
-
-    // dump buffer contents
-    for (nRow=0; ; nRow++)
-    {
-        sprintf(szLineBuff, "\n%04lX:   ", (unsigned long)(nRow*COLUMNS_PER_LINE));
-        Serial.print(szLineBuff);
-
-        for (nCol=0; nCol<COLUMNS_PER_LINE; nCol++)
-        {
-            if ((unsigned int)nCol < uiBuffSize)
-            {
-                sprintf(szLineBuff, "%02X ", (unsigned int)*(pabBuffData+nCol));
-                Serial.print(szLineBuff);
-            }
-            else
-            {
-                Serial.print("   ");
-            }
-        }
-
-        Serial.print(" ");
-
-        for (nCol=0; nCol<COLUMNS_PER_LINE; nCol++)
-        {
-            bData = *pabBuffData++;
-            if ((unsigned int)nCol < uiBuffSize)
-            {
-                if ((bData >= 0x20) && (bData < 0x7F))
-                {
-                    sprintf(szLineBuff, "%c", bData);
-                    Serial.print(szLineBuff);
-                }
-                else
-                {
-                    Serial.print(".");
-                }
-            }
-            else
-            {
-                Serial.print(" ");
-            }
-        }
-
-        if (uiBuffSize > COLUMNS_PER_LINE)
-        {
-            uiBuffSize -= COLUMNS_PER_LINE;
-        }
-        else
-        {
-            break;
-        }
-
-        Serial.flush();     // give serial interface time to flush data
-    }
-
-    Serial.print("\n");
-
-    return;
-
-}
-
-#endif
-
-
-
-
-// EOF
+/****************************************************************************
+
+  Copyright (c) 2021 Ronald Sieber
+
+  Project:      ESP32 BLE Config
+  Description:  ESP32 Arduino BLE Config Framework
+
+  -------------------------------------------------------------------------
+
+    Arduino IDE Settings:
+
+    Board:              "ESP32 Dev Module"
+    Upload Speed:       "115200"
+    CPU Frequency:      "240MHz (WiFi/BT)"
+    Flash Frequency:    "80Mhz"
+    Flash Mode:         "QIO"
+    Flash Size:         "4MB (32Mb)"
+    Partition Scheme:   "Minimal SPIFFS (1.9MB APP with OTA/190KB SPIFFS)"
+    PSRAM:              "Disabled"
+
+    The partition scheme provides the two OTA app partitions required by
+    service [OTA] (CFG_ENABLE_BLE_OTA). Alternatively, the A/B layout
+    'partitions_ota.csv' can be used (rename it to 'partitions.csv' to be
+    used by the Arduino IDE instead of the selected scheme).
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2021/07/13 -rs:   V1.00 Initial version
+  2026/10/18:       V1.10 Connection parameters, statistics, benchmark and soak test
+  2026/10/18:       V1.20 Optional services [Stream] and [OTA], Config Image
+  2026/10/18:       V1.30 Storage backends, A/B slots with trial run, RTC cache
+  2026/10/18:       V1.40 ESP32BleCfgView with change subscription
+  2026/10/18:       V1.50 BLE Config Mode at runtime, BT memory release in Normal Operation Mode
+  2026/10/18:       V1.60 Boot pipeline, selection of the GATT backend
+  2026/10/18:       V1.70 Status LED patterns, idle timeout, loop profiler and remote log
+  2026/10/18:       V1.71 Normal-mode startup also after leaving BLE Config Mode
+  2026/10/18:       V1.72 Saved configuration published again after leaving BLE Config Mode
+  2026/10/18:       V1.73 Soak test driven by the simulated client in the host build
+
+****************************************************************************/
+
+// #define DEBUG_DUMP_BUFFER
+// #define DEBUG_BENCHMARK                      // run benchmark of config hot paths after BLE Profile Setup
+// #define DEBUG_SOAK_TEST                      // run memory soak test of config session after BLE Profile Setup
+// #define DEBUG_OTA_SIM                        // simulate firmware transfer via service [OTA] after BLE Profile Setup
+
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleAppCfgData.h"
+#include "ESP32BleCfgStorage.h"
+#include "ESP32BleCfgStats.h"
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleCfgView.h"
+#include "ESP32BleCfgBoot.h"
+#include "ESP32BleCfgLed.h"
+#include "ESP32BleCfgLoopProf.h"
+#include "ESP32BleCfgLog.h"
+#include "Trace.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include <WiFi.h>
+
+#if defined(DEBUG_SOAK_TEST) && defined(ARDUINO_HOSTSIM)
+    #include "HostSim.h"                        // simulated BLE client and heap counters (host build)
+#endif
+
+#ifdef DEBUG_OTA_SIM
+    #include "ESP32BleCfgOta.h"
+    #include "mbedtls/sha256.h"
+#endif
+
+
+
+
+
+/***************************************************************************/
+/*                                                                         */
+/*                                                                         */
+/*          G L O B A L   D E F I N I T I O N S                            */
+/*                                                                         */
+/*                                                                         */
+/***************************************************************************/
+
+//---------------------------------------------------------------------------
+//  Application Configuration
+//---------------------------------------------------------------------------
+
+const int       APP_VERSION                         = 1;                // 1.xx
+const int       APP_REVISION                        = 0;                // x.00
+const char      APP_BUILD_TIMESTAMP[]               = __DATE__ " " __TIME__;
+
+const int       CFG_ENABLE_STATUS_LED               = 1;
+const int       CFG_ENABLE_BLE_STREAM               = 0;                // enable service [Stream] for large config blobs
+const int       CFG_ENABLE_BLE_OTA                  = 0;                // enable service [OTA] for firmware updates (requires OTA partitions)
+const int       CFG_ENABLE_CFG_ROLLBACK             = 1;                // roll back to last known-good config if WiFi is not reached (EEPROM storage only)
+const int       CFG_ENABLE_NVS_STORAGE              = 0;                // store config as NVS keys instead of EEPROM image
+const int       CFG_ENABLE_RTC_CFG_CACHE            = 1;                // keep config in RTC memory for fast wake-up from deep sleep
+const int       CFG_ENABLE_RUNTIME_BLE_CFG          = 1;                // enter/leave BLE Config Mode at runtime via PIN_KEY_BLE_CFG
+const int       CFG_RELEASE_BT_MEM_ON_LEAVE         = 1;                // release BT Controller memory when leaving BLE Config Mode
+const int       CFG_RELEASE_BT_MEM_IN_NORMAL_MODE   = 1;                // release BT Controller and Host memory at startup in Normal Operation Mode
+const int       CFG_ENABLE_PARALLEL_BOOT            = 1;                // run boot stages as tasks on both cores (0 = sequential reference)
+const int       CFG_ENABLE_BLE_ATTR_TABLE           = 0;                // build core services from attribute tables (0 = BLE library objects)
+const int       CFG_ENABLE_LOOP_PROFILER            = 0;                // measure loop() duration/jitter and CPU idle share per core
+const int       CFG_ENABLE_BLE_LOG                  = 0;                // buffer TRACE output and stream it via [DevMnt/Log] in BLE Config Mode
+
+// Timeout for reaching WiFi with a new (unconfirmed) configuration
+#define         APP_CFG_TRIAL_WIFI_TIMEOUT          60000               // [ms]
+
+// Leave BLE Config Mode if no client connects or writes within this time (0 = stay in BLE Config Mode)
+#define         APP_BLE_CFG_IDLE_TIMEOUT            (10 * 60000)        // [ms]
+
+// Delay at the end of each loop() iteration (nominal loop period for the Loop Profiler)
+#define         APP_LOOP_DELAY                      50                  // [ms]
+
+// Interval for printing the results of the Loop Profiler (CFG_ENABLE_LOOP_PROFILER)
+#define         APP_LOOP_PROF_REPORT_INTERVAL       10000               // [ms]
+
+// Debounce Time of PIN_KEY_BLE_CFG (key must be stable pressed for this time)
+#define         APP_KEY_DEBOUNCE_TIME               50                  // [ms]
+
+// Request for BLE Config Mode across a restart (BT Controller memory already released)
+#define         APP_BLE_CFG_BOOT_REQUEST            0x42437242          // ASCII 'BrCB' = [B]LE [C]onfig [B]oot [R]equest
+
+// Cores for the Boot Stages (Bluedroid runs on Core 0, Arduino loop() on Core 1)
+#define         APP_BOOT_CORE_BLE                   0
+#define         APP_BOOT_CORE_APP                   1
+
+// EEPROM Size
+#define         APP_EEPROM_SIZE                     512
+
+// NVS Namespace used by the NVS Storage Backend (CFG_ENABLE_NVS_STORAGE)
+#define         APP_NVS_NAMESPACE                   "AppCfg"
+
+// Application specific Device Type
+#define         APP_DEVICE_TYPE                     1000000             // DeviceType associated with the BLE Profile
+
+// Default/initial values for Application Configuration <tAppCfgData>
+#define         APP_CFGDATA_MAGIC_ID                0x45735243          // ASCII 'EsRC' = [Es]p32[R]emote[C]onfig
+#define         APP_DEFAULT_DEVICE_NAME             "{ESP32_BLE_DEVICE}"
+#define         APP_DEFAULT_WIFI_SSID               "{WIFI SSID Name}"
+#define         APP_DEFAULT_WIFI_PASSWD             "{WIFI Password}"
+#define         APP_DEFAULT_WIFI_OWNADDR            "0.0.0.0:0"
+#define         APP_DEFAULT_WIFI_OWNMODE            WIFI_OPMODE_STA     // WIFI_OPMODE_STA / WIFI_OPMODE_AP
+#define         APP_DEFAULT_APP_RT_OPT1             true
+#define         APP_DEFAULT_APP_RT_OPT2             false
+#define         APP_DEFAULT_APP_RT_OPT3             true
+#define         APP_DEFAULT_APP_RT_OPT4             false
+#define         APP_DEFAULT_APP_RT_OPT5             false
+#define         APP_DEFAULT_APP_RT_OPT6             true
+#define         APP_DEFAULT_APP_RT_OPT7             false
+#define         APP_DEFAULT_APP_RT_OPT8             true
+#define         APP_DEFAULT_APP_RT_PEERADDR         "0.0.0.0:0"
+
+// Application specific Descriptor Text ('Labels') resp. FeatureLists for BLE Characteristics <tAppDescriptData>
+#define         APP_DESCRPT_WIFI_OWNMODE_FEATLIST   (WIFI_OPMODE_STA | WIFI_OPMODE_AP)
+
+#define         APP_LABEL_APP_RT_OPT1               "APP Runtime Opt#1"
+#define         APP_LABEL_APP_RT_OPT2               "APP Runtime Opt#2"
+#define         APP_LABEL_APP_RT_OPT3               "APP Runtime Opt#3"
+#define         APP_LABEL_APP_RT_OPT4               "APP Runtime Opt#4"
+#define         APP_LABEL_APP_RT_OPT5               "APP Runtime Opt#5"
+#define         APP_LABEL_APP_RT_OPT6               "APP Runtime Opt#6"
+#define         APP_LABEL_APP_RT_OPT7               "# (not used)"      // Start with '#' -> disable in GUI Config Tool
+#define         APP_LABEL_APP_RT_OPT8               "# (not used)"      // Start with '#' -> disable in GUI Config Tool
+#define         APP_LABEL_APP_RT_PEERADDR           "Peer Address"
+
+// Data Partition used by service [Stream] (CAUTION: previous content gets lost)
+#define         APP_STREAM_PART_LABEL               "spiffs"
+
+
+
+//---------------------------------------------------------------------------
+//  Hardware/Pin Configuration
+//---------------------------------------------------------------------------
+
+const int       PIN_KEY_BLE_CFG                     = 36;               // PIN_KEY_BLE_CFG      (GPIO36 -> Pin02)
+const int       PIN_STATUS_LED                      =  2;               // On-board LED (blue)  (GPIO02 -> Pin19)
+
+
+
+//---------------------------------------------------------------------------
+//  Local Variables
+//---------------------------------------------------------------------------
+
+static tAppCfgData  AppCfgData_g =
+{
+
+    APP_CFGDATA_MAGIC_ID,                           // .m_ui32MagicID
+
+    APP_DEFAULT_DEVICE_NAME,                        // .m_szDevMntDevName
+
+    APP_DEFAULT_WIFI_SSID,                          // .m_szWifiSSID
+    APP_DEFAULT_WIFI_PASSWD,                        // .m_szWifiPasswd
+    APP_DEFAULT_WIFI_OWNADDR,                       // .m_szWifiOwnAddr
+    APP_DEFAULT_WIFI_OWNMODE,                       // .m_ui8WifiOwnMode
+
+    APP_DEFAULT_APP_RT_OPT1,                        // .m_fAppRtOpt1 : 1
+    APP_DEFAULT_APP_RT_OPT2,                        // .m_fAppRtOpt2 : 1
+    APP_DEFAULT_APP_RT_OPT3,                        // .m_fAppRtOpt3 : 1
+    APP_DEFAULT_APP_RT_OPT4,                        // .m_fAppRtOpt4 : 1
+    APP_DEFAULT_APP_RT_OPT5,                        // .m_fAppRtOpt5 : 1
+    APP_DEFAULT_APP_RT_OPT6,                        // .m_fAppRtOpt6 : 1
+    APP_DEFAULT_APP_RT_OPT7,                        // .m_fAppRtOpt7 : 1
+    APP_DEFAULT_APP_RT_OPT8,                        // .m_fAppRtOpt8 : 1
+    APP_DEFAULT_APP_RT_PEERADDR                     // .m_szAppRtPeerAddr
+
+};
+
+static tAppDescriptData  AppDescriptData_g =
+{
+
+    APP_DESCRPT_WIFI_OWNMODE_FEATLIST,              // .m_ui16OwnModeFeatList
+
+    APP_LABEL_APP_RT_OPT1,                          // .m_pszLabelOpt1
+    APP_LABEL_APP_RT_OPT2,                          // .m_pszLabelOpt2
+    APP_LABEL_APP_RT_OPT3,                          // .m_pszLabelOpt3
+    APP_LABEL_APP_RT_OPT4,                          // .m_pszLabelOpt4
+    APP_LABEL_APP_RT_OPT5,                          // .m_pszLabelOpt5
+    APP_LABEL_APP_RT_OPT6,                          // .m_pszLabelOpt6
+    APP_LABEL_APP_RT_OPT7,                          // .m_pszLabelOpt7
+    APP_LABEL_APP_RT_OPT8,                          // .m_pszLabelOpt8
+
+    APP_LABEL_APP_RT_PEERADDR                       // .m_pszLabelPeerAddr
+
+};
+
+
+static  ESP32BleCfgProfile  ESP32BleCfgProfile_g;
+static  ESP32BleAppCfgData  ESP32BleAppCfgData_g(APP_EEPROM_SIZE);
+
+static  ESP32BleCfgStorageEeprom  AppCfgStorageEeprom_g(&ESP32BleAppCfgData_g);
+static  ESP32BleCfgStorageNvs     AppCfgStorageNvs_g(APP_NVS_NAMESPACE);
+static  ESP32BleCfgStorageRtcCache  AppCfgStorageRtcCache_g;
+static  ESP32BleCfgStorage*       pAppCfgStorage_g            = &AppCfgStorageEeprom_g;
+
+static  IPAddress       WifiOwnIpAddress_g          = IPAddress(0,0,0,0);
+static  char            szWifiOwnIpAddress_g[16]    = "";
+static  uint16_t        ui16WifiOwnPortNum_g        = 0;
+
+static  IPAddress       AppRtPeerIpAddress_g        = IPAddress(0,0,0,0);
+static  char            szAppRtPeerIpAddress_g[16]  = "";
+static  uint16_t        ui16AppRtPeerPortNum_g      = 0;
+
+static  bool            fStateBleCfg_g;
+static  bool            fBleClientConnected_g       = false;
+static  bool            fBtMemReleased_g            = false;
+
+static  volatile bool           fKeyBleCfgEvent_g       = false;
+static  volatile unsigned long  ulKeyBleCfgEventTick_g  = 0;
+static  RTC_NOINIT_ATTR uint32_t  ui32BleCfgBootRequest_g;
+
+static  bool            fAppCfgTrialRun_g           = false;
+static  unsigned long   ulAppCfgTrialStartTime_g    = 0;
+static  unsigned long   ulLoopProfReportTick_g      = 0;
+
+static  String          strChipID_g;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+
+
+
+
+
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          S K E T C H   P U B L I C   F U N C T I O N S                  //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  Application Setup
+//---------------------------------------------------------------------------
+
+void setup()
+{
+
+char              szTextBuff[64];
+tCfgRtcCacheInfo  CfgRtcCacheInfo;
+int               iStageCfgLoad;
+int               iStageBleInit;
+
+
+    // Serial console
+    Serial.begin(115200);
+    if ( CFG_ENABLE_BLE_LOG )
+    {
+        ESP32BleCfgLog::Setup();                                            // buffer TRACE output from now on
+    }
+    Serial.println();
+    Serial.println();
+    Serial.println("======== APPLICATION START ========");
+    Serial.println();
+    Serial.flush();
+
+
+    // Application Version Information
+    snprintf(szTextBuff, sizeof(szTextBuff), "App Version:      %u.%02u", APP_VERSION, APP_REVISION);
+    Serial.println(szTextBuff);
+    snprintf(szTextBuff, sizeof(szTextBuff), "Build Timestamp:  %s", APP_BUILD_TIMESTAMP);
+    Serial.println(szTextBuff);
+    Serial.println();
+    Serial.flush();
+
+
+    // Device Identification
+    strChipID_g = GetChipID();
+    Serial.print("Unique ChipID:    ");
+    Serial.println(strChipID_g);
+    Serial.println();
+    Serial.flush();
+
+
+    // Initialize Workspace
+    fBleClientConnected_g = false;
+
+
+    //-------------------------------------------------------------------
+    //  Step(1): Determine Working Mode (BLE Config or Normal Operation)
+    //-------------------------------------------------------------------
+    pinMode(PIN_KEY_BLE_CFG, INPUT);
+    delay(10);
+    fStateBleCfg_g = !digitalRead(PIN_KEY_BLE_CFG);                         // Keys are inverted (1=off, 0=on)
+    if (ui32BleCfgBootRequest_g == APP_BLE_CFG_BOOT_REQUEST)
+    {
+        // BLE Config Mode requested at runtime after the BT Controller memory was released
+        fStateBleCfg_g = true;
+    }
+    ui32BleCfgBootRequest_g = 0;
+
+
+    //-------------------------------------------------------------------
+    //  Step(2): Get Configuration Data (Boot Pipeline)
+    //-------------------------------------------------------------------
+    //           [CfgLoad]  -> Try to get Data from EEPROM / NVS, otherwise
+    //                         keep default values untouched
+    //           [BleInit]  -> Start BT Controller and Bluedroid stack
+    //                         (BLE Config Mode only), no dependencies
+    //           [BleHost]  -> Init BLE library and set device name
+    //                         (BLE Config Mode only), depends on
+    //                         [CfgLoad] and [BleInit]
+    //           [CfgSetup] -> Print and publish Configuration Data,
+    //                         split network addresses
+    //-------------------------------------------------------------------
+    memset(&CfgRtcCacheInfo, 0x00, sizeof(CfgRtcCacheInfo));
+    iStageCfgLoad = ESP32BleCfgBoot::AddStage("CfgLoad", AppBootStageCfgLoad, &CfgRtcCacheInfo, 0, APP_BOOT_CORE_APP);
+    if ( fStateBleCfg_g )
+    {
+        iStageBleInit = ESP32BleCfgBoot::AddStage("BleInit", AppBootStageBleInit, NULL, 0, APP_BOOT_CORE_BLE);
+        ESP32BleCfgBoot::AddStage("BleHost", AppBootStageBleHost, NULL, (1UL << iStageCfgLoad) | (1UL << iStageBleInit), APP_BOOT_CORE_BLE);
+    }
+    ESP32BleCfgBoot::AddStage("CfgSetup", AppBootStageCfgSetup, NULL, (1UL << iStageCfgLoad), APP_BOOT_CORE_APP);
+    ESP32BleCfgBoot::Run(CFG_ENABLE_PARALLEL_BOOT);
+    AppPrintBootReport();
+
+
+    //-------------------------------------------------------------------
+    //  Step(3): Setup BLE Profile resp. Normal Operation
+    //-------------------------------------------------------------------
+    if ( fStateBleCfg_g )
+    {
+        //-----------------------------------------------------------
+        // BLE Config Mode -> Setup BLE Profile
+        //-----------------------------------------------------------
+        AppEnterBleCfgMode();
+    }
+    else
+    {
+        //-----------------------------------------------------------
+        // Normal Operation Mode -> User/Application specific Setup
+        //-----------------------------------------------------------
+        AppEnterNormalMode(true);
+    }
+
+
+    // Key for entering/leaving BLE Config Mode at runtime
+    if ( CFG_ENABLE_RUNTIME_BLE_CFG )
+    {
+        attachInterrupt(digitalPinToInterrupt(PIN_KEY_BLE_CFG), AppIsrKeyBleCfg, FALLING);
+    }
+
+
+    // Profiler for loop() (results are printed periodically and notified as telemetry in BLE Config Mode)
+    if ( CFG_ENABLE_LOOP_PROFILER )
+    {
+        ESP32BleCfgLoopProf::Setup(APP_LOOP_DELAY * 1000);
+        ESP32BleCfgProfile_g.SetTelemetrySource(ESP32BleCfgLoopProf::GetRecord);
+        ulLoopProfReportTick_g = millis();
+    }
+
+
+    // Wake-to-Ready Time (time since boot, incl. ROM/Bootloader)
+    Serial.print("Wake-to-Ready Time: ");
+    Serial.print((uint32_t)esp_timer_get_time());
+    Serial.print(" us");
+    if ( CFG_ENABLE_RTC_CFG_CACHE && CfgRtcCacheInfo.m_fCacheHit )
+    {
+        Serial.print(" (saved by RTC Cache: ");
+        Serial.print(CfgRtcCacheInfo.m_ui32FlashLoadTime - CfgRtcCacheInfo.m_ui32LoadTime);
+        Serial.print(" us)");
+    }
+    Serial.println();
+
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Main Loop
+//---------------------------------------------------------------------------
+
+void loop()
+{
+
+    if ( CFG_ENABLE_LOOP_PROFILER )
+    {
+        ESP32BleCfgLoopProf::LoopBegin();
+    }
+
+    // dispatch configuration changes collected since the last loop tick
+    ESP32BleCfgView::DispatchChanges();
+
+    // enter/leave BLE Config Mode at runtime
+    if ( CFG_ENABLE_RUNTIME_BLE_CFG )
+    {
+        AppProcessKeyBleCfg();
+    }
+
+    // Determine Working Mode (BLE Config or Normal Operation)
+    if ( fStateBleCfg_g )
+    {
+        //-----------------------------------------------------------
+        // BLE Config Mode -> Run BLE Profile specific Loop Code
+        //-----------------------------------------------------------
+        ESP32BleCfgProfile_g.ProfileLoop();
+
+        // (Status LED is driven by ESP32BleCfgLed independently of the loop)
+
+        // fall back to Normal Operation Mode if the device was left in BLE Config Mode
+        if ( ESP32BleCfgProfile_g.IsCfgModeTimedOut() )
+        {
+            Serial.println();
+            Serial.print("BLE Config Mode idle for ");
+            Serial.print(APP_BLE_CFG_IDLE_TIMEOUT / 1000);
+            Serial.println(" s -> fall back to Normal Operation Mode");
+            AppLeaveBleCfgMode();
+            ESP32BleCfgStats::DumpToSerial();
+            AppEnterNormalMode(false);
+        }
+    }
+    else
+    {
+        //-----------------------------------------------------------
+        // Normal Operation Mode -> User/Application specific Loop
+        //-----------------------------------------------------------
+        if ( fAppCfgTrialRun_g )
+        {
+            AppSuperviseCfgTrialRun();
+        }
+
+        //
+        //  ...
+        //  <User/Application specific Loop Code here>
+        //  (read Configuration Data via ESP32BleCfgView, e.g.
+        //   ESP32BleCfgView::GetAppRtOpt(1) or GetAppRtPeerEndpoint())
+        //  ...
+        //
+    }
+
+
+    if ( CFG_ENABLE_LOOP_PROFILER )
+    {
+        ESP32BleCfgLoopProf::LoopEnd();
+
+        // (printing is outside of the measured duration, but shows up as jitter of the next period)
+        if ((millis() - ulLoopProfReportTick_g) >= APP_LOOP_PROF_REPORT_INTERVAL)
+        {
+            ulLoopProfReportTick_g = millis();
+            ESP32BleCfgLoopProf::DumpToSerial();
+        }
+    }
+
+    delay(APP_LOOP_DELAY);
+
+
+    return;
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          S K E T C H   P R I V A T E   F U N C T I O N S                //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  Boot Stage [CfgLoad]: Get Configuration Data
+//---------------------------------------------------------------------------
+
+void  AppBootStageCfgLoad (void* pvArg_p)
+{
+
+tCfgRtcCacheInfo*  pCfgRtcCacheInfo = (tCfgRtcCacheInfo*)pvArg_p;
+const char*        pszStorageName;
+uint32_t           ui32CfgGeneration;
+int                iResult;
+
+    Serial.println("Configuration Data Block Size: " + String(sizeof(tAppCfgData)) + " Bytes");
+    pszStorageName = "EEPROM";
+    if ( CFG_ENABLE_NVS_STORAGE )
+    {
+        pAppCfgStorage_g = &AppCfgStorageNvs_g;
+        pszStorageName = "NVS";
+    }
+    if ( CFG_ENABLE_RTC_CFG_CACHE )
+    {
+        // cached data is only valid for the same firmware build, layout and backend
+        ui32CfgGeneration  = ESP32BleAppCfgData::CalulateCrc32(APP_BUILD_TIMESTAMP, sizeof(APP_BUILD_TIMESTAMP));
+        ui32CfgGeneration ^= (APP_CFG_LAYOUT_VERSION << 8) | CFG_ENABLE_NVS_STORAGE;
+        AppCfgStorageRtcCache_g.SetBackend(pAppCfgStorage_g, ui32CfgGeneration);
+        pAppCfgStorage_g = &AppCfgStorageRtcCache_g;
+    }
+    Serial.println("Get Configuration Data...");
+    iResult = pAppCfgStorage_g->Load(&AppCfgData_g);
+    if (iResult == 1)
+    {
+        Serial.print("-> Use saved Data read from ");
+        Serial.println(pszStorageName);
+    }
+    else if (iResult == 2)
+    {
+        Serial.print("-> Use saved Data read from ");
+        Serial.print(pszStorageName);
+        Serial.println(" (migrated to current layout version)");
+    }
+    else if (iResult == 3)
+    {
+        Serial.print("-> Use last known-good Data read from ");
+        Serial.print(pszStorageName);
+        Serial.println(" (unconfirmed Data rolled back)");
+    }
+    else if (iResult == 0)
+    {
+        Serial.println("-> Keep default data untouched");
+    }
+    else
+    {
+        Serial.print("-> ERROR: Access to ");
+        Serial.print(pszStorageName);
+        Serial.print(" failed! (ErrorCode=");
+        Serial.print(iResult);
+        Serial.println(")");
+    }
+    if ( CFG_ENABLE_RTC_CFG_CACHE )
+    {
+        AppCfgStorageRtcCache_g.GetCacheInfo(pCfgRtcCacheInfo);
+        Serial.print((pCfgRtcCacheInfo->m_fCacheHit) ? "-> Taken from RTC Cache (Load: " : "-> RTC Cache refilled (Load: ");
+        Serial.print(pCfgRtcCacheInfo->m_ui32LoadTime);
+        Serial.print(" us, Flash Load: ");
+        Serial.print(pCfgRtcCacheInfo->m_ui32FlashLoadTime);
+        Serial.println(" us)");
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Boot Stage [BleInit]: Start BT Controller and Bluedroid stack
+//---------------------------------------------------------------------------
+//  Needs no configuration data, so it runs on Core 0 right from the start,
+//  in parallel to [CfgLoad] and [CfgSetup]. It doesn't print anything
+//  (errors are reported by <ProfileSetup()> later on).
+//---------------------------------------------------------------------------
+
+void  AppBootStageBleInit (void* pvArg_p)
+{
+
+    ESP32BleCfgProfile_g.ProfileInitStack();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Boot Stage [BleHost]: Init BLE library and set device name
+//---------------------------------------------------------------------------
+//  Configuration dependent part of the bring-up (device name from
+//  [CfgLoad]) on top of the stack started by [BleInit]. Doesn't print
+//  anything either, as it runs in parallel to [CfgSetup].
+//---------------------------------------------------------------------------
+
+void  AppBootStageBleHost (void* pvArg_p)
+{
+
+    ESP32BleCfgProfile_g.ProfileInitHost(&AppCfgData_g);
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Boot Stage [CfgSetup]: Print and publish Configuration Data
+//---------------------------------------------------------------------------
+
+void  AppBootStageCfgSetup (void* pvArg_p)
+{
+
+int  iResult;
+
+    Serial.println("Configuration Data Setup:");
+    AppPrintConfigData(&AppCfgData_g);
+    ESP32BleCfgView::Publish(&AppCfgData_g);
+    ESP32BleCfgView::Subscribe(CFG_VIEW_FIELD_ALL, AppCbHdlrCfgChanged);
+
+    iResult = AppSplitNetAddress (AppCfgData_g.m_szWifiOwnAddr, &WifiOwnIpAddress_g, &ui16WifiOwnPortNum_g);
+    if (iResult >= 0)
+    {
+        strncpy(szWifiOwnIpAddress_g, WifiOwnIpAddress_g.toString().c_str(), WifiOwnIpAddress_g.toString().length());
+        Serial.print("WifiOwnIpAddr:    ");     Serial.println(szWifiOwnIpAddress_g);
+        Serial.print("WifiOwnPortNum:   ");     Serial.println(ui16WifiOwnPortNum_g);
+    }
+    else
+    {
+        Serial.print("-> ERROR: SplitNetAddress for 'WifiOwnIpAddress' failed! (ErrorCode=");
+        Serial.print(iResult);
+        Serial.println(")");
+    }
+
+    iResult = AppSplitNetAddress (AppCfgData_g.m_szAppRtPeerAddr, &AppRtPeerIpAddress_g, &ui16AppRtPeerPortNum_g);
+    if (iResult >= 0)
+    {
+        strncpy(szAppRtPeerIpAddress_g, AppRtPeerIpAddress_g.toString().c_str(), AppRtPeerIpAddress_g.toString().length());
+        Serial.print("AppRtPeerIpAddr:  ");     Serial.println(szAppRtPeerIpAddress_g);
+        Serial.print("AppRtPeerPortNum: ");     Serial.println(ui16AppRtPeerPortNum_g);
+    }
+    else
+    {
+        Serial.print("-> ERROR: SplitNetAddress for 'AppRtPeerIpAddress' failed! (ErrorCode=");
+        Serial.print(iResult);
+        Serial.println(")");
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Print Report of the Boot Pipeline
+//---------------------------------------------------------------------------
+
+void  AppPrintBootReport()
+{
+
+tBootReport     BootReport;
+tBootStageInfo  StageInfo;
+char            szTextBuff[80];
+unsigned int    uiIdx;
+bool            fFirst;
+
+    if ( !ESP32BleCfgBoot::GetReport(&BootReport) )
+    {
+        return;
+    }
+
+    Serial.println();
+    snprintf(szTextBuff, sizeof(szTextBuff), "Boot Pipeline (%s): %u Stages, Boot Time: %lu us",
+             (BootReport.m_fParallel) ? "parallel" : "sequential", BootReport.m_ui8NumStages, (unsigned long)BootReport.m_ui32BootTime);
+    Serial.println(szTextBuff);
+    for (uiIdx=0; uiIdx<BootReport.m_ui8NumStages; uiIdx++)
+    {
+        ESP32BleCfgBoot::GetStageInfo(uiIdx, &StageInfo);
+        snprintf(szTextBuff, sizeof(szTextBuff), "  [%-8s] Core %c: %8lu .. %8lu us %s", StageInfo.m_pszName,
+                 (StageInfo.m_iCore == BOOT_CORE_ANY) ? '*' : (char)('0' + StageInfo.m_iCore),
+                 (unsigned long)StageInfo.m_ui32StartTime, (unsigned long)StageInfo.m_ui32EndTime,
+                 (BootReport.m_ui32CriticalPathMask & (1UL << uiIdx)) ? "(critical)" : "");
+        Serial.println(szTextBuff);
+    }
+
+    Serial.print("-> Critical Path: ");
+    fFirst = true;
+    for (uiIdx=0; uiIdx<BootReport.m_ui8NumStages; uiIdx++)
+    {
+        if (BootReport.m_ui32CriticalPathMask & (1UL << uiIdx))
+        {
+            ESP32BleCfgBoot::GetStageInfo(uiIdx, &StageInfo);
+            Serial.print((fFirst) ? "" : " -> ");
+            Serial.print(StageInfo.m_pszName);
+            fFirst = false;
+        }
+    }
+    Serial.print(" (");
+    Serial.print(BootReport.m_ui32CriticalPathTime);
+    Serial.println(" us)");
+
+    Serial.print("-> Sequential Boot: ");
+    Serial.print(BootReport.m_ui32SequentialTime);
+    Serial.print(" us, saved: ");
+    Serial.print((int32_t)(BootReport.m_ui32SequentialTime - BootReport.m_ui32BootTime));
+    Serial.println(" us");
+    Serial.println();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Enter BLE Config Mode (at startup or at runtime)
+//---------------------------------------------------------------------------
+
+void  AppEnterBleCfgMode()
+{
+
+uint32_t       ui32FreeHeap;
+int            iResult;
+unsigned long  ulStartTime;
+unsigned long  ulProfileSetupTime;
+
+    if ( ESP32BleCfgProfile_g.IsProfileActive() )
+    {
+        return;
+    }
+
+    // BT Controller memory can only be reclaimed by a restart
+    if ( fBtMemReleased_g )
+    {
+        Serial.println("Enter BLE Config Mode: BT Controller memory released -> RESTART into BLE Config Mode...");
+        Serial.flush();
+        ui32BleCfgBootRequest_g = APP_BLE_CFG_BOOT_REQUEST;
+        ESP.restart();
+        return;
+    }
+
+    if ( CFG_ENABLE_STATUS_LED )
+    {
+        ESP32BleCfgLed::Setup(PIN_STATUS_LED);
+    }
+
+    Serial.println("Setup BLE Profile...");
+    if ( CFG_ENABLE_BLE_STREAM )
+    {
+        ESP32BleCfgProfile_g.EnableStream(APP_STREAM_PART_LABEL, AppCbHdlrStreamDone);
+    }
+    if ( CFG_ENABLE_BLE_OTA )
+    {
+        ESP32BleCfgProfile_g.EnableOta(AppCbHdlrOtaDone);
+    }
+    if ( CFG_ENABLE_BLE_LOG )
+    {
+        ESP32BleCfgProfile_g.EnableLog(ESP32BleCfgLog::GetPacket);
+    }
+    ESP32BleCfgProfile_g.SetGattBackend(CFG_ENABLE_BLE_ATTR_TABLE ? BLE_GATT_BACKEND_ATTR_TABLE : BLE_GATT_BACKEND_OBJECTS);
+    ESP32BleCfgProfile_g.SetCfgModeTimeout(APP_BLE_CFG_IDLE_TIMEOUT);
+    ui32FreeHeap = ESP.getFreeHeap();
+    #ifdef DEBUG_BENCHMARK
+    {
+        traceEnable(false);                                                 // measure processing time, not TRACE output
+    }
+    #endif
+    ulStartTime = micros();
+    iResult = ESP32BleCfgProfile_g.ProfileSetup(APP_DEVICE_TYPE, &AppCfgData_g, &AppDescriptData_g, AppCbHdlrSaveConfig, AppCbHdlrRestartDev, AppCbHdlrConStatChg);
+    ulProfileSetupTime = micros() - ulStartTime;
+    #ifdef DEBUG_BENCHMARK
+    {
+        traceEnable(true);
+    }
+    #endif
+    if (iResult >= 0)
+    {
+        fStateBleCfg_g = true;
+        if ( CFG_ENABLE_STATUS_LED )
+        {
+            ESP32BleCfgLed::SetPattern(LED_PATTERN_ADVERTISING);
+        }
+        Serial.println("-> BLE Server started successfully");
+        Serial.print("   (ProfileSetup: ");
+        Serial.print(ulProfileSetupTime);
+        Serial.print(" us, Free Heap: ");
+        Serial.print(ui32FreeHeap);
+        Serial.print(" -> ");
+        Serial.print(ESP.getFreeHeap());
+        Serial.println(" Bytes)");
+        Serial.print("   (GATT Database: ");
+        Serial.print(CFG_ENABLE_BLE_ATTR_TABLE ? "Attribute Tables" : "Objects");
+        Serial.print(", ");
+        Serial.print(ESP32BleCfgProfile_g.GetGattSetupTime());
+        Serial.println(" us)");
+
+        #ifdef DEBUG_BENCHMARK
+        {
+            DebugRunBenchmark(ulProfileSetupTime);
+        }
+        #endif
+
+        #ifdef DEBUG_SOAK_TEST
+        {
+            DebugRunSoakTest();
+        }
+        #endif
+
+        #ifdef DEBUG_OTA_SIM
+        {
+            if ( CFG_ENABLE_BLE_OTA )
+            {
+                DebugRunOtaSim();
+            }
+        }
+        #endif
+    }
+    else
+    {
+        if ( CFG_ENABLE_STATUS_LED )
+        {
+            ESP32BleCfgLed::SetPattern(LED_PATTERN_ERROR);
+        }
+        Serial.print("-> ERROR: BLE Server start failed! (ErrorCode=");
+        Serial.print(iResult);
+        Serial.println(")");
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Enter Normal Operation Mode (at startup or after leaving BLE Config Mode)
+//---------------------------------------------------------------------------
+//  At runtime the BT memory is kept resp. released by <AppLeaveBleCfgMode()>
+//  (CFG_RELEASE_BT_MEM_ON_LEAVE), otherwise a later key press would always
+//  need a restart to enter BLE Config Mode again.
+//---------------------------------------------------------------------------
+
+void  AppEnterNormalMode (bool fStartup_p)
+{
+
+    if ( CFG_RELEASE_BT_MEM_IN_NORMAL_MODE && fStartup_p )
+    {
+        AppReleaseBtMemory();
+    }
+
+    // configuration saved in BLE Config Mode without restart -> start its trial run now
+    if ( CFG_ENABLE_CFG_ROLLBACK && !fAppCfgTrialRun_g )
+    {
+        AppStartCfgTrialRun();
+    }
+
+    //
+    //  ...
+    //  <User/Application specific Startup Code here>
+    //  ...
+    //
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Release BT Controller and Host memory (Normal Operation Mode)
+//---------------------------------------------------------------------------
+
+void  AppReleaseBtMemory()
+{
+
+int  iResult;
+
+    Serial.println("Release BT Controller and Host Memory...");
+    iResult = ESP32BleCfgProfile_g.ProfileEnterNormalMode();
+    if (iResult >= 0)
+    {
+        // BLE Config Mode at runtime is only possible by a restart from now on
+        fBtMemReleased_g = true;
+        Serial.print("-> reclaimed: ");
+        Serial.print(iResult);
+        Serial.print(" Bytes (Free Heap: ");
+        Serial.print(ESP.getFreeHeap());
+        Serial.println(" Bytes)");
+    }
+    else
+    {
+        Serial.print("-> ERROR: Releasing BT Memory failed! (ErrorCode=");
+        Serial.print(iResult);
+        Serial.println(")");
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Leave BLE Config Mode (at runtime)
+//---------------------------------------------------------------------------
+
+void  AppLeaveBleCfgMode()
+{
+
+uint32_t  ui32FreeHeapBefore;
+uint32_t  ui32FreeHeapAfter;
+
+    if ( !ESP32BleCfgProfile_g.IsProfileActive() )
+    {
+        fStateBleCfg_g = false;
+        return;
+    }
+
+    Serial.println();
+    Serial.println("Leave BLE Config Mode...");
+    ui32FreeHeapBefore = ESP.getFreeHeap();
+    ESP32BleCfgProfile_g.ProfileShutdown(CFG_RELEASE_BT_MEM_ON_LEAVE);
+    ui32FreeHeapAfter = ESP.getFreeHeap();
+    fBtMemReleased_g = (CFG_RELEASE_BT_MEM_ON_LEAVE) ? true : false;
+
+    fStateBleCfg_g = false;
+    fBleClientConnected_g = false;
+    if ( CFG_ENABLE_STATUS_LED )
+    {
+        ESP32BleCfgLed::SetPattern(LED_PATTERN_OFF);
+    }
+
+    // values written by the client but not saved are discarded -> view returns to the saved configuration
+    ESP32BleCfgView::Publish(&AppCfgData_g);
+
+    Serial.print("-> BLE Stack shut down (Free Heap: ");
+    Serial.print(ui32FreeHeapBefore);
+    Serial.print(" -> ");
+    Serial.print(ui32FreeHeapAfter);
+    Serial.print(" Bytes, reclaimed: ");
+    Serial.print((int32_t)(ui32FreeHeapAfter - ui32FreeHeapBefore));
+    Serial.println(" Bytes)");
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Interrupt Handler for PIN_KEY_BLE_CFG
+//---------------------------------------------------------------------------
+//  Attached with FALLING only: each falling edge (incl. the ones caused by
+//  bouncing of press and release) restarts the debounce time, the key is
+//  evaluated by <AppProcessKeyBleCfg()> in the main loop. A release alone
+//  is ignored there, because the key is no longer pressed (LOW).
+//---------------------------------------------------------------------------
+
+void IRAM_ATTR  AppIsrKeyBleCfg()
+{
+
+    ulKeyBleCfgEventTick_g = millis();
+    fKeyBleCfgEvent_g = true;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Process PIN_KEY_BLE_CFG (toggle BLE Config Mode)
+//---------------------------------------------------------------------------
+
+void  AppProcessKeyBleCfg()
+{
+
+    if ( !fKeyBleCfgEvent_g )
+    {
+        return;
+    }
+    if ((millis() - ulKeyBleCfgEventTick_g) < APP_KEY_DEBOUNCE_TIME)
+    {
+        return;
+    }
+    fKeyBleCfgEvent_g = false;
+
+    // key still pressed after the debounce time? (Keys are inverted: 1=off, 0=on)
+    if (digitalRead(PIN_KEY_BLE_CFG) != LOW)
+    {
+        return;
+    }
+
+    if ( fStateBleCfg_g )
+    {
+        AppLeaveBleCfgMode();
+        AppEnterNormalMode(false);
+    }
+    else
+    {
+        AppEnterBleCfgMode();
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handler: Save Configuration Data Block
+//---------------------------------------------------------------------------
+//  Return:    >= 0 -> Configuration Data saved
+//              < 0 -> Error (reported to the Client by Config Patch/Image)
+//---------------------------------------------------------------------------
+
+int  AppCbHdlrSaveConfig(const tAppCfgData* pAppCfgData_p)
+{
+
+int  iResult;
+
+    Serial.println();
+    Serial.println("Save Configuration Data:");
+
+    if (pAppCfgData_p != NULL)
+    {
+        memcpy(&AppCfgData_g, pAppCfgData_p, sizeof(AppCfgData_g));
+        AppPrintConfigData(&AppCfgData_g);
+        ESP32BleCfgView::Publish(&AppCfgData_g);
+
+        iResult = pAppCfgStorage_g->Save(&AppCfgData_g);
+        if (iResult >= 0)
+        {
+            Serial.println("-> Configuration Data saved successfully");
+            if ( CFG_ENABLE_STATUS_LED )
+            {
+                ESP32BleCfgLed::SetPattern(LED_PATTERN_SAVING);
+            }
+        }
+        else
+        {
+            Serial.print("ERROR: Saving Configuration Data failed! (ErrorCode=");
+            Serial.print(iResult);
+            Serial.println(")");
+            if ( CFG_ENABLE_STATUS_LED )
+            {
+                ESP32BleCfgLed::SetPattern(LED_PATTERN_ERROR);
+            }
+        }
+    }
+    else
+    {
+        Serial.println("ERROR: Configuration Failed!");
+        if ( CFG_ENABLE_STATUS_LED )
+        {
+            ESP32BleCfgLed::SetPattern(LED_PATTERN_ERROR);
+        }
+        iResult = -1;
+    }
+
+    return (iResult);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handler: Configuration Field changed
+//---------------------------------------------------------------------------
+//  Called once per loop tick for each changed field (see ESP32BleCfgView),
+//  the new value is read via ESP32BleCfgView.
+//---------------------------------------------------------------------------
+
+void  AppCbHdlrCfgChanged (uint8_t ui8FieldId_p)
+{
+
+    Serial.print("Configuration Field changed: FieldID=0x");
+    Serial.println(ui8FieldId_p, HEX);
+
+    //
+    //  ...
+    //  <User/Application specific reaction on changed Configuration Data>
+    //  (e.g. reconnect to the peer after CFG_FIELD_APP_RT_PEERADDR changed)
+    //  ...
+    //
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Start Trial Run of a new (unconfirmed) Configuration
+//---------------------------------------------------------------------------
+
+void  AppStartCfgTrialRun()
+{
+
+char  szWifiSSID[sizeof(AppCfgData_g.m_szWifiSSID) + 1];
+char  szWifiPasswd[sizeof(AppCfgData_g.m_szWifiPasswd) + 1];
+int   iResult;
+
+    iResult = pAppCfgStorage_g->BeginTrialRun();
+    if (iResult != 1)
+    {
+        return;
+    }
+
+    Serial.println("Configuration Data on trial, waiting for WiFi...");
+
+    // in AccessPoint Mode the configuration does not depend on an external network
+    if (ESP32BleCfgView::GetWifiOwnMode() != WIFI_OPMODE_STA)
+    {
+        pAppCfgStorage_g->ConfirmAppCfgData();
+        Serial.println("-> Configuration Data confirmed");
+        return;
+    }
+
+    ESP32BleCfgView::GetString(CFG_FIELD_WIFI_SSID, szWifiSSID, sizeof(szWifiSSID));
+    ESP32BleCfgView::GetString(CFG_FIELD_WIFI_PASSWD, szWifiPasswd, sizeof(szWifiPasswd));
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(szWifiSSID, szWifiPasswd);
+
+    ulAppCfgTrialStartTime_g = millis();
+    fAppCfgTrialRun_g = true;
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Supervise Trial Run: confirm on WiFi connect, otherwise roll back
+//---------------------------------------------------------------------------
+
+void  AppSuperviseCfgTrialRun()
+{
+
+    if (WiFi.status() == WL_CONNECTED)
+    {
+        pAppCfgStorage_g->ConfirmAppCfgData();
+        fAppCfgTrialRun_g = false;
+        Serial.println("-> WiFi connected, Configuration Data confirmed");
+        return;
+    }
+
+    if ((millis() - ulAppCfgTrialStartTime_g) >= APP_CFG_TRIAL_WIFI_TIMEOUT)
+    {
+        // the unconfirmed trial run has already been counted -> next boot rolls back
+        Serial.println("-> ERROR: WiFi not reached, roll back to last known-good Configuration Data");
+        Serial.println("-> REBOOT System now...");
+        Serial.println();
+        ESP.restart();
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handler: Restart Device
+//---------------------------------------------------------------------------
+
+void  AppCbHdlrRestartDev()
+{
+
+    Serial.println();
+    Serial.println("Restart Device:");
+    Serial.println("-> REBOOT System now...");
+    Serial.println();
+
+    ESP.restart();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handler: Inform about BLE Client Connect Status
+//---------------------------------------------------------------------------
+
+void  AppCbHdlrConStatChg (bool fBleClientConnected_p)
+{
+
+tBleConnInfo  BleConnInfo;
+
+    fBleClientConnected_g = fBleClientConnected_p;
+
+    if ( CFG_ENABLE_STATUS_LED )
+    {
+        ESP32BleCfgLed::SetPattern((fBleClientConnected_g) ? LED_PATTERN_CONNECTED : LED_PATTERN_ADVERTISING);
+    }
+
+    if ( fBleClientConnected_g )
+    {
+        Serial.println();
+        Serial.println("Client connected");
+        Serial.println();
+    }
+    else
+    {
+        Serial.println();
+        Serial.println("Client disconnected");
+        ESP32BleCfgProfile_g.GetConnInfo(&BleConnInfo);
+        Serial.print("  SessionDuration: ");    Serial.print(BleConnInfo.m_ui32SessionDuration);    Serial.println(" ms");
+        Serial.print("  MTU:             ");    Serial.println(BleConnInfo.m_ui16Mtu);
+        Serial.print("  ConnInterval:    ");    Serial.print((BleConnInfo.m_ui16ConnInterval * 125) / 100);  Serial.println(" ms");
+        Serial.print("  SlaveLatency:    ");    Serial.println(BleConnInfo.m_ui16SlaveLatency);
+        ESP32BleCfgStats::DumpToSerial();
+        Serial.println();
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handler: Stream Transfer completed
+//---------------------------------------------------------------------------
+
+void  AppCbHdlrStreamDone (uint32_t ui32BlobSize_p, uint32_t ui32BlobCrc32_p, uint32_t ui32Throughput_p)
+{
+
+char  szTextBuff[64];
+
+    Serial.println();
+    Serial.println("Stream Transfer completed:");
+    Serial.print("  BlobSize:   ");     Serial.print(ui32BlobSize_p);       Serial.println(" Bytes");
+    snprintf(szTextBuff, sizeof(szTextBuff), "  BlobCrc32:  0x%08lX", (unsigned long)ui32BlobCrc32_p);
+    Serial.println(szTextBuff);
+    Serial.print("  Throughput: ");     Serial.print(ui32Throughput_p);     Serial.println(" Bytes/s");
+    Serial.println();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handler: Firmware Update completed
+//---------------------------------------------------------------------------
+
+void  AppCbHdlrOtaDone (uint32_t ui32ImageSize_p, uint32_t ui32Throughput_p)
+{
+
+    // the new firmware is started by the next reset (e.g. via <RstDev>)
+    Serial.println();
+    Serial.println("Firmware Update completed:");
+    Serial.print("  ImageSize:  ");     Serial.print(ui32ImageSize_p);      Serial.println(" Bytes");
+    Serial.print("  Throughput: ");     Serial.print(ui32Throughput_p);     Serial.println(" Bytes/s");
+    Serial.println("  -> new firmware becomes active after Restart Device");
+    Serial.println();
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Print Configuration Data Block
+//---------------------------------------------------------------------------
+
+void  AppPrintConfigData (const tAppCfgData* pAppCfgData_p)
+{
+
+    if (pAppCfgData_p != NULL)
+    {
+        Serial.print("  DevMntDevName:  ");     Serial.println(pAppCfgData_p->m_szDevMntDevName);   Serial.flush();
+        Serial.print("  WifiSSID:       ");     Serial.println(pAppCfgData_p->m_szWifiSSID);        Serial.flush();
+        Serial.print("  WifiPasswd:     ");     Serial.println(pAppCfgData_p->m_szWifiPasswd);      Serial.flush();
+        Serial.print("  WifiOwnAddr:    ");     Serial.println(pAppCfgData_p->m_szWifiOwnAddr);     Serial.flush();
+        Serial.print("  WifiOwnMode:    ");     Serial.println(pAppCfgData_p->m_ui8WifiOwnMode);    Serial.flush();
+        Serial.print("  AppRtOpt1:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt1);        Serial.flush();
+        Serial.print("  AppRtOpt2:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt2);        Serial.flush();
+        Serial.print("  AppRtOpt3:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt3);        Serial.flush();
+        Serial.print("  AppRtOpt4:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt4);        Serial.flush();
+        Serial.print("  AppRtOpt5:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt5);        Serial.flush();
+        Serial.print("  AppRtOpt6:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt6);        Serial.flush();
+        Serial.print("  AppRtOpt7:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt7);        Serial.flush();
+        Serial.print("  AppRtOpt8:      ");     Serial.println(pAppCfgData_p->m_fAppRtOpt8);        Serial.flush();
+        Serial.print("  AppRtPeerAddr:  ");     Serial.println(pAppCfgData_p->m_szAppRtPeerAddr);   Serial.flush();
+    }
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Split Network Address String into IpAddress and PortNumber
+//---------------------------------------------------------------------------
+
+int  AppSplitNetAddress (const char* pszNetAddr_p, IPAddress* pIpAddress_p, uint16_t* pui16PortNum_p)
+{
+
+String     strNetAddr;
+String     strIpAddr;
+String     strPortNum;
+IPAddress  IpAddr;
+long       lPortNum;
+int        iIdx;
+bool       fSuccess;
+
+    // process IPAddress
+    strNetAddr = pszNetAddr_p;
+    iIdx = strNetAddr.indexOf(':');
+    if (iIdx > 0)
+    {
+        strIpAddr = strNetAddr.substring(0, iIdx);
+    }
+    else
+    {
+        strIpAddr = strNetAddr;
+    }
+
+    fSuccess = IpAddr.fromString(strIpAddr);
+    if ( fSuccess )
+    {
+        if (pIpAddress_p != NULL)
+        {
+            *pIpAddress_p = IpAddr;
+        }
+    }
+    else
+    {
+        return (-1);
+    }
+
+    // process PortNumber
+    if (iIdx > 0)
+    {
+        strPortNum = strNetAddr.substring(iIdx+1);
+        lPortNum = strPortNum.toInt();
+        if ((lPortNum >= 0) && (lPortNum <= 0xFFFF))
+        {
+            if (pui16PortNum_p != NULL)
+            {
+                *pui16PortNum_p = (uint16_t)lPortNum;
+            }
+        }
+        else
+        {
+            return (-2);
+        }
+    }
+
+    return (0);
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          P R I V A T E   G E N E R I C   F U N C T I O N S              //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  Get Unique Client Name
+//---------------------------------------------------------------------------
+
+String  GetUniqueClientName (const char* pszClientPrefix_p)
+{
+
+String  strChipID;
+String  strClientName;
+
+
+    // Create a unique client name, based on ChipID (the ChipID is essentially its 6byte MAC address)
+    strChipID = GetChipID();
+    strClientName  = pszClientPrefix_p;
+    strClientName += strChipID;
+
+    return (strClientName);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Get ChipID as String
+//---------------------------------------------------------------------------
+
+String  GetChipID()
+{
+
+String  strChipID;
+
+
+    strChipID = GetEsp32MacId(false);
+
+    return (strChipID);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Get ChipMAC as String
+//---------------------------------------------------------------------------
+
+String  GetChipMAC()
+{
+
+String  strChipMAC;
+
+
+    strChipMAC = GetEsp32MacId(true);
+
+    return (strChipMAC);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Get GetEsp32MacId as String
+//---------------------------------------------------------------------------
+
+String  GetEsp32MacId (bool fUseMacFormat_p)
+{
+
+uint64_t  ui64MacID;
+String    strMacID;
+byte      bDigit;
+char      acDigit[3];
+int       iIdx;
+
+
+    ui64MacID = ESP.getEfuseMac();
+    strMacID = "";
+    for (iIdx=0; iIdx<6; iIdx++)
+    {
+        bDigit = (byte) (ui64MacID >> (iIdx * 8));
+        sprintf(acDigit, "%02X", bDigit);
+        strMacID += String(acDigit);
+
+        if (fUseMacFormat_p && (iIdx<5))
+        {
+            strMacID += ":";
+        }
+    }
+
+    strMacID.toUpperCase();
+
+    return (strMacID);
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          D E B U G   F U N C T I O N S                                  //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  DEBUG: Dump Buffer
+//---------------------------------------------------------------------------
+
+#ifdef DEBUG_DUMP_BUFFER
+
+void  DebugDumpBuffer (String strBuffer_p)
+{
+
+int            iBufferLen = strBuffer_p.length();
+unsigned char  abDataBuff[iBufferLen];
+
+    strBuffer_p.getBytes(abDataBuff, iBufferLen);
+    DebugDumpBuffer(abDataBuff, strBuffer_p.length());
+
+    return;
+
+}
+
+//---------------------------------------------------------------------------
+
+void  DebugDumpBuffer (const void* pabDataBuff_p, unsigned int uiDataBuffLen_p)
+{
+
+#define COLUMNS_PER_LINE    16
+
+const unsigned char*  pabBuffData;
+unsigned int          uiBuffSize;
+char                  szLineBuff[128];
+unsigned char         bData;
+int                   nRow;
+int                   nCol;
+
+    // get pointer to buffer and length of buffer
+    pabBuffData = (const unsigned char*)pabDataBuff_p;
+    uiBuffSize  = (unsigned int)uiDataBuffLen_p;
+
+
+    // dump buffer contents
+    for (nRow=0; ; nRow++)
+    {
+        sprintf(szLineBuff, "\n%04lX:   ", (unsigned long)(nRow*COLUMNS_PER_LINE));
+        Serial.print(szLineBuff);
+
+        for (nCol=0; nCol<COLUMNS_PER_LINE; nCol++)
+        {
+            if ((unsigned int)nCol < uiBuffSize)
+            {
+                sprintf(szLineBuff, "%02X ", (unsigned int)*(pabBuffData+nCol));
+                Serial.print(szLineBuff);
+            }
+            else
+            {
+                Serial.print("   ");
+            }
+        }
+
+        Serial.print(" ");
+
+        for (nCol=0; nCol<COLUMNS_PER_LINE; nCol++)
+        {
+            bData = *pabBuffData++;
+            if ((unsigned int)nCol < uiBuffSize)
+            {
+                if ((bData >= 0x20) && (bData < 0x7F))
+                {
+                    sprintf(szLineBuff, "%c", bData);
+                    Serial.print(szLineBuff);
+                }
+                else
+                {
+                    Serial.print(".");
+                }
+            }
+            else
+            {
+                Serial.print(" ");
+            }
+        }
+
+        if (uiBuffSize > COLUMNS_PER_LINE)
+        {
+            uiBuffSize -= COLUMNS_PER_LINE;
+        }
+        else
+        {
+            break;
+        }
+
+        Serial.flush();     // give serial interface time to flush data
+    }
+
+    Serial.print("\n");
+
+    return;
+
+}
+
+#endif
+
+
+
+//---------------------------------------------------------------------------
+//  DEBUG: Benchmark of Config Hot Paths
+//---------------------------------------------------------------------------
+//  Runs the boot-critical and write-critical code paths of the framework
+//  BENCH_RUNS times each and prints the fastest run as one JSON line on the
+//  serial console, so that a test bench can parse it. TRACE is suspended
+//  while the benchmark runs, and the JSON line is assembled completely
+//  before it is printed, so no other output can end up inside it.
+//
+//  A result exceeding its reference value by more than BENCH_MAX_REGRESSION_PCT
+//  fails, and so does a result without reference value (0): an uncalibrated
+//  bench must not report "pass". The references below are the values for
+//  the target board, to be taken from the "avg_ns" of a run on it. The host
+//  runner (HostTest/Bench.cpp) overrides them with HostTest/BenchRef.h.
+//---------------------------------------------------------------------------
+
+#ifdef DEBUG_BENCHMARK
+
+#define BENCH_ITERATIONS                1000
+#define BENCH_RUNS                      5                   // each hot path is measured BENCH_RUNS times, the fastest run counts
+#define BENCH_JSON_BUFF_SIZE            1536
+
+#ifndef BENCH_MAX_REGRESSION_PCT
+    #define BENCH_MAX_REGRESSION_PCT    20                  // max. allowed slowdown against reference [%]
+#endif
+
+#ifndef BENCH_REF_NS_CRC32                                  // reference values: average time per call [ns]
+    #define BENCH_REF_NS_CRC32              0
+    #define BENCH_REF_NS_IMPORT_WORKSPACE   0
+    #define BENCH_REF_NS_EXPORT_WORKSPACE   0
+    #define BENCH_REF_NS_READ_CHARACTRSTC   0
+    #define BENCH_REF_NS_SPLIT_NET_ADDR     0
+    #define BENCH_REF_NS_GET_MAC_ID         0
+    #define BENCH_REF_NS_PROFILE_SETUP      0
+#endif
+
+// measures <Statement_p> (BENCH_ITERATIONS calls per run), result is the fastest run [us]
+#define BENCH_MEASURE(ulBestTime_p, Statement_p)                                \
+    ulBestTime_p = ~0UL;                                                        \
+    for (uiRun=0; uiRun<BENCH_RUNS; uiRun++)                                    \
+    {                                                                           \
+        ulStartTime = micros();                                                 \
+        for (uiIdx=0; uiIdx<BENCH_ITERATIONS; uiIdx++)                          \
+        {                                                                       \
+            Statement_p;                                                        \
+        }                                                                       \
+        ulStartTime = micros() - ulStartTime;                                   \
+        ulBestTime_p = (ulStartTime < ulBestTime_p) ? ulStartTime : ulBestTime_p; \
+    }
+
+bool  DebugRunBenchmark (unsigned long ulProfileSetupTime_p)
+{
+
+static  char       szJson[BENCH_JSON_BUFF_SIZE];
+tAppCfgData        AppCfgData;
+IPAddress          IpAddress;
+uint16_t           ui16PortNum;
+String             strMacID;
+volatile uint32_t  ui32Sink;
+unsigned long      ulStartTime;
+unsigned long      ulBestTime;
+unsigned int       uiRun;
+unsigned int       uiIdx;
+size_t             JsonLen;
+bool               fPass;
+
+    traceEnable(false);
+
+    fPass = true;
+    JsonLen = snprintf(szJson, sizeof(szJson), "{\"benchmark\":\"ESP32BleConfig\",\"runs\":%u,\"max_regression_pct\":%u,\"results\":[",
+                       BENCH_RUNS, BENCH_MAX_REGRESSION_PCT);
+
+    // ---- CalulateCrc32() ----
+    BENCH_MEASURE(ulBestTime, ui32Sink = ESP32BleAppCfgData::CalulateCrc32(&AppCfgData_g, sizeof(AppCfgData_g)));
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "CalulateCrc32", BENCH_ITERATIONS, ulBestTime, BENCH_REF_NS_CRC32);
+
+    // ---- ImportInstanceWorkspace() ----
+    BENCH_MEASURE(ulBestTime, ESP32BleCfgProfile::ImportInstanceWorkspace(&AppCfgData_g));
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "ImportInstanceWorkspace", BENCH_ITERATIONS, ulBestTime, BENCH_REF_NS_IMPORT_WORKSPACE);
+
+    // ---- ExportInstanceWorkspace() ----
+    BENCH_MEASURE(ulBestTime, ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData));
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "ExportInstanceWorkspace", BENCH_ITERATIONS, ulBestTime, BENCH_REF_NS_EXPORT_WORKSPACE);
+
+    // ---- ReadDataFromBleCharacterisics() ----
+    BENCH_MEASURE(ulBestTime, ESP32BleCfgProfile::ReadDataFromBleCharacterisics());
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "ReadDataFromBleCharacterisics", BENCH_ITERATIONS, ulBestTime, BENCH_REF_NS_READ_CHARACTRSTC);
+
+    // ---- AppSplitNetAddress() ----
+    BENCH_MEASURE(ulBestTime, AppSplitNetAddress(AppCfgData_g.m_szAppRtPeerAddr, &IpAddress, &ui16PortNum));
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "AppSplitNetAddress", BENCH_ITERATIONS, ulBestTime, BENCH_REF_NS_SPLIT_NET_ADDR);
+
+    // ---- GetEsp32MacId() ----
+    BENCH_MEASURE(ulBestTime, strMacID = GetEsp32MacId(true));
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "GetEsp32MacId", BENCH_ITERATIONS, ulBestTime, BENCH_REF_NS_GET_MAC_ID);
+
+    // ---- ProfileSetup() (runs once per BLE Config Mode, measured by AppEnterBleCfgMode()) ----
+    fPass &= DebugAddBenchResult(szJson, &JsonLen, "ProfileSetup", 1, ulProfileSetupTime_p, BENCH_REF_NS_PROFILE_SETUP);
+
+    snprintf(&szJson[JsonLen], sizeof(szJson) - JsonLen, "],\"pass\":%s}", (fPass ? "true" : "false"));
+
+    // JSON on a line of its own (the line before may be incomplete output of another task)
+    Serial.println();
+    Serial.println(szJson);
+    Serial.flush();
+
+    traceEnable(true);
+
+    (void)ui32Sink;
+
+    return (fPass);
+
+}
+
+//---------------------------------------------------------------------------
+
+bool  DebugAddBenchResult (char* pszJson_p, size_t* pJsonLen_p, const char* pszName_p, unsigned int uiIterations_p, unsigned long ulTotalTime_p, uint32_t ui32RefAvgNs_p)
+{
+
+uint32_t  ui32AvgNs;
+bool      fPass;
+int       iLen;
+
+    ui32AvgNs = (uint32_t)(((uint64_t)ulTotalTime_p * 1000) / uiIterations_p);
+
+    // without reference the result can't be judged -> fail
+    fPass = false;
+    if (ui32RefAvgNs_p > 0)
+    {
+        fPass = ((uint64_t)ui32AvgNs * 100 <= (uint64_t)ui32RefAvgNs_p * (100 + BENCH_MAX_REGRESSION_PCT));
+    }
+
+    iLen = snprintf(&pszJson_p[*pJsonLen_p], BENCH_JSON_BUFF_SIZE - *pJsonLen_p,
+                    "%s{\"name\":\"%s\",\"iterations\":%u,\"total_us\":%lu,\"avg_ns\":%lu,\"ref_ns\":%lu,\"pass\":%s}",
+                    ((pszJson_p[*pJsonLen_p - 1] == '[') ? "" : ","), pszName_p, uiIterations_p, ulTotalTime_p,
+                    (unsigned long)ui32AvgNs, (unsigned long)ui32RefAvgNs_p, (fPass ? "true" : "false"));
+    if ((iLen < 0) || ((size_t)iLen >= (BENCH_JSON_BUFF_SIZE - *pJsonLen_p)))
+    {
+        return (false);                             // JSON buffer too small
+    }
+    *pJsonLen_p += iLen;
+
+    return (fPass);
+
+}
+
+#endif
+
+
+
+//---------------------------------------------------------------------------
+//  DEBUG: Memory Soak Test of Config Sessions
+//---------------------------------------------------------------------------
+//  Runs SOAK_CYCLES config sessions against the real BLE Profile: in each
+//  cycle a client writes an alternating configuration into the value
+//  characteristics and triggers <Save Config> (see DebugSoakRunSession()).
+//  The saved configuration is checked by its CRC. Every SOAK_SESSION_CYCLES
+//  cycles the BLE Config Mode is left and entered again like at runtime:
+//  <ProfileShutdown()> (without releasing the BT memory) deletes the
+//  services, <ProfileSetup()> creates them again.
+//
+//  The heap is measured only in settled states (after SOAK_SETTLE_TIME, so
+//  the BLE task has processed all pending events): the free heap after the
+//  warm-up (incl. one restart of the BLE Config Mode) is the baseline. The
+//  test fails on any net growth of the heap usage at the end, i.e. a lower
+//  free heap or more allocated than freed blocks (host build only) than
+//  at the baseline. The settled free heap after each restart is reported,
+//  so a leak per restart shows up as a steady decline.
+//
+//  TRACE is suspended during the test, only the periodic reports and the
+//  final JSON line are printed (plus the output of <AppCbHdlrSaveConfig()>
+//  in the host build).
+//---------------------------------------------------------------------------
+
+#ifdef DEBUG_SOAK_TEST
+
+#define SOAK_CYCLES                     10000
+#define SOAK_WARMUP_CYCLES              100
+#define SOAK_SESSION_CYCLES             500                 // cycles per BLE Config Mode (Shutdown/Setup in between)
+#define SOAK_REPORT_INTERVAL            1000
+#define SOAK_SETTLE_TIME                200                 // [ms]
+
+#ifdef ARDUINO_HOSTSIM
+
+// characteristics written by the simulated client (see BleProfileDefinition.txt)
+static  const char*  SOAK_UUID_DEVMNT_DEVNAME    = "00001300-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_DEVMNT_SAVE_CFG   = "00001400-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_WIFI_SSID         = "00002100-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_WIFI_PASSWD       = "00002200-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_WIFI_OWNADDR      = "00002300-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_WIFI_OWNMODE      = "00002400-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_APP_RT_PEERADDR   = "00003900-0000-1000-8000-E776CC14FE69";
+static  const char*  SOAK_UUID_APP_RT_OPT[]      = { "00003100-0000-1000-8000-E776CC14FE69", "00003200-0000-1000-8000-E776CC14FE69",
+                                                     "00003300-0000-1000-8000-E776CC14FE69", "00003400-0000-1000-8000-E776CC14FE69",
+                                                     "00003500-0000-1000-8000-E776CC14FE69", "00003600-0000-1000-8000-E776CC14FE69",
+                                                     "00003700-0000-1000-8000-E776CC14FE69", "00003800-0000-1000-8000-E776CC14FE69" };
+
+#endif
+
+
+
+//---------------------------------------------------------------------------
+//  Soak Test: Config Session of a Client
+//---------------------------------------------------------------------------
+//  Host build: the simulated client connects, writes all values, writes
+//  <Save Config> and disconnects, so each cycle runs through the BLE
+//  callbacks and <AppCbHdlrSaveConfig()> (incl. storage and view).
+//  Target: without a client, the accesses of the BLE callbacks are done
+//  directly and the configuration is only exported (no flash write).
+//
+//  Return:    0 -> Session completed, configuration in pSavedCfgData_p
+//            -1 -> Error
+//---------------------------------------------------------------------------
+
+int  DebugSoakRunSession (const tAppCfgData* pAppCfgData_p, tAppCfgData* pSavedCfgData_p)
+{
+
+#ifdef ARDUINO_HOSTSIM
+
+const uint8_t  abAppRtOpt[] = { pAppCfgData_p->m_fAppRtOpt1, pAppCfgData_p->m_fAppRtOpt2, pAppCfgData_p->m_fAppRtOpt3, pAppCfgData_p->m_fAppRtOpt4,
+                                pAppCfgData_p->m_fAppRtOpt5, pAppCfgData_p->m_fAppRtOpt6, pAppCfgData_p->m_fAppRtOpt7, pAppCfgData_p->m_fAppRtOpt8 };
+const uint8_t  bSaveCfg = 1;
+unsigned int   uiIdx;
+int            iResult;
+
+    if (HostSimBleConnect() != 0)
+    {
+        return (-1);
+    }
+
+    iResult  = HostSimBleWrite(SOAK_UUID_DEVMNT_DEVNAME, pAppCfgData_p->m_szDevMntDevName, strnlen(pAppCfgData_p->m_szDevMntDevName, sizeof(pAppCfgData_p->m_szDevMntDevName)));
+    iResult |= HostSimBleWrite(SOAK_UUID_WIFI_SSID, pAppCfgData_p->m_szWifiSSID, strnlen(pAppCfgData_p->m_szWifiSSID, sizeof(pAppCfgData_p->m_szWifiSSID)));
+    iResult |= HostSimBleWrite(SOAK_UUID_WIFI_PASSWD, pAppCfgData_p->m_szWifiPasswd, strnlen(pAppCfgData_p->m_szWifiPasswd, sizeof(pAppCfgData_p->m_szWifiPasswd)));
+    iResult |= HostSimBleWrite(SOAK_UUID_WIFI_OWNADDR, pAppCfgData_p->m_szWifiOwnAddr, strnlen(pAppCfgData_p->m_szWifiOwnAddr, sizeof(pAppCfgData_p->m_szWifiOwnAddr)));
+    iResult |= HostSimBleWrite(SOAK_UUID_WIFI_OWNMODE, &pAppCfgData_p->m_ui8WifiOwnMode, sizeof(pAppCfgData_p->m_ui8WifiOwnMode));
+    for (uiIdx=0; uiIdx<8; uiIdx++)
+    {
+        // options disabled by their label ('#') have no characteristic (-1 = not found)
+        if (HostSimBleWrite(SOAK_UUID_APP_RT_OPT[uiIdx], &abAppRtOpt[uiIdx], sizeof(abAppRtOpt[uiIdx])) > 0)
+        {
+            iResult = -1;
+        }
+    }
+    iResult |= HostSimBleWrite(SOAK_UUID_APP_RT_PEERADDR, pAppCfgData_p->m_szAppRtPeerAddr, strnlen(pAppCfgData_p->m_szAppRtPeerAddr, sizeof(pAppCfgData_p->m_szAppRtPeerAddr)));
+
+    // <Save Config> -> AppCbHdlrSaveConfig() -> AppCfgData_g
+    iResult |= HostSimBleWrite(SOAK_UUID_DEVMNT_SAVE_CFG, &bSaveCfg, sizeof(bSaveCfg));
+    memcpy(pSavedCfgData_p, &AppCfgData_g, sizeof(*pSavedCfgData_p));
+
+    iResult |= HostSimBleDisconnect();
+
+    return ((iResult == 0) ? 0 : -1);
+
+#else
+
+    // client write access to all characteristics
+    ESP32BleCfgProfile::ImportInstanceWorkspace(pAppCfgData_p);
+    ESP32BleCfgProfile::WriteDataToBleCharacterisics();
+
+    // <Save Config>: read back characteristics and export data (without flash commit)
+    ESP32BleCfgProfile::ReadDataFromBleCharacterisics();
+    memset(pSavedCfgData_p, 0x00, sizeof(*pSavedCfgData_p));
+    ESP32BleCfgProfile::ExportInstanceWorkspace(pSavedCfgData_p);
+
+    return (0);
+
+#endif
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Soak Test: Number of allocated resp. freed Heap Blocks
+//---------------------------------------------------------------------------
+//  Counted by the heap of the host simulation only, on the target (heap
+//  tracing disabled) both numbers stay 0.
+//---------------------------------------------------------------------------
+
+void  DebugSoakGetAllocCounts (unsigned long* pulAllocs_p, unsigned long* pulFrees_p)
+{
+
+#ifdef ARDUINO_HOSTSIM
+
+tHostSimHeapStats  HeapStats;
+
+    HostSimHeapGetStats(&HeapStats);
+    *pulAllocs_p = HeapStats.m_ulAllocCalls;
+    *pulFrees_p  = HeapStats.m_ulFreeCalls;
+
+#else
+
+    *pulAllocs_p = 0;
+    *pulFrees_p  = 0;
+
+#endif
+
+    return;
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Soak Test
+//---------------------------------------------------------------------------
+
+void  DebugRunSoakTest ()
+{
+
+tAppCfgData        aAppCfgData[3];
+tAppCfgData        AppCfgData;
+uint32_t           aui32Crc[2];
+size_t             BaseFreeBytes;
+size_t             BaseMinFreeBytes;
+size_t             SessionFreeBytes;
+size_t             EndFreeBytes;
+size_t             EndMinFreeBytes;
+unsigned long      ulBaseAllocs;
+unsigned long      ulBaseFrees;
+unsigned long      ulEndAllocs;
+unsigned long      ulEndFrees;
+unsigned long      ulStartTime;
+unsigned long      ulCycleTime;
+unsigned long      ulCycleTimeMax;
+unsigned long      ulSetupTimeMax;
+uint64_t           ui64CycleTimeSum;
+unsigned int       uiCycle;
+unsigned int       uiSet;
+unsigned int       uiSessions;
+unsigned int       uiErrCnt;
+char               szTextBuff[256];
+bool               fPass;
+
+    Serial.println();
+    Serial.println("Soak Test: start...");
+    Serial.flush();
+    traceEnable(false);
+
+    // build two different configuration sets based on the current configuration (restored by set [2] at the end)
+    memcpy(&aAppCfgData[0], &AppCfgData_g, sizeof(aAppCfgData[0]));
+    memcpy(&aAppCfgData[1], &AppCfgData_g, sizeof(aAppCfgData[1]));
+    memcpy(&aAppCfgData[2], &AppCfgData_g, sizeof(aAppCfgData[2]));
+    strncpy(aAppCfgData[0].m_szDevMntDevName, "SoakTestDevice-A", sizeof(aAppCfgData[0].m_szDevMntDevName));
+    strncpy(aAppCfgData[1].m_szDevMntDevName, "SoakTestDev-B-WithLongerName", sizeof(aAppCfgData[1].m_szDevMntDevName));
+    strncpy(aAppCfgData[0].m_szWifiSSID, "SSID-A", sizeof(aAppCfgData[0].m_szWifiSSID));
+    strncpy(aAppCfgData[1].m_szWifiSSID, "SSID-B-0123456789-0123456789", sizeof(aAppCfgData[1].m_szWifiSSID));
+    strncpy(aAppCfgData[0].m_szWifiPasswd, "PasswdA-0123", sizeof(aAppCfgData[0].m_szWifiPasswd));
+    strncpy(aAppCfgData[1].m_szWifiPasswd, "PasswdB-0123456789-0123456789-0123456789", sizeof(aAppCfgData[1].m_szWifiPasswd));
+    strncpy(aAppCfgData[0].m_szWifiOwnAddr, "192.168.1.10:8080", sizeof(aAppCfgData[0].m_szWifiOwnAddr));
+    strncpy(aAppCfgData[1].m_szWifiOwnAddr, "10.0.0.1", sizeof(aAppCfgData[1].m_szWifiOwnAddr));
+    aAppCfgData[0].m_fAppRtOpt1 = 0;
+    aAppCfgData[1].m_fAppRtOpt1 = 1;
+    aAppCfgData[0].m_fAppRtOpt6 = 1;
+    aAppCfgData[1].m_fAppRtOpt6 = 0;
+    strncpy(aAppCfgData[0].m_szAppRtPeerAddr, "192.168.1.20:1883", sizeof(aAppCfgData[0].m_szAppRtPeerAddr));
+    strncpy(aAppCfgData[1].m_szAppRtPeerAddr, "10.0.0.2", sizeof(aAppCfgData[1].m_szAppRtPeerAddr));
+    for (uiSet=0; uiSet<2; uiSet++)
+    {
+        aAppCfgData[uiSet].m_ui32Crc32 = 0;
+        aui32Crc[uiSet] = ESP32BleAppCfgData::CalulateCrc32(&aAppCfgData[uiSet], sizeof(aAppCfgData[uiSet]));
+    }
+
+    BaseFreeBytes    = 0;
+    BaseMinFreeBytes = 0;
+    ulBaseAllocs     = 0;
+    ulBaseFrees      = 0;
+    ulCycleTimeMax   = 0;
+    ulSetupTimeMax   = 0;
+    ui64CycleTimeSum = 0;
+    uiSessions       = 0;
+    uiErrCnt         = 0;
+
+    // warm-up cycles and one restart first (one-time allocations), then <SOAK_CYCLES> measured cycles
+    for (uiCycle=0; uiCycle<(SOAK_WARMUP_CYCLES + SOAK_CYCLES); uiCycle++)
+    {
+        if ((uiCycle == SOAK_WARMUP_CYCLES - 1) || ((uiCycle >= SOAK_WARMUP_CYCLES) && (((uiCycle - SOAK_WARMUP_CYCLES + 1) % SOAK_SESSION_CYCLES) == 0)))
+        {
+            // ---- leave and re-enter BLE Config Mode ----
+            ulStartTime = micros();
+            ESP32BleCfgProfile_g.ProfileShutdown(false);
+            if (ESP32BleCfgProfile_g.ProfileSetup(APP_DEVICE_TYPE, &AppCfgData_g, &AppDescriptData_g, AppCbHdlrSaveConfig, AppCbHdlrRestartDev, AppCbHdlrConStatChg) < 0)
+            {
+                uiErrCnt++;
+                break;
+            }
+            ulCycleTime = micros() - ulStartTime;
+            ulSetupTimeMax = (ulCycleTime > ulSetupTimeMax) ? ulCycleTime : ulSetupTimeMax;
+            uiSessions++;
+
+            delay(SOAK_SETTLE_TIME);
+            SessionFreeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+            if (uiCycle == SOAK_WARMUP_CYCLES - 1)
+            {
+                BaseFreeBytes    = SessionFreeBytes;
+                BaseMinFreeBytes = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+                DebugSoakGetAllocCounts(&ulBaseAllocs, &ulBaseFrees);
+            }
+            snprintf(szTextBuff, sizeof(szTextBuff), "  Session %u: FreeBytes=%u (Baseline=%u), Shutdown+Setup=%lu us",
+                     uiSessions, (unsigned)SessionFreeBytes, (unsigned)BaseFreeBytes, ulCycleTime);
+            Serial.println(szTextBuff);
+            continue;
+        }
+
+        uiSet = uiCycle & 1;
+        ulStartTime = micros();
+
+        // client session: write configuration set, <Save Config>, check the saved data
+        if (DebugSoakRunSession(&aAppCfgData[uiSet], &AppCfgData) < 0)
+        {
+            uiErrCnt++;
+        }
+        AppCfgData.m_ui32MagicID = aAppCfgData[uiSet].m_ui32MagicID;
+        AppCfgData.m_ui32Crc32 = 0;
+        if (ESP32BleAppCfgData::CalulateCrc32(&AppCfgData, sizeof(AppCfgData)) != aui32Crc[uiSet])
+        {
+            uiErrCnt++;
+        }
+
+        ulCycleTime = micros() - ulStartTime;
+        if (uiCycle >= SOAK_WARMUP_CYCLES)
+        {
+            ui64CycleTimeSum += ulCycleTime;
+            ulCycleTimeMax = (ulCycleTime > ulCycleTimeMax) ? ulCycleTime : ulCycleTimeMax;
+        }
+
+        if ((uiCycle >= SOAK_WARMUP_CYCLES) && (((uiCycle - SOAK_WARMUP_CYCLES + 1) % SOAK_REPORT_INTERVAL) == 0))
+        {
+            snprintf(szTextBuff, sizeof(szTextBuff), "  Cycle %u: FreeBytes=%u, MinFreeEver=%u, MaxCycle=%lu us",
+                     uiCycle - SOAK_WARMUP_CYCLES + 1, (unsigned)heap_caps_get_free_size(MALLOC_CAP_8BIT),
+                     (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT), ulCycleTimeMax);
+            Serial.println(szTextBuff);
+        }
+
+        // give the BLE stack and the idle task (watchdog) a chance to run
+        if ((uiCycle % 100) == 0)
+        {
+            delay(1);
+        }
+    }
+
+    // final measurement in the same settled state as the baseline (the last cycle restarted
+    // the BLE Config Mode with the same configuration set saved before)
+    delay(SOAK_SETTLE_TIME);
+    EndFreeBytes    = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    EndMinFreeBytes = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    DebugSoakGetAllocCounts(&ulEndAllocs, &ulEndFrees);
+
+    // restore the original configuration
+    if (DebugSoakRunSession(&aAppCfgData[2], &AppCfgData) < 0)
+    {
+        uiErrCnt++;
+    }
+    traceEnable(true);
+
+    // no net growth: neither less free heap nor more live heap blocks than at the baseline
+    fPass = ((uiErrCnt == 0) && (BaseFreeBytes > 0) && (EndFreeBytes >= BaseFreeBytes) &&
+             ((ulEndAllocs - ulBaseAllocs) <= (ulEndFrees - ulBaseFrees))) ? true : false;
+
+    snprintf(szTextBuff, sizeof(szTextBuff), "{\"soaktest\":\"ESP32BleConfig\",\"cycles\":%u,\"sessions\":%u,\"errors\":%u,\"free_bytes_loss\":%d,"
+             "\"allocs\":%lu,\"frees\":%lu,\"peak_usage\":%d,\"avg_cycle_us\":%lu,\"max_cycle_us\":%lu,\"max_session_us\":%lu,\"pass\":%s}",
+             (unsigned)SOAK_CYCLES, uiSessions, uiErrCnt, (int)(BaseFreeBytes - EndFreeBytes),
+             (ulEndAllocs - ulBaseAllocs), (ulEndFrees - ulBaseFrees),
+             (int)(BaseMinFreeBytes - EndMinFreeBytes), (unsigned long)(ui64CycleTimeSum / SOAK_CYCLES), ulCycleTimeMax, ulSetupTimeMax,
+             (fPass ? "true" : "false"));
+    Serial.println();
+    Serial.println(szTextBuff);
+    Serial.flush();
+
+    return;
+
+}
+
+#endif
+
+
+
+//---------------------------------------------------------------------------
+//  DEBUG: Simulate Firmware Transfer via service [OTA]
+//---------------------------------------------------------------------------
+//  Feeds a synthetic image through the OTA pipeline in the same way as the
+//  BLE callbacks do it (MTU sized packets, credit based flow control,
+//  flash writer task). The image starts with a valid header magic but is
+//  no executable firmware, so the update must end with OTA_STATUS_IMAGE_ERROR
+//  after the SHA-256 was verified successfully. The boot partition is never
+//  changed by the simulation.
+//---------------------------------------------------------------------------
+
+#ifdef DEBUG_OTA_SIM
+
+#define OTA_SIM_IMAGE_SIZE              (256 * 1024)
+#define OTA_SIM_PACKET_SIZE             244                     // = ATT_MTU(247) - 3
+#define OTA_SIM_TIMEOUT                 30000                   // [ms]
+
+uint8_t  DebugOtaSimGetByte (uint32_t ui32Offset_p)
+{
+
+    // first byte = ESP_IMAGE_HEADER_MAGIC, otherwise <esp_ota_write()> rejects the image
+    return ((ui32Offset_p == 0) ? 0xE9 : (uint8_t)((ui32Offset_p * 7) ^ (ui32Offset_p >> 8)));
+
+}
+
+void  DebugRunOtaSim ()
+{
+
+mbedtls_sha256_context  Sha256Ctx;
+uint8_t        abPacket[OTA_SIM_PACKET_SIZE];
+uint8_t        abCmd[OTA_CMD_START_SIZE];
+tOtaStatus     OtaStatus;
+uint32_t       ui32Offset;
+unsigned int   uiPacketLen;
+unsigned int   uiIdx;
+unsigned int   uiStallCnt;
+unsigned long  ulStartTime;
+unsigned long  ulElapsedTime;
+char           szTextBuff[160];
+bool           fPass;
+
+    Serial.println();
+    Serial.println("OTA Simulation: start...");
+
+    // SHA-256 over the synthetic image
+    mbedtls_sha256_init(&Sha256Ctx);
+    mbedtls_sha256_starts(&Sha256Ctx, 0);
+    for (ui32Offset=0; ui32Offset<OTA_SIM_IMAGE_SIZE; ui32Offset+=uiPacketLen)
+    {
+        uiPacketLen = ((OTA_SIM_IMAGE_SIZE - ui32Offset) < OTA_SIM_PACKET_SIZE) ? (OTA_SIM_IMAGE_SIZE - ui32Offset) : OTA_SIM_PACKET_SIZE;
+        for (uiIdx=0; uiIdx<uiPacketLen; uiIdx++)
+        {
+            abPacket[uiIdx] = DebugOtaSimGetByte(ui32Offset + uiIdx);
+        }
+        mbedtls_sha256_update(&Sha256Ctx, abPacket, uiPacketLen);
+    }
+
+    memset(abCmd, 0x00, sizeof(abCmd));
+    abCmd[0] = OTA_CMD_START;
+    abCmd[2] = (uint8_t)(OTA_SIM_IMAGE_SIZE);
+    abCmd[3] = (uint8_t)(OTA_SIM_IMAGE_SIZE >> 8);
+    abCmd[4] = (uint8_t)(OTA_SIM_IMAGE_SIZE >> 16);
+    abCmd[5] = (uint8_t)(OTA_SIM_IMAGE_SIZE >> 24);
+    mbedtls_sha256_finish(&Sha256Ctx, &abCmd[6]);
+    mbedtls_sha256_free(&Sha256Ctx);
+
+    // transfer image, each packet only as far as the current credit allows
+    ulStartTime = millis();
+    uiStallCnt  = 0;
+    ESP32BleCfgOta::ProcessCtrl(abCmd, OTA_CMD_START_SIZE, OTA_SIM_PACKET_SIZE);
+    ui32Offset = 0;
+    while (ui32Offset < OTA_SIM_IMAGE_SIZE)
+    {
+        ESP32BleCfgOta::GetStatus(&OtaStatus);
+        if ((OtaStatus.m_ui8State != OTA_STATE_ACTIVE) || ((millis() - ulStartTime) > OTA_SIM_TIMEOUT))
+        {
+            break;
+        }
+
+        uiPacketLen = ((OTA_SIM_IMAGE_SIZE - ui32Offset) < OTA_SIM_PACKET_SIZE) ? (OTA_SIM_IMAGE_SIZE - ui32Offset) : OTA_SIM_PACKET_SIZE;
+        if ((ui32Offset + uiPacketLen) > OtaStatus.m_ui32CreditLimit)
+        {
+            // no credit -> wait for flash writer
+            uiStallCnt++;
+            delay(1);
+            continue;
+        }
+
+        for (uiIdx=0; uiIdx<uiPacketLen; uiIdx++)
+        {
+            abPacket[uiIdx] = DebugOtaSimGetByte(ui32Offset + uiIdx);
+        }
+        ESP32BleCfgOta::ProcessData(abPacket, uiPacketLen);
+        ui32Offset += uiPacketLen;
+    }
+
+    abCmd[0] = OTA_CMD_FINISH;
+    ESP32BleCfgOta::ProcessCtrl(abCmd, 1, OTA_SIM_PACKET_SIZE);
+    do
+    {
+        delay(10);
+        ESP32BleCfgOta::GetStatus(&OtaStatus);
+    }
+    while ((OtaStatus.m_ui8State == OTA_STATE_ACTIVE) && ((millis() - ulStartTime) < OTA_SIM_TIMEOUT));
+    ulElapsedTime = millis() - ulStartTime;
+
+    // synthetic image passes the hash check but is rejected by the image validation
+    fPass = ((OtaStatus.m_ui8State == OTA_STATE_ERROR) && (OtaStatus.m_ui8Status == OTA_STATUS_IMAGE_ERROR) &&
+             (OtaStatus.m_ui32WrittenOffset == OTA_SIM_IMAGE_SIZE));
+
+    snprintf(szTextBuff, sizeof(szTextBuff), "{\"OtaSim\":{\"ImageSize\":%u,\"PacketSize\":%u,\"Time_ms\":%lu,\"Throughput\":%lu,\"MaxWrite_us\":%lu,\"Stalls\":%u,\"Status\":%u,\"Pass\":%s}}",
+             (unsigned)OTA_SIM_IMAGE_SIZE, (unsigned)OTA_SIM_PACKET_SIZE, ulElapsedTime, (unsigned long)OtaStatus.m_ui32Throughput,
+             (unsigned long)OtaStatus.m_ui32MaxWriteTime, uiStallCnt, OtaStatus.m_ui8Status, (fPass ? "true" : "false"));
+    Serial.println(szTextBuff);
+    Serial.println("OTA Simulation: done");
+    Serial.println();
+
+    return;
+
+}
+
+#endif
+
+
+
+// EOF
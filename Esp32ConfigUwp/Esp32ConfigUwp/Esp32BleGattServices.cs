@@ -1877,7 +1877,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt1);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt1 != null) ? m_strLabelOpt1 : "#");
             }
         }
 
@@ -1902,7 +1903,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt2);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt2 != null) ? m_strLabelOpt2 : "#");
             }
         }
 
@@ -1927,7 +1929,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt3);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt3 != null) ? m_strLabelOpt3 : "#");
             }
         }
 
@@ -1952,7 +1955,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt4);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt4 != null) ? m_strLabelOpt4 : "#");
             }
         }
 
@@ -1977,7 +1981,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt5);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt5 != null) ? m_strLabelOpt5 : "#");
             }
         }
 
@@ -2002,7 +2007,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt6);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt6 != null) ? m_strLabelOpt6 : "#");
             }
         }
 
@@ -2027,7 +2033,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt7);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt7 != null) ? m_strLabelOpt7 : "#");
             }
         }
 
@@ -2052,7 +2059,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelOpt8);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtOpt8 != null) ? m_strLabelOpt8 : "#");
             }
         }
 
@@ -2077,7 +2085,8 @@ namespace Esp32ConfigUwp
         {
             get
             {
-                return (m_strLabelPeerAddr);
+                // characteristic not created by the device -> option is disabled
+                return ((m_CharacAppRtPeerAddr != null) ? m_strLabelPeerAddr : "#");
             }
         }
 
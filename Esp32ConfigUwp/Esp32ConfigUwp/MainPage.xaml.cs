@@ -885,7 +885,10 @@ namespace Esp32ConfigUwp
                 strLabel_p = strLabel_p.Trim();
             }
 
-            OptionControl_p.Content = strLabel_p;
+            if (strLabel_p.Length > 0)
+            {
+                OptionControl_p.Content = strLabel_p;
+            }
             OptionControl_p.IsEnabled = fEnableState;
 
             return;
@@ -914,7 +917,10 @@ namespace Esp32ConfigUwp
                 strLabel_p += ":";
             }
 
-            OptionControlLabel_p.Text = strLabel_p;
+            if (strLabel_p.Length > 1)
+            {
+                OptionControlLabel_p.Text = strLabel_p;
+            }
             OptionControlValue_p.IsEnabled = fEnableState;
             
             return;
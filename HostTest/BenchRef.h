@@ -0,0 +1,42 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Reference values of the benchmark for the host build
+                (replace the target values in ESP32BleConfig.ino)
+
+  -------------------------------------------------------------------------
+
+    - Values are the slowest "avg_ns" of 20 runs of the host build (-O2,
+      x86_64, best of BENCH_RUNS each), rounded up.
+      They catch algorithmic regressions of the hot paths (e.g. a loop
+      becoming quadratic), not the speed of a particular machine, so the
+      tolerance is wider than on the target.
+    - After an intended change of a hot path, take the new values from
+      "make bench" and update them here.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _BENCHREF_H_
+#define _BENCHREF_H_
+
+
+#define BENCH_MAX_REGRESSION_PCT        100                 // max. allowed slowdown against reference [%]
+
+#define BENCH_REF_NS_CRC32              3000                // reference values: average time per call [ns]
+#define BENCH_REF_NS_IMPORT_WORKSPACE   20
+#define BENCH_REF_NS_EXPORT_WORKSPACE   30
+#define BENCH_REF_NS_READ_CHARACTRSTC   100
+#define BENCH_REF_NS_SPLIT_NET_ADDR     130
+#define BENCH_REF_NS_GET_MAC_ID         1100
+#define BENCH_REF_NS_PROFILE_SETUP      140000
+
+
+#endif  // _BENCHREF_H_
@@ -0,0 +1,204 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the BT Memory Accounting (Normal Operation Mode)
+
+  -------------------------------------------------------------------------
+
+    - Checks <ProfileEnterNormalMode()> and its use by the sketch against
+      the simulated BT Controller: esp_bt_mem_release() is called exactly
+      once with ESP_BT_MODE_BTDM, and the number of reclaimed bytes
+      reported by the framework resp. the sketch matches the memory given
+      back to the simulated heap.
+    - Linked with the sketch (<setup()> boots it in Normal Operation Mode).
+      The release is not reversible until the next restart, so the test
+      case booting the sketch must run last.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+#include "esp_bt.h"
+#include "esp_heap_caps.h"
+
+#include "ESP32BleCfgProfile.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define BTMEM_TEST_PIN_KEY_BLE_CFG      36                  // PIN_KEY_BLE_CFG of the sketch (HIGH = Normal Operation Mode)
+#define BTMEM_TEST_RELEASED_BYTES       (HOSTSIM_BT_CTRL_MEM_SIZE + HOSTSIM_BT_HOST_MEM_SIZE)
+
+static  const char*  BTMEM_TEST_RECLAIMED_PREFIX = "-> reclaimed: ";
+
+void  setup ();
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  int  BtMemTestSetup ()
+{
+
+static  const tHostTestProfileParam  Param = { "BtMemTestDevice", NULL, BLE_GATT_BACKEND_OBJECTS, 0, 0 };
+
+    return (HostTestProfileSetup(&Param));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+static  void  TestNormalModeRefusedWhileProfileActive ()
+{
+
+tHostSimBtStats  BtStats;
+
+    HOSTTEST_CHECK(BtMemTestSetup() >= 0);
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileEnterNormalMode(), -1);
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileShutdown(false), 1);
+
+    HostSimGetBtStats(&BtStats);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiMemReleaseCalls, 0);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiCtrlMemReleaseCalls, 0);
+    HOSTTEST_CHECK_EQ(BtStats.m_ReleasedBytes, 0);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  TestNormalModeRefusedWhileCtrlNotIdle ()
+{
+
+esp_bt_controller_config_t  BtCfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
+tHostSimBtStats             BtStats;
+
+    HOSTTEST_CHECK_EQ(esp_bt_controller_init(&BtCfg), ESP_OK);
+    HOSTTEST_CHECK_EQ(esp_bt_controller_get_status(), ESP_BT_CONTROLLER_STATUS_INITED);
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileEnterNormalMode(), -2);
+    HOSTTEST_CHECK_EQ(esp_bt_controller_deinit(), ESP_OK);
+
+    HostSimGetBtStats(&BtStats);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiMemReleaseCalls, 0);
+    HOSTTEST_CHECK_EQ(BtStats.m_ReleasedBytes, 0);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  TestShutdownKeepsBtMemory ()
+{
+
+tHostSimBtStats  BtStats;
+size_t           FreeBytes;
+
+    FreeBytes = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    HOSTTEST_CHECK(BtMemTestSetup() >= 0);
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileShutdown(false), 1);
+    HOSTTEST_CHECK_EQ(esp_bt_controller_get_status(), ESP_BT_CONTROLLER_STATUS_IDLE);
+
+    // without releasing the BT memory, the profile objects must be given back completely
+    HOSTTEST_CHECK_EQ(heap_caps_get_free_size(MALLOC_CAP_8BIT), FreeBytes);
+
+    HostSimGetBtStats(&BtStats);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiMemReleaseCalls, 0);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiCtrlMemReleaseCalls, 0);
+    HOSTTEST_CHECK_EQ(BtStats.m_ReleasedBytes, 0);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  TestSketchReleasesBtMemory ()
+{
+
+FILE*            pConsole;
+char             szLine[256];
+tHostSimBtStats  BtStats;
+size_t           TotalBytes;
+int              iReclaimed;
+
+    pConsole = tmpfile();
+    HOSTTEST_CHECK(pConsole != NULL);
+    if (pConsole == NULL)
+    {
+        return;
+    }
+
+    // boot the sketch in Normal Operation Mode (CFG_RELEASE_BT_MEM_IN_NORMAL_MODE)
+    TotalBytes = heap_caps_get_total_size(MALLOC_CAP_8BIT);
+    HostSimSetSerialOutput(pConsole);
+    HostSimSetPinLevel(BTMEM_TEST_PIN_KEY_BLE_CFG, HIGH);
+    setup();
+    HostSimSetSerialOutput(NULL);
+
+    HostSimGetBtStats(&BtStats);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiMemReleaseCalls, 1);
+    HOSTTEST_CHECK_EQ(BtStats.m_LastMemReleaseMode, ESP_BT_MODE_BTDM);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiCtrlMemReleaseCalls, 0);
+    HOSTTEST_CHECK_EQ(BtStats.m_ReleasedBytes, BTMEM_TEST_RELEASED_BYTES);
+    HOSTTEST_CHECK_EQ(heap_caps_get_total_size(MALLOC_CAP_8BIT), TotalBytes + BTMEM_TEST_RELEASED_BYTES);
+
+    // the number of bytes reported by the sketch is the one returned by <ProfileEnterNormalMode()>
+    iReclaimed = -1;
+    rewind(pConsole);
+    while (fgets(szLine, sizeof(szLine), pConsole) != NULL)
+    {
+        if (strncmp(szLine, BTMEM_TEST_RECLAIMED_PREFIX, strlen(BTMEM_TEST_RECLAIMED_PREFIX)) == 0)
+        {
+            iReclaimed = atoi(szLine + strlen(BTMEM_TEST_RECLAIMED_PREFIX));
+        }
+    }
+    fclose(pConsole);
+    HOSTTEST_CHECK_EQ(iReclaimed, BTMEM_TEST_RELEASED_BYTES);
+
+    // not reversible: no second release, no BLE Profile until the next restart
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileEnterNormalMode(), 0);
+    HOSTTEST_CHECK_EQ(BtMemTestSetup(), -5);
+    HostSimGetBtStats(&BtStats);
+    HOSTTEST_CHECK_EQ(BtStats.m_uiMemReleaseCalls, 1);
+    HOSTTEST_CHECK_EQ(BtStats.m_ReleasedBytes, BTMEM_TEST_RELEASED_BYTES);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestNormalModeRefusedWhileProfileActive);
+    HOSTTEST_RUN(TestNormalModeRefusedWhileCtrlNotIdle);
+    HOSTTEST_RUN(TestShutdownKeepsBtMemory);
+    HOSTTEST_RUN(TestSketchReleasesBtMemory);           // must be the last one (not reversible)
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
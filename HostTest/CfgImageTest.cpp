@@ -0,0 +1,383 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Config Image (ESP32BleCfgFields and
+                [DevMnt/ConfigImage])
+
+  -------------------------------------------------------------------------
+
+    - Round trip: DecodeImage(EncodeImage(x)) has to result in x for a
+      set of valid configurations (min. and max. length values, all
+      options), decoded into a configuration with different values.
+    - Rejection of images with version 0, a newer version, a wrong CRC
+      or a repeated Field ID.
+    - Write of an image via [DevMnt/ConfigImage]: a failed save (callback
+      handler returns < 0) has to be reported as CFG_STATUS_SAVE_ERROR.
+    - Reports the throughput of EncodeImage() and DecodeImage() (fastest
+      of IMAGE_TEST_RUNS runs, as the benchmark of the sketch measures).
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleAppCfgData.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define IMAGE_TEST_OWNMODE_FEATLIST     (WIFI_OPMODE_STA | WIFI_OPMODE_AP)
+#define IMAGE_TEST_ITERATIONS           1000
+#define IMAGE_TEST_RUNS                 5
+
+// UUIDs (see BleProfileDefinition.txt)
+static  const char*  IMAGE_TEST_UUID_CFGIMAGE  = "00001900-0000-1000-8000-E776CC14FE69";
+
+static  const uint8_t  aui8GattBackend_g[] = { BLE_GATT_BACKEND_OBJECTS, BLE_GATT_BACKEND_ATTR_TABLE };
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+// Configuration with all values set (strings without terminating zero if they fill the field)
+static  void  ImageTestBuildCfg (tAppCfgData* pAppCfgData_p, unsigned int uiVariant_p)
+{
+
+    memset(pAppCfgData_p, 0x00, sizeof(*pAppCfgData_p));
+    pAppCfgData_p->m_ui32MagicID = 0x12345678;
+
+    switch (uiVariant_p)
+    {
+        case 0:                                                 // min. length values, open network
+        {
+            strcpy(pAppCfgData_p->m_szDevMntDevName, "D");
+            strcpy(pAppCfgData_p->m_szWifiSSID, "S");
+            strcpy(pAppCfgData_p->m_szWifiOwnAddr, "1.2.3.4");
+            pAppCfgData_p->m_ui8WifiOwnMode = WIFI_OPMODE_STA;
+            strcpy(pAppCfgData_p->m_szAppRtPeerAddr, "0.0.0.0");
+            break;
+        }
+
+        case 1:                                                 // typical values
+        {
+            strcpy(pAppCfgData_p->m_szDevMntDevName, "Device-1");
+            strcpy(pAppCfgData_p->m_szWifiSSID, "HomeNet");
+            strcpy(pAppCfgData_p->m_szWifiPasswd, "Secret-Passwd");
+            strcpy(pAppCfgData_p->m_szWifiOwnAddr, "192.168.10.20:8080");
+            pAppCfgData_p->m_ui8WifiOwnMode = WIFI_OPMODE_AP;
+            pAppCfgData_p->m_fAppRtOpt1 = 1;
+            pAppCfgData_p->m_fAppRtOpt5 = 1;
+            strcpy(pAppCfgData_p->m_szAppRtPeerAddr, "10.0.0.1");
+            break;
+        }
+
+        case 2:                                                 // max. length values, all options
+        {
+            memset(pAppCfgData_p->m_szDevMntDevName, 'D', sizeof(pAppCfgData_p->m_szDevMntDevName));
+            memset(pAppCfgData_p->m_szWifiSSID, 'S', sizeof(pAppCfgData_p->m_szWifiSSID));
+            memset(pAppCfgData_p->m_szWifiPasswd, 'a', sizeof(pAppCfgData_p->m_szWifiPasswd));      // 64 hex digits (PSK)
+            strcpy(pAppCfgData_p->m_szWifiOwnAddr, "255.255.255.255:65535");
+            pAppCfgData_p->m_ui8WifiOwnMode = WIFI_OPMODE_STA;
+            pAppCfgData_p->m_fAppRtOpt1 = 1;
+            pAppCfgData_p->m_fAppRtOpt2 = 1;
+            pAppCfgData_p->m_fAppRtOpt3 = 1;
+            pAppCfgData_p->m_fAppRtOpt4 = 1;
+            pAppCfgData_p->m_fAppRtOpt5 = 1;
+            pAppCfgData_p->m_fAppRtOpt6 = 1;
+            pAppCfgData_p->m_fAppRtOpt7 = 1;
+            pAppCfgData_p->m_fAppRtOpt8 = 1;
+            strcpy(pAppCfgData_p->m_szAppRtPeerAddr, "1.2.3.4:1");
+            break;
+        }
+    }
+
+    pAppCfgData_p->m_ui32Crc32 = ESP32BleAppCfgData::CalulateCrc32(pAppCfgData_p, sizeof(*pAppCfgData_p) - sizeof(uint32_t));
+
+}
+
+//---------------------------------------------------------------------------
+//  Changes header byte <uiIdx_p> of an image and recalculates its CRC
+//---------------------------------------------------------------------------
+
+static  void  ImageTestPatchImage (uint8_t* pabImage_p, int iImageLen_p, unsigned int uiIdx_p, uint8_t ui8Value_p)
+{
+
+uint32_t  ui32Crc;
+
+    pabImage_p[uiIdx_p] = ui8Value_p;
+    ui32Crc = ESP32BleAppCfgData::CalulateCrc32(pabImage_p, iImageLen_p - CFG_IMAGE_CRC_SIZE);
+    pabImage_p[iImageLen_p - 4] = (uint8_t)(ui32Crc);
+    pabImage_p[iImageLen_p - 3] = (uint8_t)(ui32Crc >> 8);
+    pabImage_p[iImageLen_p - 2] = (uint8_t)(ui32Crc >> 16);
+    pabImage_p[iImageLen_p - 1] = (uint8_t)(ui32Crc >> 24);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  int  ImageTestSetup (uint8_t ui8GattBackend_p, int iSaveResult_p)
+{
+
+tHostTestProfileParam  Param = { "ImageTestDevice", NULL, ui8GattBackend_p, 247, iSaveResult_p };
+tAppCfgData            AppCfgData;
+
+    ImageTestBuildCfg(&AppCfgData, 0);
+    Param.m_pAppCfgData = &AppCfgData;
+
+    return ((HostTestProfileSetup(&Param) < 0) ? -1 : 0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+static  void  TestImageRoundTrip ()
+{
+
+tAppCfgData   AppCfgData;
+tAppCfgData   AppCfgDataDecoded;
+uint8_t       abImage[CFG_IMAGE_MAX_SIZE];
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiVariant;
+int           iImageLen;
+
+    ESP32BleCfgFields::SetOwnModeFeatList(IMAGE_TEST_OWNMODE_FEATLIST);
+
+    for (uiVariant=0; uiVariant<3; uiVariant++)
+    {
+        ImageTestBuildCfg(&AppCfgData, uiVariant);
+        iImageLen = ESP32BleCfgFields::EncodeImage(&AppCfgData, abImage, sizeof(abImage));
+        HOSTTEST_CHECK(iImageLen > (CFG_IMAGE_HDR_SIZE + CFG_IMAGE_CRC_SIZE));
+        HOSTTEST_CHECK(iImageLen <= CFG_IMAGE_MAX_SIZE);
+
+        // decode into a configuration with different values in every field
+        ImageTestBuildCfg(&AppCfgDataDecoded, (uiVariant + 1) % 3);
+        ESP32BleCfgFields::DecodeImage(abImage, iImageLen, &AppCfgDataDecoded, abRsp);
+        HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_OK);
+        HOSTTEST_CHECK_EQ(abRsp[1], CFG_PATCH_NO_ENTRY_IDX);
+
+        // the image contains the configuration fields only (not MagicID and CRC)
+        AppCfgDataDecoded.m_ui32MagicID = AppCfgData.m_ui32MagicID;
+        AppCfgDataDecoded.m_ui32Crc32   = AppCfgData.m_ui32Crc32;
+        HOSTTEST_CHECK(memcmp(&AppCfgDataDecoded, &AppCfgData, sizeof(AppCfgData)) == 0);
+    }
+
+}
+
+// Buffer too small for the image
+static  void  TestImageEncodeBuffer ()
+{
+
+tAppCfgData  AppCfgData;
+uint8_t      abImage[CFG_IMAGE_MAX_SIZE];
+
+    ImageTestBuildCfg(&AppCfgData, 2);
+    HOSTTEST_CHECK(ESP32BleCfgFields::EncodeImage(&AppCfgData, abImage, 64) < 0);
+    HOSTTEST_CHECK(ESP32BleCfgFields::EncodeImage(NULL, abImage, sizeof(abImage)) < 0);
+
+}
+
+static  void  TestImageInvalidVersion ()
+{
+
+tAppCfgData  AppCfgData;
+tAppCfgData  AppCfgDataDecoded;
+uint8_t      abImage[CFG_IMAGE_MAX_SIZE];
+uint8_t      abRsp[CFG_PATCH_RSP_SIZE];
+int          iImageLen;
+
+    ESP32BleCfgFields::SetOwnModeFeatList(IMAGE_TEST_OWNMODE_FEATLIST);
+    ImageTestBuildCfg(&AppCfgData, 1);
+    iImageLen = ESP32BleCfgFields::EncodeImage(&AppCfgData, abImage, sizeof(abImage));
+
+    ImageTestPatchImage(abImage, iImageLen, 2, 0);
+    ImageTestBuildCfg(&AppCfgDataDecoded, 0);
+    ESP32BleCfgFields::DecodeImage(abImage, iImageLen, &AppCfgDataDecoded, abRsp);
+    HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_VERSION_ERROR);
+    HOSTTEST_CHECK_EQ(abRsp[2], 0);
+    HOSTTEST_CHECK(strcmp(AppCfgDataDecoded.m_szWifiSSID, "S") == 0);
+
+    ImageTestPatchImage(abImage, iImageLen, 2, CFG_IMAGE_VERSION + 1);
+    ESP32BleCfgFields::DecodeImage(abImage, iImageLen, &AppCfgDataDecoded, abRsp);
+    HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_VERSION_ERROR);
+
+}
+
+static  void  TestImageCrcError ()
+{
+
+tAppCfgData  AppCfgData;
+uint8_t      abImage[CFG_IMAGE_MAX_SIZE];
+uint8_t      abRsp[CFG_PATCH_RSP_SIZE];
+int          iImageLen;
+
+    ESP32BleCfgFields::SetOwnModeFeatList(IMAGE_TEST_OWNMODE_FEATLIST);
+    ImageTestBuildCfg(&AppCfgData, 1);
+    iImageLen = ESP32BleCfgFields::EncodeImage(&AppCfgData, abImage, sizeof(abImage));
+
+    abImage[CFG_IMAGE_HDR_SIZE + 3] ^= 0x01;
+    ESP32BleCfgFields::DecodeImage(abImage, iImageLen, &AppCfgData, abRsp);
+    HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_CRC_ERROR);
+
+}
+
+// Image with two entries for the same field (header: 2 entries)
+static  void  TestImageDuplicateField ()
+{
+
+tAppCfgData  AppCfgData;
+uint8_t      abImage[] = { (uint8_t)CFG_IMAGE_MAGIC, (uint8_t)(CFG_IMAGE_MAGIC >> 8), CFG_IMAGE_VERSION, 2,
+                           CFG_FIELD_WIFI_SSID, 1, 'A',
+                           CFG_FIELD_WIFI_SSID, 1, 'B',
+                           0, 0, 0, 0 };
+uint8_t      abRsp[CFG_PATCH_RSP_SIZE];
+
+    ESP32BleCfgFields::SetOwnModeFeatList(IMAGE_TEST_OWNMODE_FEATLIST);
+    ImageTestBuildCfg(&AppCfgData, 0);
+    ImageTestPatchImage(abImage, sizeof(abImage), 3, 2);
+
+    ESP32BleCfgFields::DecodeImage(abImage, sizeof(abImage), &AppCfgData, abRsp);
+    HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_DUPLICATE_FIELD);
+    HOSTTEST_CHECK_EQ(abRsp[1], 1);
+    HOSTTEST_CHECK(strcmp(AppCfgData.m_szWifiSSID, "S") == 0);
+
+}
+
+// Write via [DevMnt/ConfigImage]: result of the Save Config callback is reported
+static  void  TestImageWriteSave ()
+{
+
+tAppCfgData   AppCfgData;
+uint8_t       abImage[CFG_IMAGE_MAX_SIZE];
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiIdx;
+unsigned int  uiNotifyCnt;
+int           iImageLen;
+int           iSaveResult;
+
+    for (uiIdx=0; uiIdx<sizeof(aui8GattBackend_g); uiIdx++)
+    {
+        for (iSaveResult=0; iSaveResult>=-1; iSaveResult--)
+        {
+            HOSTTEST_CHECK_EQ(ImageTestSetup(aui8GattBackend_g[uiIdx], iSaveResult), 0);
+
+            ImageTestBuildCfg(&AppCfgData, 1);
+            iImageLen = ESP32BleCfgFields::EncodeImage(&AppCfgData, abImage, sizeof(abImage));
+            uiNotifyCnt = HostSimBleGetNotifyCount(IMAGE_TEST_UUID_CFGIMAGE);
+            HostSimBleWrite(IMAGE_TEST_UUID_CFGIMAGE, abImage, iImageLen);
+            HOSTTEST_CHECK_EQ(HostSimBleGetNotifyCount(IMAGE_TEST_UUID_CFGIMAGE), uiNotifyCnt + 1);
+            HOSTTEST_CHECK_EQ(HostSimBleGetLastNotify(IMAGE_TEST_UUID_CFGIMAGE, abRsp, sizeof(abRsp)), CFG_PATCH_RSP_SIZE);
+            HOSTTEST_CHECK_EQ(abRsp[0], (iSaveResult < 0) ? CFG_STATUS_SAVE_ERROR : CFG_STATUS_OK);
+            HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiSaveCalls, 1);
+
+            HostTestProfileShutdown();
+        }
+    }
+
+}
+
+
+
+// Throughput of encoding and decoding an image with max. length values [Bytes/s]
+static  void  TestImageThroughput ()
+{
+
+tAppCfgData    AppCfgData;
+tAppCfgData    AppCfgDataDecoded;
+uint8_t        abImage[CFG_IMAGE_MAX_SIZE];
+uint8_t        abRsp[CFG_PATCH_RSP_SIZE];
+unsigned long  ulStartTime;
+unsigned long  ulEncodeTime;
+unsigned long  ulDecodeTime;
+unsigned int   uiRun;
+unsigned int   uiIdx;
+unsigned int   uiDecodeErr;
+int            iImageLen;
+
+    ESP32BleCfgFields::SetOwnModeFeatList(IMAGE_TEST_OWNMODE_FEATLIST);
+    ImageTestBuildCfg(&AppCfgData, 2);
+    ImageTestBuildCfg(&AppCfgDataDecoded, 0);
+
+    iImageLen    = 0;
+    uiDecodeErr  = 0;
+    ulEncodeTime = ~0UL;
+    ulDecodeTime = ~0UL;
+    for (uiRun=0; uiRun<IMAGE_TEST_RUNS; uiRun++)
+    {
+        ulStartTime = micros();
+        for (uiIdx=0; uiIdx<IMAGE_TEST_ITERATIONS; uiIdx++)
+        {
+            iImageLen = ESP32BleCfgFields::EncodeImage(&AppCfgData, abImage, sizeof(abImage));
+        }
+        ulStartTime = micros() - ulStartTime;
+        ulEncodeTime = (ulStartTime < ulEncodeTime) ? ulStartTime : ulEncodeTime;
+
+        ulStartTime = micros();
+        for (uiIdx=0; uiIdx<IMAGE_TEST_ITERATIONS; uiIdx++)
+        {
+            ESP32BleCfgFields::DecodeImage(abImage, iImageLen, &AppCfgDataDecoded, abRsp);
+            uiDecodeErr += (abRsp[0] != CFG_STATUS_OK) ? 1 : 0;
+        }
+        ulStartTime = micros() - ulStartTime;
+        ulDecodeTime = (ulStartTime < ulDecodeTime) ? ulStartTime : ulDecodeTime;
+    }
+
+    HOSTTEST_CHECK(iImageLen > (CFG_IMAGE_HDR_SIZE + CFG_IMAGE_CRC_SIZE));
+    HOSTTEST_CHECK_EQ(uiDecodeErr, 0);
+    AppCfgDataDecoded.m_ui32MagicID = AppCfgData.m_ui32MagicID;
+    AppCfgDataDecoded.m_ui32Crc32   = AppCfgData.m_ui32Crc32;
+    HOSTTEST_CHECK(memcmp(&AppCfgDataDecoded, &AppCfgData, sizeof(AppCfgData)) == 0);
+
+    ulEncodeTime = (ulEncodeTime == 0) ? 1 : ulEncodeTime;
+    ulDecodeTime = (ulDecodeTime == 0) ? 1 : ulDecodeTime;
+    HostTestReportThroughput("-> EncodeImage() throughput", (uint32_t)(((uint64_t)iImageLen * IMAGE_TEST_ITERATIONS * 1000000) / ulEncodeTime));
+    HostTestReportThroughput("-> DecodeImage() throughput", (uint32_t)(((uint64_t)iImageLen * IMAGE_TEST_ITERATIONS * 1000000) / ulDecodeTime));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestImageRoundTrip);
+    HOSTTEST_RUN(TestImageEncodeBuffer);
+    HOSTTEST_RUN(TestImageInvalidVersion);
+    HOSTTEST_RUN(TestImageCrcError);
+    HOSTTEST_RUN(TestImageDuplicateField);
+    HOSTTEST_RUN(TestImageWriteSave);
+    HOSTTEST_RUN(TestImageThroughput);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
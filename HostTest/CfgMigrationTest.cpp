@@ -0,0 +1,397 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Layout Migration of the Configuration Data
+                in EEPROM (ESP32BleAppCfgData)
+
+  -------------------------------------------------------------------------
+
+    - One fixture per historical EEPROM layout: the raw EEPROM content as
+      written by the corresponding firmware version, frozen as byte
+      arrays (they must never be regenerated from the current code).
+    - Each fixture has to be loaded with the stored values, migrated
+      images have to be written back in the current layout, so that the
+      next boot loads them without migration.
+    - Images of a newer layout version or with a wrong CRC keep the
+      default data untouched.
+    - When APP_CFG_LAYOUT_VERSION is incremented, a fixture of the new
+      layout has to be added (checked by TestFixturesCoverAllLayouts).
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleAppCfgData.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define MIGRATION_TEST_EEPROM_SIZE      512                 // same as APP_EEPROM_SIZE of the sketch
+#define MIGRATION_TEST_MAGIC_ID         0x45735243          // APP_CFGDATA_MAGIC_ID of the sketch
+#define MIGRATION_TEST_MAX_SEGMENTS     3
+
+
+// Fixture: EEPROM content written by a historical firmware version
+typedef struct
+{
+
+    unsigned int    m_uiEepromAddr;
+    const uint8_t*  m_pabData;
+    unsigned int    m_uiDataSize;
+
+} tMigrationSegment;
+
+typedef struct
+{
+
+    const char*         m_pszName;
+    unsigned int        m_uiLayoutVersion;              // layout version of the stored <tAppCfgData>
+    int                 m_iExpectedLoadRes;             // return value of LoadAppCfgDataFromEeprom()
+    tMigrationSegment   m_aSegment[MIGRATION_TEST_MAX_SEGMENTS];
+
+} tMigrationFixture;
+
+
+
+//---------------------------------------------------------------------------
+//  Fixtures
+//---------------------------------------------------------------------------
+
+// Configuration stored in all fixtures:
+//   DevName "FieldDevice", SSID "SiteNet", Passwd "Secret-1234",
+//   OwnAddr "192.168.10.20:8080", OwnMode STA, Opt1/Opt3/Opt8 set,
+//   PeerAddr "192.168.10.1:5000"
+
+// Layout 0: tAppCfgData with embedded CRC32 (also the data part of layout 1)
+static  const uint8_t  abFixtureCfgData_g[] =
+{
+    0x43, 0x52, 0x73, 0x45, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x53, 0x69, 0x74, 0x65, 0x4E, 0x65, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x53, 0x65, 0x63, 0x72, 0x65, 0x74, 0x2D, 0x31, 0x32, 0x33, 0x34, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x39, 0x32, 0x2E, 0x31, 0x36, 0x38, 0x2E, 0x31, 0x30, 0x2E, 0x32,
+    0x30, 0x3A, 0x38, 0x30, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x85, 0x31, 0x39,
+    0x32, 0x2E, 0x31, 0x36, 0x38, 0x2E, 0x31, 0x30, 0x2E, 0x31, 0x3A, 0x35, 0x30, 0x30, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x90, 0xA1, 0x45
+};
+
+// Layout 1: tAppCfgImageHdr (Magic 'CfgH', Version 1, Size 186, CRC32 of the data)
+static  const uint8_t  abFixtureImageHdrV1_g[] =
+{
+    0x43, 0x66, 0x67, 0x48, 0x01, 0x00, 0xBA, 0x00, 0x54, 0xA8, 0xB1, 0xFD
+};
+
+// tAppCfgSlotCtrl (Magic 'CfgS', ActiveSlot 0, CONFIRMED, TrialRuns 0, Sequence 1)
+static  const uint8_t  abFixtureSlotCtrl_g[] =
+{
+    0x43, 0x66, 0x67, 0x53, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0x66, 0xE2
+};
+
+
+static  const tMigrationFixture  aMigrationFixture_g[] =
+{
+    // ESP32BleAppCfgData V1.00: data without header at address 0
+    {
+        "V1.00 (layout 0, no header)", 0, 2,
+        {
+            { 0,    abFixtureCfgData_g,     sizeof(abFixtureCfgData_g)      },
+        }
+    },
+
+    // ESP32BleAppCfgData V1.10: header and data at address 0
+    {
+        "V1.10 (layout 1, header)", 1, 2,
+        {
+            { 0,    abFixtureImageHdrV1_g,  sizeof(abFixtureImageHdrV1_g)   },
+            { 12,   abFixtureCfgData_g,     sizeof(abFixtureCfgData_g)      },
+        }
+    },
+
+    // ESP32BleAppCfgData V1.20: Slot Control and image in slot 0
+    {
+        "V1.20 (layout 1, A/B slots)", 1, 1,
+        {
+            { 0,    abFixtureSlotCtrl_g,    sizeof(abFixtureSlotCtrl_g)     },
+            { 16,   abFixtureImageHdrV1_g,  sizeof(abFixtureImageHdrV1_g)   },
+            { 28,   abFixtureCfgData_g,     sizeof(abFixtureCfgData_g)      },
+        }
+    },
+};
+
+#define MIGRATION_TEST_FIXTURE_CNT      (sizeof(aMigrationFixture_g) / sizeof(aMigrationFixture_g[0]))
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  void  MigrationTestLoadEeprom (const tMigrationFixture* pFixture_p)
+{
+
+uint8_t       abEeprom[MIGRATION_TEST_EEPROM_SIZE];
+unsigned int  uiIdx;
+
+    memset(abEeprom, 0xFF, sizeof(abEeprom));
+    for (uiIdx=0; uiIdx<MIGRATION_TEST_MAX_SEGMENTS; uiIdx++)
+    {
+        if (pFixture_p->m_aSegment[uiIdx].m_pabData != NULL)
+        {
+            memcpy(&abEeprom[pFixture_p->m_aSegment[uiIdx].m_uiEepromAddr],
+                   pFixture_p->m_aSegment[uiIdx].m_pabData,
+                   pFixture_p->m_aSegment[uiIdx].m_uiDataSize);
+        }
+    }
+
+    HostSimEepromLoad(abEeprom, sizeof(abEeprom));
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  MigrationTestSetDefaults (tAppCfgData* pAppCfgData_p)
+{
+
+    memset(pAppCfgData_p, 0x00, sizeof(*pAppCfgData_p));
+    pAppCfgData_p->m_ui32MagicID = MIGRATION_TEST_MAGIC_ID;
+    strcpy(pAppCfgData_p->m_szDevMntDevName, "DefaultDevice");
+    strcpy(pAppCfgData_p->m_szWifiSSID, "DefaultSSID");
+    strcpy(pAppCfgData_p->m_szWifiOwnAddr, "0.0.0.0");
+    pAppCfgData_p->m_ui8WifiOwnMode = WIFI_OPMODE_AP;
+    strcpy(pAppCfgData_p->m_szAppRtPeerAddr, "0.0.0.0");
+
+}
+
+//---------------------------------------------------------------------------
+
+static  bool  MigrationTestIsDefault (const tAppCfgData* pAppCfgData_p)
+{
+
+tAppCfgData  DefaultCfgData;
+
+    MigrationTestSetDefaults(&DefaultCfgData);
+    return (memcmp(pAppCfgData_p, &DefaultCfgData, sizeof(DefaultCfgData)) == 0);
+
+}
+
+//---------------------------------------------------------------------------
+//  Checks the values stored in the fixtures
+//---------------------------------------------------------------------------
+
+static  void  MigrationTestCheckValues (const tAppCfgData* pAppCfgData_p)
+{
+
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_ui32MagicID, MIGRATION_TEST_MAGIC_ID);
+    HOSTTEST_CHECK(strcmp(pAppCfgData_p->m_szDevMntDevName, "FieldDevice") == 0);
+    HOSTTEST_CHECK(strcmp(pAppCfgData_p->m_szWifiSSID, "SiteNet") == 0);
+    HOSTTEST_CHECK(strcmp(pAppCfgData_p->m_szWifiPasswd, "Secret-1234") == 0);
+    HOSTTEST_CHECK(strcmp(pAppCfgData_p->m_szWifiOwnAddr, "192.168.10.20:8080") == 0);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_ui8WifiOwnMode, WIFI_OPMODE_STA);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt1, 1);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt2, 0);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt3, 1);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt4, 0);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt5, 0);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt6, 0);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt7, 0);
+    HOSTTEST_CHECK_EQ(pAppCfgData_p->m_fAppRtOpt8, 1);
+    HOSTTEST_CHECK(strcmp(pAppCfgData_p->m_szAppRtPeerAddr, "192.168.10.1:5000") == 0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+// Every layout version from 0 to APP_CFG_LAYOUT_VERSION needs a fixture
+static  void  TestFixturesCoverAllLayouts ()
+{
+
+bool          afCovered[APP_CFG_LAYOUT_VERSION + 1];
+unsigned int  uiIdx;
+
+    memset(afCovered, 0x00, sizeof(afCovered));
+    for (uiIdx=0; uiIdx<MIGRATION_TEST_FIXTURE_CNT; uiIdx++)
+    {
+        HOSTTEST_CHECK(aMigrationFixture_g[uiIdx].m_uiLayoutVersion <= APP_CFG_LAYOUT_VERSION);
+        if (aMigrationFixture_g[uiIdx].m_uiLayoutVersion <= APP_CFG_LAYOUT_VERSION)
+        {
+            afCovered[aMigrationFixture_g[uiIdx].m_uiLayoutVersion] = true;
+        }
+    }
+
+    for (uiIdx=0; uiIdx<=APP_CFG_LAYOUT_VERSION; uiIdx++)
+    {
+        if ( !afCovered[uiIdx] )
+        {
+            fprintf(stderr, "  no fixture for layout version %u\n", uiIdx);
+        }
+        HOSTTEST_CHECK(afCovered[uiIdx]);
+    }
+
+    // all fixtures hold data of the same size
+    HOSTTEST_CHECK_EQ(sizeof(abFixtureCfgData_g), sizeof(tAppCfgData));
+
+}
+
+// Each fixture is loaded with the stored values and written back in the current layout
+static  void  TestLoadFixtures ()
+{
+
+tAppCfgData   AppCfgData;
+unsigned int  uiIdx;
+int           iRes;
+
+    for (uiIdx=0; uiIdx<MIGRATION_TEST_FIXTURE_CNT; uiIdx++)
+    {
+        ESP32BleAppCfgData  AppCfgDataBoot1(MIGRATION_TEST_EEPROM_SIZE);
+        ESP32BleAppCfgData  AppCfgDataBoot2(MIGRATION_TEST_EEPROM_SIZE);
+
+        MigrationTestLoadEeprom(&aMigrationFixture_g[uiIdx]);
+
+        // 1st boot with the current firmware: migration (if required)
+        MigrationTestSetDefaults(&AppCfgData);
+        iRes = AppCfgDataBoot1.LoadAppCfgDataFromEeprom(&AppCfgData);
+        if (iRes != aMigrationFixture_g[uiIdx].m_iExpectedLoadRes)
+        {
+            fprintf(stderr, "  fixture %s\n", aMigrationFixture_g[uiIdx].m_pszName);
+        }
+        HOSTTEST_CHECK_EQ(iRes, aMigrationFixture_g[uiIdx].m_iExpectedLoadRes);
+        MigrationTestCheckValues(&AppCfgData);
+
+        // 2nd boot: image is already in the current layout
+        MigrationTestSetDefaults(&AppCfgData);
+        iRes = AppCfgDataBoot2.LoadAppCfgDataFromEeprom(&AppCfgData);
+        HOSTTEST_CHECK_EQ(iRes, 1);
+        MigrationTestCheckValues(&AppCfgData);
+    }
+
+}
+
+// A migrated configuration can be saved and confirmed like any other
+static  void  TestSaveAfterMigration ()
+{
+
+ESP32BleAppCfgData  AppCfgDataBoot1(MIGRATION_TEST_EEPROM_SIZE);
+ESP32BleAppCfgData  AppCfgDataBoot2(MIGRATION_TEST_EEPROM_SIZE);
+tAppCfgData         AppCfgData;
+
+    MigrationTestLoadEeprom(&aMigrationFixture_g[0]);
+
+    MigrationTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(AppCfgDataBoot1.LoadAppCfgDataFromEeprom(&AppCfgData), 2);
+    strcpy(AppCfgData.m_szWifiSSID, "NewSiteNet");
+    HOSTTEST_CHECK_EQ(AppCfgDataBoot1.SaveAppCfgDataToEeprom(&AppCfgData), 1);
+    HOSTTEST_CHECK_EQ(AppCfgDataBoot1.ConfirmAppCfgData(), 1);
+
+    MigrationTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(AppCfgDataBoot2.LoadAppCfgDataFromEeprom(&AppCfgData), 1);
+    HOSTTEST_CHECK(strcmp(AppCfgData.m_szWifiSSID, "NewSiteNet") == 0);
+    HOSTTEST_CHECK(strcmp(AppCfgData.m_szDevMntDevName, "FieldDevice") == 0);
+
+}
+
+// Image of a newer firmware (unknown layout version): defaults are kept, EEPROM is not touched
+static  void  TestNewerLayoutRejected ()
+{
+
+ESP32BleAppCfgData  AppCfgDataBoot(MIGRATION_TEST_EEPROM_SIZE);
+tMigrationFixture   Fixture;
+uint8_t             abImageHdr[sizeof(abFixtureImageHdrV1_g)];
+uint8_t             abEeprom[MIGRATION_TEST_EEPROM_SIZE];
+tAppCfgData         AppCfgData;
+
+    memcpy(abImageHdr, abFixtureImageHdrV1_g, sizeof(abImageHdr));
+    abImageHdr[offsetof(tAppCfgImageHdr, m_ui16LayoutVersion)] = APP_CFG_LAYOUT_VERSION + 1;
+
+    memcpy(&Fixture, &aMigrationFixture_g[2], sizeof(Fixture));
+    Fixture.m_aSegment[1].m_pabData = abImageHdr;
+    MigrationTestLoadEeprom(&Fixture);
+    memcpy(abEeprom, HostSimEepromGetData(NULL), sizeof(abEeprom));
+
+    MigrationTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(AppCfgDataBoot.LoadAppCfgDataFromEeprom(&AppCfgData), 0);
+    HOSTTEST_CHECK(MigrationTestIsDefault(&AppCfgData));
+    HOSTTEST_CHECK(memcmp(abEeprom, HostSimEepromGetData(NULL), sizeof(abEeprom)) == 0);
+
+}
+
+// Corrupted image of each fixture: defaults are kept
+static  void  TestCorruptedFixtures ()
+{
+
+tMigrationFixture   Fixture;
+uint8_t             abCfgData[sizeof(abFixtureCfgData_g)];
+tAppCfgData         AppCfgData;
+unsigned int        uiIdx;
+unsigned int        uiSeg;
+
+    memcpy(abCfgData, abFixtureCfgData_g, sizeof(abCfgData));
+    abCfgData[offsetof(tAppCfgData, m_szWifiSSID)] ^= 0x01;
+
+    for (uiIdx=0; uiIdx<MIGRATION_TEST_FIXTURE_CNT; uiIdx++)
+    {
+        ESP32BleAppCfgData  AppCfgDataBoot(MIGRATION_TEST_EEPROM_SIZE);
+
+        memcpy(&Fixture, &aMigrationFixture_g[uiIdx], sizeof(Fixture));
+        for (uiSeg=0; uiSeg<MIGRATION_TEST_MAX_SEGMENTS; uiSeg++)
+        {
+            if (Fixture.m_aSegment[uiSeg].m_pabData == abFixtureCfgData_g)
+            {
+                Fixture.m_aSegment[uiSeg].m_pabData = abCfgData;
+            }
+        }
+        MigrationTestLoadEeprom(&Fixture);
+
+        MigrationTestSetDefaults(&AppCfgData);
+        HOSTTEST_CHECK_EQ(AppCfgDataBoot.LoadAppCfgDataFromEeprom(&AppCfgData), 0);
+        HOSTTEST_CHECK(MigrationTestIsDefault(&AppCfgData));
+    }
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestFixturesCoverAllLayouts);
+    HOSTTEST_RUN(TestLoadFixtures);
+    HOSTTEST_RUN(TestSaveAfterMigration);
+    HOSTTEST_RUN(TestNewerLayoutRejected);
+    HOSTTEST_RUN(TestCorruptedFixtures);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
@@ -0,0 +1,299 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Config Patch via [DevMnt/ConfigPatch]
+
+  -------------------------------------------------------------------------
+
+    - Writes Config Patches through the simulated BLE client with both
+      GATT backends and checks the notified response, the resulting
+      configuration and the calls of the Save Config callback handler.
+    - A failed save (callback handler returns < 0) has to be reported as
+      CFG_STATUS_SAVE_ERROR, a patch repeating a Field ID is rejected.
+    - Values written by the client (single characteristic or patch without
+      commit) reach the subscribers of ESP32BleCfgView before they are saved.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleCfgView.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+// UUIDs (see BleProfileDefinition.txt)
+static  const char*  PATCH_TEST_UUID_CFGPATCH   = "00001800-0000-1000-8000-E776CC14FE69";
+static  const char*  PATCH_TEST_UUID_WIFI_SSID  = "00002100-0000-1000-8000-E776CC14FE69";
+
+static  const uint8_t  aui8GattBackend_g[] = { BLE_GATT_BACKEND_OBJECTS, BLE_GATT_BACKEND_ATTR_TABLE };
+
+
+
+//---------------------------------------------------------------------------
+//  Local Variables
+//---------------------------------------------------------------------------
+
+static  unsigned int    uiCfgChangedCalls_g     = 0;
+static  uint8_t         ui8CfgChangedField_g    = 0;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  void  AppCbHdlrCfgChanged (uint8_t ui8FieldId_p)
+{
+    uiCfgChangedCalls_g++;
+    ui8CfgChangedField_g = ui8FieldId_p;
+}
+
+//---------------------------------------------------------------------------
+
+static  int  PatchTestSetup (uint8_t ui8GattBackend_p, int iSaveResult_p)
+{
+
+tHostTestProfileParam  Param = { "PatchTestDevice", NULL, ui8GattBackend_p, 247, iSaveResult_p };
+tAppCfgData            AppCfgData;
+
+    memset(&AppCfgData, 0x00, sizeof(AppCfgData));
+    strcpy(AppCfgData.m_szDevMntDevName, Param.m_pszDevName);
+    strcpy(AppCfgData.m_szWifiSSID, "OldSSID");
+    AppCfgData.m_ui8WifiOwnMode = WIFI_OPMODE_STA;
+    Param.m_pAppCfgData = &AppCfgData;
+
+    return ((HostTestProfileSetup(&Param) < 0) ? -1 : 0);
+
+}
+
+//---------------------------------------------------------------------------
+//  Writes a patch, returns the notified response (Status, ErrEntryIdx, AppliedEntries)
+//---------------------------------------------------------------------------
+
+static  bool  PatchTestWrite (const uint8_t* pabPatch_p, size_t PatchLen_p, uint8_t abRsp_p[CFG_PATCH_RSP_SIZE])
+{
+
+unsigned int  uiNotifyCnt;
+
+    uiNotifyCnt = HostSimBleGetNotifyCount(PATCH_TEST_UUID_CFGPATCH);
+    HostSimBleWrite(PATCH_TEST_UUID_CFGPATCH, pabPatch_p, PatchLen_p);
+    if (HostSimBleGetNotifyCount(PATCH_TEST_UUID_CFGPATCH) != (uiNotifyCnt + 1))
+    {
+        return (false);
+    }
+
+    return (HostSimBleGetLastNotify(PATCH_TEST_UUID_CFGPATCH, abRsp_p, CFG_PATCH_RSP_SIZE) == CFG_PATCH_RSP_SIZE);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  bool  PatchTestCheckSsid (const char* pszSsid_p)
+{
+
+char  szSsid[64];
+int   iLen;
+
+    iLen = HostSimBleRead(PATCH_TEST_UUID_WIFI_SSID, szSsid, sizeof(szSsid) - 1);
+    if (iLen < 0)
+    {
+        return (false);
+    }
+    szSsid[iLen] = '\0';
+
+    return (strcmp(szSsid, pszSsid_p) == 0);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+static  void  TestPatchCommitSaved ()
+{
+
+static  const uint8_t  abPatch[] = { CFG_PATCH_FLAG_COMMIT, CFG_FIELD_WIFI_SSID, 7, 'N', 'e', 'w', 'S', 'S', 'I', 'D',
+                                     CFG_FIELD_APP_RT_OPT3, 1, 1 };
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<sizeof(aui8GattBackend_g); uiIdx++)
+    {
+        HOSTTEST_CHECK_EQ(PatchTestSetup(aui8GattBackend_g[uiIdx], 0), 0);
+
+        HOSTTEST_CHECK(PatchTestWrite(abPatch, sizeof(abPatch), abRsp));
+        HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_OK);
+        HOSTTEST_CHECK_EQ(abRsp[1], CFG_PATCH_NO_ENTRY_IDX);
+        HOSTTEST_CHECK_EQ(abRsp[2], 2);
+        HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiSaveCalls, 1);
+        HOSTTEST_CHECK(strcmp(HostTestProfileEvents_g.m_SavedCfgData.m_szWifiSSID, "NewSSID") == 0);
+        HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_SavedCfgData.m_fAppRtOpt3, 1);
+        HOSTTEST_CHECK(PatchTestCheckSsid("NewSSID"));
+
+        HostTestProfileShutdown();
+    }
+
+}
+
+// Save Config callback fails: the Client has to get CFG_STATUS_SAVE_ERROR
+static  void  TestPatchCommitSaveError ()
+{
+
+static  const uint8_t  abPatch[] = { CFG_PATCH_FLAG_COMMIT, CFG_FIELD_WIFI_SSID, 7, 'N', 'e', 'w', 'S', 'S', 'I', 'D' };
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<sizeof(aui8GattBackend_g); uiIdx++)
+    {
+        HOSTTEST_CHECK_EQ(PatchTestSetup(aui8GattBackend_g[uiIdx], -3), 0);
+
+        HOSTTEST_CHECK(PatchTestWrite(abPatch, sizeof(abPatch), abRsp));
+        HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_SAVE_ERROR);
+        HOSTTEST_CHECK_EQ(abRsp[1], CFG_PATCH_NO_ENTRY_IDX);
+        HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiSaveCalls, 1);
+
+        HostTestProfileShutdown();
+    }
+
+}
+
+// Without commit flag the Save Config callback is not called
+static  void  TestPatchWithoutCommit ()
+{
+
+static  const uint8_t  abPatch[] = { 0, CFG_FIELD_WIFI_SSID, 7, 'N', 'e', 'w', 'S', 'S', 'I', 'D' };
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<sizeof(aui8GattBackend_g); uiIdx++)
+    {
+        HOSTTEST_CHECK_EQ(PatchTestSetup(aui8GattBackend_g[uiIdx], -3), 0);
+
+        HOSTTEST_CHECK(PatchTestWrite(abPatch, sizeof(abPatch), abRsp));
+        HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_OK);
+        HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiSaveCalls, 0);
+        HOSTTEST_CHECK(PatchTestCheckSsid("NewSSID"));
+
+        HostTestProfileShutdown();
+    }
+
+}
+
+// Same Field ID twice: rejected at the repeated entry, nothing applied or saved
+static  void  TestPatchDuplicateField ()
+{
+
+static  const uint8_t  abPatch[] = { CFG_PATCH_FLAG_COMMIT, CFG_FIELD_APP_RT_OPT1, 1, 1,
+                                     CFG_FIELD_WIFI_SSID, 1, 'A',
+                                     CFG_FIELD_WIFI_SSID, 1, 'B' };
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<sizeof(aui8GattBackend_g); uiIdx++)
+    {
+        HOSTTEST_CHECK_EQ(PatchTestSetup(aui8GattBackend_g[uiIdx], 0), 0);
+
+        HOSTTEST_CHECK(PatchTestWrite(abPatch, sizeof(abPatch), abRsp));
+        HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_DUPLICATE_FIELD);
+        HOSTTEST_CHECK_EQ(abRsp[1], 2);
+        HOSTTEST_CHECK_EQ(abRsp[2], 0);
+        HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiSaveCalls, 0);
+        HOSTTEST_CHECK(PatchTestCheckSsid("OldSSID"));
+
+        HostTestProfileShutdown();
+    }
+
+}
+
+
+
+// Values written by the client are published to ESP32BleCfgView without SaveConfig
+static  void  TestValueWritePublished ()
+{
+
+static  const char     szSsid[]   = "ViewSSID";
+static  const uint8_t  abPatch[]  = { 0, CFG_FIELD_WIFI_SSID, 8, 'P', 'a', 't', 'c', 'h', 'S', 'S', 'I' };
+tAppCfgData   AppCfgData;
+char          szViewSsid[64];
+uint8_t       abRsp[CFG_PATCH_RSP_SIZE];
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<sizeof(aui8GattBackend_g); uiIdx++)
+    {
+        HOSTTEST_CHECK_EQ(PatchTestSetup(aui8GattBackend_g[uiIdx], 0), 0);
+
+        // initial configuration published by the sketch
+        HOSTTEST_CHECK(ESP32BleCfgProfile::ExportInstanceWorkspace(&AppCfgData) >= 0);
+        ESP32BleCfgView::Publish(&AppCfgData);
+        ESP32BleCfgView::DispatchChanges();
+        HOSTTEST_CHECK_EQ(ESP32BleCfgView::Subscribe(CFG_FIELD_WIFI_SSID, AppCbHdlrCfgChanged), 0);
+        uiCfgChangedCalls_g = 0;
+
+        // single characteristic: dispatched with the next loop tick, once
+        HOSTTEST_CHECK_EQ(HostSimBleWrite(PATCH_TEST_UUID_WIFI_SSID, szSsid, strlen(szSsid)), 0);
+        HOSTTEST_CHECK(ESP32BleCfgView::GetPendingChanges() != 0);
+        ESP32BleCfgView::DispatchChanges();
+        ESP32BleCfgView::DispatchChanges();
+        HOSTTEST_CHECK_EQ(uiCfgChangedCalls_g, 1);
+        HOSTTEST_CHECK_EQ(ui8CfgChangedField_g, CFG_FIELD_WIFI_SSID);
+        HOSTTEST_CHECK(ESP32BleCfgView::GetString(CFG_FIELD_WIFI_SSID, szViewSsid, sizeof(szViewSsid)) >= 0);
+        HOSTTEST_CHECK(strcmp(szViewSsid, szSsid) == 0);
+
+        // patch without commit
+        HOSTTEST_CHECK(PatchTestWrite(abPatch, sizeof(abPatch), abRsp));
+        HOSTTEST_CHECK_EQ(abRsp[0], CFG_STATUS_OK);
+        ESP32BleCfgView::DispatchChanges();
+        HOSTTEST_CHECK_EQ(uiCfgChangedCalls_g, 2);
+        HOSTTEST_CHECK(ESP32BleCfgView::GetString(CFG_FIELD_WIFI_SSID, szViewSsid, sizeof(szViewSsid)) >= 0);
+        HOSTTEST_CHECK(strcmp(szViewSsid, "PatchSSI") == 0);
+        HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiSaveCalls, 0);
+
+        ESP32BleCfgView::Unsubscribe(AppCbHdlrCfgChanged);
+        HostTestProfileShutdown();
+    }
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestPatchCommitSaved);
+    HOSTTEST_RUN(TestPatchCommitSaveError);
+    HOSTTEST_RUN(TestPatchWithoutCommit);
+    HOSTTEST_RUN(TestPatchDuplicateField);
+    HOSTTEST_RUN(TestValueWritePublished);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
@@ -0,0 +1,445 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Storage Backends (ESP32BleCfgStorage)
+
+  -------------------------------------------------------------------------
+
+    - Load(), LoadField(), Save() and Clear() of the EEPROM, NVS and RAM
+      backends: LoadField() has to change only the requested field.
+    - NVS backend: keys are read lazily (LoadField() reads one key, each
+      key is read only once), Save() writes only modified keys and
+      commits only if a key was written.
+    - RTC Cache in front of the RAM backend: after a wake from deep sleep
+      the data has to be served from RTC memory without backend access.
+    - RTC Cache in front of the EEPROM backend: data on trial is never
+      served from RTC memory, a wake from deep sleep during the trial run
+      has to roll back to the previous data.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgFields.h"
+#include "ESP32BleAppCfgData.h"
+#include "ESP32BleCfgStorage.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define STORAGE_TEST_EEPROM_SIZE        512
+#define STORAGE_TEST_NVS_NAMESPACE      "StorageTest"
+#define STORAGE_TEST_FIELD_CNT          14              // number of fields of <tAppCfgData>
+#define STORAGE_TEST_UNKNOWN_FIELD      0x7F
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  void  StorageTestSetDefaults (tAppCfgData* pAppCfgData_p)
+{
+
+    memset(pAppCfgData_p, 0x00, sizeof(*pAppCfgData_p));
+    strcpy(pAppCfgData_p->m_szDevMntDevName, "DefaultDevice");
+    strcpy(pAppCfgData_p->m_szWifiSSID, "DefaultSSID");
+    strcpy(pAppCfgData_p->m_szWifiOwnAddr, "0.0.0.0");
+    pAppCfgData_p->m_ui8WifiOwnMode = WIFI_OPMODE_AP;
+    strcpy(pAppCfgData_p->m_szAppRtPeerAddr, "0.0.0.0");
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  StorageTestSetValues (tAppCfgData* pAppCfgData_p, const char* pszSsid_p)
+{
+
+    StorageTestSetDefaults(pAppCfgData_p);
+    strcpy(pAppCfgData_p->m_szDevMntDevName, "StorageDevice");
+    strcpy(pAppCfgData_p->m_szWifiSSID, pszSsid_p);
+    strcpy(pAppCfgData_p->m_szWifiPasswd, "Secret-1234");
+    strcpy(pAppCfgData_p->m_szWifiOwnAddr, "192.168.10.20:8080");
+    pAppCfgData_p->m_ui8WifiOwnMode = WIFI_OPMODE_STA;
+    pAppCfgData_p->m_fAppRtOpt2 = 1;
+    pAppCfgData_p->m_fAppRtOpt7 = 1;
+    strcpy(pAppCfgData_p->m_szAppRtPeerAddr, "192.168.10.1:5000");
+
+}
+
+//---------------------------------------------------------------------------
+//  Compares the values of all fields (the NVS backend stores the fields
+//  only, neither MagicID/CRC nor the bytes behind the end of a string)
+//---------------------------------------------------------------------------
+
+static  bool  StorageTestIsEqual (const tAppCfgData* pAppCfgData1_p, const tAppCfgData* pAppCfgData2_p)
+{
+
+const tCfgFieldDescr*  pFieldDescr;
+uint8_t                abValue1[UINT8_MAX];
+uint8_t                abValue2[UINT8_MAX];
+unsigned int           uiFieldIdx;
+int                    iValueLen1;
+int                    iValueLen2;
+
+    for (uiFieldIdx=0; (pFieldDescr = ESP32BleCfgFields::GetFieldDescrByIdx(uiFieldIdx)) != NULL; uiFieldIdx++)
+    {
+        iValueLen1 = ESP32BleCfgFields::GetField(pAppCfgData1_p, pFieldDescr->m_ui8FieldId, abValue1, sizeof(abValue1));
+        iValueLen2 = ESP32BleCfgFields::GetField(pAppCfgData2_p, pFieldDescr->m_ui8FieldId, abValue2, sizeof(abValue2));
+        if ((iValueLen1 < 0) || (iValueLen1 != iValueLen2) || (memcmp(abValue1, abValue2, iValueLen1) != 0))
+        {
+            fprintf(stderr, "  field 0x%02X differs\n", pFieldDescr->m_ui8FieldId);
+            return (false);
+        }
+    }
+
+    return (true);
+
+}
+
+//---------------------------------------------------------------------------
+//  LoadField() of the peer address into default data: only this field changes
+//---------------------------------------------------------------------------
+
+static  void  StorageTestCheckLoadField (ESP32BleCfgStorage* pStorage_p)
+{
+
+tAppCfgData  AppCfgData;
+tAppCfgData  ExpectedCfgData;
+
+    StorageTestSetDefaults(&AppCfgData);
+    StorageTestSetDefaults(&ExpectedCfgData);
+    strcpy(ExpectedCfgData.m_szAppRtPeerAddr, "192.168.10.1:5000");
+
+    HOSTTEST_CHECK_EQ(pStorage_p->LoadField(CFG_FIELD_APP_RT_PEERADDR, &AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &ExpectedCfgData));
+
+    HOSTTEST_CHECK_EQ(pStorage_p->LoadField(STORAGE_TEST_UNKNOWN_FIELD, &AppCfgData), -1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &ExpectedCfgData));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+static  void  TestRamBackend ()
+{
+
+ESP32BleCfgStorageRam  StorageRam;
+tAppCfgData            AppCfgData;
+tAppCfgData            SavedCfgData;
+tAppCfgData            DefaultCfgData;
+
+    StorageTestSetDefaults(&DefaultCfgData);
+
+    // nothing saved yet -> defaults untouched
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageRam.Load(&AppCfgData), 0);
+    HOSTTEST_CHECK_EQ(StorageRam.LoadField(CFG_FIELD_WIFI_SSID, &AppCfgData), 0);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &DefaultCfgData));
+
+    StorageTestSetValues(&SavedCfgData, "RamSSID");
+    HOSTTEST_CHECK_EQ(StorageRam.Save(&SavedCfgData), 1);
+
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageRam.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &SavedCfgData));
+
+    StorageTestCheckLoadField(&StorageRam);
+
+    HOSTTEST_CHECK_EQ(StorageRam.Clear(), 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageRam.Load(&AppCfgData), 0);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &DefaultCfgData));
+
+}
+
+// EEPROM backend: the image is read as a whole, LoadField() copies one field only
+static  void  TestEepromBackend ()
+{
+
+ESP32BleAppCfgData        AppCfgDataBoot1(STORAGE_TEST_EEPROM_SIZE);
+ESP32BleAppCfgData        AppCfgDataBoot2(STORAGE_TEST_EEPROM_SIZE);
+ESP32BleCfgStorageEeprom  StorageBoot1(&AppCfgDataBoot1);
+ESP32BleCfgStorageEeprom  StorageBoot2(&AppCfgDataBoot2);
+tAppCfgData               AppCfgData;
+tAppCfgData               SavedCfgData;
+tAppCfgData               DefaultCfgData;
+
+    StorageTestSetDefaults(&DefaultCfgData);
+
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageBoot1.LoadField(CFG_FIELD_APP_RT_PEERADDR, &AppCfgData), 0);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &DefaultCfgData));
+
+    StorageTestSetValues(&SavedCfgData, "EepromSSID");
+    HOSTTEST_CHECK_EQ(StorageBoot1.Save(&SavedCfgData), 1);
+
+    StorageTestCheckLoadField(&StorageBoot2);
+
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageBoot2.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &SavedCfgData));
+
+    HOSTTEST_CHECK_EQ(StorageBoot2.Clear(), 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageBoot2.Load(&AppCfgData), 0);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &DefaultCfgData));
+
+}
+
+// NVS backend: one handle, keys are read on first access only
+static  void  TestNvsLazyLoad ()
+{
+
+tHostSimNvsStats  NvsStats;
+tHostSimNvsStats  NvsStatsBase;
+tAppCfgData       AppCfgData;
+tAppCfgData       SavedCfgData;
+
+    {
+        ESP32BleCfgStorageNvs  StorageBoot1(STORAGE_TEST_NVS_NAMESPACE);
+
+        StorageTestSetValues(&SavedCfgData, "NvsSSID");
+        HOSTTEST_CHECK_EQ(StorageBoot1.Save(&SavedCfgData), 1);
+    }
+
+    ESP32BleCfgStorageNvs  StorageBoot2(STORAGE_TEST_NVS_NAMESPACE);
+
+    HostSimGetNvsStats(&NvsStatsBase);
+
+    // LoadField() reads the requested key only
+    StorageTestCheckLoadField(&StorageBoot2);
+    HostSimGetNvsStats(&NvsStats);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiOpenCalls - NvsStatsBase.m_uiOpenCalls, 1);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiGetCalls - NvsStatsBase.m_uiGetCalls, 1);
+
+    // Load() reads the remaining keys, the peer address is not read again
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageBoot2.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &SavedCfgData));
+    HostSimGetNvsStats(&NvsStats);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiOpenCalls - NvsStatsBase.m_uiOpenCalls, 1);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiGetCalls - NvsStatsBase.m_uiGetCalls, STORAGE_TEST_FIELD_CNT);
+
+    // further loads are served from the shadow copy
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageBoot2.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &SavedCfgData));
+    HostSimGetNvsStats(&NvsStats);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiGetCalls - NvsStatsBase.m_uiGetCalls, STORAGE_TEST_FIELD_CNT);
+
+}
+
+// NVS backend: Save() writes modified keys only
+static  void  TestNvsWritesModifiedKeys ()
+{
+
+ESP32BleCfgStorageNvs  StorageNvs(STORAGE_TEST_NVS_NAMESPACE);
+tHostSimNvsStats       NvsStats;
+tHostSimNvsStats       NvsStatsBase;
+tAppCfgData            AppCfgData;
+tAppCfgData            DefaultCfgData;
+
+    // nothing saved yet -> defaults untouched, all keys written by the first save
+    StorageTestSetDefaults(&DefaultCfgData);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageNvs.Load(&AppCfgData), 0);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &DefaultCfgData));
+
+    HostSimGetNvsStats(&NvsStatsBase);
+    StorageTestSetValues(&AppCfgData, "NvsSSID");
+    HOSTTEST_CHECK_EQ(StorageNvs.Save(&AppCfgData), 1);
+    HostSimGetNvsStats(&NvsStats);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiSetCalls - NvsStatsBase.m_uiSetCalls, STORAGE_TEST_FIELD_CNT);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiCommitCalls - NvsStatsBase.m_uiCommitCalls, 1);
+
+    // one modified field -> one key
+    HostSimGetNvsStats(&NvsStatsBase);
+    strcpy(AppCfgData.m_szWifiSSID, "OtherSSID");
+    HOSTTEST_CHECK_EQ(StorageNvs.Save(&AppCfgData), 1);
+    HostSimGetNvsStats(&NvsStats);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiSetCalls - NvsStatsBase.m_uiSetCalls, 1);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiCommitCalls - NvsStatsBase.m_uiCommitCalls, 1);
+
+    // unchanged data -> no write, no commit
+    HostSimGetNvsStats(&NvsStatsBase);
+    HOSTTEST_CHECK_EQ(StorageNvs.Save(&AppCfgData), 1);
+    HostSimGetNvsStats(&NvsStats);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiSetCalls - NvsStatsBase.m_uiSetCalls, 0);
+    HOSTTEST_CHECK_EQ(NvsStats.m_uiCommitCalls - NvsStatsBase.m_uiCommitCalls, 0);
+
+    // after Clear() all keys are missing again
+    HOSTTEST_CHECK_EQ(StorageNvs.Clear(), 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(StorageNvs.Load(&AppCfgData), 0);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &DefaultCfgData));
+
+}
+
+// RTC Cache: served from RTC memory after deep sleep, from the backend otherwise
+static  void  TestRtcCache ()
+{
+
+ESP32BleCfgStorageRam       StorageRam;
+ESP32BleCfgStorageRtcCache  CacheBoot1;
+ESP32BleCfgStorageRtcCache  CacheBoot2;
+ESP32BleCfgStorageRtcCache  CacheBoot3;
+tCfgRtcCacheInfo            CacheInfo;
+tAppCfgData                 AppCfgData;
+tAppCfgData                 CachedCfgData;
+tAppCfgData                 BackendCfgData;
+
+    CacheBoot1.Invalidate();
+
+    // cold boot -> loaded from backend, cache refilled
+    StorageTestSetValues(&CachedCfgData, "CachedSSID");
+    HOSTTEST_CHECK_EQ(StorageRam.Save(&CachedCfgData), 1);
+    CacheBoot1.SetBackend(&StorageRam, 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot1.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &CachedCfgData));
+    HOSTTEST_CHECK(CacheBoot1.GetCacheInfo(&CacheInfo));
+    HOSTTEST_CHECK(!CacheInfo.m_fCacheHit);
+
+    // the RAM backend has no trial run -> data confirmed immediately
+    HOSTTEST_CHECK_EQ(CacheBoot1.BeginTrialRun(), 0);
+
+    // backend modified behind the cache: a hit still returns the cached data
+    StorageTestSetValues(&BackendCfgData, "BackendSSID");
+    HOSTTEST_CHECK_EQ(StorageRam.Save(&BackendCfgData), 1);
+
+    // wake from deep sleep -> served from RTC memory
+    HostSimSetResetReason(ESP_RST_DEEPSLEEP);
+    CacheBoot2.SetBackend(&StorageRam, 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot2.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &CachedCfgData));
+    HOSTTEST_CHECK(CacheBoot2.GetCacheInfo(&CacheInfo));
+    HOSTTEST_CHECK(CacheInfo.m_fCacheHit);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot2.LoadField(CFG_FIELD_WIFI_SSID, &AppCfgData), 1);
+    HOSTTEST_CHECK(strcmp(AppCfgData.m_szWifiSSID, "CachedSSID") == 0);
+
+    // other generation (e.g. new firmware) -> loaded from backend
+    CacheBoot3.SetBackend(&StorageRam, 2);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot3.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &BackendCfgData));
+    HOSTTEST_CHECK(CacheBoot3.GetCacheInfo(&CacheInfo));
+    HOSTTEST_CHECK(!CacheInfo.m_fCacheHit);
+
+    // write-through
+    StorageTestSetValues(&AppCfgData, "SavedSSID");
+    HOSTTEST_CHECK_EQ(CacheBoot3.Save(&AppCfgData), 1);
+    StorageTestSetDefaults(&BackendCfgData);
+    HOSTTEST_CHECK_EQ(StorageRam.Load(&BackendCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&BackendCfgData, &AppCfgData));
+
+    CacheBoot3.Invalidate();
+
+}
+
+// RTC Cache: a wake from deep sleep during the trial run rolls back to the known-good data
+static  void  TestRtcCacheDeepSleepDuringTrial ()
+{
+
+ESP32BleAppCfgData          AppCfgDataBoot1(STORAGE_TEST_EEPROM_SIZE);
+ESP32BleAppCfgData          AppCfgDataBoot2(STORAGE_TEST_EEPROM_SIZE);
+ESP32BleAppCfgData          AppCfgDataBoot3(STORAGE_TEST_EEPROM_SIZE);
+ESP32BleCfgStorageEeprom    StorageBoot1(&AppCfgDataBoot1);
+ESP32BleCfgStorageEeprom    StorageBoot2(&AppCfgDataBoot2);
+ESP32BleCfgStorageEeprom    StorageBoot3(&AppCfgDataBoot3);
+ESP32BleCfgStorageRtcCache  CacheBoot1;
+ESP32BleCfgStorageRtcCache  CacheBoot2;
+ESP32BleCfgStorageRtcCache  CacheBoot3;
+tCfgRtcCacheInfo            CacheInfo;
+tAppCfgData                 AppCfgData;
+tAppCfgData                 GoodCfgData;
+tAppCfgData                 BadCfgData;
+
+    CacheBoot1.Invalidate();
+
+    // known-good data (first save, nothing to roll back to -> confirmed),
+    // then new data on trial (e.g. a wrong WiFi password)
+    CacheBoot1.SetBackend(&StorageBoot1, 1);
+    StorageTestSetValues(&GoodCfgData, "GoodSSID");
+    HOSTTEST_CHECK_EQ(CacheBoot1.Save(&GoodCfgData), 1);
+    HOSTTEST_CHECK_EQ(CacheBoot1.BeginTrialRun(), 0);
+    StorageTestSetValues(&BadCfgData, "BadSSID");
+    HOSTTEST_CHECK_EQ(CacheBoot1.Save(&BadCfgData), 1);
+
+    // restart -> trial run of the new data starts
+    CacheBoot2.SetBackend(&StorageBoot2, 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot2.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &BadCfgData));
+    HOSTTEST_CHECK_EQ(CacheBoot2.BeginTrialRun(), 1);
+
+    // deep sleep before the data is confirmed -> the backend rolls back
+    HostSimSetResetReason(ESP_RST_DEEPSLEEP);
+    CacheBoot3.SetBackend(&StorageBoot3, 1);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot3.Load(&AppCfgData), 3);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &GoodCfgData));
+    HOSTTEST_CHECK(CacheBoot3.GetCacheInfo(&CacheInfo));
+    HOSTTEST_CHECK(!CacheInfo.m_fCacheHit);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot3.LoadField(CFG_FIELD_WIFI_SSID, &AppCfgData), 1);
+    HOSTTEST_CHECK(strcmp(AppCfgData.m_szWifiSSID, "GoodSSID") == 0);
+
+    // the restored data is confirmed -> the next wake is served from RTC memory
+    HOSTTEST_CHECK_EQ(CacheBoot3.BeginTrialRun(), 0);
+    StorageTestSetDefaults(&AppCfgData);
+    HOSTTEST_CHECK_EQ(CacheBoot3.Load(&AppCfgData), 1);
+    HOSTTEST_CHECK(StorageTestIsEqual(&AppCfgData, &GoodCfgData));
+    HOSTTEST_CHECK(CacheBoot3.GetCacheInfo(&CacheInfo));
+    HOSTTEST_CHECK(CacheInfo.m_fCacheHit);
+
+    CacheBoot3.Invalidate();
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestRamBackend);
+    HOSTTEST_RUN(TestEepromBackend);
+    HOSTTEST_RUN(TestNvsLazyLoad);
+    HOSTTEST_RUN(TestNvsWritesModifiedKeys);
+    HOSTTEST_RUN(TestRtcCache);
+    HOSTTEST_RUN(TestRtcCacheDeepSleepDuringTrial);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
@@ -0,0 +1,203 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Connection Handling of the BLE Profile
+
+  -------------------------------------------------------------------------
+
+    - Connects and disconnects the simulated BLE client. As the BLE
+      library, the simulation doesn't restart advertising after a
+      disconnect, so the profile has to do it itself, otherwise the
+      device can't be reached anymore after the first session.
+    - Checks that <ProfileShutdown()> leaves the radio silent.
+    - Checks that the BLE callbacks of a session are recorded in the
+      latency histograms of the Diagnostics blob.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgStats.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define CONN_TEST_SESSIONS              3
+
+// UUIDs (see BleProfileDefinition.txt)
+static  const char*  CONN_TEST_UUID_DIAG       = "00001700-0000-1000-8000-E776CC14FE69";
+static  const char*  CONN_TEST_UUID_WIFI_SSID  = "00002100-0000-1000-8000-E776CC14FE69";
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  int  ConnTestSetup ()
+{
+
+static  const tHostTestProfileParam  Param = { "ConnTestDevice", NULL, BLE_GATT_BACKEND_OBJECTS, 0, 0 };
+
+    // the test cases connect the simulated client themselves
+    return (HostTestProfileSetup(&Param));
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Returns the Count of a histogram in a Diagnostics blob (-1 = not contained)
+//---------------------------------------------------------------------------
+
+static  long  ConnTestGetHistCount (const uint8_t* pabBlob_p, int iBlobLen_p, unsigned int uiHistID_p)
+{
+
+const uint8_t*  pabData;
+unsigned int    uiEntry;
+
+    pabData = pabBlob_p + STATS_BLOB_FIXED_SIZE;
+    for (uiEntry=0; uiEntry<pabBlob_p[1]; uiEntry++)
+    {
+        if ((pabData + STATS_BLOB_HIST_SIZE) > (pabBlob_p + iBlobLen_p))
+        {
+            return (-1);
+        }
+        if (pabData[0] == uiHistID_p)
+        {
+            return ((long)(pabData[1] | (pabData[2] << 8) | (pabData[3] << 16) | ((uint32_t)pabData[4] << 24)));
+        }
+        pabData += STATS_BLOB_HIST_SIZE;
+    }
+
+    return (-1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+static  void  TestAdvertisingAfterDisconnect ()
+{
+
+unsigned int  uiSession;
+
+    HOSTTEST_CHECK(ConnTestSetup() >= 0);
+    HOSTTEST_CHECK(HostSimBleIsAdvertising());
+
+    for (uiSession=0; uiSession<CONN_TEST_SESSIONS; uiSession++)
+    {
+        HOSTTEST_CHECK_EQ(HostSimBleConnect(), 0);
+        HOSTTEST_CHECK(HostTestProfile_g.IsBleClientConnected());
+        HOSTTEST_CHECK(!HostSimBleIsAdvertising());
+
+        // the next client must find the device again
+        HOSTTEST_CHECK_EQ(HostSimBleDisconnect(), 0);
+        HOSTTEST_CHECK(!HostTestProfile_g.IsBleClientConnected());
+        HOSTTEST_CHECK(HostSimBleIsAdvertising());
+    }
+    HOSTTEST_CHECK_EQ(HostTestProfileEvents_g.m_uiConStatChgCalls, 2 * CONN_TEST_SESSIONS);
+    HOSTTEST_CHECK(!HostTestProfileEvents_g.m_fLastConStat);
+
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileShutdown(false), 1);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  TestNoAdvertisingAfterShutdown ()
+{
+
+    HOSTTEST_CHECK(ConnTestSetup() >= 0);
+    HOSTTEST_CHECK_EQ(HostSimBleConnect(), 0);
+    HOSTTEST_CHECK_EQ(HostSimBleDisconnect(), 0);
+    HOSTTEST_CHECK(HostSimBleIsAdvertising());
+
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileShutdown(false), 1);
+    HOSTTEST_CHECK(!HostSimBleIsAdvertising());
+    HOSTTEST_CHECK(!HostTestProfile_g.IsProfileActive());
+
+    // a new session after the shutdown advertises again
+    HOSTTEST_CHECK(ConnTestSetup() >= 0);
+    HOSTTEST_CHECK(HostSimBleIsAdvertising());
+    HOSTTEST_CHECK_EQ(HostSimBleConnect(), 0);
+    HOSTTEST_CHECK_EQ(HostSimBleDisconnect(), 0);
+    HOSTTEST_CHECK(HostSimBleIsAdvertising());
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileShutdown(false), 1);
+    HOSTTEST_CHECK(!HostSimBleIsAdvertising());
+
+}
+
+
+//---------------------------------------------------------------------------
+
+static  void  TestCallbackHistograms ()
+{
+
+static  const char  szSsid[] = "HistSSID";
+uint8_t             abBlob[STATS_BLOB_MAX_SIZE];
+int                 iBlobLen;
+
+    ESP32BleCfgStats::Reset();
+    HOSTTEST_CHECK(ConnTestSetup() >= 0);
+    HOSTTEST_CHECK_EQ(HostSimBleConnect(), 0);
+    HOSTTEST_CHECK_EQ(HostSimBleWrite(CONN_TEST_UUID_WIFI_SSID, szSsid, strlen(szSsid)), 0);
+
+    iBlobLen = HostSimBleRead(CONN_TEST_UUID_DIAG, abBlob, sizeof(abBlob));
+    HOSTTEST_CHECK(iBlobLen >= STATS_BLOB_FIXED_SIZE);
+    HOSTTEST_CHECK(iBlobLen <= STATS_BLOB_MAX_SIZE);
+    if (iBlobLen >= STATS_BLOB_FIXED_SIZE)
+    {
+        HOSTTEST_CHECK_EQ(abBlob[0], STATS_BLOB_VERSION);
+        HOSTTEST_CHECK_EQ(abBlob[5], 0);
+        HOSTTEST_CHECK_EQ(iBlobLen, STATS_BLOB_FIXED_SIZE + (abBlob[1] * STATS_BLOB_HIST_SIZE));
+        HOSTTEST_CHECK_EQ(ConnTestGetHistCount(abBlob, iBlobLen, STATS_HIST_CB_CONNECT), 1);
+        HOSTTEST_CHECK_EQ(ConnTestGetHistCount(abBlob, iBlobLen, STATS_HIST_CB_CFG_VALUE), 1);
+        HOSTTEST_CHECK_EQ(ConnTestGetHistCount(abBlob, iBlobLen, STATS_HIST_CB_DISCONNECT), -1);   // empty -> left out
+    }
+
+    HOSTTEST_CHECK_EQ(HostSimBleDisconnect(), 0);
+    HOSTTEST_CHECK_EQ(HostTestProfile_g.ProfileShutdown(false), 1);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestAdvertisingAfterDisconnect);
+    HOSTTEST_RUN(TestNoAdvertisingAfterShutdown);
+    HOSTTEST_RUN(TestCallbackHistograms);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
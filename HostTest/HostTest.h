@@ -0,0 +1,242 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Check Macros and Test Runner shared by the host tests
+
+  -------------------------------------------------------------------------
+
+    - Each test program defines its test cases as functions and runs them
+      by HOSTTEST_RUN(). A failed check is reported with file and line and
+      fails the test case, but the remaining test cases still run.
+    - HostTestResult() prints the summary, its value is the exit code of
+      the test program (0 = all test cases passed).
+    - Profile Fixture: HostTestProfileSetup() sets up the BLE Profile
+      <HostTestProfile_g> with the parameters of the test case and
+      connects the simulated client, HostTestProfileShutdown() disconnects
+      and shuts it down again. The application callbacks record their
+      calls in <HostTestProfileEvents_g>.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTTEST_H_
+#define _HOSTTEST_H_
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "HostSim.h"
+
+#include "ESP32BleCfgProfile.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+static  unsigned int    uiHostTestCases_g       = 0;
+static  unsigned int    uiHostTestFailed_g      = 0;
+static  unsigned int    uiHostTestCheckErr_g    = 0;
+
+
+// Checks a condition, a failure is reported but the test case continues
+#define HOSTTEST_CHECK(Cond_p)                                                          \
+    do                                                                                  \
+    {                                                                                   \
+        if ( !(Cond_p) )                                                                \
+        {                                                                               \
+            fprintf(stderr, "  %s:%d: CHECK FAILED: %s\n", __FILE__, __LINE__, #Cond_p);\
+            uiHostTestCheckErr_g++;                                                     \
+        }                                                                               \
+    } while (0)
+
+// Compares two integer values, both values are reported on failure
+#define HOSTTEST_CHECK_EQ(Actual_p, Expected_p)                                         \
+    do                                                                                  \
+    {                                                                                   \
+        long long  llActual   = (long long)(Actual_p);                                  \
+        long long  llExpected = (long long)(Expected_p);                                \
+        if (llActual != llExpected)                                                     \
+        {                                                                               \
+            fprintf(stderr, "  %s:%d: CHECK FAILED: %s == %s (%lld != %lld)\n",         \
+                    __FILE__, __LINE__, #Actual_p, #Expected_p, llActual, llExpected);  \
+            uiHostTestCheckErr_g++;                                                     \
+        }                                                                               \
+    } while (0)
+
+// Runs one test case on a freshly reset simulation (console output discarded)
+#define HOSTTEST_RUN(TestFunc_p)                                                        \
+    do                                                                                  \
+    {                                                                                   \
+        uiHostTestCheckErr_g = 0;                                                       \
+        HostSimReset();                                                                 \
+        HostSimSetSerialOutput(NULL);                                                   \
+        TestFunc_p();                                                                   \
+        uiHostTestCases_g++;                                                            \
+        if (uiHostTestCheckErr_g > 0)                                                   \
+        {                                                                               \
+            uiHostTestFailed_g++;                                                       \
+        }                                                                               \
+        printf("  %-48s %s\n", #TestFunc_p, (uiHostTestCheckErr_g > 0) ? "FAILED" : "ok");\
+        fflush(stdout);                                                                 \
+    } while (0)
+
+
+
+#define HOSTTEST_DEVICE_TYPE            1000000
+
+
+// Parameters of the Profile Fixture
+typedef struct
+{
+    const char*         m_pszDevName;           // device name of the initial configuration
+    const tAppCfgData*  m_pAppCfgData;          // initial configuration (NULL -> empty, WiFi STA mode)
+    uint8_t             m_ui8GattBackend;       // BLE_GATT_BACKEND_xxx
+    uint16_t            m_ui16Mtu;              // MTU after connect (0 -> no client connected)
+    int                 m_iSaveResult;          // return value of the SaveConfig handler
+} tHostTestProfileParam;
+
+// Calls of the application callbacks (reset by HostTestProfileSetup())
+typedef struct
+{
+    int                 m_iSaveResult;
+    unsigned int        m_uiSaveCalls;
+    tAppCfgData         m_SavedCfgData;         // data of the last SaveConfig
+    unsigned int        m_uiRestartCalls;
+    unsigned int        m_uiConStatChgCalls;
+    bool                m_fLastConStat;
+} tHostTestProfileEvents;
+
+static  ESP32BleCfgProfile      HostTestProfile_g;
+static  tHostTestProfileEvents  HostTestProfileEvents_g;
+
+
+
+//---------------------------------------------------------------------------
+//  Functions
+//---------------------------------------------------------------------------
+
+static  inline  int  HostTestResult ()
+{
+
+    printf("  %u test cases, %u failed\n", uiHostTestCases_g, uiHostTestFailed_g);
+    return ((uiHostTestFailed_g == 0) ? 0 : 1);
+
+}
+
+//---------------------------------------------------------------------------
+//  Reports a throughput measured by a test case
+//---------------------------------------------------------------------------
+
+static  inline  void  HostTestReportThroughput (const char* pszName_p, uint32_t ui32BytesPerSec_p)
+{
+
+    printf("  %-48s %lu Bytes/s\n", pszName_p, (unsigned long)ui32BytesPerSec_p);
+    fflush(stdout);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Profile Fixture
+//---------------------------------------------------------------------------
+
+static  inline  int  HostTestCbHdlrSaveConfig (const tAppCfgData* pAppCfgData_p)
+{
+
+    HostTestProfileEvents_g.m_uiSaveCalls++;
+    if (pAppCfgData_p != NULL)
+    {
+        memcpy(&HostTestProfileEvents_g.m_SavedCfgData, pAppCfgData_p, sizeof(HostTestProfileEvents_g.m_SavedCfgData));
+    }
+
+    return (HostTestProfileEvents_g.m_iSaveResult);
+
+}
+
+static  inline  void  HostTestCbHdlrRestartDev ()
+{
+
+    HostTestProfileEvents_g.m_uiRestartCalls++;
+
+}
+
+static  inline  void  HostTestCbHdlrConStatChg (bool fConnected_p)
+{
+
+    HostTestProfileEvents_g.m_uiConStatChgCalls++;
+    HostTestProfileEvents_g.m_fLastConStat = fConnected_p;
+
+}
+
+//---------------------------------------------------------------------------
+//  Sets up <HostTestProfile_g> and connects the simulated client. Services
+//  enabled by the test case before (e.g. EnableOta()) are set up as well.
+//  Return: result of ProfileSetup() (< 0 -> error, client not connected)
+//---------------------------------------------------------------------------
+
+static  inline  int  HostTestProfileSetup (const tHostTestProfileParam* pParam_p)
+{
+
+static  const tAppDescriptData  AppDescriptData = { WIFI_OPMODE_STA | WIFI_OPMODE_AP, "Opt1", "Opt2", "Opt3", "Opt4", "Opt5", "Opt6", "Opt7", "Opt8", "PeerAddr" };
+tAppCfgData  AppCfgData;
+int          iRes;
+
+    if (pParam_p->m_pAppCfgData != NULL)
+    {
+        memcpy(&AppCfgData, pParam_p->m_pAppCfgData, sizeof(AppCfgData));
+    }
+    else
+    {
+        memset(&AppCfgData, 0x00, sizeof(AppCfgData));
+        strncpy(AppCfgData.m_szDevMntDevName, pParam_p->m_pszDevName, sizeof(AppCfgData.m_szDevMntDevName) - 1);
+        AppCfgData.m_ui8WifiOwnMode = WIFI_OPMODE_STA;
+    }
+
+    memset(&HostTestProfileEvents_g, 0x00, sizeof(HostTestProfileEvents_g));
+    HostTestProfileEvents_g.m_iSaveResult = pParam_p->m_iSaveResult;
+
+    HostTestProfile_g.SetGattBackend(pParam_p->m_ui8GattBackend);
+    iRes = HostTestProfile_g.ProfileSetup(HOSTTEST_DEVICE_TYPE, &AppCfgData, &AppDescriptData, HostTestCbHdlrSaveConfig, HostTestCbHdlrRestartDev, HostTestCbHdlrConStatChg);
+    if (iRes < 0)
+    {
+        return (iRes);
+    }
+
+    if (pParam_p->m_ui16Mtu != 0)
+    {
+        HostSimBleConnect();
+        HostSimBleSetMtu(pParam_p->m_ui16Mtu);
+    }
+
+    return (iRes);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  inline  int  HostTestProfileShutdown ()
+{
+
+    if ( HostSimBleIsConnected() )
+    {
+        HostSimBleDisconnect();
+    }
+
+    return (HostTestProfile_g.ProfileShutdown(false));
+
+}
+
+
+
+#endif  // _HOSTTEST_H_
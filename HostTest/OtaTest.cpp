@@ -0,0 +1,504 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Firmware Transfer via service [OTA]
+
+  -------------------------------------------------------------------------
+
+    - Sets up the BLE Profile with service [OTA] and transfers firmware
+      images through the simulated BLE client, using the protocol as a
+      real client has to (see ESP32BleCfgOta.h): OTA_CMD_START, image
+      packets within the granted credit, OTA_CMD_FINISH.
+    - Checks the written update partition, the selected boot partition
+      and the rejection of invalid transfers.
+    - Reports the throughput of the transfer as measured by the device.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+#include "esp_partition.h"
+#include "esp_ota_ops.h"
+#include "mbedtls/sha256.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgOta.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define OTA_TEST_RSP_TIMEOUT            2000                // [ms]
+#define OTA_TEST_IMAGE_MAGIC            0xE9                // first byte of an ESP32 app image
+
+// UUIDs of service [OTA] (see BleProfileDefinition.txt)
+static  const char*  OTA_TEST_UUID_CTRL = "00005100-0000-1000-8000-E776CC14FE69";
+static  const char*  OTA_TEST_UUID_DATA = "00005200-0000-1000-8000-E776CC14FE69";
+
+
+// OTA Response as notified via [OTA/Control]
+typedef struct
+{
+    uint8_t         m_ui8Rsp;
+    uint8_t         m_ui8Status;
+    uint16_t        m_ui16MaxPacketSize;
+    uint32_t        m_ui32CreditLimit;
+    uint32_t        m_ui32WrittenOffset;
+} tOtaTestRsp;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Variables
+//---------------------------------------------------------------------------
+
+static  unsigned int    uiOtaDoneCalls_g        = 0;
+static  uint32_t        ui32OtaDoneSize_g       = 0;
+static  uint32_t        ui32OtaThroughput_g     = 0;
+static  unsigned int    uiNotifyCnt_g           = 0;
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handlers
+//---------------------------------------------------------------------------
+
+static  void  AppCbHdlrOtaDone (uint32_t ui32ImageSize_p, uint32_t ui32Throughput_p)
+{
+    uiOtaDoneCalls_g++;
+    ui32OtaDoneSize_g   = ui32ImageSize_p;
+    ui32OtaThroughput_g = ui32Throughput_p;
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  int  OtaTestSetup (uint16_t ui16Mtu_p)
+{
+
+tHostTestProfileParam  Param = { "OtaTestDevice", NULL, BLE_GATT_BACKEND_OBJECTS, ui16Mtu_p, 0 };
+
+    uiOtaDoneCalls_g    = 0;
+    ui32OtaDoneSize_g   = 0;
+    ui32OtaThroughput_g = 0;
+    uiNotifyCnt_g       = 0;
+
+    HostTestProfile_g.EnableOta(AppCbHdlrOtaDone);
+
+    return ((HostTestProfileSetup(&Param) < 0) ? -1 : 0);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  std::vector<uint8_t>  OtaTestBuildImage (size_t ImageSize_p)
+{
+
+std::vector<uint8_t>  Image(ImageSize_p);
+uint32_t              ui32Seed;
+size_t                Idx;
+
+    ui32Seed = (uint32_t)ImageSize_p;
+    for (Idx=0; Idx<ImageSize_p; Idx++)
+    {
+        ui32Seed = (ui32Seed * 1103515245) + 12345;
+        Image[Idx] = (uint8_t)(ui32Seed >> 16);
+    }
+    Image[0] = OTA_TEST_IMAGE_MAGIC;
+
+    return (Image);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  OtaTestCalcSha256 (const std::vector<uint8_t>& Image_p, uint8_t abSha256_p[OTA_SHA256_SIZE])
+{
+
+mbedtls_sha256_context  Sha256Ctx;
+
+    mbedtls_sha256_init(&Sha256Ctx);
+    mbedtls_sha256_starts(&Sha256Ctx, 0);
+    mbedtls_sha256_update(&Sha256Ctx, Image_p.data(), Image_p.size());
+    mbedtls_sha256_finish(&Sha256Ctx, abSha256_p);
+    mbedtls_sha256_free(&Sha256Ctx);
+
+}
+
+//---------------------------------------------------------------------------
+//  Takes the latest response if a new one was notified since the last call
+//  (responses may be coalesced, the credit of the latest one is valid)
+//---------------------------------------------------------------------------
+
+static  bool  OtaTestPollRsp (tOtaTestRsp* pRsp_p)
+{
+
+uint8_t       abRsp[OTA_RSP_SIZE];
+unsigned int  uiNotifyCnt;
+
+    uiNotifyCnt = HostSimBleGetNotifyCount(OTA_TEST_UUID_CTRL);
+    if (uiNotifyCnt == uiNotifyCnt_g)
+    {
+        return (false);
+    }
+    uiNotifyCnt_g = uiNotifyCnt;
+
+    if (HostSimBleGetLastNotify(OTA_TEST_UUID_CTRL, abRsp, sizeof(abRsp)) != OTA_RSP_SIZE)
+    {
+        return (false);
+    }
+
+    pRsp_p->m_ui8Rsp            = abRsp[0];
+    pRsp_p->m_ui8Status         = abRsp[1];
+    pRsp_p->m_ui16MaxPacketSize = (uint16_t)(abRsp[2] | (abRsp[3] << 8));
+    pRsp_p->m_ui32CreditLimit   = (uint32_t)abRsp[4] | ((uint32_t)abRsp[5] << 8) | ((uint32_t)abRsp[6] << 16) | ((uint32_t)abRsp[7] << 24);
+    pRsp_p->m_ui32WrittenOffset = (uint32_t)abRsp[8] | ((uint32_t)abRsp[9] << 8) | ((uint32_t)abRsp[10] << 16) | ((uint32_t)abRsp[11] << 24);
+
+    return (true);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  bool  OtaTestWaitRsp (tOtaTestRsp* pRsp_p)
+{
+
+unsigned long  ulStartTime;
+
+    ulStartTime = millis();
+    while (!OtaTestPollRsp(pRsp_p))
+    {
+        if ((millis() - ulStartTime) > OTA_TEST_RSP_TIMEOUT)
+        {
+            return (false);
+        }
+        delay(1);
+    }
+
+    return (true);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  void  OtaTestSendStart (uint32_t ui32ImageSize_p, const uint8_t abSha256_p[OTA_SHA256_SIZE])
+{
+
+uint8_t  abCmd[OTA_CMD_START_SIZE];
+
+    abCmd[0] = OTA_CMD_START;
+    abCmd[1] = 0;
+    abCmd[2] = (uint8_t)(ui32ImageSize_p);
+    abCmd[3] = (uint8_t)(ui32ImageSize_p >> 8);
+    abCmd[4] = (uint8_t)(ui32ImageSize_p >> 16);
+    abCmd[5] = (uint8_t)(ui32ImageSize_p >> 24);
+    memcpy(&abCmd[6], abSha256_p, OTA_SHA256_SIZE);
+
+    HostSimBleWrite(OTA_TEST_UUID_CTRL, abCmd, sizeof(abCmd));
+
+}
+
+//---------------------------------------------------------------------------
+//  Sender: complete transfer as done by a client
+//  Return: final response (ACK of START failed, ERROR during transfer,
+//          DONE/ERROR after FINISH), m_ui8Rsp = 0 on timeout
+//---------------------------------------------------------------------------
+
+static  tOtaTestRsp  OtaTestSendImage (const std::vector<uint8_t>& Image_p, const uint8_t abSha256_p[OTA_SHA256_SIZE])
+{
+
+tOtaTestRsp  Rsp;
+uint8_t      bCmd;
+uint32_t     ui32Offset;
+uint32_t     ui32CreditLimit;
+uint32_t     ui32MaxPacket;
+uint32_t     ui32PacketSize;
+
+    memset(&Rsp, 0x00, sizeof(Rsp));
+
+    OtaTestSendStart((uint32_t)Image_p.size(), abSha256_p);
+    if ( !OtaTestWaitRsp(&Rsp) || (Rsp.m_ui8Rsp != OTA_RSP_ACK) )
+    {
+        return (Rsp);
+    }
+
+    ui32Offset      = 0;
+    ui32CreditLimit = Rsp.m_ui32CreditLimit;
+    ui32MaxPacket   = Rsp.m_ui16MaxPacketSize;
+    while (ui32Offset < Image_p.size())
+    {
+        // take new credit resp. stop on error notified during the transfer,
+        // wait for credit when the granted data is sent
+        if (OtaTestPollRsp(&Rsp) || ((ui32Offset >= ui32CreditLimit) && OtaTestWaitRsp(&Rsp)))
+        {
+            if (Rsp.m_ui8Rsp == OTA_RSP_ERROR)
+            {
+                return (Rsp);
+            }
+            if (Rsp.m_ui32CreditLimit > ui32CreditLimit)
+            {
+                ui32CreditLimit = Rsp.m_ui32CreditLimit;
+            }
+        }
+        if (ui32Offset >= ui32CreditLimit)
+        {
+            Rsp.m_ui8Rsp = 0;
+            return (Rsp);
+        }
+
+        ui32PacketSize = ui32MaxPacket;
+        if (ui32PacketSize > (ui32CreditLimit - ui32Offset))
+        {
+            ui32PacketSize = ui32CreditLimit - ui32Offset;
+        }
+        HostSimBleWrite(OTA_TEST_UUID_DATA, &Image_p[ui32Offset], ui32PacketSize);
+        ui32Offset += ui32PacketSize;
+    }
+
+    // late credits may still arrive, wait for the result of FINISH
+    bCmd = OTA_CMD_FINISH;
+    HostSimBleWrite(OTA_TEST_UUID_CTRL, &bCmd, sizeof(bCmd));
+    do
+    {
+        if ( !OtaTestWaitRsp(&Rsp) )
+        {
+            Rsp.m_ui8Rsp = 0;
+            break;
+        }
+    } while ((Rsp.m_ui8Rsp != OTA_RSP_DONE) && (Rsp.m_ui8Rsp != OTA_RSP_ERROR));
+
+    return (Rsp);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  bool  OtaTestCheckPartition (const std::vector<uint8_t>& Image_p)
+{
+
+const esp_partition_t*  pPart;
+std::vector<uint8_t>    PartData(Image_p.size());
+
+    pPart = esp_partition_find_first(ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_APP_OTA_1, NULL);
+    if ((pPart == NULL) || (esp_partition_read(pPart, 0, PartData.data(), PartData.size()) != ESP_OK))
+    {
+        return (false);
+    }
+
+    return (PartData == Image_p);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+// Image of odd size (neither a multiple of the packet size nor of the write buffers)
+static  void  TestOtaTransfer ()
+{
+
+std::vector<uint8_t>  Image = OtaTestBuildImage((48 * OTA_WRITE_BUFF_SIZE) + 1234);
+uint8_t               abSha256[OTA_SHA256_SIZE];
+tOtaTestRsp           Rsp;
+tOtaStatus            OtaStatus;
+
+    HOSTTEST_CHECK_EQ(OtaTestSetup(247), 0);
+    OtaTestCalcSha256(Image, abSha256);
+
+    Rsp = OtaTestSendImage(Image, abSha256);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_DONE);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_OK);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui16MaxPacketSize, 247 - 3);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui32WrittenOffset, Image.size());
+
+    HOSTTEST_CHECK(OtaTestCheckPartition(Image));
+    HOSTTEST_CHECK(esp_ota_get_boot_partition()->subtype == ESP_PARTITION_SUBTYPE_APP_OTA_1);
+
+    HOSTTEST_CHECK_EQ(uiOtaDoneCalls_g, 1);
+    HOSTTEST_CHECK_EQ(ui32OtaDoneSize_g, Image.size());
+    HOSTTEST_CHECK(ESP32BleCfgOta::GetStatus(&OtaStatus));
+    HOSTTEST_CHECK_EQ(OtaStatus.m_ui8State, OTA_STATE_DONE);
+    HOSTTEST_CHECK_EQ(ui32OtaThroughput_g, OtaStatus.m_ui32Throughput);
+    HOSTTEST_CHECK(ui32OtaThroughput_g > 0);
+    HostTestReportThroughput("-> OTA throughput (MTU 247)", ui32OtaThroughput_g);
+
+    HostTestProfileShutdown();
+
+}
+
+// Default ATT_MTU: 20 Bytes per packet
+static  void  TestOtaTransferDefaultMtu ()
+{
+
+std::vector<uint8_t>  Image = OtaTestBuildImage((3 * OTA_WRITE_BUFF_SIZE) + 7);
+uint8_t               abSha256[OTA_SHA256_SIZE];
+tOtaTestRsp           Rsp;
+
+    HOSTTEST_CHECK_EQ(OtaTestSetup(HOSTSIM_BLE_DEF_MTU), 0);
+    OtaTestCalcSha256(Image, abSha256);
+
+    Rsp = OtaTestSendImage(Image, abSha256);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_DONE);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui16MaxPacketSize, HOSTSIM_BLE_DEF_MTU - 3);
+    HOSTTEST_CHECK(OtaTestCheckPartition(Image));
+    HostTestReportThroughput("-> OTA throughput (default MTU)", ui32OtaThroughput_g);
+
+    HostTestProfileShutdown();
+
+}
+
+// Wrong SHA-256: image must not be activated
+static  void  TestOtaHashMismatch ()
+{
+
+std::vector<uint8_t>  Image = OtaTestBuildImage(5 * OTA_WRITE_BUFF_SIZE);
+uint8_t               abSha256[OTA_SHA256_SIZE];
+tOtaTestRsp           Rsp;
+
+    HOSTTEST_CHECK_EQ(OtaTestSetup(247), 0);
+    OtaTestCalcSha256(Image, abSha256);
+    abSha256[0] ^= 0xFF;
+
+    Rsp = OtaTestSendImage(Image, abSha256);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ERROR);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_HASH_ERROR);
+    HOSTTEST_CHECK(esp_ota_get_boot_partition()->subtype == ESP_PARTITION_SUBTYPE_APP_OTA_0);
+    HOSTTEST_CHECK_EQ(uiOtaDoneCalls_g, 0);
+
+    HostTestProfileShutdown();
+
+}
+
+// No ESP32 app image: rejected by the first flash write
+static  void  TestOtaInvalidImage ()
+{
+
+std::vector<uint8_t>  Image = OtaTestBuildImage(5 * OTA_WRITE_BUFF_SIZE);
+uint8_t               abSha256[OTA_SHA256_SIZE];
+tOtaTestRsp           Rsp;
+
+    HOSTTEST_CHECK_EQ(OtaTestSetup(247), 0);
+    Image[0] = 0x00;
+    OtaTestCalcSha256(Image, abSha256);
+
+    Rsp = OtaTestSendImage(Image, abSha256);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ERROR);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_IMAGE_ERROR);
+    HOSTTEST_CHECK(esp_ota_get_boot_partition()->subtype == ESP_PARTITION_SUBTYPE_APP_OTA_0);
+
+    HostTestProfileShutdown();
+
+}
+
+// Invalid commands: image size, FINISH before the end, oversized packet
+static  void  TestOtaInvalidCommands ()
+{
+
+std::vector<uint8_t>  Image = OtaTestBuildImage(2 * OTA_WRITE_BUFF_SIZE);
+uint8_t               abSha256[OTA_SHA256_SIZE];
+uint8_t               bCmd;
+tOtaTestRsp           Rsp;
+
+    HOSTTEST_CHECK_EQ(OtaTestSetup(247), 0);
+    OtaTestCalcSha256(Image, abSha256);
+
+    OtaTestSendStart(0, abSha256);
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ERROR);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_SIZE_ERROR);
+
+    OtaTestSendStart(64 * 1024 * 1024, abSha256);
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_SIZE_ERROR);
+
+    OtaTestSendStart((uint32_t)Image.size(), abSha256);
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ACK);
+    HostSimBleWrite(OTA_TEST_UUID_DATA, Image.data(), 100);
+    bCmd = OTA_CMD_FINISH;
+    HostSimBleWrite(OTA_TEST_UUID_CTRL, &bCmd, sizeof(bCmd));
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ERROR);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_STATE_ERROR);
+
+    HostSimBleWrite(OTA_TEST_UUID_DATA, &Image[100], 247 - 3 + 1);
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ERROR);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, OTA_STATUS_PARAM_ERROR);
+
+    HostTestProfileShutdown();
+
+}
+
+// ABORT discards a running update, a new one starts from scratch
+static  void  TestOtaAbortAndRestart ()
+{
+
+std::vector<uint8_t>  Image = OtaTestBuildImage((6 * OTA_WRITE_BUFF_SIZE) + 99);
+uint8_t               abSha256[OTA_SHA256_SIZE];
+uint8_t               bCmd;
+tOtaTestRsp           Rsp;
+
+    HOSTTEST_CHECK_EQ(OtaTestSetup(247), 0);
+    OtaTestCalcSha256(Image, abSha256);
+
+    OtaTestSendStart((uint32_t)Image.size(), abSha256);
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HostSimBleWrite(OTA_TEST_UUID_DATA, Image.data(), 200);
+    bCmd = OTA_CMD_ABORT;
+    HostSimBleWrite(OTA_TEST_UUID_CTRL, &bCmd, sizeof(bCmd));
+    HOSTTEST_CHECK(OtaTestWaitRsp(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_ACK);
+
+    Rsp = OtaTestSendImage(Image, abSha256);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, OTA_RSP_DONE);
+    HOSTTEST_CHECK(OtaTestCheckPartition(Image));
+    HOSTTEST_CHECK_EQ(uiOtaDoneCalls_g, 1);
+
+    HostTestProfileShutdown();
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestOtaTransfer);
+    HOSTTEST_RUN(TestOtaTransferDefaultMtu);
+    HOSTTEST_RUN(TestOtaHashMismatch);
+    HOSTTEST_RUN(TestOtaInvalidImage);
+    HOSTTEST_RUN(TestOtaInvalidCommands);
+    HOSTTEST_RUN(TestOtaAbortAndRestart);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
@@ -0,0 +1,235 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the Arduino Core API (subset used by the
+                sketch and the framework classes)
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ARDUINO_H_
+#define _HOSTSIM_ARDUINO_H_
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_timer.h"
+#include "esp_system.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+// Marks the host build (like ARDUINO_ARCH_ESP32 marks the target build)
+#define ARDUINO_HOSTSIM         1
+
+typedef uint8_t  byte;
+
+#define HIGH                    1
+#define LOW                     0
+
+#define INPUT                   0x01
+#define OUTPUT                  0x03
+#define INPUT_PULLUP            0x05
+
+#define RISING                  0x01
+#define FALLING                 0x02
+#define CHANGE                  0x03
+
+#define DEC                     10
+#define HEX                     16
+#define OCT                     8
+#define BIN                     2
+
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+
+
+
+//---------------------------------------------------------------------------
+//  Class String
+//---------------------------------------------------------------------------
+
+class  String
+{
+
+    public:
+
+        String ()                                   {                               }
+        String (const char* psz_p)                  { m_str = (psz_p != NULL) ? psz_p : ""; }
+        String (const std::string& str_p)           { m_str = str_p;                }
+        String (char c_p)                           { m_str = std::string(1, c_p);  }
+        String (int i_p, unsigned char base_p=10);
+        String (unsigned int ui_p, unsigned char base_p=10);
+        String (long l_p, unsigned char base_p=10);
+        String (unsigned long ul_p, unsigned char base_p=10);
+
+        const char*   c_str () const                { return (m_str.c_str());       }
+        unsigned int  length () const               { return ((unsigned int)m_str.length()); }
+
+        int     indexOf (char c_p) const;
+        int     indexOf (char c_p, unsigned int uiFrom_p) const;
+        String  substring (unsigned int uiBegin_p) const;
+        String  substring (unsigned int uiBegin_p, unsigned int uiEnd_p) const;
+        long    toInt () const;
+        void    toUpperCase ();
+        void    toLowerCase ();
+        void    getBytes (unsigned char* pabBuff_p, unsigned int uiBuffSize_p, unsigned int uiIndex_p=0) const;
+        char    charAt (unsigned int uiIdx_p) const;
+
+        String&  operator+= (const String& str_p)   { m_str += str_p.m_str; return (*this); }
+        String&  operator+= (const char* psz_p)     { m_str += psz_p;       return (*this); }
+        String&  operator+= (char c_p)              { m_str += c_p;         return (*this); }
+        char     operator[] (unsigned int uiIdx_p) const { return (charAt(uiIdx_p)); }
+        bool     operator== (const String& str_p) const  { return (m_str == str_p.m_str); }
+        bool     operator== (const char* psz_p) const    { return (m_str == psz_p);       }
+        bool     operator!= (const String& str_p) const  { return (m_str != str_p.m_str); }
+
+        friend String  operator+ (const String& a_p, const String& b_p)   { return (String(a_p.m_str + b_p.m_str)); }
+        friend String  operator+ (const char* a_p, const String& b_p)     { return (String(std::string(a_p) + b_p.m_str)); }
+        friend String  operator+ (const String& a_p, const char* b_p)     { return (String(a_p.m_str + b_p)); }
+
+    private:
+
+        std::string  m_str;
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class Print / HardwareSerial
+//---------------------------------------------------------------------------
+//  Output goes to the stream selected by <HostSimSetSerialOutput()>
+//  (default: stdout).
+//---------------------------------------------------------------------------
+
+class  Print
+{
+
+    public:
+
+        size_t  write (uint8_t ui8Data_p);
+        size_t  write (const uint8_t* pabData_p, size_t Size_p);
+
+        size_t  print (const char* psz_p);
+        size_t  print (const String& str_p);
+        size_t  print (char c_p);
+        size_t  print (int i_p, int iBase_p=DEC);
+        size_t  print (unsigned int ui_p, int iBase_p=DEC);
+        size_t  print (long l_p, int iBase_p=DEC);
+        size_t  print (unsigned long ul_p, int iBase_p=DEC);
+        size_t  print (long long ll_p, int iBase_p=DEC);
+        size_t  print (unsigned long long ull_p, int iBase_p=DEC);
+        size_t  print (double d_p, int iDigits_p=2);
+
+        size_t  println ();
+        template <typename T>
+        size_t  println (T Value_p)                 { size_t n = print(Value_p); return (n + println()); }
+        template <typename T>
+        size_t  println (T Value_p, int iFmt_p)     { size_t n = print(Value_p, iFmt_p); return (n + println()); }
+
+        size_t  printf (const char* pszFmt_p, ...) __attribute__ ((format (printf, 2, 3)));
+
+};
+
+class  HardwareSerial : public Print
+{
+
+    public:
+
+        void  begin (unsigned long ulBaud_p);
+        void  flush ();
+
+};
+
+extern HardwareSerial  Serial;
+
+
+
+//---------------------------------------------------------------------------
+//  Class IPAddress
+//---------------------------------------------------------------------------
+
+class  IPAddress
+{
+
+    public:
+
+        IPAddress ()                                { m_ui32Addr = 0;               }
+        IPAddress (uint8_t b1_p, uint8_t b2_p, uint8_t b3_p, uint8_t b4_p);
+        IPAddress (uint32_t ui32Addr_p)             { m_ui32Addr = ui32Addr_p;      }
+
+        bool     fromString (const char* psz_p);
+        bool     fromString (const String& str_p)   { return (fromString(str_p.c_str())); }
+        String   toString () const;
+        uint8_t  operator[] (int iIdx_p) const      { return ((uint8_t)(m_ui32Addr >> (8 * iIdx_p))); }
+        operator uint32_t () const                  { return (m_ui32Addr);          }
+
+    private:
+
+        uint32_t  m_ui32Addr;                       // byte order as on the target (first octet in the LSB)
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class EspClass
+//---------------------------------------------------------------------------
+
+class  EspClass
+{
+
+    public:
+
+        uint64_t  getEfuseMac ();
+        void      restart ();
+        uint32_t  getFreeHeap ();
+        uint32_t  getMinFreeHeap ();
+        uint32_t  getHeapSize ();
+        uint32_t  getMaxAllocHeap ();
+        uint32_t  getCpuFreqMHz ()                  { return (240);                 }
+
+};
+
+extern EspClass  ESP;
+
+
+
+//---------------------------------------------------------------------------
+//  Functions
+//---------------------------------------------------------------------------
+
+unsigned long  millis ();
+unsigned long  micros ();
+void           delay (uint32_t ui32Ms_p);
+void           delayMicroseconds (uint32_t ui32Us_p);
+
+void           pinMode (uint8_t ui8Pin_p, uint8_t ui8Mode_p);
+void           digitalWrite (uint8_t ui8Pin_p, uint8_t ui8Val_p);
+int            digitalRead (uint8_t ui8Pin_p);
+int            digitalPinToInterrupt (int iPin_p);
+void           attachInterrupt (uint8_t ui8Pin_p, void (*pfnIsr_p)(void), int iMode_p);
+void           detachInterrupt (uint8_t ui8Pin_p);
+
+
+
+#endif  // _HOSTSIM_ARDUINO_H_
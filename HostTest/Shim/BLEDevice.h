@@ -0,0 +1,330 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the Arduino BLE library (BLEDevice,
+                BLEServer, BLEService, BLECharacteristic, BLEDescriptor)
+
+  -------------------------------------------------------------------------
+
+    - Behaves like the library of the Arduino Core 2.x for the parts used
+      by the framework: objects created by the library are owned by the
+      application, <removeService()> and <BLEDevice::deinit()> don't
+      delete any object, advertising is not restarted after a disconnect.
+    - The client side (connect, read, write, notifications) is driven by
+      the functions in HostSim.h.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_BLEDEVICE_H_
+#define _HOSTSIM_BLEDEVICE_H_
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include "esp_gatts_api.h"
+#include "esp_gap_ble_api.h"
+
+
+
+class  BLEServer;
+class  BLEService;
+class  BLECharacteristic;
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEUUID
+//---------------------------------------------------------------------------
+
+class  BLEUUID
+{
+
+    public:
+
+        BLEUUID ();
+        BLEUUID (const char* pszUuid_p);
+        BLEUUID (const std::string& strUuid_p);
+        BLEUUID (uint16_t ui16Uuid_p);
+
+        bool           equals (const BLEUUID& Uuid_p) const;
+        bool           equals (const uint8_t* pabUuid_p, uint16_t ui16UuidLen_p) const;
+        std::string    toString () const;
+        esp_bt_uuid_t* getNative ()                 { return (&m_Uuid);             }
+
+    private:
+
+        esp_bt_uuid_t  m_Uuid;                      // 128 bit UUIDs in little endian byte order (as in the attribute tables)
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEDescriptor
+//---------------------------------------------------------------------------
+
+class  BLEDescriptor
+{
+
+    public:
+
+        BLEDescriptor (const char* pszUuid_p, uint16_t ui16MaxLen_p=100);
+        BLEDescriptor (BLEUUID Uuid_p, uint16_t ui16MaxLen_p=100);
+        virtual ~BLEDescriptor ();
+
+        void      setValue (const uint8_t* pabData_p, size_t Length_p);
+        void      setValue (const std::string& strValue_p);
+        void      setValue (const char* pszValue_p)     { setValue(std::string(pszValue_p)); }
+        uint8_t*  getValue ()                           { return ((uint8_t*)m_strValue.data()); }
+        size_t    getLength ()                          { return (m_strValue.length()); }
+        BLEUUID   getUUID ()                            { return (m_Uuid);              }
+        uint16_t  getHandle ()                          { return (m_ui16Handle);        }
+
+    private:
+
+        friend class  BLECharacteristic;
+
+        BLEUUID      m_Uuid;
+        uint16_t     m_ui16MaxLen;
+        uint16_t     m_ui16Handle;
+        std::string  m_strValue;
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLECharacteristicCallbacks
+//---------------------------------------------------------------------------
+
+class  BLECharacteristicCallbacks
+{
+
+    public:
+
+        virtual ~BLECharacteristicCallbacks ();
+
+        virtual void  onRead (BLECharacteristic* pCharacteristic_p, esp_ble_gatts_cb_param_t* pParam_p);
+        virtual void  onRead (BLECharacteristic* pCharacteristic_p);
+        virtual void  onWrite (BLECharacteristic* pCharacteristic_p, esp_ble_gatts_cb_param_t* pParam_p);
+        virtual void  onWrite (BLECharacteristic* pCharacteristic_p);
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLECharacteristic
+//---------------------------------------------------------------------------
+
+class  BLECharacteristic
+{
+
+    public:
+
+        static const uint32_t  PROPERTY_READ        = 1 << 0;
+        static const uint32_t  PROPERTY_WRITE       = 1 << 1;
+        static const uint32_t  PROPERTY_NOTIFY      = 1 << 2;
+        static const uint32_t  PROPERTY_BROADCAST   = 1 << 3;
+        static const uint32_t  PROPERTY_INDICATE    = 1 << 4;
+        static const uint32_t  PROPERTY_WRITE_NR    = 1 << 5;
+
+        BLECharacteristic (const char* pszUuid_p, uint32_t ui32Properties_p=0);
+        BLECharacteristic (BLEUUID Uuid_p, uint32_t ui32Properties_p=0);
+        virtual ~BLECharacteristic ();
+
+        void         setValue (const uint8_t* pabData_p, size_t Length_p);
+        void         setValue (const std::string& strValue_p);
+        void         setValue (uint16_t& ui16Value_p);
+        void         setValue (uint32_t& ui32Value_p);
+        void         setValue (int& iValue_p);
+        void         setValue (float& fValue_p);
+        void         setValue (double& dValue_p);
+        std::string  getValue ()                        { return (m_strValue);          }
+        uint8_t*     getData ()                         { return ((uint8_t*)m_strValue.data()); }
+        size_t       getLength ()                       { return (m_strValue.length()); }
+
+        void         notify (bool fIsNotification_p=true);
+        void         indicate ()                        { notify(false);                }
+        void         setCallbacks (BLECharacteristicCallbacks* pCallbacks_p);
+        void         addDescriptor (BLEDescriptor* pDescriptor_p);
+        BLEUUID      getUUID ()                         { return (m_Uuid);              }
+        uint16_t     getHandle ()                       { return (m_ui16Handle);        }
+        BLEService*  getService ()                      { return (m_pService);          }
+        uint32_t     getProperties ()                   { return (m_ui32Properties);    }
+
+        void         handleGATTServerEvent (esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p);
+
+    private:
+
+        friend class  BLEService;
+
+        BLEUUID                         m_Uuid;
+        uint32_t                        m_ui32Properties;
+        uint16_t                        m_ui16Handle;
+        std::string                     m_strValue;
+        BLECharacteristicCallbacks*     m_pCallbacks;
+        BLEService*                     m_pService;
+        std::vector<BLEDescriptor*>     m_DescriptorList;
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEService
+//---------------------------------------------------------------------------
+
+class  BLEService
+{
+
+    public:
+
+        BLEService (BLEUUID Uuid_p, uint16_t ui16NumHandles_p);
+        virtual ~BLEService ();
+
+        BLECharacteristic*  createCharacteristic (const char* pszUuid_p, uint32_t ui32Properties_p);
+        BLECharacteristic*  createCharacteristic (BLEUUID Uuid_p, uint32_t ui32Properties_p);
+        void                addCharacteristic (BLECharacteristic* pCharacteristic_p);
+        BLECharacteristic*  getCharacteristic (BLEUUID Uuid_p);
+        void                start ();
+        void                stop ();
+        void                executeDelete ();
+        BLEUUID             getUUID ()                  { return (m_Uuid);              }
+        uint16_t            getHandle ()                { return (m_ui16Handle);        }
+        BLEServer*          getServer ()                { return (m_pServer);           }
+
+    private:
+
+        friend class  BLEServer;
+        friend class  BLECharacteristic;
+
+        BLEUUID                             m_Uuid;
+        uint16_t                            m_ui16NumHandles;
+        uint16_t                            m_ui16Handle;
+        uint16_t                            m_ui16NextHandle;
+        bool                                m_fStarted;
+        BLEServer*                          m_pServer;
+        std::vector<BLECharacteristic*>     m_CharacteristicList;
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEServerCallbacks
+//---------------------------------------------------------------------------
+
+class  BLEServerCallbacks
+{
+
+    public:
+
+        virtual ~BLEServerCallbacks ();
+
+        virtual void  onConnect (BLEServer* pServer_p);
+        virtual void  onConnect (BLEServer* pServer_p, esp_ble_gatts_cb_param_t* pParam_p);
+        virtual void  onDisconnect (BLEServer* pServer_p);
+        virtual void  onDisconnect (BLEServer* pServer_p, esp_ble_gatts_cb_param_t* pParam_p);
+        virtual void  onMtuChanged (BLEServer* pServer_p, esp_ble_gatts_cb_param_t* pParam_p);
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEAdvertising
+//---------------------------------------------------------------------------
+
+class  BLEAdvertising
+{
+
+    public:
+
+        void  start ();
+        void  stop ();
+        void  addServiceUUID (BLEUUID Uuid_p)           {                               }
+        void  setScanResponse (bool fScanResponse_p)    {                               }
+        void  setMinPreferred (uint16_t ui16Val_p)      {                               }
+        void  setMaxPreferred (uint16_t ui16Val_p)      {                               }
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEServer
+//---------------------------------------------------------------------------
+
+class  BLEServer
+{
+
+    public:
+
+        BLEServer ();
+        virtual ~BLEServer ();
+
+        BLEService*      createService (const char* pszUuid_p);
+        BLEService*      createService (BLEUUID Uuid_p, uint32_t ui32NumHandles_p=15, uint8_t ui8InstId_p=0);
+        void             removeService (BLEService* pService_p);
+        void             setCallbacks (BLEServerCallbacks* pCallbacks_p);
+        BLEAdvertising*  getAdvertising ();
+        void             startAdvertising ();
+        uint16_t         getConnId ()                   { return (m_ui16ConnId);        }
+        uint32_t         getConnectedCount ()           { return (m_uiConnectedCount);  }
+        const std::vector<BLEService*>&  getServiceList () { return (m_ServiceList);    }
+        void             disconnect (uint16_t ui16ConnId_p);
+
+        void             handleGATTServerEvent (esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p);
+
+    private:
+
+        friend class  BLEService;
+
+        BLEServerCallbacks*         m_pCallbacks;
+        uint16_t                    m_ui16ConnId;
+        unsigned int                m_uiConnectedCount;
+        std::vector<BLEService*>    m_ServiceList;
+
+};
+
+
+
+//---------------------------------------------------------------------------
+//  Class BLEDevice
+//---------------------------------------------------------------------------
+
+class  BLEDevice
+{
+
+    public:
+
+        static void             init (std::string strDeviceName_p);
+        static void             deinit (bool fReleaseMemory_p=false);
+        static bool             getInitialized ();
+        static BLEServer*       createServer ();
+        static BLEServer*       getServer ();
+        static esp_err_t        setMTU (uint16_t ui16Mtu_p);
+        static uint16_t         getMTU ();
+        static BLEAdvertising*  getAdvertising ();
+        static void             startAdvertising ();
+        static void             stopAdvertising ();
+        static void             setCustomGapHandler (void (*pfnHandler_p)(esp_gap_ble_cb_event_t Event_p, esp_ble_gap_cb_param_t* pParam_p));
+        static void             setCustomGattsHandler (esp_gatts_cb_t pfnHandler_p);
+
+};
+
+
+
+#endif  // _HOSTSIM_BLEDEVICE_H_
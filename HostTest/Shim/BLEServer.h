@@ -0,0 +1,21 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <BLEServer.h> (see BLEDevice.h)
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_BLESERVER_H_
+#define _HOSTSIM_BLESERVER_H_
+
+#include "BLEDevice.h"
+
+#endif  // _HOSTSIM_BLESERVER_H_
@@ -0,0 +1,59 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <EEPROM.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_EEPROM_H_
+#define _HOSTSIM_EEPROM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//  The EEPROM content is kept in memory and survives <end()>/<begin()>,
+//  like the flash sector on the target (see <HostSimEepromXxx()>).
+
+class  EEPROMClass
+{
+
+    public:
+
+        bool      begin (size_t Size_p);
+        void      end ();
+        bool      commit ();
+        uint8_t   read (int iAddr_p);
+        void      write (int iAddr_p, uint8_t ui8Val_p);
+        size_t    readBytes (int iAddr_p, void* pvDst_p, size_t Len_p);
+        size_t    writeBytes (int iAddr_p, const void* pvSrc_p, size_t Len_p);
+        uint8_t*  getDataPtr ();
+        size_t    length ();
+
+        template <typename T>
+        T&  get (int iAddr_p, T& Value_p)
+        {
+            readBytes(iAddr_p, &Value_p, sizeof(T));
+            return (Value_p);
+        }
+
+        template <typename T>
+        const T&  put (int iAddr_p, const T& Value_p)
+        {
+            writeBytes(iAddr_p, &Value_p, sizeof(T));
+            return (Value_p);
+        }
+
+};
+
+extern EEPROMClass  EEPROM;
+
+#endif  // _HOSTSIM_EEPROM_H_
@@ -0,0 +1,121 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Control Interface of the Host Simulation (used by the
+                test programs only, never by the framework itself)
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_H_
+#define _HOSTSIM_H_
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "esp_bt.h"
+#include "esp_system.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+// Simulated heap: every allocation by <operator new> is accounted against
+// HOSTSIM_HEAP_SIZE. The memory reserved for the BT Controller and the
+// Bluedroid Host stack is part of the heap only after it was released.
+#define HOSTSIM_HEAP_SIZE               (256 * 1024)            // [Bytes]
+#define HOSTSIM_BT_CTRL_MEM_SIZE        (54 * 1024)             // released by esp_bt_controller_mem_release() / esp_bt_mem_release()
+#define HOSTSIM_BT_HOST_MEM_SIZE        (12 * 1024)             // released by esp_bt_mem_release() only
+
+// Connection of the simulated client
+#define HOSTSIM_BLE_CONN_ID             0
+#define HOSTSIM_BLE_GATTS_IF            3
+#define HOSTSIM_BLE_DEF_MTU             23
+
+typedef struct
+{
+    unsigned int    m_uiCtrlInitCalls;          // esp_bt_controller_init() (incl. by BLEDevice::init())
+    unsigned int    m_uiMemReleaseCalls;        // esp_bt_mem_release()
+    unsigned int    m_uiCtrlMemReleaseCalls;    // esp_bt_controller_mem_release() (incl. by BLEDevice::deinit(true))
+    esp_bt_mode_t   m_LastMemReleaseMode;
+    size_t          m_ReleasedBytes;            // BT memory given to the heap so far
+    char            m_szDeviceName[32];         // set by esp_ble_gap_set_device_name()
+} tHostSimBtStats;
+
+typedef struct
+{
+    unsigned int    m_uiOpenCalls;              // nvs_open()
+    unsigned int    m_uiGetCalls;               // nvs_get_blob()
+    unsigned int    m_uiSetCalls;               // nvs_set_blob()
+    unsigned int    m_uiCommitCalls;            // nvs_commit()
+} tHostSimNvsStats;
+
+typedef struct
+{
+    size_t          m_UsedBytes;                // currently allocated
+    unsigned long   m_ulAllocCalls;             // operator new / new[]
+    unsigned long   m_ulFreeCalls;              // operator delete / delete[] (without NULL pointers)
+} tHostSimHeapStats;
+
+
+
+//---------------------------------------------------------------------------
+//  Prototypes
+//---------------------------------------------------------------------------
+
+// Reset of the simulated hardware (EEPROM, NVS, flash partitions, pins,
+// BT Controller state, counters). Objects of the application (e.g. BLE
+// objects) are not touched.
+void    HostSimReset ();
+
+// Serial Console: stream for the output of <Serial> (NULL = discard)
+void    HostSimSetSerialOutput (FILE* pStream_p);
+
+// GPIO / Reset / WiFi
+void    HostSimSetPinLevel (uint8_t ui8Pin_p, int iLevel_p);
+int     HostSimGetPinLevel (uint8_t ui8Pin_p);
+void    HostSimSetResetReason (esp_reset_reason_t ResetReason_p);
+unsigned int  HostSimGetRestartCount ();
+void    HostSimSetWifiStatus (int iStatus_p);
+
+// EEPROM content (emulated flash sector, survives EEPROM.end()/begin())
+void      HostSimEepromLoad (const void* pvData_p, size_t Size_p);
+uint8_t*  HostSimEepromGetData (size_t* pSize_p);
+
+// NVS access counters (reset by HostSimReset())
+void    HostSimGetNvsStats (tHostSimNvsStats* pNvsStats_p);
+
+// Heap (the alloc/free counters are never reset, the objects of the application survive HostSimReset())
+size_t  HostSimHeapGetUsed ();
+void    HostSimHeapResetMinimum ();
+void    HostSimHeapGetStats (tHostSimHeapStats* pHeapStats_p);
+
+// BT Controller
+void    HostSimGetBtStats (tHostSimBtStats* pBtStats_p);
+
+// BLE Client: all functions act on the server created by BLEDevice::createServer().
+// Characteristics are addressed by their UUID (string form as in the profile).
+int     HostSimBleConnect ();
+int     HostSimBleDisconnect ();
+int     HostSimBleSetMtu (uint16_t ui16Mtu_p);
+int     HostSimBleWrite (const char* pszUuid_p, const void* pvData_p, size_t Size_p);      // -> GATT Status, -1 = not found
+int     HostSimBleRead (const char* pszUuid_p, void* pvBuff_p, size_t BuffSize_p);         // -> Length, -1 = not found
+bool    HostSimBleIsConnected ();
+bool    HostSimBleIsAdvertising ();
+unsigned int  HostSimBleGetNotifyCount (const char* pszUuid_p);
+int     HostSimBleGetLastNotify (const char* pszUuid_p, void* pvBuff_p, size_t BuffSize_p); // -> Length, -1 = none
+
+
+
+#endif  // _HOSTSIM_H_
@@ -0,0 +1,732 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the Arduino Core API, EEPROM, WiFi,
+                esp_timer and the simulated heap
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include <stdarg.h>
+#include <malloc.h>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "WiFi.h"
+#include "esp_heap_caps.h"
+#include "HostSim.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Variables
+//---------------------------------------------------------------------------
+
+#define HOSTSIM_NUM_PINS                40
+#define HOSTSIM_EEPROM_MAX_SIZE         4096
+
+static  const std::chrono::steady_clock::time_point  StartTime_g = std::chrono::steady_clock::now();
+
+static  FILE*               pSerialOutput_g                 = stdout;
+
+static  int                 aiPinLevel_g[HOSTSIM_NUM_PINS];
+static  bool                fPinLevelInit_g                 = false;
+static  esp_reset_reason_t  ResetReason_g                   = ESP_RST_POWERON;
+static  unsigned int        uiRestartCount_g                = 0;
+static  wl_status_t         WifiStatus_g                    = WL_DISCONNECTED;
+
+static  uint8_t             abEepromData_g[HOSTSIM_EEPROM_MAX_SIZE];
+static  size_t              EepromSize_g                    = 0;
+static  bool                fEepromInit_g                   = false;
+
+static  std::atomic<size_t> HeapUsed_g(0);
+static  std::atomic<size_t> HeapMaxUsed_g(0);
+static  std::atomic<unsigned long>  HeapAllocCalls_g(0);
+static  std::atomic<unsigned long>  HeapFreeCalls_g(0);
+
+extern  size_t  HostSimBtGetReleasedMem ();
+extern  void    HostSimResetIdf ();
+extern  void    HostSimResetBle ();
+
+
+
+//---------------------------------------------------------------------------
+//  Global Objects
+//---------------------------------------------------------------------------
+
+HardwareSerial  Serial;
+EspClass        ESP;
+EEPROMClass     EEPROM;
+WiFiClass       WiFi;
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          S I M U L A T I O N   C O N T R O L                            //
+//                                                                         //
+//=========================================================================//
+
+void  HostSimReset ()
+{
+
+    memset(abEepromData_g, 0xFF, sizeof(abEepromData_g));
+    fEepromInit_g   = true;
+    EepromSize_g    = 0;
+
+    for (unsigned int uiIdx=0; uiIdx<HOSTSIM_NUM_PINS; uiIdx++)
+    {
+        aiPinLevel_g[uiIdx] = HIGH;             // inputs with pull-up, keys released
+    }
+    fPinLevelInit_g = true;
+
+    ResetReason_g    = ESP_RST_POWERON;
+    uiRestartCount_g = 0;
+    WifiStatus_g     = WL_DISCONNECTED;
+
+    HostSimResetIdf();
+    HostSimResetBle();
+    HostSimHeapResetMinimum();
+
+    return;
+
+}
+
+//---------------------------------------------------------------------------
+
+void  HostSimSetSerialOutput (FILE* pStream_p)
+{
+    pSerialOutput_g = pStream_p;
+}
+
+void  HostSimSetPinLevel (uint8_t ui8Pin_p, int iLevel_p)
+{
+    digitalRead(0);                             // ensure defaults
+    if (ui8Pin_p < HOSTSIM_NUM_PINS)
+    {
+        aiPinLevel_g[ui8Pin_p] = iLevel_p;
+    }
+}
+
+int  HostSimGetPinLevel (uint8_t ui8Pin_p)
+{
+    return (digitalRead(ui8Pin_p));
+}
+
+void  HostSimSetResetReason (esp_reset_reason_t ResetReason_p)
+{
+    ResetReason_g = ResetReason_p;
+}
+
+unsigned int  HostSimGetRestartCount ()
+{
+    return (uiRestartCount_g);
+}
+
+void  HostSimSetWifiStatus (int iStatus_p)
+{
+    WifiStatus_g = (wl_status_t)iStatus_p;
+}
+
+void  HostSimEepromLoad (const void* pvData_p, size_t Size_p)
+{
+    if (!fEepromInit_g)
+    {
+        HostSimReset();
+    }
+    if (Size_p > sizeof(abEepromData_g))
+    {
+        Size_p = sizeof(abEepromData_g);
+    }
+    memset(abEepromData_g, 0xFF, sizeof(abEepromData_g));
+    memcpy(abEepromData_g, pvData_p, Size_p);
+}
+
+uint8_t*  HostSimEepromGetData (size_t* pSize_p)
+{
+    if (pSize_p != NULL)
+    {
+        *pSize_p = EepromSize_g;
+    }
+    return (abEepromData_g);
+}
+
+size_t  HostSimHeapGetUsed ()
+{
+    return (HeapUsed_g.load());
+}
+
+void  HostSimHeapResetMinimum ()
+{
+    HeapMaxUsed_g.store(HeapUsed_g.load());
+}
+
+void  HostSimHeapGetStats (tHostSimHeapStats* pHeapStats_p)
+{
+    pHeapStats_p->m_UsedBytes     = HeapUsed_g.load();
+    pHeapStats_p->m_ulAllocCalls  = HeapAllocCalls_g.load();
+    pHeapStats_p->m_ulFreeCalls   = HeapFreeCalls_g.load();
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          H E A P                                                        //
+//                                                                         //
+//=========================================================================//
+
+static  void*  HeapAlloc (size_t Size_p)
+{
+
+void*   pvMem;
+size_t  Used;
+size_t  MaxUsed;
+
+    pvMem = malloc((Size_p != 0) ? Size_p : 1);
+    if (pvMem == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    HeapAllocCalls_g++;
+    Used = HeapUsed_g.fetch_add(malloc_usable_size(pvMem)) + malloc_usable_size(pvMem);
+    MaxUsed = HeapMaxUsed_g.load();
+    while ((Used > MaxUsed) && !HeapMaxUsed_g.compare_exchange_weak(MaxUsed, Used))
+    {
+    }
+
+    return (pvMem);
+
+}
+
+static  void  HeapFree (void* pvMem_p)
+{
+
+    if (pvMem_p != NULL)
+    {
+        HeapFreeCalls_g++;
+        HeapUsed_g.fetch_sub(malloc_usable_size(pvMem_p));
+        free(pvMem_p);
+    }
+
+}
+
+void*  operator new (size_t Size_p)                         { return (HeapAlloc(Size_p)); }
+void*  operator new[] (size_t Size_p)                       { return (HeapAlloc(Size_p)); }
+void   operator delete (void* pvMem_p) noexcept             { HeapFree(pvMem_p);          }
+void   operator delete[] (void* pvMem_p) noexcept           { HeapFree(pvMem_p);          }
+void   operator delete (void* pvMem_p, size_t) noexcept     { HeapFree(pvMem_p);          }
+void   operator delete[] (void* pvMem_p, size_t) noexcept   { HeapFree(pvMem_p);          }
+
+//---------------------------------------------------------------------------
+
+size_t  heap_caps_get_total_size (uint32_t ui32Caps_p)
+{
+    return (HOSTSIM_HEAP_SIZE + HostSimBtGetReleasedMem());
+}
+
+size_t  heap_caps_get_free_size (uint32_t ui32Caps_p)
+{
+size_t  Used = HeapUsed_g.load();
+    return ((Used < heap_caps_get_total_size(ui32Caps_p)) ? (heap_caps_get_total_size(ui32Caps_p) - Used) : 0);
+}
+
+size_t  heap_caps_get_minimum_free_size (uint32_t ui32Caps_p)
+{
+size_t  MaxUsed = HeapMaxUsed_g.load();
+    return ((MaxUsed < heap_caps_get_total_size(ui32Caps_p)) ? (heap_caps_get_total_size(ui32Caps_p) - MaxUsed) : 0);
+}
+
+size_t  heap_caps_get_largest_free_block (uint32_t ui32Caps_p)
+{
+    return (heap_caps_get_free_size(ui32Caps_p));
+}
+
+void  heap_caps_get_info (multi_heap_info_t* pInfo_p, uint32_t ui32Caps_p)
+{
+    memset(pInfo_p, 0x00, sizeof(*pInfo_p));
+    pInfo_p->total_free_bytes      = heap_caps_get_free_size(ui32Caps_p);
+    pInfo_p->total_allocated_bytes = HeapUsed_g.load();
+    pInfo_p->largest_free_block    = heap_caps_get_largest_free_block(ui32Caps_p);
+    pInfo_p->minimum_free_bytes    = heap_caps_get_minimum_free_size(ui32Caps_p);
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          A R D U I N O   C O R E                                        //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  Time / GPIO
+//---------------------------------------------------------------------------
+
+int64_t  esp_timer_get_time ()
+{
+    return (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - StartTime_g).count());
+}
+
+unsigned long  millis ()
+{
+    return ((unsigned long)(esp_timer_get_time() / 1000));
+}
+
+unsigned long  micros ()
+{
+    return ((unsigned long)esp_timer_get_time());
+}
+
+void  delay (uint32_t ui32Ms_p)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ui32Ms_p));
+}
+
+void  delayMicroseconds (uint32_t ui32Us_p)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(ui32Us_p));
+}
+
+void  pinMode (uint8_t ui8Pin_p, uint8_t ui8Mode_p)
+{
+}
+
+void  digitalWrite (uint8_t ui8Pin_p, uint8_t ui8Val_p)
+{
+    HostSimSetPinLevel(ui8Pin_p, ui8Val_p);
+}
+
+int  digitalRead (uint8_t ui8Pin_p)
+{
+    if (!fPinLevelInit_g)
+    {
+        for (unsigned int uiIdx=0; uiIdx<HOSTSIM_NUM_PINS; uiIdx++)
+        {
+            aiPinLevel_g[uiIdx] = HIGH;
+        }
+        fPinLevelInit_g = true;
+    }
+    return ((ui8Pin_p < HOSTSIM_NUM_PINS) ? aiPinLevel_g[ui8Pin_p] : LOW);
+}
+
+int  digitalPinToInterrupt (int iPin_p)
+{
+    return (iPin_p);
+}
+
+void  attachInterrupt (uint8_t ui8Pin_p, void (*pfnIsr_p)(void), int iMode_p)
+{
+}
+
+void  detachInterrupt (uint8_t ui8Pin_p)
+{
+}
+
+esp_reset_reason_t  esp_reset_reason ()
+{
+    return (ResetReason_g);
+}
+
+
+
+//---------------------------------------------------------------------------
+//  esp_timer (callbacks are never invoked)
+//---------------------------------------------------------------------------
+
+struct  esp_timer
+{
+    esp_timer_create_args_t  m_Args;
+};
+
+esp_err_t  esp_timer_create (const esp_timer_create_args_t* pArgs_p, esp_timer_handle_t* phTimer_p)
+{
+    *phTimer_p = new esp_timer;
+    (*phTimer_p)->m_Args = *pArgs_p;
+    return (ESP_OK);
+}
+
+esp_err_t  esp_timer_start_once (esp_timer_handle_t hTimer_p, uint64_t ui64TimeoutUs_p)         { return (ESP_OK); }
+esp_err_t  esp_timer_start_periodic (esp_timer_handle_t hTimer_p, uint64_t ui64PeriodUs_p)      { return (ESP_OK); }
+esp_err_t  esp_timer_stop (esp_timer_handle_t hTimer_p)                                         { return (ESP_OK); }
+esp_err_t  esp_timer_delete (esp_timer_handle_t hTimer_p)                                       { delete hTimer_p; return (ESP_OK); }
+
+
+
+//---------------------------------------------------------------------------
+//  Class String
+//---------------------------------------------------------------------------
+
+static  std::string  FormatNumber (unsigned long long ullVal_p, bool fNegative_p, unsigned int uiBase_p)
+{
+
+std::string  strRes;
+
+    if ((uiBase_p < 2) || (uiBase_p > 16))
+    {
+        uiBase_p = 10;
+    }
+    do
+    {
+        strRes.insert(strRes.begin(), "0123456789ABCDEF"[ullVal_p % uiBase_p]);
+        ullVal_p /= uiBase_p;
+    } while (ullVal_p != 0);
+    if (fNegative_p)
+    {
+        strRes.insert(strRes.begin(), '-');
+    }
+
+    return (strRes);
+
+}
+
+String::String (int i_p, unsigned char base_p)              { m_str = (base_p == 10) ? FormatNumber((i_p < 0) ? -(long long)i_p : i_p, (i_p < 0), 10) : FormatNumber((unsigned int)i_p, false, base_p); }
+String::String (unsigned int ui_p, unsigned char base_p)    { m_str = FormatNumber(ui_p, false, base_p); }
+String::String (long l_p, unsigned char base_p)             { m_str = (base_p == 10) ? FormatNumber((l_p < 0) ? -(long long)l_p : l_p, (l_p < 0), 10) : FormatNumber((unsigned long)l_p, false, base_p); }
+String::String (unsigned long ul_p, unsigned char base_p)   { m_str = FormatNumber(ul_p, false, base_p); }
+
+int  String::indexOf (char c_p) const
+{
+    return (indexOf(c_p, 0));
+}
+
+int  String::indexOf (char c_p, unsigned int uiFrom_p) const
+{
+size_t  Pos = m_str.find(c_p, uiFrom_p);
+    return ((Pos == std::string::npos) ? -1 : (int)Pos);
+}
+
+String  String::substring (unsigned int uiBegin_p) const
+{
+    return (substring(uiBegin_p, length()));
+}
+
+String  String::substring (unsigned int uiBegin_p, unsigned int uiEnd_p) const
+{
+    if (uiBegin_p > uiEnd_p)
+    {
+        unsigned int uiTmp = uiBegin_p;  uiBegin_p = uiEnd_p;  uiEnd_p = uiTmp;
+    }
+    if (uiBegin_p >= length())
+    {
+        return (String(""));
+    }
+    if (uiEnd_p > length())
+    {
+        uiEnd_p = length();
+    }
+    return (String(m_str.substr(uiBegin_p, uiEnd_p - uiBegin_p)));
+}
+
+long  String::toInt () const
+{
+    return (atol(m_str.c_str()));
+}
+
+void  String::toUpperCase ()
+{
+    for (size_t Idx=0; Idx<m_str.length(); Idx++)
+    {
+        m_str[Idx] = (char)toupper((unsigned char)m_str[Idx]);
+    }
+}
+
+void  String::toLowerCase ()
+{
+    for (size_t Idx=0; Idx<m_str.length(); Idx++)
+    {
+        m_str[Idx] = (char)tolower((unsigned char)m_str[Idx]);
+    }
+}
+
+void  String::getBytes (unsigned char* pabBuff_p, unsigned int uiBuffSize_p, unsigned int uiIndex_p) const
+{
+
+unsigned int  uiLen;
+
+    if ((pabBuff_p == NULL) || (uiBuffSize_p == 0))
+    {
+        return;
+    }
+    if (uiIndex_p >= length())
+    {
+        pabBuff_p[0] = '\0';
+        return;
+    }
+    uiLen = length() - uiIndex_p;
+    if (uiLen > (uiBuffSize_p - 1))
+    {
+        uiLen = uiBuffSize_p - 1;
+    }
+    memcpy(pabBuff_p, m_str.data() + uiIndex_p, uiLen);
+    pabBuff_p[uiLen] = '\0';
+
+}
+
+char  String::charAt (unsigned int uiIdx_p) const
+{
+    return ((uiIdx_p < length()) ? m_str[uiIdx_p] : '\0');
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Class Print / HardwareSerial
+//---------------------------------------------------------------------------
+
+size_t  Print::write (uint8_t ui8Data_p)
+{
+    return (write(&ui8Data_p, 1));
+}
+
+size_t  Print::write (const uint8_t* pabData_p, size_t Size_p)
+{
+    if (pSerialOutput_g != NULL)
+    {
+        fwrite(pabData_p, 1, Size_p, pSerialOutput_g);
+    }
+    return (Size_p);
+}
+
+size_t  Print::print (const char* psz_p)                    { return (write((const uint8_t*)psz_p, strlen(psz_p))); }
+size_t  Print::print (const String& str_p)                  { return (write((const uint8_t*)str_p.c_str(), str_p.length())); }
+size_t  Print::print (char c_p)                             { return (write((uint8_t)c_p)); }
+size_t  Print::print (int i_p, int iBase_p)                 { return (print((long long)i_p, iBase_p)); }
+size_t  Print::print (unsigned int ui_p, int iBase_p)       { return (print((unsigned long long)ui_p, iBase_p)); }
+size_t  Print::print (long l_p, int iBase_p)                { return (print((long long)l_p, iBase_p)); }
+size_t  Print::print (unsigned long ul_p, int iBase_p)      { return (print((unsigned long long)ul_p, iBase_p)); }
+
+size_t  Print::print (long long ll_p, int iBase_p)
+{
+    if (iBase_p != 10)
+    {
+        return (print((unsigned long long)ll_p, iBase_p));
+    }
+    return (print(FormatNumber((ll_p < 0) ? -(unsigned long long)ll_p : (unsigned long long)ll_p, (ll_p < 0), 10).c_str()));
+}
+
+size_t  Print::print (unsigned long long ull_p, int iBase_p)
+{
+    return (print(FormatNumber(ull_p, false, iBase_p).c_str()));
+}
+
+size_t  Print::print (double d_p, int iDigits_p)
+{
+char  szBuff[64];
+    snprintf(szBuff, sizeof(szBuff), "%.*f", iDigits_p, d_p);
+    return (print(szBuff));
+}
+
+size_t  Print::println ()
+{
+    return (print("\r\n"));
+}
+
+size_t  Print::printf (const char* pszFmt_p, ...)
+{
+
+char     szBuff[512];
+va_list  pArgList;
+int      iLen;
+
+    va_start(pArgList, pszFmt_p);
+    iLen = vsnprintf(szBuff, sizeof(szBuff), pszFmt_p, pArgList);
+    va_end(pArgList);
+
+    return ((iLen > 0) ? print(szBuff) : 0);
+
+}
+
+void  HardwareSerial::begin (unsigned long ulBaud_p)
+{
+}
+
+void  HardwareSerial::flush ()
+{
+    if (pSerialOutput_g != NULL)
+    {
+        fflush(pSerialOutput_g);
+    }
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Class IPAddress
+//---------------------------------------------------------------------------
+
+IPAddress::IPAddress (uint8_t b1_p, uint8_t b2_p, uint8_t b3_p, uint8_t b4_p)
+{
+    m_ui32Addr = (uint32_t)b1_p | ((uint32_t)b2_p << 8) | ((uint32_t)b3_p << 16) | ((uint32_t)b4_p << 24);
+}
+
+bool  IPAddress::fromString (const char* psz_p)
+{
+
+uint32_t      ui32Acc;
+uint32_t      ui32Addr;
+unsigned int  uiDots;
+bool          fDigit;
+
+    // same rules as the Arduino Core: 4 decimal octets, each 0..255
+    ui32Acc  = 0;
+    ui32Addr = 0;
+    uiDots   = 0;
+    fDigit   = false;
+    for ( ; *psz_p != '\0'; psz_p++)
+    {
+        if ((*psz_p >= '0') && (*psz_p <= '9'))
+        {
+            ui32Acc = ui32Acc * 10 + (*psz_p - '0');
+            if (ui32Acc > 255)
+            {
+                return (false);
+            }
+            fDigit = true;
+        }
+        else if (*psz_p == '.')
+        {
+            if ((uiDots == 3) || !fDigit)
+            {
+                return (false);
+            }
+            ui32Addr |= ui32Acc << (8 * uiDots);
+            uiDots++;
+            ui32Acc = 0;
+            fDigit  = false;
+        }
+        else
+        {
+            return (false);
+        }
+    }
+    if ((uiDots != 3) || !fDigit)
+    {
+        return (false);
+    }
+    m_ui32Addr = ui32Addr | (ui32Acc << 24);
+
+    return (true);
+
+}
+
+String  IPAddress::toString () const
+{
+char  szBuff[16];
+    snprintf(szBuff, sizeof(szBuff), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return (String(szBuff));
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Class EspClass
+//---------------------------------------------------------------------------
+
+uint64_t  EspClass::getEfuseMac ()
+{
+    return (0x0000A4CF12345678ULL);                 // byte order as on the target (first octet in the LSB)
+}
+
+void  EspClass::restart ()
+{
+    // on the target this call never returns
+    uiRestartCount_g++;
+}
+
+uint32_t  EspClass::getFreeHeap ()      { return ((uint32_t)heap_caps_get_free_size(MALLOC_CAP_INTERNAL)); }
+uint32_t  EspClass::getMinFreeHeap ()   { return ((uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL)); }
+uint32_t  EspClass::getHeapSize ()      { return ((uint32_t)heap_caps_get_total_size(MALLOC_CAP_INTERNAL)); }
+uint32_t  EspClass::getMaxAllocHeap ()  { return ((uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL)); }
+
+
+
+//---------------------------------------------------------------------------
+//  Class EEPROMClass
+//---------------------------------------------------------------------------
+
+bool  EEPROMClass::begin (size_t Size_p)
+{
+    if (!fEepromInit_g)
+    {
+        HostSimReset();
+    }
+    if ((Size_p == 0) || (Size_p > HOSTSIM_EEPROM_MAX_SIZE))
+    {
+        return (false);
+    }
+    EepromSize_g = Size_p;
+    return (true);
+}
+
+void      EEPROMClass::end ()                   { EepromSize_g = 0;                             }
+bool      EEPROMClass::commit ()                { return (EepromSize_g != 0);                   }
+uint8_t*  EEPROMClass::getDataPtr ()            { return ((EepromSize_g != 0) ? abEepromData_g : NULL); }
+size_t    EEPROMClass::length ()                { return (EepromSize_g);                        }
+
+uint8_t  EEPROMClass::read (int iAddr_p)
+{
+    return (((iAddr_p >= 0) && ((size_t)iAddr_p < EepromSize_g)) ? abEepromData_g[iAddr_p] : 0);
+}
+
+void  EEPROMClass::write (int iAddr_p, uint8_t ui8Val_p)
+{
+    if ((iAddr_p >= 0) && ((size_t)iAddr_p < EepromSize_g))
+    {
+        abEepromData_g[iAddr_p] = ui8Val_p;
+    }
+}
+
+size_t  EEPROMClass::readBytes (int iAddr_p, void* pvDst_p, size_t Len_p)
+{
+    if ((iAddr_p < 0) || (((size_t)iAddr_p + Len_p) > EepromSize_g))
+    {
+        return (0);
+    }
+    memcpy(pvDst_p, &abEepromData_g[iAddr_p], Len_p);
+    return (Len_p);
+}
+
+size_t  EEPROMClass::writeBytes (int iAddr_p, const void* pvSrc_p, size_t Len_p)
+{
+    if ((iAddr_p < 0) || (((size_t)iAddr_p + Len_p) > EepromSize_g))
+    {
+        return (0);
+    }
+    memcpy(&abEepromData_g[iAddr_p], pvSrc_p, Len_p);
+    return (Len_p);
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Class WiFiClass
+//---------------------------------------------------------------------------
+
+bool         WiFiClass::mode (wifi_mode_t Mode_p)                               { return (true);            }
+wl_status_t  WiFiClass::begin (const char* pszSsid_p, const char* pszPasswd_p)  { return (WifiStatus_g);    }
+wl_status_t  WiFiClass::status ()                                               { return (WifiStatus_g);    }
+bool         WiFiClass::disconnect (bool fWifiOff_p)                            { return (true);            }
+
+
+
+//  EOF
@@ -0,0 +1,1822 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the BT Controller, Bluedroid, the GATT
+                Server API and the Arduino BLE library, incl. a simulated
+                Client (see HostSim.h)
+
+  -------------------------------------------------------------------------
+
+    - GATTS events are delivered synchronously from the calling context,
+      first to the BLEServer object, then to the custom handler. GAP events
+      and disconnects requested by the server are deferred until the
+      current client access is completed (on the target they are
+      delivered by the BTC task as well).
+    - <BLEDevice::init()> doesn't wait the 200 ms of the library, so the
+      setup time measured on the host is the pure processing time.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "BLEDevice.h"
+#include "esp_bt.h"
+#include "esp_bt_main.h"
+#include "HostSim.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Types / Variables
+//---------------------------------------------------------------------------
+
+typedef struct
+{
+    BLEUUID                 m_Uuid;
+    bool                    m_fDecl;                    // service / characteristic declaration
+    uint8_t                 m_ui8AutoRsp;
+    uint16_t                m_ui16Perm;
+    uint16_t                m_ui16MaxLen;
+    uint16_t                m_ui16Handle;
+    std::vector<uint8_t>    m_Value;
+} tHostSimAttr;
+
+typedef struct
+{
+    uint16_t                    m_ui16ServiceHdl;
+    uint8_t                     m_ui8InstId;
+    std::vector<tHostSimAttr>   m_AttrList;
+    std::vector<uint16_t>       m_HandleList;
+} tHostSimAttrTab;
+
+typedef struct
+{
+    unsigned int            m_uiCount;
+    std::vector<uint8_t>    m_LastValue;
+} tHostSimNotify;
+
+static  const uint8_t   abBleBaseUuid_g[ESP_UUID_LEN_128] =        // 0000xxxx-0000-1000-8000-00805F9B34FB (little endian)
+{
+    0xFB, 0x34, 0x9B, 0x5F, 0x80, 0x00, 0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static  std::recursive_mutex    BleMutex_g;
+
+// BT Controller / Bluedroid
+static  esp_bt_controller_status_t  BtCtrlStatus_g          = ESP_BT_CONTROLLER_STATUS_IDLE;
+static  esp_bluedroid_status_t      BluedroidStatus_g       = ESP_BLUEDROID_STATUS_UNINITIALIZED;
+static  bool                        fBtCtrlMemReleased_g    = false;
+static  bool                        fBtHostMemReleased_g    = false;
+static  tHostSimBtStats             BtStats_g;
+
+// BLE library
+static  bool                        fBleInitialized_g       = false;
+static  BLEServer*                  pBleServer_g            = NULL;
+static  BLEAdvertising              BleAdvertising_g;
+static  uint16_t                    ui16BleLocalMtu_g       = HOSTSIM_BLE_DEF_MTU;
+static  esp_gatts_cb_t              pfnCustomGattsHdlr_g    = NULL;
+static  void                        (*pfnCustomGapHdlr_g)(esp_gap_ble_cb_event_t, esp_ble_gap_cb_param_t*) = NULL;
+
+// GATT Server / Client
+static  uint16_t                    ui16NextHandle_g        = 1;
+static  std::vector<tHostSimAttrTab>            AttrTabList_g;
+static  std::map<uint16_t, tHostSimNotify>      NotifyMap_g;
+static  std::deque<std::function<void()>>       DeferredList_g;
+static  bool                        fAdvertising_g          = false;
+static  bool                        fConnected_g            = false;
+static  uint16_t                    ui16ConnMtu_g           = HOSTSIM_BLE_DEF_MTU;
+static  uint32_t                    ui32TransId_g           = 0;
+static  bool                        fRspReceived_g          = false;
+static  esp_gatt_status_t           RspStatus_g             = ESP_GATT_OK;
+static  esp_gatt_rsp_t              RspData_g;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  void  DispatchGattsEvent (esp_gatts_cb_event_t Event_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+
+    if (pBleServer_g != NULL)
+    {
+        pBleServer_g->handleGATTServerEvent(Event_p, HOSTSIM_BLE_GATTS_IF, pParam_p);
+    }
+    if (pfnCustomGattsHdlr_g != NULL)
+    {
+        pfnCustomGattsHdlr_g(Event_p, HOSTSIM_BLE_GATTS_IF, pParam_p);
+    }
+
+    return;
+
+}
+
+static  void  ProcessDeferred ()
+{
+
+    while ( !DeferredList_g.empty() )
+    {
+        std::function<void()>  fnAction = DeferredList_g.front();
+        DeferredList_g.pop_front();
+        fnAction();
+    }
+
+    return;
+
+}
+
+static  tHostSimAttr*  FindAttrByHandle (uint16_t ui16Handle_p, tHostSimAttrTab** ppAttrTab_p = NULL)
+{
+
+    for (tHostSimAttrTab& AttrTab : AttrTabList_g)
+    {
+        for (tHostSimAttr& Attr : AttrTab.m_AttrList)
+        {
+            if (Attr.m_ui16Handle == ui16Handle_p)
+            {
+                if (ppAttrTab_p != NULL)
+                {
+                    *ppAttrTab_p = &AttrTab;
+                }
+                return (&Attr);
+            }
+        }
+    }
+
+    return (NULL);
+
+}
+
+static  tHostSimAttr*  FindAttrByUuid (const BLEUUID& Uuid_p)
+{
+
+    for (tHostSimAttrTab& AttrTab : AttrTabList_g)
+    {
+        for (tHostSimAttr& Attr : AttrTab.m_AttrList)
+        {
+            if (!Attr.m_fDecl && Attr.m_Uuid.equals(Uuid_p))
+            {
+                return (&Attr);
+            }
+        }
+    }
+
+    return (NULL);
+
+}
+
+static  BLECharacteristic*  FindCharacteristic (const BLEUUID& Uuid_p)
+{
+
+BLECharacteristic*  pCharacteristic;
+
+    if (pBleServer_g == NULL)
+    {
+        return (NULL);
+    }
+    for (BLEService* pService : pBleServer_g->getServiceList())
+    {
+        if ((pCharacteristic = pService->getCharacteristic(Uuid_p)) != NULL)
+        {
+            return (pCharacteristic);
+        }
+    }
+
+    return (NULL);
+
+}
+
+static  uint16_t  FindValueHandle (const char* pszUuid_p)
+{
+
+BLEUUID             Uuid(pszUuid_p);
+BLECharacteristic*  pCharacteristic;
+tHostSimAttr*       pAttr;
+
+    if ((pCharacteristic = FindCharacteristic(Uuid)) != NULL)
+    {
+        return (pCharacteristic->getHandle());
+    }
+    if ((pAttr = FindAttrByUuid(Uuid)) != NULL)
+    {
+        return (pAttr->m_ui16Handle);
+    }
+
+    return (0);
+
+}
+
+static  void  RecordNotify (uint16_t ui16Handle_p, const uint8_t* pabData_p, size_t Length_p)
+{
+
+    std::lock_guard<std::recursive_mutex>  Lock(BleMutex_g);
+    if ( !fConnected_g )
+    {
+        return;
+    }
+    tHostSimNotify&  Notify = NotifyMap_g[ui16Handle_p];
+    Notify.m_uiCount++;
+    Notify.m_LastValue.assign(pabData_p, pabData_p + Length_p);
+
+    return;
+
+}
+
+//---------------------------------------------------------------------------
+
+size_t  HostSimBtGetReleasedMem ()
+{
+    return (BtStats_g.m_ReleasedBytes);
+}
+
+void  HostSimResetBle ()
+{
+
+    std::lock_guard<std::recursive_mutex>  Lock(BleMutex_g);
+
+    BtCtrlStatus_g        = ESP_BT_CONTROLLER_STATUS_IDLE;
+    BluedroidStatus_g     = ESP_BLUEDROID_STATUS_UNINITIALIZED;
+    fBtCtrlMemReleased_g  = false;
+    fBtHostMemReleased_g  = false;
+    memset(&BtStats_g, 0x00, sizeof(BtStats_g));
+
+    fBleInitialized_g     = false;
+    pBleServer_g          = NULL;                       // owned by the application
+    ui16BleLocalMtu_g     = HOSTSIM_BLE_DEF_MTU;
+    pfnCustomGattsHdlr_g  = NULL;
+    pfnCustomGapHdlr_g    = NULL;
+
+    ui16NextHandle_g      = 1;
+    AttrTabList_g.clear();
+    NotifyMap_g.clear();
+    DeferredList_g.clear();
+    fAdvertising_g        = false;
+    fConnected_g          = false;
+    ui16ConnMtu_g         = HOSTSIM_BLE_DEF_MTU;
+
+    return;
+
+}
+
+void  HostSimGetBtStats (tHostSimBtStats* pBtStats_p)
+{
+    *pBtStats_p = BtStats_g;
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          B T   C O N T R O L L E R   /   B L U E D R O I D              //
+//                                                                         //
+//=========================================================================//
+
+esp_err_t  esp_bt_controller_init (esp_bt_controller_config_t* pCfg_p)
+{
+
+    BtStats_g.m_uiCtrlInitCalls++;
+    if ( fBtCtrlMemReleased_g )
+    {
+        return (ESP_ERR_INVALID_STATE);         // controller memory is part of the heap now
+    }
+    if (BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_IDLE)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BtCtrlStatus_g = ESP_BT_CONTROLLER_STATUS_INITED;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bt_controller_deinit ()
+{
+
+    if (BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_INITED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BtCtrlStatus_g = ESP_BT_CONTROLLER_STATUS_IDLE;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bt_controller_enable (esp_bt_mode_t Mode_p)
+{
+
+    if (BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_INITED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BtCtrlStatus_g = ESP_BT_CONTROLLER_STATUS_ENABLED;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bt_controller_disable ()
+{
+
+    if (BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_ENABLED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BtCtrlStatus_g = ESP_BT_CONTROLLER_STATUS_INITED;
+
+    return (ESP_OK);
+
+}
+
+esp_bt_controller_status_t  esp_bt_controller_get_status ()
+{
+    return (BtCtrlStatus_g);
+}
+
+esp_err_t  esp_bt_controller_mem_release (esp_bt_mode_t Mode_p)
+{
+
+    BtStats_g.m_uiCtrlMemReleaseCalls++;
+    BtStats_g.m_LastMemReleaseMode = Mode_p;
+    if (BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_IDLE)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    if ( !fBtCtrlMemReleased_g )
+    {
+        fBtCtrlMemReleased_g = true;
+        BtStats_g.m_ReleasedBytes += HOSTSIM_BT_CTRL_MEM_SIZE;
+    }
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bt_mem_release (esp_bt_mode_t Mode_p)
+{
+
+    BtStats_g.m_uiMemReleaseCalls++;
+    BtStats_g.m_LastMemReleaseMode = Mode_p;
+    if ((BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_IDLE) || (BluedroidStatus_g != ESP_BLUEDROID_STATUS_UNINITIALIZED))
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    if ( !fBtCtrlMemReleased_g )
+    {
+        fBtCtrlMemReleased_g = true;
+        BtStats_g.m_ReleasedBytes += HOSTSIM_BT_CTRL_MEM_SIZE;
+    }
+    if ( !fBtHostMemReleased_g )
+    {
+        fBtHostMemReleased_g = true;
+        BtStats_g.m_ReleasedBytes += HOSTSIM_BT_HOST_MEM_SIZE;
+    }
+
+    return (ESP_OK);
+
+}
+
+//---------------------------------------------------------------------------
+
+esp_bluedroid_status_t  esp_bluedroid_get_status ()
+{
+    return (BluedroidStatus_g);
+}
+
+esp_err_t  esp_bluedroid_init ()
+{
+
+    if (fBtHostMemReleased_g || (BtCtrlStatus_g != ESP_BT_CONTROLLER_STATUS_ENABLED) || (BluedroidStatus_g != ESP_BLUEDROID_STATUS_UNINITIALIZED))
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BluedroidStatus_g = ESP_BLUEDROID_STATUS_INITIALIZED;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bluedroid_deinit ()
+{
+
+    if (BluedroidStatus_g != ESP_BLUEDROID_STATUS_INITIALIZED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BluedroidStatus_g = ESP_BLUEDROID_STATUS_UNINITIALIZED;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bluedroid_enable ()
+{
+
+    if (BluedroidStatus_g != ESP_BLUEDROID_STATUS_INITIALIZED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BluedroidStatus_g = ESP_BLUEDROID_STATUS_ENABLED;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_bluedroid_disable ()
+{
+
+    if (BluedroidStatus_g != ESP_BLUEDROID_STATUS_ENABLED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    BluedroidStatus_g = ESP_BLUEDROID_STATUS_INITIALIZED;
+    fAdvertising_g    = false;
+    fConnected_g      = false;
+
+    return (ESP_OK);
+
+}
+
+//---------------------------------------------------------------------------
+
+esp_err_t  esp_ble_gap_set_device_name (const char* pszName_p)
+{
+
+    if (BluedroidStatus_g != ESP_BLUEDROID_STATUS_ENABLED)
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+    snprintf(BtStats_g.m_szDeviceName, sizeof(BtStats_g.m_szDeviceName), "%s", pszName_p);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ble_gap_update_conn_params (esp_ble_conn_update_params_t* pParams_p)
+{
+
+esp_ble_gap_cb_param_t  Param;
+
+    if ( !fConnected_g )
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.update_conn_params.status   = ESP_BT_STATUS_SUCCESS;
+    memcpy(Param.update_conn_params.bda, pParams_p->bda, sizeof(esp_bd_addr_t));
+    Param.update_conn_params.min_int  = pParams_p->min_int;
+    Param.update_conn_params.max_int  = pParams_p->max_int;
+    Param.update_conn_params.latency  = pParams_p->latency;
+    Param.update_conn_params.conn_int = pParams_p->max_int;
+    Param.update_conn_params.timeout  = pParams_p->timeout;
+
+    DeferredList_g.push_back([Param]() mutable
+    {
+        if (pfnCustomGapHdlr_g != NULL)
+        {
+            pfnCustomGapHdlr_g(ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT, &Param);
+        }
+    });
+
+    return (ESP_OK);
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          G A T T   S E R V E R   A P I                                  //
+//                                                                         //
+//=========================================================================//
+
+esp_err_t  esp_ble_gatts_create_attr_tab (const esp_gatts_attr_db_t* pGattsAttrDb_p, esp_gatt_if_t GattsIf_p, uint16_t ui16MaxNumAttr_p, uint8_t ui8SrvInstId_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+tHostSimAttrTab           AttrTab;
+tHostSimAttr              Attr;
+esp_gatt_status_t         Status;
+const esp_attr_desc_t*    pDesc;
+uint16_t                  ui16Idx;
+
+    if ((pGattsAttrDb_p == NULL) || (ui16MaxNumAttr_p == 0) || (GattsIf_p != HOSTSIM_BLE_GATTS_IF) || (BluedroidStatus_g != ESP_BLUEDROID_STATUS_ENABLED))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+
+    Status = ESP_GATT_OK;
+    AttrTab.m_ui8InstId = ui8SrvInstId_p;
+    for (ui16Idx=0; ui16Idx<ui16MaxNumAttr_p; ui16Idx++)
+    {
+        pDesc = &pGattsAttrDb_p[ui16Idx].att_desc;
+        if ((pDesc->uuid_p == NULL) || ((pDesc->uuid_length != ESP_UUID_LEN_16) && (pDesc->uuid_length != ESP_UUID_LEN_128)) ||
+            (pDesc->max_length > ESP_GATT_MAX_ATTR_LEN) || (pDesc->length > pDesc->max_length) ||
+            ((pDesc->length > 0) && (pDesc->value == NULL)))
+        {
+            Status = ESP_GATT_INVALID_ATTR_LEN;
+            break;
+        }
+        Attr.m_ui8AutoRsp = pGattsAttrDb_p[ui16Idx].attr_control.auto_rsp;
+        if (pDesc->uuid_length == ESP_UUID_LEN_16)
+        {
+            Attr.m_Uuid = BLEUUID((uint16_t)(pDesc->uuid_p[0] | (pDesc->uuid_p[1] << 8)));
+        }
+        else
+        {
+            Attr.m_Uuid = BLEUUID();
+            Attr.m_Uuid.getNative()->len = ESP_UUID_LEN_128;
+            memcpy(Attr.m_Uuid.getNative()->uuid.uuid128, pDesc->uuid_p, ESP_UUID_LEN_128);
+        }
+        Attr.m_fDecl      = Attr.m_Uuid.equals(BLEUUID((uint16_t)ESP_GATT_UUID_PRI_SERVICE)) ||
+                            Attr.m_Uuid.equals(BLEUUID((uint16_t)ESP_GATT_UUID_SEC_SERVICE)) ||
+                            Attr.m_Uuid.equals(BLEUUID((uint16_t)ESP_GATT_UUID_CHAR_DECLARE));
+        Attr.m_ui16Perm   = pDesc->perm;
+        Attr.m_ui16MaxLen = pDesc->max_length;
+        Attr.m_ui16Handle = ui16NextHandle_g + ui16Idx;
+        Attr.m_Value.assign(pDesc->value, pDesc->value + pDesc->length);
+        AttrTab.m_AttrList.push_back(Attr);
+        AttrTab.m_HandleList.push_back(Attr.m_ui16Handle);
+    }
+    if ((Status == ESP_GATT_OK) && !AttrTab.m_AttrList[0].m_Uuid.equals(BLEUUID((uint16_t)ESP_GATT_UUID_PRI_SERVICE)))
+    {
+        Status = ESP_GATT_ERROR;                // a table has to start with the service declaration
+    }
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.add_attr_tab.status      = Status;
+    Param.add_attr_tab.svc_inst_id = ui8SrvInstId_p;
+    if (Status == ESP_GATT_OK)
+    {
+        AttrTab.m_ui16ServiceHdl = AttrTab.m_HandleList[0];
+        ui16NextHandle_g += ui16MaxNumAttr_p;
+        AttrTabList_g.push_back(AttrTab);
+        Param.add_attr_tab.svc_uuid   = *AttrTabList_g.back().m_AttrList[0].m_Uuid.getNative();
+        Param.add_attr_tab.num_handle = ui16MaxNumAttr_p;
+        Param.add_attr_tab.handles    = AttrTabList_g.back().m_HandleList.data();
+    }
+    DispatchGattsEvent(ESP_GATTS_CREAT_ATTR_TAB_EVT, &Param);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ble_gatts_start_service (uint16_t ui16ServiceHdl_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.start.status         = ESP_GATT_OK;
+    Param.start.service_handle = ui16ServiceHdl_p;
+    if (FindAttrByHandle(ui16ServiceHdl_p) == NULL)
+    {
+        Param.start.status = ESP_GATT_INVALID_HANDLE;
+    }
+    DispatchGattsEvent(ESP_GATTS_START_EVT, &Param);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ble_gatts_delete_service (uint16_t ui16ServiceHdl_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+size_t                    Idx;
+
+    for (Idx=0; Idx<AttrTabList_g.size(); Idx++)
+    {
+        if (AttrTabList_g[Idx].m_ui16ServiceHdl == ui16ServiceHdl_p)
+        {
+            AttrTabList_g.erase(AttrTabList_g.begin() + Idx);
+            memset(&Param, 0x00, sizeof(Param));
+            DispatchGattsEvent(ESP_GATTS_DELETE_EVT, &Param);
+            return (ESP_OK);
+        }
+    }
+
+    return (ESP_ERR_INVALID_ARG);
+
+}
+
+esp_err_t  esp_ble_gatts_set_attr_value (uint16_t ui16AttrHdl_p, uint16_t ui16Len_p, const uint8_t* pabValue_p)
+{
+
+tHostSimAttr*  pAttr;
+
+    if ((pAttr = FindAttrByHandle(ui16AttrHdl_p)) == NULL)
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    if (ui16Len_p > pAttr->m_ui16MaxLen)
+    {
+        return (ESP_ERR_INVALID_SIZE);
+    }
+    pAttr->m_Value.assign(pabValue_p, pabValue_p + ui16Len_p);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ble_gatts_get_attr_value (uint16_t ui16AttrHdl_p, uint16_t* pui16Len_p, const uint8_t** ppabValue_p)
+{
+
+tHostSimAttr*  pAttr;
+
+    if ((pAttr = FindAttrByHandle(ui16AttrHdl_p)) == NULL)
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    *pui16Len_p  = (uint16_t)pAttr->m_Value.size();
+    *ppabValue_p = pAttr->m_Value.data();
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ble_gatts_send_indicate (esp_gatt_if_t GattsIf_p, uint16_t ui16ConnId_p, uint16_t ui16AttrHdl_p, uint16_t ui16ValueLen_p, uint8_t* pabValue_p, bool fNeedConfirm_p)
+{
+
+    if ((GattsIf_p != HOSTSIM_BLE_GATTS_IF) || (ui16ValueLen_p > (ui16ConnMtu_g - 3)))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    RecordNotify(ui16AttrHdl_p, pabValue_p, ui16ValueLen_p);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ble_gatts_send_response (esp_gatt_if_t GattsIf_p, uint16_t ui16ConnId_p, uint32_t ui32TransId_p, esp_gatt_status_t Status_p, esp_gatt_rsp_t* pRsp_p)
+{
+
+    if ((GattsIf_p != HOSTSIM_BLE_GATTS_IF) || (ui32TransId_p != ui32TransId_g) || fRspReceived_g)
+    {
+        return (ESP_ERR_INVALID_STATE);         // no outstanding request
+    }
+    fRspReceived_g = true;
+    RspStatus_g    = Status_p;
+    if (pRsp_p != NULL)
+    {
+        RspData_g = *pRsp_p;
+    }
+    else
+    {
+        memset(&RspData_g, 0x00, sizeof(RspData_g));
+    }
+
+    return (ESP_OK);
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          B L E   L I B R A R Y                                          //
+//                                                                         //
+//=========================================================================//
+
+//---------------------------------------------------------------------------
+//  BLEUUID
+//---------------------------------------------------------------------------
+
+BLEUUID::BLEUUID ()
+{
+    memset(&m_Uuid, 0x00, sizeof(m_Uuid));
+}
+
+BLEUUID::BLEUUID (uint16_t ui16Uuid_p)
+{
+    memset(&m_Uuid, 0x00, sizeof(m_Uuid));
+    m_Uuid.len         = ESP_UUID_LEN_16;
+    m_Uuid.uuid.uuid16 = ui16Uuid_p;
+}
+
+BLEUUID::BLEUUID (const std::string& strUuid_p)
+    : BLEUUID(strUuid_p.c_str())
+{
+}
+
+BLEUUID::BLEUUID (const char* pszUuid_p)
+{
+
+std::string   strHex;
+unsigned int  uiIdx;
+
+    memset(&m_Uuid, 0x00, sizeof(m_Uuid));
+    for ( ; *pszUuid_p != '\0'; pszUuid_p++)
+    {
+        if (*pszUuid_p != '-')
+        {
+            strHex += *pszUuid_p;
+        }
+    }
+
+    if (strHex.length() == 4)
+    {
+        m_Uuid.len         = ESP_UUID_LEN_16;
+        m_Uuid.uuid.uuid16 = (uint16_t)strtoul(strHex.c_str(), NULL, 16);
+    }
+    else if (strHex.length() == 8)
+    {
+        m_Uuid.len         = ESP_UUID_LEN_32;
+        m_Uuid.uuid.uuid32 = (uint32_t)strtoul(strHex.c_str(), NULL, 16);
+    }
+    else if (strHex.length() == 32)
+    {
+        m_Uuid.len = ESP_UUID_LEN_128;
+        for (uiIdx=0; uiIdx<ESP_UUID_LEN_128; uiIdx++)
+        {
+            m_Uuid.uuid.uuid128[ESP_UUID_LEN_128 - 1 - uiIdx] = (uint8_t)strtoul(strHex.substr(2 * uiIdx, 2).c_str(), NULL, 16);
+        }
+    }
+
+}
+
+static  void  To128 (const esp_bt_uuid_t* pUuid_p, uint8_t* pabUuid128_p)
+{
+
+uint32_t  ui32Short;
+
+    if (pUuid_p->len == ESP_UUID_LEN_128)
+    {
+        memcpy(pabUuid128_p, pUuid_p->uuid.uuid128, ESP_UUID_LEN_128);
+        return;
+    }
+
+    ui32Short = (pUuid_p->len == ESP_UUID_LEN_16) ? pUuid_p->uuid.uuid16 : pUuid_p->uuid.uuid32;
+    memcpy(pabUuid128_p, abBleBaseUuid_g, ESP_UUID_LEN_128);
+    pabUuid128_p[12] = (uint8_t)(ui32Short);
+    pabUuid128_p[13] = (uint8_t)(ui32Short >> 8);
+    pabUuid128_p[14] = (uint8_t)(ui32Short >> 16);
+    pabUuid128_p[15] = (uint8_t)(ui32Short >> 24);
+
+    return;
+
+}
+
+bool  BLEUUID::equals (const BLEUUID& Uuid_p) const
+{
+
+uint8_t  abUuidA[ESP_UUID_LEN_128];
+uint8_t  abUuidB[ESP_UUID_LEN_128];
+
+    if ((m_Uuid.len == 0) || (Uuid_p.m_Uuid.len == 0))
+    {
+        return (false);
+    }
+    To128(&m_Uuid, abUuidA);
+    To128(&Uuid_p.m_Uuid, abUuidB);
+
+    return (memcmp(abUuidA, abUuidB, ESP_UUID_LEN_128) == 0);
+
+}
+
+bool  BLEUUID::equals (const uint8_t* pabUuid_p, uint16_t ui16UuidLen_p) const
+{
+
+BLEUUID  Uuid;
+
+    if (ui16UuidLen_p == ESP_UUID_LEN_16)
+    {
+        Uuid = BLEUUID((uint16_t)(pabUuid_p[0] | (pabUuid_p[1] << 8)));
+    }
+    else if (ui16UuidLen_p == ESP_UUID_LEN_128)
+    {
+        Uuid.m_Uuid.len = ESP_UUID_LEN_128;
+        memcpy(Uuid.m_Uuid.uuid.uuid128, pabUuid_p, ESP_UUID_LEN_128);
+    }
+
+    return (equals(Uuid));
+
+}
+
+std::string  BLEUUID::toString () const
+{
+
+uint8_t       abUuid[ESP_UUID_LEN_128];
+char          szUuid[40];
+char*         pszPos;
+unsigned int  uiIdx;
+
+    if (m_Uuid.len == 0)
+    {
+        return ("<NULL>");
+    }
+
+    To128(&m_Uuid, abUuid);
+    pszPos = szUuid;
+    for (uiIdx=0; uiIdx<ESP_UUID_LEN_128; uiIdx++)
+    {
+        if ((uiIdx == 4) || (uiIdx == 6) || (uiIdx == 8) || (uiIdx == 10))
+        {
+            *pszPos++ = '-';
+        }
+        pszPos += sprintf(pszPos, "%02x", abUuid[ESP_UUID_LEN_128 - 1 - uiIdx]);
+    }
+
+    return (std::string(szUuid));
+
+}
+
+//---------------------------------------------------------------------------
+//  BLEDescriptor
+//---------------------------------------------------------------------------
+
+BLEDescriptor::BLEDescriptor (const char* pszUuid_p, uint16_t ui16MaxLen_p)
+    : BLEDescriptor(BLEUUID(pszUuid_p), ui16MaxLen_p)
+{
+}
+
+BLEDescriptor::BLEDescriptor (BLEUUID Uuid_p, uint16_t ui16MaxLen_p)
+    : m_Uuid(Uuid_p), m_ui16MaxLen(ui16MaxLen_p), m_ui16Handle(0)
+{
+}
+
+BLEDescriptor::~BLEDescriptor ()
+{
+}
+
+void  BLEDescriptor::setValue (const uint8_t* pabData_p, size_t Length_p)
+{
+    if (Length_p > m_ui16MaxLen)
+    {
+        return;                                 // as the library: value is ignored
+    }
+    m_strValue.assign((const char*)pabData_p, Length_p);
+}
+
+void  BLEDescriptor::setValue (const std::string& strValue_p)
+{
+    setValue((const uint8_t*)strValue_p.data(), strValue_p.length());
+}
+
+//---------------------------------------------------------------------------
+//  BLECharacteristicCallbacks
+//---------------------------------------------------------------------------
+
+BLECharacteristicCallbacks::~BLECharacteristicCallbacks ()
+{
+}
+
+void  BLECharacteristicCallbacks::onRead (BLECharacteristic* pCharacteristic_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+    onRead(pCharacteristic_p);
+}
+
+void  BLECharacteristicCallbacks::onRead (BLECharacteristic* pCharacteristic_p)
+{
+}
+
+void  BLECharacteristicCallbacks::onWrite (BLECharacteristic* pCharacteristic_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+    onWrite(pCharacteristic_p);
+}
+
+void  BLECharacteristicCallbacks::onWrite (BLECharacteristic* pCharacteristic_p)
+{
+}
+
+//---------------------------------------------------------------------------
+//  BLECharacteristic
+//---------------------------------------------------------------------------
+
+BLECharacteristic::BLECharacteristic (const char* pszUuid_p, uint32_t ui32Properties_p)
+    : BLECharacteristic(BLEUUID(pszUuid_p), ui32Properties_p)
+{
+}
+
+BLECharacteristic::BLECharacteristic (BLEUUID Uuid_p, uint32_t ui32Properties_p)
+    : m_Uuid(Uuid_p), m_ui32Properties(ui32Properties_p), m_ui16Handle(0), m_pCallbacks(NULL), m_pService(NULL)
+{
+}
+
+BLECharacteristic::~BLECharacteristic ()
+{
+    // as the library: descriptors and callbacks are owned by the application
+}
+
+void  BLECharacteristic::setValue (const uint8_t* pabData_p, size_t Length_p)
+{
+    if (Length_p > ESP_GATT_MAX_ATTR_LEN)
+    {
+        return;                                 // as the library: value is ignored
+    }
+    m_strValue.assign((const char*)pabData_p, Length_p);
+}
+
+void  BLECharacteristic::setValue (const std::string& strValue_p)
+{
+    setValue((const uint8_t*)strValue_p.data(), strValue_p.length());
+}
+
+void  BLECharacteristic::setValue (uint16_t& ui16Value_p)
+{
+    setValue((const uint8_t*)&ui16Value_p, sizeof(ui16Value_p));
+}
+
+void  BLECharacteristic::setValue (uint32_t& ui32Value_p)
+{
+    setValue((const uint8_t*)&ui32Value_p, sizeof(ui32Value_p));
+}
+
+void  BLECharacteristic::setValue (int& iValue_p)
+{
+    setValue((const uint8_t*)&iValue_p, sizeof(iValue_p));
+}
+
+void  BLECharacteristic::setValue (float& fValue_p)
+{
+    setValue((const uint8_t*)&fValue_p, sizeof(fValue_p));
+}
+
+void  BLECharacteristic::setValue (double& dValue_p)
+{
+    setValue((const uint8_t*)&dValue_p, sizeof(dValue_p));
+}
+
+void  BLECharacteristic::notify (bool fIsNotification_p)
+{
+
+size_t  Length;
+
+    // as the library: the value is truncated to (MTU - 3)
+    Length = m_strValue.length();
+    if (Length > (size_t)(ui16ConnMtu_g - 3))
+    {
+        Length = ui16ConnMtu_g - 3;
+    }
+    RecordNotify(m_ui16Handle, (const uint8_t*)m_strValue.data(), Length);
+
+    return;
+
+}
+
+void  BLECharacteristic::setCallbacks (BLECharacteristicCallbacks* pCallbacks_p)
+{
+    m_pCallbacks = pCallbacks_p;
+}
+
+void  BLECharacteristic::addDescriptor (BLEDescriptor* pDescriptor_p)
+{
+
+    m_DescriptorList.push_back(pDescriptor_p);
+    if (m_pService != NULL)
+    {
+        pDescriptor_p->m_ui16Handle = m_pService->m_ui16NextHandle++;
+    }
+
+    return;
+
+}
+
+void  BLECharacteristic::handleGATTServerEvent (esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+
+esp_gatt_rsp_t  Rsp;
+size_t          Length;
+
+    switch (Event_p)
+    {
+        case ESP_GATTS_WRITE_EVT:
+        {
+            if ((pParam_p->write.handle != m_ui16Handle) || pParam_p->write.is_prep)
+            {
+                break;
+            }
+            // the library answers before the value is passed to the application
+            if ( pParam_p->write.need_rsp )
+            {
+                esp_ble_gatts_send_response(GattsIf_p, pParam_p->write.conn_id, pParam_p->write.trans_id, ESP_GATT_OK, NULL);
+            }
+            setValue(pParam_p->write.value, pParam_p->write.len);
+            if (m_pCallbacks != NULL)
+            {
+                m_pCallbacks->onWrite(this, pParam_p);
+            }
+            break;
+        }
+
+        case ESP_GATTS_READ_EVT:
+        {
+            if ((pParam_p->read.handle != m_ui16Handle) || !pParam_p->read.need_rsp)
+            {
+                break;
+            }
+            if ((pParam_p->read.offset == 0) && (m_pCallbacks != NULL))
+            {
+                m_pCallbacks->onRead(this, pParam_p);
+            }
+            memset(&Rsp, 0x00, sizeof(Rsp));
+            Length = (pParam_p->read.offset < m_strValue.length()) ? (m_strValue.length() - pParam_p->read.offset) : 0;
+            if (Length > (size_t)(ui16ConnMtu_g - 1))
+            {
+                Length = ui16ConnMtu_g - 1;
+            }
+            Rsp.attr_value.handle = m_ui16Handle;
+            Rsp.attr_value.offset = pParam_p->read.offset;
+            Rsp.attr_value.len    = (uint16_t)Length;
+            memcpy(Rsp.attr_value.value, m_strValue.data() + pParam_p->read.offset, Length);
+            esp_ble_gatts_send_response(GattsIf_p, pParam_p->read.conn_id, pParam_p->read.trans_id, ESP_GATT_OK, &Rsp);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return;
+
+}
+
+//---------------------------------------------------------------------------
+//  BLEService
+//---------------------------------------------------------------------------
+
+BLEService::BLEService (BLEUUID Uuid_p, uint16_t ui16NumHandles_p)
+    : m_Uuid(Uuid_p), m_ui16NumHandles(ui16NumHandles_p), m_ui16Handle(0), m_ui16NextHandle(0), m_fStarted(false), m_pServer(NULL)
+{
+}
+
+BLEService::~BLEService ()
+{
+    // as the library: characteristics are owned by the application
+}
+
+BLECharacteristic*  BLEService::createCharacteristic (const char* pszUuid_p, uint32_t ui32Properties_p)
+{
+    return (createCharacteristic(BLEUUID(pszUuid_p), ui32Properties_p));
+}
+
+BLECharacteristic*  BLEService::createCharacteristic (BLEUUID Uuid_p, uint32_t ui32Properties_p)
+{
+
+BLECharacteristic*  pCharacteristic;
+
+    pCharacteristic = new BLECharacteristic(Uuid_p, ui32Properties_p);
+    addCharacteristic(pCharacteristic);
+
+    return (pCharacteristic);
+
+}
+
+void  BLEService::addCharacteristic (BLECharacteristic* pCharacteristic_p)
+{
+
+    pCharacteristic_p->m_pService   = this;
+    m_ui16NextHandle++;                                         // characteristic declaration
+    pCharacteristic_p->m_ui16Handle = m_ui16NextHandle++;       // value
+    m_CharacteristicList.push_back(pCharacteristic_p);
+
+    return;
+
+}
+
+BLECharacteristic*  BLEService::getCharacteristic (BLEUUID Uuid_p)
+{
+
+    for (BLECharacteristic* pCharacteristic : m_CharacteristicList)
+    {
+        if (pCharacteristic->m_Uuid.equals(Uuid_p))
+        {
+            return (pCharacteristic);
+        }
+    }
+
+    return (NULL);
+
+}
+
+void  BLEService::start ()
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    if (m_ui16NextHandle > (m_ui16Handle + m_ui16NumHandles))
+    {
+        fprintf(stderr, "HostSim: service %s needs %u handles, only %u reserved\n",
+                m_Uuid.toString().c_str(), (unsigned)(m_ui16NextHandle - m_ui16Handle), (unsigned)m_ui16NumHandles);
+        return;                                 // on the target the surplus attributes are missing
+    }
+    m_fStarted = true;
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.start.status         = ESP_GATT_OK;
+    Param.start.service_handle = m_ui16Handle;
+    DispatchGattsEvent(ESP_GATTS_START_EVT, &Param);
+
+    return;
+
+}
+
+void  BLEService::stop ()
+{
+    m_fStarted = false;
+}
+
+void  BLEService::executeDelete ()
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    m_fStarted = false;
+    memset(&Param, 0x00, sizeof(Param));
+    DispatchGattsEvent(ESP_GATTS_DELETE_EVT, &Param);
+
+    return;
+
+}
+
+//---------------------------------------------------------------------------
+//  BLEServerCallbacks
+//---------------------------------------------------------------------------
+
+BLEServerCallbacks::~BLEServerCallbacks ()
+{
+}
+
+void  BLEServerCallbacks::onConnect (BLEServer* pServer_p)
+{
+}
+
+void  BLEServerCallbacks::onConnect (BLEServer* pServer_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+}
+
+void  BLEServerCallbacks::onDisconnect (BLEServer* pServer_p)
+{
+}
+
+void  BLEServerCallbacks::onDisconnect (BLEServer* pServer_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+}
+
+void  BLEServerCallbacks::onMtuChanged (BLEServer* pServer_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+}
+
+//---------------------------------------------------------------------------
+//  BLEAdvertising
+//---------------------------------------------------------------------------
+
+void  BLEAdvertising::start ()
+{
+    if ((BluedroidStatus_g == ESP_BLUEDROID_STATUS_ENABLED) && !fConnected_g)
+    {
+        fAdvertising_g = true;
+    }
+}
+
+void  BLEAdvertising::stop ()
+{
+    fAdvertising_g = false;
+}
+
+//---------------------------------------------------------------------------
+//  BLEServer
+//---------------------------------------------------------------------------
+
+BLEServer::BLEServer ()
+    : m_pCallbacks(NULL), m_ui16ConnId(0xFFFF), m_uiConnectedCount(0)
+{
+}
+
+BLEServer::~BLEServer ()
+{
+}
+
+BLEService*  BLEServer::createService (const char* pszUuid_p)
+{
+    return (createService(BLEUUID(pszUuid_p)));
+}
+
+BLEService*  BLEServer::createService (BLEUUID Uuid_p, uint32_t ui32NumHandles_p, uint8_t ui8InstId_p)
+{
+
+BLEService*  pService;
+
+    pService = new BLEService(Uuid_p, (uint16_t)ui32NumHandles_p);
+    pService->m_pServer        = this;
+    pService->m_ui16Handle     = ui16NextHandle_g;
+    pService->m_ui16NextHandle = ui16NextHandle_g + 1;
+    ui16NextHandle_g += (uint16_t)ui32NumHandles_p;
+    m_ServiceList.push_back(pService);
+
+    return (pService);
+
+}
+
+void  BLEServer::removeService (BLEService* pService_p)
+{
+
+size_t  Idx;
+
+    pService_p->executeDelete();
+    for (Idx=0; Idx<m_ServiceList.size(); Idx++)
+    {
+        if (m_ServiceList[Idx] == pService_p)
+        {
+            m_ServiceList.erase(m_ServiceList.begin() + Idx);
+            break;
+        }
+    }
+
+    return;
+
+}
+
+void  BLEServer::setCallbacks (BLEServerCallbacks* pCallbacks_p)
+{
+    m_pCallbacks = pCallbacks_p;
+}
+
+BLEAdvertising*  BLEServer::getAdvertising ()
+{
+    return (BLEDevice::getAdvertising());
+}
+
+void  BLEServer::startAdvertising ()
+{
+    BLEDevice::startAdvertising();
+}
+
+void  BLEServer::disconnect (uint16_t ui16ConnId_p)
+{
+
+    if (fConnected_g && (ui16ConnId_p == HOSTSIM_BLE_CONN_ID))
+    {
+        DeferredList_g.push_back([]()
+        {
+            HostSimBleDisconnect();
+        });
+    }
+
+    return;
+
+}
+
+void  BLEServer::handleGATTServerEvent (esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p)
+{
+
+    switch (Event_p)
+    {
+        case ESP_GATTS_CONNECT_EVT:
+        {
+            m_ui16ConnId = pParam_p->connect.conn_id;
+            if (m_pCallbacks != NULL)
+            {
+                m_pCallbacks->onConnect(this);
+                m_pCallbacks->onConnect(this, pParam_p);
+            }
+            m_uiConnectedCount++;
+            break;
+        }
+
+        case ESP_GATTS_DISCONNECT_EVT:
+        {
+            if (m_pCallbacks != NULL)
+            {
+                m_pCallbacks->onDisconnect(this);
+                m_pCallbacks->onDisconnect(this, pParam_p);
+            }
+            if (m_uiConnectedCount > 0)
+            {
+                m_uiConnectedCount--;
+            }
+            break;
+        }
+
+        case ESP_GATTS_MTU_EVT:
+        {
+            if (m_pCallbacks != NULL)
+            {
+                m_pCallbacks->onMtuChanged(this, pParam_p);
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    // copy of the list, a callback may remove a service
+    std::vector<BLEService*>  ServiceList = m_ServiceList;
+    for (BLEService* pService : ServiceList)
+    {
+        for (BLECharacteristic* pCharacteristic : pService->m_CharacteristicList)
+        {
+            pCharacteristic->handleGATTServerEvent(Event_p, GattsIf_p, pParam_p);
+        }
+    }
+
+    return;
+
+}
+
+//---------------------------------------------------------------------------
+//  BLEDevice
+//---------------------------------------------------------------------------
+
+void  BLEDevice::init (std::string strDeviceName_p)
+{
+
+esp_bt_controller_config_t  BtCfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
+
+    if ( fBleInitialized_g )
+    {
+        return;
+    }
+    fBleInitialized_g = true;               // as the library: set before the stack is started
+
+    // btStart()
+    if (esp_bt_controller_get_status() == ESP_BT_CONTROLLER_STATUS_IDLE)
+    {
+        if (esp_bt_controller_init(&BtCfg) != ESP_OK)
+        {
+            return;
+        }
+    }
+    if (esp_bt_controller_get_status() == ESP_BT_CONTROLLER_STATUS_INITED)
+    {
+        if (esp_bt_controller_enable(ESP_BT_MODE_BLE) != ESP_OK)
+        {
+            return;
+        }
+    }
+
+    if (esp_bluedroid_get_status() == ESP_BLUEDROID_STATUS_UNINITIALIZED)
+    {
+        if (esp_bluedroid_init() != ESP_OK)
+        {
+            return;
+        }
+    }
+    if (esp_bluedroid_get_status() != ESP_BLUEDROID_STATUS_ENABLED)
+    {
+        if (esp_bluedroid_enable() != ESP_OK)
+        {
+            return;
+        }
+    }
+
+    esp_ble_gap_set_device_name(strDeviceName_p.c_str());
+
+    return;
+
+}
+
+void  BLEDevice::deinit (bool fReleaseMemory_p)
+{
+
+    if ( !fBleInitialized_g )
+    {
+        return;
+    }
+
+    esp_bluedroid_disable();
+    esp_bluedroid_deinit();
+    esp_bt_controller_disable();
+    esp_bt_controller_deinit();
+    AttrTabList_g.clear();
+    NotifyMap_g.clear();
+    pBleServer_g = NULL;                                    // no further events, the application may delete the server
+
+    if ( fReleaseMemory_p )
+    {
+        esp_bt_controller_mem_release(ESP_BT_MODE_BTDM);    // as the library: stays 'initialized'
+    }
+    else
+    {
+        fBleInitialized_g = false;
+    }
+
+    return;
+
+}
+
+bool  BLEDevice::getInitialized ()
+{
+    return (fBleInitialized_g);
+}
+
+BLEServer*  BLEDevice::createServer ()
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    pBleServer_g = new BLEServer();
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.reg.status = (BluedroidStatus_g == ESP_BLUEDROID_STATUS_ENABLED) ? ESP_GATT_OK : ESP_GATT_ERROR;
+    Param.reg.app_id = 0;
+    DispatchGattsEvent(ESP_GATTS_REG_EVT, &Param);
+
+    return (pBleServer_g);
+
+}
+
+BLEServer*  BLEDevice::getServer ()
+{
+    return (pBleServer_g);
+}
+
+esp_err_t  BLEDevice::setMTU (uint16_t ui16Mtu_p)
+{
+    ui16BleLocalMtu_g = ui16Mtu_p;
+    return (ESP_OK);
+}
+
+uint16_t  BLEDevice::getMTU ()
+{
+    return (ui16BleLocalMtu_g);
+}
+
+BLEAdvertising*  BLEDevice::getAdvertising ()
+{
+    return (&BleAdvertising_g);
+}
+
+void  BLEDevice::startAdvertising ()
+{
+    getAdvertising()->start();
+}
+
+void  BLEDevice::stopAdvertising ()
+{
+    getAdvertising()->stop();
+}
+
+void  BLEDevice::setCustomGapHandler (void (*pfnHandler_p)(esp_gap_ble_cb_event_t Event_p, esp_ble_gap_cb_param_t* pParam_p))
+{
+    pfnCustomGapHdlr_g = pfnHandler_p;
+}
+
+void  BLEDevice::setCustomGattsHandler (esp_gatts_cb_t pfnHandler_p)
+{
+    pfnCustomGattsHdlr_g = pfnHandler_p;
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          S I M U L A T E D   C L I E N T                                //
+//                                                                         //
+//=========================================================================//
+
+int  HostSimBleConnect ()
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    if ((pBleServer_g == NULL) || fConnected_g || !fAdvertising_g)
+    {
+        return (-1);
+    }
+
+    // the controller stops advertising as soon as a connection is established
+    fAdvertising_g = false;
+    fConnected_g   = true;
+    ui16ConnMtu_g  = HOSTSIM_BLE_DEF_MTU;
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.connect.conn_id              = HOSTSIM_BLE_CONN_ID;
+    Param.connect.conn_params.interval = 24;            // 30 ms
+    Param.connect.conn_params.latency  = 0;
+    Param.connect.conn_params.timeout  = 400;           // 4 s
+    DispatchGattsEvent(ESP_GATTS_CONNECT_EVT, &Param);
+    ProcessDeferred();
+
+    return (0);
+
+}
+
+int  HostSimBleDisconnect ()
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    if ( !fConnected_g )
+    {
+        return (-1);
+    }
+
+    // advertising is not restarted by the stack
+    fConnected_g  = false;
+    ui16ConnMtu_g = HOSTSIM_BLE_DEF_MTU;
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.disconnect.conn_id = HOSTSIM_BLE_CONN_ID;
+    Param.disconnect.reason  = 0x13;                    // remote user terminated connection
+    DispatchGattsEvent(ESP_GATTS_DISCONNECT_EVT, &Param);
+    ProcessDeferred();
+
+    return (0);
+
+}
+
+int  HostSimBleSetMtu (uint16_t ui16Mtu_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    if ( !fConnected_g )
+    {
+        return (-1);
+    }
+
+    ui16ConnMtu_g = (ui16Mtu_p < ui16BleLocalMtu_g) ? ui16Mtu_p : ui16BleLocalMtu_g;
+    if (ui16ConnMtu_g < HOSTSIM_BLE_DEF_MTU)
+    {
+        ui16ConnMtu_g = HOSTSIM_BLE_DEF_MTU;
+    }
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.mtu.conn_id = HOSTSIM_BLE_CONN_ID;
+    Param.mtu.mtu     = ui16ConnMtu_g;
+    DispatchGattsEvent(ESP_GATTS_MTU_EVT, &Param);
+    ProcessDeferred();
+
+    return (ui16ConnMtu_g);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  esp_gatt_status_t  ClientWriteReq (uint16_t ui16Handle_p, const uint8_t* pabData_p, size_t Size_p, uint16_t ui16Offset_p, bool fPrep_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.write.conn_id  = HOSTSIM_BLE_CONN_ID;
+    Param.write.trans_id = ++ui32TransId_g;
+    Param.write.handle   = ui16Handle_p;
+    Param.write.offset   = ui16Offset_p;
+    Param.write.need_rsp = true;
+    Param.write.is_prep  = fPrep_p;
+    Param.write.len      = (uint16_t)Size_p;
+    Param.write.value    = (uint8_t*)pabData_p;
+
+    fRspReceived_g = false;
+    DispatchGattsEvent(ESP_GATTS_WRITE_EVT, &Param);
+
+    return (fRspReceived_g ? RspStatus_g : ESP_GATT_ERROR);      // no response = ATT transaction timeout
+
+}
+
+int  HostSimBleWrite (const char* pszUuid_p, const void* pvData_p, size_t Size_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+BLEUUID                   Uuid(pszUuid_p);
+BLECharacteristic*        pCharacteristic;
+tHostSimAttr*             pAttr;
+const uint8_t*            pabData = (const uint8_t*)pvData_p;
+esp_gatt_status_t         Status;
+size_t                    ChunkSize;
+size_t                    Offset;
+
+    if ( !fConnected_g )
+    {
+        return (-1);
+    }
+
+    // ---- characteristic of the library (Long Write is collected by the library) ----
+    if ((pCharacteristic = FindCharacteristic(Uuid)) != NULL)
+    {
+        if ((pCharacteristic->getProperties() & (BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_WRITE_NR)) == 0)
+        {
+            return (ESP_GATT_WRITE_NOT_PERMIT);
+        }
+        Status = ClientWriteReq(pCharacteristic->getHandle(), pabData, Size_p, 0, false);
+        ProcessDeferred();
+        return (Status);
+    }
+
+    // ---- value of an attribute table ----
+    if ((pAttr = FindAttrByUuid(Uuid)) == NULL)
+    {
+        return (-1);
+    }
+    if ((pAttr->m_ui16Perm & ESP_GATT_PERM_WRITE) == 0)
+    {
+        return (ESP_GATT_WRITE_NOT_PERMIT);
+    }
+
+    if (pAttr->m_ui8AutoRsp == ESP_GATT_AUTO_RSP)
+    {
+        if (Size_p > pAttr->m_ui16MaxLen)
+        {
+            return (ESP_GATT_INVALID_ATTR_LEN);
+        }
+        pAttr->m_Value.assign(pabData, pabData + Size_p);
+        memset(&Param, 0x00, sizeof(Param));
+        Param.write.conn_id  = HOSTSIM_BLE_CONN_ID;
+        Param.write.trans_id = ++ui32TransId_g;
+        Param.write.handle   = pAttr->m_ui16Handle;
+        Param.write.need_rsp = false;
+        Param.write.len      = (uint16_t)Size_p;
+        Param.write.value    = (uint8_t*)pabData;
+        DispatchGattsEvent(ESP_GATTS_WRITE_EVT, &Param);
+        ProcessDeferred();
+        return (ESP_GATT_OK);
+    }
+
+    if (Size_p <= (size_t)(ui16ConnMtu_g - 3))
+    {
+        Status = ClientWriteReq(pAttr->m_ui16Handle, pabData, Size_p, 0, false);
+        ProcessDeferred();
+        return (Status);
+    }
+
+    // ---- Long Write: Prepare Write Requests + Execute Write Request ----
+    Status = ESP_GATT_OK;
+    for (Offset=0; (Offset < Size_p) && (Status == ESP_GATT_OK); Offset+=ChunkSize)
+    {
+        ChunkSize = Size_p - Offset;
+        if (ChunkSize > (size_t)(ui16ConnMtu_g - 5))
+        {
+            ChunkSize = ui16ConnMtu_g - 5;
+        }
+        Status = ClientWriteReq(pAttr->m_ui16Handle, &pabData[Offset], ChunkSize, (uint16_t)Offset, true);
+    }
+
+    memset(&Param, 0x00, sizeof(Param));
+    Param.exec_write.conn_id         = HOSTSIM_BLE_CONN_ID;
+    Param.exec_write.trans_id        = ++ui32TransId_g;
+    Param.exec_write.exec_write_flag = (Status == ESP_GATT_OK) ? ESP_GATT_PREP_WRITE_EXEC : ESP_GATT_PREP_WRITE_CANCEL;
+    fRspReceived_g = false;
+    DispatchGattsEvent(ESP_GATTS_EXEC_WRITE_EVT, &Param);
+    if (Status == ESP_GATT_OK)
+    {
+        Status = fRspReceived_g ? RspStatus_g : ESP_GATT_ERROR;
+    }
+    ProcessDeferred();
+
+    return (Status);
+
+}
+
+//---------------------------------------------------------------------------
+
+int  HostSimBleRead (const char* pszUuid_p, void* pvBuff_p, size_t BuffSize_p)
+{
+
+esp_ble_gatts_cb_param_t  Param;
+BLEUUID                   Uuid(pszUuid_p);
+BLECharacteristic*        pCharacteristic;
+tHostSimAttr*             pAttr;
+std::vector<uint8_t>      Value;
+uint16_t                  ui16Handle;
+bool                      fRspByApp;
+size_t                    Length;
+
+    if ( !fConnected_g )
+    {
+        return (-1);
+    }
+
+    if ((pCharacteristic = FindCharacteristic(Uuid)) != NULL)
+    {
+        if ((pCharacteristic->getProperties() & BLECharacteristic::PROPERTY_READ) == 0)
+        {
+            return (-1);
+        }
+        ui16Handle = pCharacteristic->getHandle();
+        fRspByApp  = true;
+    }
+    else if ((pAttr = FindAttrByUuid(Uuid)) != NULL)
+    {
+        if ((pAttr->m_ui16Perm & ESP_GATT_PERM_READ) == 0)
+        {
+            return (-1);
+        }
+        ui16Handle = pAttr->m_ui16Handle;
+        fRspByApp  = (pAttr->m_ui8AutoRsp == ESP_GATT_RSP_BY_APP);
+    }
+    else
+    {
+        return (-1);
+    }
+
+    // Read Request, followed by Read Blob Requests as long as a response is completely filled
+    do
+    {
+        memset(&Param, 0x00, sizeof(Param));
+        Param.read.conn_id  = HOSTSIM_BLE_CONN_ID;
+        Param.read.trans_id = ++ui32TransId_g;
+        Param.read.handle   = ui16Handle;
+        Param.read.offset   = (uint16_t)Value.size();
+        Param.read.is_long  = (Value.size() > 0);
+        Param.read.need_rsp = fRspByApp;
+        fRspReceived_g = false;
+        DispatchGattsEvent(ESP_GATTS_READ_EVT, &Param);
+
+        if ( !fRspByApp )
+        {
+            pAttr = FindAttrByHandle(ui16Handle);
+            Value = pAttr->m_Value;
+            break;
+        }
+        if (!fRspReceived_g || (RspStatus_g != ESP_GATT_OK))
+        {
+            ProcessDeferred();
+            return (-1);
+        }
+        Value.insert(Value.end(), RspData_g.attr_value.value, RspData_g.attr_value.value + RspData_g.attr_value.len);
+    }
+    while ((RspData_g.attr_value.len == (ui16ConnMtu_g - 1)) && (Value.size() < ESP_GATT_MAX_ATTR_LEN));
+    ProcessDeferred();
+
+    Length = (Value.size() < BuffSize_p) ? Value.size() : BuffSize_p;
+    memcpy(pvBuff_p, Value.data(), Length);
+
+    return ((int)Length);
+
+}
+
+//---------------------------------------------------------------------------
+
+bool  HostSimBleIsConnected ()
+{
+    return (fConnected_g);
+}
+
+bool  HostSimBleIsAdvertising ()
+{
+    return (fAdvertising_g);
+}
+
+unsigned int  HostSimBleGetNotifyCount (const char* pszUuid_p)
+{
+
+uint16_t  ui16Handle;
+
+    std::lock_guard<std::recursive_mutex>  Lock(BleMutex_g);
+    ui16Handle = FindValueHandle(pszUuid_p);
+    if ((ui16Handle == 0) || (NotifyMap_g.count(ui16Handle) == 0))
+    {
+        return (0);
+    }
+
+    return (NotifyMap_g[ui16Handle].m_uiCount);
+
+}
+
+int  HostSimBleGetLastNotify (const char* pszUuid_p, void* pvBuff_p, size_t BuffSize_p)
+{
+
+uint16_t  ui16Handle;
+size_t    Length;
+
+    std::lock_guard<std::recursive_mutex>  Lock(BleMutex_g);
+    ui16Handle = FindValueHandle(pszUuid_p);
+    if ((ui16Handle == 0) || (NotifyMap_g.count(ui16Handle) == 0))
+    {
+        return (-1);
+    }
+    std::vector<uint8_t>&  Value = NotifyMap_g[ui16Handle].m_LastValue;
+    Length = (Value.size() < BuffSize_p) ? Value.size() : BuffSize_p;
+    memcpy(pvBuff_p, Value.data(), Length);
+
+    return ((int)Length);
+
+}
+
+
+
+//  EOF
@@ -0,0 +1,634 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the ESP-IDF components used by the
+                framework (ROM CRC, SHA-256, NVS, partitions, OTA)
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "esp_rom_crc.h"
+#include "mbedtls/sha256.h"
+#include "nvs.h"
+#include "esp_partition.h"
+#include "esp_ota_ops.h"
+#include "HostSim.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Types / Variables
+//---------------------------------------------------------------------------
+
+#define HOSTSIM_APP_PART_SIZE           (1280 * 1024)
+#define HOSTSIM_DATA_PART_SIZE          (192 * 1024)
+#define HOSTSIM_FLASH_SECTOR_SIZE       4096
+#define HOSTSIM_APP_IMAGE_MAGIC         0xE9
+#define HOSTSIM_OTA_HANDLE              1
+
+typedef std::map<std::string, std::vector<uint8_t>>  tNvsNamespace;
+
+static  std::map<std::string, tNvsNamespace>    NvsStore_g;
+static  std::vector<std::string>                NvsHandleList_g;
+static  tHostSimNvsStats                        NvsStats_g;
+
+static  const esp_partition_t   aPartTab_g[] =
+{
+    //  chip  type                      subtype                             address     size                        label       encr.
+    {   NULL, ESP_PARTITION_TYPE_APP,   ESP_PARTITION_SUBTYPE_APP_OTA_0,    0x010000,   HOSTSIM_APP_PART_SIZE,      "ota_0",    false   },
+    {   NULL, ESP_PARTITION_TYPE_APP,   ESP_PARTITION_SUBTYPE_APP_OTA_1,    0x150000,   HOSTSIM_APP_PART_SIZE,      "ota_1",    false   },
+    {   NULL, ESP_PARTITION_TYPE_DATA,  ESP_PARTITION_SUBTYPE_DATA_SPIFFS,  0x290000,   HOSTSIM_DATA_PART_SIZE,     "spiffs",   false   },
+};
+
+#define HOSTSIM_NUM_PARTS               (sizeof(aPartTab_g) / sizeof(aPartTab_g[0]))
+
+static  std::vector<uint8_t>    aPartData_g[HOSTSIM_NUM_PARTS];
+static  const esp_partition_t*  pBootPart_g                 = &aPartTab_g[0];
+static  bool                    fOtaActive_g                = false;
+static  size_t                  OtaWritePos_g               = 0;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  std::vector<uint8_t>*  GetPartData (const esp_partition_t* pPart_p)
+{
+
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<HOSTSIM_NUM_PARTS; uiIdx++)
+    {
+        if (pPart_p == &aPartTab_g[uiIdx])
+        {
+            if (aPartData_g[uiIdx].size() != aPartTab_g[uiIdx].size)
+            {
+                aPartData_g[uiIdx].assign(aPartTab_g[uiIdx].size, 0xFF);
+            }
+            return (&aPartData_g[uiIdx]);
+        }
+    }
+
+    return (NULL);
+
+}
+
+//---------------------------------------------------------------------------
+
+void  HostSimResetIdf ()
+{
+
+unsigned int  uiIdx;
+
+    NvsStore_g.clear();
+    NvsHandleList_g.clear();
+    memset(&NvsStats_g, 0x00, sizeof(NvsStats_g));
+    for (uiIdx=0; uiIdx<HOSTSIM_NUM_PARTS; uiIdx++)
+    {
+        std::vector<uint8_t>().swap(aPartData_g[uiIdx]);
+    }
+    pBootPart_g   = &aPartTab_g[0];
+    fOtaActive_g  = false;
+    OtaWritePos_g = 0;
+
+    return;
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          R O M   C R C   /   S H A - 2 5 6                              //
+//                                                                         //
+//=========================================================================//
+
+uint32_t  esp_rom_crc32_le (uint32_t crc, uint8_t const* buf, uint32_t len)
+{
+
+uint32_t      ui32Crc;
+unsigned int  uiBit;
+
+    ui32Crc = ~crc;
+    while (len-- > 0)
+    {
+        ui32Crc ^= *buf++;
+        for (uiBit=0; uiBit<8; uiBit++)
+        {
+            ui32Crc = (ui32Crc >> 1) ^ (0xEDB88320 & (0 - (ui32Crc & 1)));
+        }
+    }
+
+    return (~ui32Crc);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  const uint32_t  aui32Sha256K_g[64] =
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define ROTR(x, n)      (((x) >> (n)) | ((x) << (32 - (n))))
+
+static  void  Sha256Block (mbedtls_sha256_context* pCtx_p, const uint8_t* pabBlock_p)
+{
+
+uint32_t      aui32W[64];
+uint32_t      a, b, c, d, e, f, g, h, t1, t2;
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<16; uiIdx++)
+    {
+        aui32W[uiIdx] = ((uint32_t)pabBlock_p[4*uiIdx] << 24) | ((uint32_t)pabBlock_p[4*uiIdx+1] << 16) |
+                        ((uint32_t)pabBlock_p[4*uiIdx+2] << 8) | (uint32_t)pabBlock_p[4*uiIdx+3];
+    }
+    for (uiIdx=16; uiIdx<64; uiIdx++)
+    {
+        aui32W[uiIdx] = (ROTR(aui32W[uiIdx-2], 17) ^ ROTR(aui32W[uiIdx-2], 19) ^ (aui32W[uiIdx-2] >> 10)) + aui32W[uiIdx-7] +
+                        (ROTR(aui32W[uiIdx-15], 7) ^ ROTR(aui32W[uiIdx-15], 18) ^ (aui32W[uiIdx-15] >> 3)) + aui32W[uiIdx-16];
+    }
+
+    a = pCtx_p->state[0];  b = pCtx_p->state[1];  c = pCtx_p->state[2];  d = pCtx_p->state[3];
+    e = pCtx_p->state[4];  f = pCtx_p->state[5];  g = pCtx_p->state[6];  h = pCtx_p->state[7];
+    for (uiIdx=0; uiIdx<64; uiIdx++)
+    {
+        t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + aui32Sha256K_g[uiIdx] + aui32W[uiIdx];
+        t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;  g = f;  f = e;  e = d + t1;
+        d = c;  c = b;  b = a;  a = t1 + t2;
+    }
+    pCtx_p->state[0] += a;  pCtx_p->state[1] += b;  pCtx_p->state[2] += c;  pCtx_p->state[3] += d;
+    pCtx_p->state[4] += e;  pCtx_p->state[5] += f;  pCtx_p->state[6] += g;  pCtx_p->state[7] += h;
+
+    return;
+
+}
+
+void  mbedtls_sha256_init (mbedtls_sha256_context* pCtx_p)
+{
+    memset(pCtx_p, 0x00, sizeof(*pCtx_p));
+}
+
+void  mbedtls_sha256_free (mbedtls_sha256_context* pCtx_p)
+{
+    memset(pCtx_p, 0x00, sizeof(*pCtx_p));
+}
+
+int  mbedtls_sha256_starts (mbedtls_sha256_context* pCtx_p, int is224_p)
+{
+
+static  const uint32_t  aui32Init[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+
+    if (is224_p != 0)
+    {
+        return (-1);                            // SHA-224 is not used by the framework
+    }
+    memcpy(pCtx_p->state, aui32Init, sizeof(pCtx_p->state));
+    pCtx_p->total[0] = 0;
+    pCtx_p->total[1] = 0;
+    pCtx_p->is224    = 0;
+
+    return (0);
+
+}
+
+int  mbedtls_sha256_update (mbedtls_sha256_context* pCtx_p, const unsigned char* pabInput_p, size_t Len_p)
+{
+
+size_t  Fill;
+
+    while (Len_p > 0)
+    {
+        Fill = pCtx_p->total[0] & 0x3F;
+        if ((Fill == 0) && (Len_p >= 64))
+        {
+            Sha256Block(pCtx_p, pabInput_p);
+            Fill = 64;
+        }
+        else
+        {
+            Fill = ((64 - Fill) < Len_p) ? (64 - Fill) : Len_p;
+            memcpy(&pCtx_p->buffer[pCtx_p->total[0] & 0x3F], pabInput_p, Fill);
+            if (((pCtx_p->total[0] + Fill) & 0x3F) == 0)
+            {
+                Sha256Block(pCtx_p, pCtx_p->buffer);
+            }
+        }
+        pCtx_p->total[0] += (uint32_t)Fill;
+        if (pCtx_p->total[0] < Fill)
+        {
+            pCtx_p->total[1]++;
+        }
+        pabInput_p += Fill;
+        Len_p      -= Fill;
+    }
+
+    return (0);
+
+}
+
+int  mbedtls_sha256_finish (mbedtls_sha256_context* pCtx_p, unsigned char abOutput_p[32])
+{
+
+uint8_t       abPad[72];
+uint64_t      ui64BitLen;
+size_t        PadLen;
+unsigned int  uiIdx;
+
+    ui64BitLen = (((uint64_t)pCtx_p->total[1] << 32) | pCtx_p->total[0]) << 3;
+    PadLen = ((pCtx_p->total[0] & 0x3F) < 56) ? (56 - (pCtx_p->total[0] & 0x3F)) : (120 - (pCtx_p->total[0] & 0x3F));
+    memset(abPad, 0x00, sizeof(abPad));
+    abPad[0] = 0x80;
+    for (uiIdx=0; uiIdx<8; uiIdx++)
+    {
+        abPad[PadLen + uiIdx] = (uint8_t)(ui64BitLen >> (56 - 8 * uiIdx));
+    }
+    mbedtls_sha256_update(pCtx_p, abPad, PadLen + 8);
+
+    for (uiIdx=0; uiIdx<8; uiIdx++)
+    {
+        abOutput_p[4*uiIdx]   = (uint8_t)(pCtx_p->state[uiIdx] >> 24);
+        abOutput_p[4*uiIdx+1] = (uint8_t)(pCtx_p->state[uiIdx] >> 16);
+        abOutput_p[4*uiIdx+2] = (uint8_t)(pCtx_p->state[uiIdx] >> 8);
+        abOutput_p[4*uiIdx+3] = (uint8_t)(pCtx_p->state[uiIdx]);
+    }
+
+    return (0);
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          N V S                                                          //
+//                                                                         //
+//=========================================================================//
+
+void  HostSimGetNvsStats (tHostSimNvsStats* pNvsStats_p)
+{
+    *pNvsStats_p = NvsStats_g;
+}
+
+esp_err_t  nvs_open (const char* pszNamespace_p, nvs_open_mode_t Mode_p, nvs_handle_t* pHandle_p)
+{
+
+    if ((pszNamespace_p == NULL) || (strlen(pszNamespace_p) > 15) || (pHandle_p == NULL))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+
+    NvsStats_g.m_uiOpenCalls++;
+    NvsHandleList_g.push_back(pszNamespace_p);
+    *pHandle_p = (nvs_handle_t)NvsHandleList_g.size();          // 0 is never a valid handle
+
+    return (ESP_OK);
+
+}
+
+void  nvs_close (nvs_handle_t Handle_p)
+{
+}
+
+static  tNvsNamespace*  GetNvsNamespace (nvs_handle_t Handle_p)
+{
+    if ((Handle_p == 0) || (Handle_p > NvsHandleList_g.size()))
+    {
+        return (NULL);
+    }
+    return (&NvsStore_g[NvsHandleList_g[Handle_p - 1]]);
+}
+
+esp_err_t  nvs_get_blob (nvs_handle_t Handle_p, const char* pszKey_p, void* pvValue_p, size_t* pLength_p)
+{
+
+tNvsNamespace*  pNamespace;
+
+    if ((pNamespace = GetNvsNamespace(Handle_p)) == NULL)
+    {
+        return (ESP_ERR_NVS_INVALID_HANDLE);
+    }
+    NvsStats_g.m_uiGetCalls++;
+    tNvsNamespace::iterator  It = pNamespace->find(pszKey_p);
+    if (It == pNamespace->end())
+    {
+        return (ESP_ERR_NVS_NOT_FOUND);
+    }
+    if (pvValue_p == NULL)
+    {
+        *pLength_p = It->second.size();
+        return (ESP_OK);
+    }
+    if (*pLength_p < It->second.size())
+    {
+        *pLength_p = It->second.size();
+        return (ESP_ERR_NVS_INVALID_LENGTH);
+    }
+    memcpy(pvValue_p, It->second.data(), It->second.size());
+    *pLength_p = It->second.size();
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  nvs_set_blob (nvs_handle_t Handle_p, const char* pszKey_p, const void* pvValue_p, size_t Length_p)
+{
+
+tNvsNamespace*  pNamespace;
+
+    if ((pNamespace = GetNvsNamespace(Handle_p)) == NULL)
+    {
+        return (ESP_ERR_NVS_INVALID_HANDLE);
+    }
+    if ((pszKey_p == NULL) || (strlen(pszKey_p) > 15))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    NvsStats_g.m_uiSetCalls++;
+    (*pNamespace)[pszKey_p].assign((const uint8_t*)pvValue_p, (const uint8_t*)pvValue_p + Length_p);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  nvs_erase_key (nvs_handle_t Handle_p, const char* pszKey_p)
+{
+
+tNvsNamespace*  pNamespace;
+
+    if ((pNamespace = GetNvsNamespace(Handle_p)) == NULL)
+    {
+        return (ESP_ERR_NVS_INVALID_HANDLE);
+    }
+
+    return ((pNamespace->erase(pszKey_p) != 0) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND);
+
+}
+
+esp_err_t  nvs_erase_all (nvs_handle_t Handle_p)
+{
+
+tNvsNamespace*  pNamespace;
+
+    if ((pNamespace = GetNvsNamespace(Handle_p)) == NULL)
+    {
+        return (ESP_ERR_NVS_INVALID_HANDLE);
+    }
+    pNamespace->clear();
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  nvs_commit (nvs_handle_t Handle_p)
+{
+    NvsStats_g.m_uiCommitCalls++;
+    return ((GetNvsNamespace(Handle_p) != NULL) ? ESP_OK : ESP_ERR_NVS_INVALID_HANDLE);
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          P A R T I T I O N S   /   O T A                                //
+//                                                                         //
+//=========================================================================//
+
+const esp_partition_t*  esp_partition_find_first (esp_partition_type_t Type_p, esp_partition_subtype_t Subtype_p, const char* pszLabel_p)
+{
+
+unsigned int  uiIdx;
+
+    for (uiIdx=0; uiIdx<HOSTSIM_NUM_PARTS; uiIdx++)
+    {
+        if ((aPartTab_g[uiIdx].type == Type_p) &&
+            ((Subtype_p == ESP_PARTITION_SUBTYPE_ANY) || (aPartTab_g[uiIdx].subtype == Subtype_p)) &&
+            ((pszLabel_p == NULL) || (strcmp(aPartTab_g[uiIdx].label, pszLabel_p) == 0)))
+        {
+            return (&aPartTab_g[uiIdx]);
+        }
+    }
+
+    return (NULL);
+
+}
+
+esp_err_t  esp_partition_read (const esp_partition_t* pPart_p, size_t Offset_p, void* pvDst_p, size_t Size_p)
+{
+
+std::vector<uint8_t>*  pData;
+
+    if ((pData = GetPartData(pPart_p)) == NULL)
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    if ((Offset_p + Size_p) > pData->size())
+    {
+        return (ESP_ERR_INVALID_SIZE);
+    }
+    memcpy(pvDst_p, pData->data() + Offset_p, Size_p);
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_partition_write (const esp_partition_t* pPart_p, size_t Offset_p, const void* pvSrc_p, size_t Size_p)
+{
+
+std::vector<uint8_t>*  pData;
+size_t                 Idx;
+
+    if ((pData = GetPartData(pPart_p)) == NULL)
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    if ((Offset_p + Size_p) > pData->size())
+    {
+        return (ESP_ERR_INVALID_SIZE);
+    }
+    for (Idx=0; Idx<Size_p; Idx++)
+    {
+        (*pData)[Offset_p + Idx] &= ((const uint8_t*)pvSrc_p)[Idx];             // NOR flash: bits can only be cleared
+    }
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_partition_erase_range (const esp_partition_t* pPart_p, size_t Offset_p, size_t Size_p)
+{
+
+std::vector<uint8_t>*  pData;
+
+    if ((pData = GetPartData(pPart_p)) == NULL)
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    if (((Offset_p % HOSTSIM_FLASH_SECTOR_SIZE) != 0) || ((Size_p % HOSTSIM_FLASH_SECTOR_SIZE) != 0) || ((Offset_p + Size_p) > pData->size()))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    memset(pData->data() + Offset_p, 0xFF, Size_p);
+
+    return (ESP_OK);
+
+}
+
+//---------------------------------------------------------------------------
+
+const esp_partition_t*  esp_ota_get_running_partition ()
+{
+    return (&aPartTab_g[0]);
+}
+
+const esp_partition_t*  esp_ota_get_boot_partition ()
+{
+    return (pBootPart_g);
+}
+
+const esp_partition_t*  esp_ota_get_next_update_partition (const esp_partition_t* pStartFrom_p)
+{
+    return (&aPartTab_g[1]);
+}
+
+esp_err_t  esp_ota_begin (const esp_partition_t* pPart_p, size_t ImageSize_p, esp_ota_handle_t* pHandle_p)
+{
+
+    if ((pPart_p != &aPartTab_g[1]) || (pHandle_p == NULL))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    if ( fOtaActive_g )
+    {
+        return (ESP_ERR_INVALID_STATE);
+    }
+
+    if (ImageSize_p != OTA_WITH_SEQUENTIAL_WRITES)
+    {
+        esp_partition_erase_range(pPart_p, 0, pPart_p->size);
+    }
+    fOtaActive_g  = true;
+    OtaWritePos_g = 0;
+    *pHandle_p    = HOSTSIM_OTA_HANDLE;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ota_write (esp_ota_handle_t Handle_p, const void* pvData_p, size_t Size_p)
+{
+
+const esp_partition_t*  pPart = &aPartTab_g[1];
+size_t                  EraseFrom;
+size_t                  EraseTo;
+
+    if ((Handle_p != HOSTSIM_OTA_HANDLE) || !fOtaActive_g)
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    if ((OtaWritePos_g == 0) && (Size_p > 0) && (((const uint8_t*)pvData_p)[0] != HOSTSIM_APP_IMAGE_MAGIC))
+    {
+        return (ESP_ERR_OTA_VALIDATE_FAILED);
+    }
+    if ((OtaWritePos_g + Size_p) > pPart->size)
+    {
+        return (ESP_ERR_INVALID_SIZE);
+    }
+
+    // erase sector by sector in front of the data (OTA_WITH_SEQUENTIAL_WRITES)
+    EraseFrom = (OtaWritePos_g + HOSTSIM_FLASH_SECTOR_SIZE - 1) / HOSTSIM_FLASH_SECTOR_SIZE * HOSTSIM_FLASH_SECTOR_SIZE;
+    EraseTo   = (OtaWritePos_g + Size_p + HOSTSIM_FLASH_SECTOR_SIZE - 1) / HOSTSIM_FLASH_SECTOR_SIZE * HOSTSIM_FLASH_SECTOR_SIZE;
+    if (OtaWritePos_g == 0)
+    {
+        EraseFrom = 0;
+    }
+    if (EraseTo > EraseFrom)
+    {
+        esp_partition_erase_range(pPart, EraseFrom, EraseTo - EraseFrom);
+    }
+    esp_partition_write(pPart, OtaWritePos_g, pvData_p, Size_p);
+    OtaWritePos_g += Size_p;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ota_end (esp_ota_handle_t Handle_p)
+{
+
+uint8_t  bMagic = 0;
+
+    if ((Handle_p != HOSTSIM_OTA_HANDLE) || !fOtaActive_g)
+    {
+        return (ESP_ERR_NOT_FOUND);
+    }
+    fOtaActive_g = false;
+
+    esp_partition_read(&aPartTab_g[1], 0, &bMagic, sizeof(bMagic));
+    if ((OtaWritePos_g == 0) || (bMagic != HOSTSIM_APP_IMAGE_MAGIC))
+    {
+        return (ESP_ERR_OTA_VALIDATE_FAILED);
+    }
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ota_abort (esp_ota_handle_t Handle_p)
+{
+
+    if ((Handle_p != HOSTSIM_OTA_HANDLE) || !fOtaActive_g)
+    {
+        return (ESP_ERR_NOT_FOUND);
+    }
+    fOtaActive_g = false;
+
+    return (ESP_OK);
+
+}
+
+esp_err_t  esp_ota_set_boot_partition (const esp_partition_t* pPart_p)
+{
+
+    if ((pPart_p != &aPartTab_g[0]) && (pPart_p != &aPartTab_g[1]))
+    {
+        return (ESP_ERR_INVALID_ARG);
+    }
+    pBootPart_g = pPart_p;
+
+    return (ESP_OK);
+
+}
+
+
+
+//  EOF
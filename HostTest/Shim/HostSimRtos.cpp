@@ -0,0 +1,370 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the FreeRTOS API (see freertos/FreeRTOS.h)
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+
+#include <string.h>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <thread>
+#include <chrono>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_freertos_hooks.h"
+#include "esp_timer.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Module Local Types / Variables
+//---------------------------------------------------------------------------
+
+struct  tHostSimSync                            // semaphore, queue and event group
+{
+    std::mutex                          m_Mutex;
+    std::condition_variable             m_Cond;
+    unsigned int                        m_uiCount;
+    unsigned int                        m_uiMaxCount;
+    size_t                              m_ItemSize;
+    std::deque<std::vector<uint8_t>>    m_ItemList;
+    EventBits_t                         m_Bits;
+};
+
+static  std::recursive_mutex    CriticalMutex_g;
+static  thread_local int        iCurrentCore_l      = 1;            // Arduino loop() runs on Core 1
+static  thread_local void*      pvCurrentTask_l     = NULL;
+static  int                     aiIdleTask_g[portNUM_PROCESSORS];
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+template <typename Pred>
+static  bool  WaitFor (tHostSimSync* pSync_p, std::unique_lock<std::mutex>& Lock_p, TickType_t Ticks_p, Pred fnPred_p)
+{
+
+    if (Ticks_p == portMAX_DELAY)
+    {
+        pSync_p->m_Cond.wait(Lock_p, fnPred_p);
+        return (true);
+    }
+
+    return (pSync_p->m_Cond.wait_for(Lock_p, std::chrono::milliseconds(Ticks_p), fnPred_p));
+
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          C R I T I C A L   S E C T I O N S / T A S K S                  //
+//                                                                         //
+//=========================================================================//
+
+void  HostSimEnterCritical (portMUX_TYPE* pMux_p)
+{
+    CriticalMutex_g.lock();
+}
+
+void  HostSimExitCritical (portMUX_TYPE* pMux_p)
+{
+    CriticalMutex_g.unlock();
+}
+
+//---------------------------------------------------------------------------
+
+BaseType_t  xTaskCreatePinnedToCore (
+        TaskFunction_t pfnTask_p,
+        const char* pszName_p,
+        uint32_t ui32StackSize_p,
+        void* pvParam_p,
+        UBaseType_t uiPriority_p,
+        TaskHandle_t* phTask_p,
+        BaseType_t iCoreId_p)
+{
+
+int  iCore;
+
+    iCore = ((iCoreId_p >= 0) && (iCoreId_p < portNUM_PROCESSORS)) ? iCoreId_p : 0;
+
+    std::thread  Thread([=]()
+    {
+        iCurrentCore_l  = iCore;
+        pvCurrentTask_l = (void*)&pvCurrentTask_l;
+        pfnTask_p(pvParam_p);
+    });
+
+    if (phTask_p != NULL)
+    {
+        *phTask_p = (TaskHandle_t)Thread.native_handle();
+    }
+    Thread.detach();
+
+    return (pdPASS);
+
+}
+
+void  vTaskDelete (TaskHandle_t hTask_p)
+{
+    // a task deletes itself at the end of its function (the thread ends on return)
+}
+
+void  vTaskDelay (TickType_t Ticks_p)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(Ticks_p));
+}
+
+TickType_t  xTaskGetTickCount ()
+{
+    return ((TickType_t)(esp_timer_get_time() / 1000));
+}
+
+BaseType_t  xPortGetCoreID ()
+{
+    return (iCurrentCore_l);
+}
+
+TaskHandle_t  xTaskGetCurrentTaskHandle ()
+{
+    return ((pvCurrentTask_l != NULL) ? pvCurrentTask_l : (TaskHandle_t)&iCurrentCore_l);
+}
+
+TaskHandle_t  xTaskGetIdleTaskHandleForCPU (UBaseType_t uiCpuId_p)
+{
+    return ((uiCpuId_p < portNUM_PROCESSORS) ? (TaskHandle_t)&aiIdleTask_g[uiCpuId_p] : NULL);
+}
+
+esp_err_t  esp_register_freertos_tick_hook_for_cpu (esp_freertos_tick_cb_t pfnTickCb_p, int iCpu_p)
+{
+    return (ESP_OK);
+}
+
+void  esp_deregister_freertos_tick_hook_for_cpu (esp_freertos_tick_cb_t pfnTickCb_p, int iCpu_p)
+{
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          S E M A P H O R E S                                            //
+//                                                                         //
+//=========================================================================//
+
+SemaphoreHandle_t  xSemaphoreCreateCounting (UBaseType_t uiMaxCount_p, UBaseType_t uiInitialCount_p)
+{
+
+tHostSimSync*  pSync;
+
+    pSync = new tHostSimSync;
+    pSync->m_uiCount    = uiInitialCount_p;
+    pSync->m_uiMaxCount = uiMaxCount_p;
+    pSync->m_ItemSize   = 0;
+    pSync->m_Bits       = 0;
+
+    return ((SemaphoreHandle_t)pSync);
+
+}
+
+SemaphoreHandle_t  xSemaphoreCreateBinary ()
+{
+    return (xSemaphoreCreateCounting(1, 0));
+}
+
+SemaphoreHandle_t  xSemaphoreCreateMutex ()
+{
+    return (xSemaphoreCreateCounting(1, 1));
+}
+
+BaseType_t  xSemaphoreTake (SemaphoreHandle_t hSem_p, TickType_t Ticks_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hSem_p;
+
+    std::unique_lock<std::mutex>  Lock(pSync->m_Mutex);
+    if ( !WaitFor(pSync, Lock, Ticks_p, [pSync]{ return (pSync->m_uiCount > 0); }) )
+    {
+        return (pdFALSE);
+    }
+    pSync->m_uiCount--;
+
+    return (pdTRUE);
+
+}
+
+BaseType_t  xSemaphoreGive (SemaphoreHandle_t hSem_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hSem_p;
+
+    std::lock_guard<std::mutex>  Lock(pSync->m_Mutex);
+    if (pSync->m_uiCount >= pSync->m_uiMaxCount)
+    {
+        return (pdFALSE);
+    }
+    pSync->m_uiCount++;
+    pSync->m_Cond.notify_all();
+
+    return (pdTRUE);
+
+}
+
+void  vSemaphoreDelete (SemaphoreHandle_t hSem_p)
+{
+    delete (tHostSimSync*)hSem_p;
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          Q U E U E S                                                    //
+//                                                                         //
+//=========================================================================//
+
+QueueHandle_t  xQueueCreate (UBaseType_t uiLength_p, UBaseType_t uiItemSize_p)
+{
+
+tHostSimSync*  pSync;
+
+    pSync = (tHostSimSync*)xSemaphoreCreateCounting(uiLength_p, 0);
+    pSync->m_ItemSize = uiItemSize_p;
+
+    return ((QueueHandle_t)pSync);
+
+}
+
+BaseType_t  xQueueSend (QueueHandle_t hQueue_p, const void* pvItem_p, TickType_t Ticks_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hQueue_p;
+
+    std::unique_lock<std::mutex>  Lock(pSync->m_Mutex);
+    if ( !WaitFor(pSync, Lock, Ticks_p, [pSync]{ return (pSync->m_ItemList.size() < pSync->m_uiMaxCount); }) )
+    {
+        return (pdFALSE);
+    }
+    pSync->m_ItemList.push_back(std::vector<uint8_t>((const uint8_t*)pvItem_p, (const uint8_t*)pvItem_p + pSync->m_ItemSize));
+    pSync->m_Cond.notify_all();
+
+    return (pdTRUE);
+
+}
+
+BaseType_t  xQueueReceive (QueueHandle_t hQueue_p, void* pvItem_p, TickType_t Ticks_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hQueue_p;
+
+    std::unique_lock<std::mutex>  Lock(pSync->m_Mutex);
+    if ( !WaitFor(pSync, Lock, Ticks_p, [pSync]{ return (!pSync->m_ItemList.empty()); }) )
+    {
+        return (pdFALSE);
+    }
+    memcpy(pvItem_p, pSync->m_ItemList.front().data(), pSync->m_ItemSize);
+    pSync->m_ItemList.pop_front();
+    pSync->m_Cond.notify_all();
+
+    return (pdTRUE);
+
+}
+
+UBaseType_t  uxQueueMessagesWaiting (QueueHandle_t hQueue_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hQueue_p;
+
+    std::lock_guard<std::mutex>  Lock(pSync->m_Mutex);
+    return ((UBaseType_t)pSync->m_ItemList.size());
+
+}
+
+void  vQueueDelete (QueueHandle_t hQueue_p)
+{
+    delete (tHostSimSync*)hQueue_p;
+}
+
+
+
+
+
+//=========================================================================//
+//                                                                         //
+//          E V E N T   G R O U P S                                        //
+//                                                                         //
+//=========================================================================//
+
+EventGroupHandle_t  xEventGroupCreate ()
+{
+    return ((EventGroupHandle_t)xSemaphoreCreateCounting(0, 0));
+}
+
+void  vEventGroupDelete (EventGroupHandle_t hEventGroup_p)
+{
+    delete (tHostSimSync*)hEventGroup_p;
+}
+
+EventBits_t  xEventGroupSetBits (EventGroupHandle_t hEventGroup_p, EventBits_t Bits_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hEventGroup_p;
+
+    std::lock_guard<std::mutex>  Lock(pSync->m_Mutex);
+    pSync->m_Bits |= Bits_p;
+    pSync->m_Cond.notify_all();
+
+    return (pSync->m_Bits);
+
+}
+
+EventBits_t  xEventGroupWaitBits (
+        EventGroupHandle_t hEventGroup_p,
+        EventBits_t Bits_p,
+        BaseType_t fClearOnExit_p,
+        BaseType_t fWaitForAll_p,
+        TickType_t Ticks_p)
+{
+
+tHostSimSync*  pSync = (tHostSimSync*)hEventGroup_p;
+EventBits_t    Bits;
+
+    std::unique_lock<std::mutex>  Lock(pSync->m_Mutex);
+    WaitFor(pSync, Lock, Ticks_p, [pSync, Bits_p, fWaitForAll_p]
+    {
+        return ((fWaitForAll_p) ? ((pSync->m_Bits & Bits_p) == Bits_p) : ((pSync->m_Bits & Bits_p) != 0));
+    });
+    Bits = pSync->m_Bits;
+    if ( fClearOnExit_p )
+    {
+        pSync->m_Bits &= ~Bits_p;
+    }
+
+    return (Bits);
+
+}
+
+
+
+//  EOF
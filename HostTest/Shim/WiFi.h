@@ -0,0 +1,54 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <WiFi.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_WIFI_H_
+#define _HOSTSIM_WIFI_H_
+
+#include "Arduino.h"
+
+//  The station never connects, unless forced by <HostSimSetWifiStatus()>.
+
+typedef enum
+{
+    WIFI_OFF    = 0,
+    WIFI_STA    = 1,
+    WIFI_AP     = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+typedef enum
+{
+    WL_IDLE_STATUS      = 0,
+    WL_NO_SSID_AVAIL    = 1,
+    WL_CONNECTED        = 3,
+    WL_CONNECT_FAILED   = 4,
+    WL_DISCONNECTED     = 6
+} wl_status_t;
+
+class  WiFiClass
+{
+
+    public:
+
+        bool         mode (wifi_mode_t Mode_p);
+        wl_status_t  begin (const char* pszSsid_p, const char* pszPasswd_p=NULL);
+        wl_status_t  status ();
+        bool         disconnect (bool fWifiOff_p=false);
+
+};
+
+extern WiFiClass  WiFi;
+
+#endif  // _HOSTSIM_WIFI_H_
@@ -0,0 +1,56 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_bt.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_BT_H_
+#define _HOSTSIM_ESP_BT_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+//  Only the state of the controller and its reserved memory are simulated
+//  (see HostSim.h for the sizes and the call counters).
+
+typedef enum
+{
+    ESP_BT_MODE_IDLE        = 0x00,
+    ESP_BT_MODE_BLE         = 0x01,
+    ESP_BT_MODE_CLASSIC_BT  = 0x02,
+    ESP_BT_MODE_BTDM        = 0x03
+} esp_bt_mode_t;
+
+typedef enum
+{
+    ESP_BT_CONTROLLER_STATUS_IDLE = 0,
+    ESP_BT_CONTROLLER_STATUS_INITED,
+    ESP_BT_CONTROLLER_STATUS_ENABLED,
+    ESP_BT_CONTROLLER_STATUS_NUM
+} esp_bt_controller_status_t;
+
+typedef struct
+{
+    uint8_t   mode;                             // as the IDF: mode for esp_bt_controller_enable()
+} esp_bt_controller_config_t;
+
+#define BT_CONTROLLER_INIT_CONFIG_DEFAULT()     { ESP_BT_MODE_BTDM }    // as the Arduino Core (CONFIG_BTDM_CTRL_MODE_BTDM)
+
+esp_err_t                   esp_bt_controller_init (esp_bt_controller_config_t* pCfg_p);
+esp_err_t                   esp_bt_controller_deinit ();
+esp_err_t                   esp_bt_controller_enable (esp_bt_mode_t Mode_p);
+esp_err_t                   esp_bt_controller_disable ();
+esp_bt_controller_status_t  esp_bt_controller_get_status ();
+esp_err_t                   esp_bt_controller_mem_release (esp_bt_mode_t Mode_p);
+esp_err_t                   esp_bt_mem_release (esp_bt_mode_t Mode_p);
+
+#endif  // _HOSTSIM_ESP_BT_H_
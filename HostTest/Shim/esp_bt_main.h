@@ -0,0 +1,34 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_bt_main.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_BT_MAIN_H_
+#define _HOSTSIM_ESP_BT_MAIN_H_
+
+#include "esp_err.h"
+
+typedef enum
+{
+    ESP_BLUEDROID_STATUS_UNINITIALIZED = 0,
+    ESP_BLUEDROID_STATUS_INITIALIZED,
+    ESP_BLUEDROID_STATUS_ENABLED
+} esp_bluedroid_status_t;
+
+esp_bluedroid_status_t  esp_bluedroid_get_status ();
+esp_err_t               esp_bluedroid_init ();
+esp_err_t               esp_bluedroid_deinit ();
+esp_err_t               esp_bluedroid_enable ();
+esp_err_t               esp_bluedroid_disable ();
+
+#endif  // _HOSTSIM_ESP_BT_MAIN_H_
@@ -0,0 +1,28 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_freertos_hooks.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_FREERTOS_HOOKS_H_
+#define _HOSTSIM_ESP_FREERTOS_HOOKS_H_
+
+#include "esp_err.h"
+
+//  Hooks are accepted, but never called (there is no tick interrupt).
+
+typedef void  (*esp_freertos_tick_cb_t)(void);
+
+esp_err_t  esp_register_freertos_tick_hook_for_cpu (esp_freertos_tick_cb_t pfnTickCb_p, int iCpu_p);
+void       esp_deregister_freertos_tick_hook_for_cpu (esp_freertos_tick_cb_t pfnTickCb_p, int iCpu_p);
+
+#endif  // _HOSTSIM_ESP_FREERTOS_HOOKS_H_
@@ -0,0 +1,58 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_gap_ble_api.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_GAP_BLE_API_H_
+#define _HOSTSIM_ESP_GAP_BLE_API_H_
+
+#include "esp_gatts_api.h"
+
+//  A connection parameter update request is answered immediately with
+//  ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT (accepted as requested).
+
+#define ESP_BT_STATUS_SUCCESS           0
+
+typedef enum
+{
+    ESP_GAP_BLE_ADV_START_COMPLETE_EVT  = 6,
+    ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT  = 20
+} esp_gap_ble_cb_event_t;
+
+typedef union
+{
+    struct ble_update_conn_params_evt_param
+    {
+        int            status;
+        esp_bd_addr_t  bda;
+        uint16_t       min_int;
+        uint16_t       max_int;
+        uint16_t       latency;
+        uint16_t       conn_int;
+        uint16_t       timeout;
+    } update_conn_params;
+} esp_ble_gap_cb_param_t;
+
+typedef struct
+{
+    esp_bd_addr_t  bda;
+    uint16_t       min_int;
+    uint16_t       max_int;
+    uint16_t       latency;
+    uint16_t       timeout;
+} esp_ble_conn_update_params_t;
+
+esp_err_t  esp_ble_gap_update_conn_params (esp_ble_conn_update_params_t* pParams_p);
+esp_err_t  esp_ble_gap_set_device_name (const char* pszName_p);
+
+#endif  // _HOSTSIM_ESP_GAP_BLE_API_H_
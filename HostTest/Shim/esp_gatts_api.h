@@ -0,0 +1,245 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_gatts_api.h> (incl. <esp_gatt_defs.h>)
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_GATTS_API_H_
+#define _HOSTSIM_ESP_GATTS_API_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_bt.h"
+
+//  Events are delivered synchronously from the calling context, first to
+//  the BLEServer object, then to the handler registered by
+//  <BLEDevice::setCustomGattsHandler()> (same order as the BLE library).
+
+//---------------------------------------------------------------------------
+//  <esp_bt_defs.h> / <esp_gatt_defs.h>
+//---------------------------------------------------------------------------
+
+#define ESP_BD_ADDR_LEN                 6
+typedef uint8_t  esp_bd_addr_t[ESP_BD_ADDR_LEN];
+
+#define ESP_UUID_LEN_16                 2
+#define ESP_UUID_LEN_32                 4
+#define ESP_UUID_LEN_128                16
+
+typedef struct
+{
+    uint16_t  len;
+    union
+    {
+        uint16_t  uuid16;
+        uint32_t  uuid32;
+        uint8_t   uuid128[ESP_UUID_LEN_128];
+    } uuid;
+} esp_bt_uuid_t;
+
+typedef uint8_t  esp_gatt_if_t;
+#define ESP_GATT_IF_NONE                0xff
+
+typedef int  esp_gatt_status_t;
+#define ESP_GATT_OK                     0x00
+#define ESP_GATT_INVALID_HANDLE         0x01
+#define ESP_GATT_READ_NOT_PERMIT        0x02
+#define ESP_GATT_WRITE_NOT_PERMIT       0x03
+#define ESP_GATT_INVALID_PDU            0x04
+#define ESP_GATT_INVALID_OFFSET         0x07
+#define ESP_GATT_PREPARE_Q_FULL         0x09
+#define ESP_GATT_NOT_FOUND              0x0a
+#define ESP_GATT_INVALID_ATTR_LEN       0x0d
+#define ESP_GATT_ERROR                  0x85
+#define ESP_GATT_OUT_OF_RANGE           0xff
+
+#define ESP_GATT_UUID_PRI_SERVICE       0x2800
+#define ESP_GATT_UUID_SEC_SERVICE       0x2801
+#define ESP_GATT_UUID_CHAR_DECLARE      0x2803
+#define ESP_GATT_UUID_CHAR_DESCRIPTION  0x2901
+#define ESP_GATT_UUID_CHAR_CLIENT_CONFIG 0x2902
+
+#define ESP_GATT_PERM_READ              (1 << 0)
+#define ESP_GATT_PERM_WRITE             (1 << 4)
+
+#define ESP_GATT_CHAR_PROP_BIT_BROADCAST (1 << 0)
+#define ESP_GATT_CHAR_PROP_BIT_READ     (1 << 1)
+#define ESP_GATT_CHAR_PROP_BIT_WRITE_NR (1 << 2)
+#define ESP_GATT_CHAR_PROP_BIT_WRITE    (1 << 3)
+#define ESP_GATT_CHAR_PROP_BIT_NOTIFY   (1 << 4)
+#define ESP_GATT_CHAR_PROP_BIT_INDICATE (1 << 5)
+
+#define ESP_GATT_RSP_BY_APP             0
+#define ESP_GATT_AUTO_RSP               1
+
+#define ESP_GATT_PREP_WRITE_CANCEL      0x00
+#define ESP_GATT_PREP_WRITE_EXEC        0x01
+
+#define ESP_GATT_MAX_ATTR_LEN           600
+
+typedef struct
+{
+    uint16_t  uuid_length;
+    uint8_t*  uuid_p;
+    uint16_t  perm;
+    uint16_t  max_length;
+    uint16_t  length;
+    uint8_t*  value;
+} esp_attr_desc_t;
+
+typedef struct
+{
+    uint8_t  auto_rsp;
+} esp_attr_control_t;
+
+typedef struct
+{
+    esp_attr_control_t  attr_control;
+    esp_attr_desc_t     att_desc;
+} esp_gatts_attr_db_t;
+
+typedef struct
+{
+    uint8_t   value[ESP_GATT_MAX_ATTR_LEN];
+    uint16_t  handle;
+    uint16_t  offset;
+    uint16_t  len;
+    uint8_t   auth_req;
+} esp_gatt_value_t;
+
+typedef union
+{
+    esp_gatt_value_t  attr_value;
+    uint16_t          handle;
+} esp_gatt_rsp_t;
+
+typedef struct
+{
+    uint16_t  interval;
+    uint16_t  latency;
+    uint16_t  timeout;
+} esp_gatt_conn_params_t;
+
+
+
+//---------------------------------------------------------------------------
+//  <esp_gatts_api.h>
+//---------------------------------------------------------------------------
+
+typedef enum
+{
+    ESP_GATTS_REG_EVT               = 0,
+    ESP_GATTS_READ_EVT              = 1,
+    ESP_GATTS_WRITE_EVT             = 2,
+    ESP_GATTS_EXEC_WRITE_EVT        = 3,
+    ESP_GATTS_MTU_EVT               = 4,
+    ESP_GATTS_CONF_EVT              = 5,
+    ESP_GATTS_UNREG_EVT             = 6,
+    ESP_GATTS_CREATE_EVT            = 7,
+    ESP_GATTS_DELETE_EVT            = 11,
+    ESP_GATTS_START_EVT             = 12,
+    ESP_GATTS_STOP_EVT              = 13,
+    ESP_GATTS_CONNECT_EVT           = 14,
+    ESP_GATTS_DISCONNECT_EVT        = 15,
+    ESP_GATTS_CREAT_ATTR_TAB_EVT    = 22
+} esp_gatts_cb_event_t;
+
+typedef union
+{
+    struct gatts_reg_evt_param
+    {
+        esp_gatt_status_t  status;
+        uint16_t           app_id;
+    } reg;
+
+    struct gatts_read_evt_param
+    {
+        uint16_t       conn_id;
+        uint32_t       trans_id;
+        esp_bd_addr_t  bda;
+        uint16_t       handle;
+        uint16_t       offset;
+        bool           is_long;
+        bool           need_rsp;
+    } read;
+
+    struct gatts_write_evt_param
+    {
+        uint16_t       conn_id;
+        uint32_t       trans_id;
+        esp_bd_addr_t  bda;
+        uint16_t       handle;
+        uint16_t       offset;
+        bool           need_rsp;
+        bool           is_prep;
+        uint16_t       len;
+        uint8_t*       value;
+    } write;
+
+    struct gatts_exec_write_evt_param
+    {
+        uint16_t       conn_id;
+        uint32_t       trans_id;
+        esp_bd_addr_t  bda;
+        uint8_t        exec_write_flag;
+    } exec_write;
+
+    struct gatts_mtu_evt_param
+    {
+        uint16_t  conn_id;
+        uint16_t  mtu;
+    } mtu;
+
+    struct gatts_start_evt_param
+    {
+        esp_gatt_status_t  status;
+        uint16_t           service_handle;
+    } start;
+
+    struct gatts_connect_evt_param
+    {
+        uint16_t                conn_id;
+        uint8_t                 link_role;
+        esp_bd_addr_t           remote_bda;
+        esp_gatt_conn_params_t  conn_params;
+    } connect;
+
+    struct gatts_disconnect_evt_param
+    {
+        uint16_t       conn_id;
+        esp_bd_addr_t  remote_bda;
+        int            reason;
+    } disconnect;
+
+    struct gatts_add_attr_tab_evt_param
+    {
+        esp_gatt_status_t  status;
+        esp_bt_uuid_t      svc_uuid;
+        uint8_t            svc_inst_id;
+        uint16_t           num_handle;
+        uint16_t*          handles;
+    } add_attr_tab;
+
+} esp_ble_gatts_cb_param_t;
+
+typedef void  (*esp_gatts_cb_t)(esp_gatts_cb_event_t Event_p, esp_gatt_if_t GattsIf_p, esp_ble_gatts_cb_param_t* pParam_p);
+
+esp_err_t  esp_ble_gatts_create_attr_tab (const esp_gatts_attr_db_t* pGattsAttrDb_p, esp_gatt_if_t GattsIf_p, uint16_t ui16MaxNumAttr_p, uint8_t ui8SrvInstId_p);
+esp_err_t  esp_ble_gatts_start_service (uint16_t ui16ServiceHdl_p);
+esp_err_t  esp_ble_gatts_delete_service (uint16_t ui16ServiceHdl_p);
+esp_err_t  esp_ble_gatts_set_attr_value (uint16_t ui16AttrHdl_p, uint16_t ui16Len_p, const uint8_t* pabValue_p);
+esp_err_t  esp_ble_gatts_get_attr_value (uint16_t ui16AttrHdl_p, uint16_t* pui16Len_p, const uint8_t** ppabValue_p);
+esp_err_t  esp_ble_gatts_send_indicate (esp_gatt_if_t GattsIf_p, uint16_t ui16ConnId_p, uint16_t ui16AttrHdl_p, uint16_t ui16ValueLen_p, uint8_t* pabValue_p, bool fNeedConfirm_p);
+esp_err_t  esp_ble_gatts_send_response (esp_gatt_if_t GattsIf_p, uint16_t ui16ConnId_p, uint32_t ui32TransId_p, esp_gatt_status_t Status_p, esp_gatt_rsp_t* pRsp_p);
+
+#endif  // _HOSTSIM_ESP_GATTS_API_H_
@@ -0,0 +1,49 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_heap_caps.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_HEAP_CAPS_H_
+#define _HOSTSIM_ESP_HEAP_CAPS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//  The heap is simulated by accounting all allocations by <operator new>
+//  against a fixed heap size (see HostSim.h).
+
+#define MALLOC_CAP_EXEC                 (1 << 0)
+#define MALLOC_CAP_32BIT                (1 << 1)
+#define MALLOC_CAP_8BIT                 (1 << 2)
+#define MALLOC_CAP_DMA                  (1 << 3)
+#define MALLOC_CAP_INTERNAL             (1 << 11)
+#define MALLOC_CAP_DEFAULT              (1 << 12)
+
+typedef struct
+{
+    size_t  total_free_bytes;
+    size_t  total_allocated_bytes;
+    size_t  largest_free_block;
+    size_t  minimum_free_bytes;
+    size_t  allocated_blocks;
+    size_t  free_blocks;
+    size_t  total_blocks;
+} multi_heap_info_t;
+
+size_t  heap_caps_get_total_size (uint32_t ui32Caps_p);
+size_t  heap_caps_get_free_size (uint32_t ui32Caps_p);
+size_t  heap_caps_get_minimum_free_size (uint32_t ui32Caps_p);
+size_t  heap_caps_get_largest_free_block (uint32_t ui32Caps_p);
+void    heap_caps_get_info (multi_heap_info_t* pInfo_p, uint32_t ui32Caps_p);
+
+#endif  // _HOSTSIM_ESP_HEAP_CAPS_H_
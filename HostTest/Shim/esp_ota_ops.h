@@ -0,0 +1,44 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_ota_ops.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_OTA_OPS_H_
+#define _HOSTSIM_ESP_OTA_OPS_H_
+
+#include "esp_partition.h"
+
+//  The update is written into the simulated partition "ota_1". An image
+//  is accepted by <esp_ota_end()> if it starts with the magic byte of an
+//  ESP32 app image (0xE9).
+
+typedef uint32_t  esp_ota_handle_t;
+
+#define OTA_SIZE_UNKNOWN                0xffffffff
+#define OTA_WITH_SEQUENTIAL_WRITES      0xfffffffe
+
+#define ESP_ERR_OTA_BASE                0x1500
+#define ESP_ERR_OTA_PARTITION_CONFLICT  (ESP_ERR_OTA_BASE + 0x01)
+#define ESP_ERR_OTA_SELECT_INFO_INVALID (ESP_ERR_OTA_BASE + 0x02)
+#define ESP_ERR_OTA_VALIDATE_FAILED     (ESP_ERR_OTA_BASE + 0x03)
+
+const esp_partition_t*  esp_ota_get_running_partition ();
+const esp_partition_t*  esp_ota_get_boot_partition ();
+const esp_partition_t*  esp_ota_get_next_update_partition (const esp_partition_t* pStartFrom_p);
+esp_err_t               esp_ota_begin (const esp_partition_t* pPart_p, size_t ImageSize_p, esp_ota_handle_t* pHandle_p);
+esp_err_t               esp_ota_write (esp_ota_handle_t Handle_p, const void* pvData_p, size_t Size_p);
+esp_err_t               esp_ota_end (esp_ota_handle_t Handle_p);
+esp_err_t               esp_ota_abort (esp_ota_handle_t Handle_p);
+esp_err_t               esp_ota_set_boot_partition (const esp_partition_t* pPart_p);
+
+#endif  // _HOSTSIM_ESP_OTA_OPS_H_
@@ -0,0 +1,61 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_partition.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_PARTITION_H_
+#define _HOSTSIM_ESP_PARTITION_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+//  Partition table of the simulation (content kept in memory, erased = 0xFF):
+//      "ota_0"  app/ota_0   (running)
+//      "ota_1"  app/ota_1
+//      "spiffs" data/spiffs
+
+typedef enum
+{
+    ESP_PARTITION_TYPE_APP  = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01
+} esp_partition_type_t;
+
+typedef enum
+{
+    ESP_PARTITION_SUBTYPE_APP_FACTORY   = 0x00,
+    ESP_PARTITION_SUBTYPE_APP_OTA_0     = 0x10,
+    ESP_PARTITION_SUBTYPE_APP_OTA_1     = 0x11,
+    ESP_PARTITION_SUBTYPE_DATA_OTA      = 0x00,
+    ESP_PARTITION_SUBTYPE_DATA_NVS      = 0x02,
+    ESP_PARTITION_SUBTYPE_DATA_SPIFFS   = 0x82,
+    ESP_PARTITION_SUBTYPE_ANY           = 0xff
+} esp_partition_subtype_t;
+
+typedef struct
+{
+    void*                   flash_chip;
+    esp_partition_type_t    type;
+    esp_partition_subtype_t subtype;
+    uint32_t                address;
+    uint32_t                size;
+    char                    label[17];
+    bool                    encrypted;
+} esp_partition_t;
+
+const esp_partition_t*  esp_partition_find_first (esp_partition_type_t Type_p, esp_partition_subtype_t Subtype_p, const char* pszLabel_p);
+esp_err_t               esp_partition_read (const esp_partition_t* pPart_p, size_t Offset_p, void* pvDst_p, size_t Size_p);
+esp_err_t               esp_partition_write (const esp_partition_t* pPart_p, size_t Offset_p, const void* pvSrc_p, size_t Size_p);
+esp_err_t               esp_partition_erase_range (const esp_partition_t* pPart_p, size_t Offset_p, size_t Size_p);
+
+#endif  // _HOSTSIM_ESP_PARTITION_H_
@@ -0,0 +1,25 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_rom_crc.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_ROM_CRC_H_
+#define _HOSTSIM_ESP_ROM_CRC_H_
+
+#include <stdint.h>
+
+//  CRC32 (IEEE 802.3), chainable like the ROM function: the value returned
+//  by one call is passed as <crc> to the next one, 0 to start.
+uint32_t  esp_rom_crc32_le (uint32_t crc, uint8_t const* buf, uint32_t len);
+
+#endif  // _HOSTSIM_ESP_ROM_CRC_H_
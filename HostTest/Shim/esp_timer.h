@@ -0,0 +1,49 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <esp_timer.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_ESP_TIMER_H_
+#define _HOSTSIM_ESP_TIMER_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+//  The time base is the start of the process. Timer callbacks are never
+//  invoked, so periodic activities (e.g. the LED pattern engine) are idle.
+
+typedef struct esp_timer*  esp_timer_handle_t;
+typedef void  (*esp_timer_cb_t)(void* pvArg_p);
+
+typedef enum
+{
+    ESP_TIMER_TASK
+} esp_timer_dispatch_t;
+
+typedef struct
+{
+    esp_timer_cb_t          callback;
+    void*                   arg;
+    esp_timer_dispatch_t    dispatch_method;
+    const char*             name;
+    bool                    skip_unhandled_events;
+} esp_timer_create_args_t;
+
+int64_t    esp_timer_get_time ();
+esp_err_t  esp_timer_create (const esp_timer_create_args_t* pArgs_p, esp_timer_handle_t* phTimer_p);
+esp_err_t  esp_timer_start_once (esp_timer_handle_t hTimer_p, uint64_t ui64TimeoutUs_p);
+esp_err_t  esp_timer_start_periodic (esp_timer_handle_t hTimer_p, uint64_t ui64PeriodUs_p);
+esp_err_t  esp_timer_stop (esp_timer_handle_t hTimer_p);
+esp_err_t  esp_timer_delete (esp_timer_handle_t hTimer_p);
+
+#endif  // _HOSTSIM_ESP_TIMER_H_
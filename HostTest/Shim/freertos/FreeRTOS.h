@@ -0,0 +1,108 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of the FreeRTOS API (ESP-IDF flavour)
+
+  -------------------------------------------------------------------------
+
+    - Tasks are mapped to detached threads, one tick is 1 ms.
+    - Semaphores, queues and event groups are implemented on top of a
+      mutex and a condition variable.
+    - All critical sections (portENTER_CRITICAL) share one recursive
+      mutex, like a single core with disabled interrupts.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_FREERTOS_H_
+#define _HOSTSIM_FREERTOS_H_
+
+
+#include <stdint.h>
+#include <stddef.h>
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+typedef int             BaseType_t;
+typedef unsigned int    UBaseType_t;
+typedef uint32_t        TickType_t;
+typedef uint32_t        EventBits_t;
+
+typedef void*           TaskHandle_t;
+typedef void*           QueueHandle_t;
+typedef void*           SemaphoreHandle_t;
+typedef void*           EventGroupHandle_t;
+typedef void            (*TaskFunction_t)(void*);
+
+typedef struct
+{
+    int  m_iDummy;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+
+#define pdFALSE                         0
+#define pdTRUE                          1
+#define pdFAIL                          0
+#define pdPASS                          1
+
+#define portMAX_DELAY                   ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS              1
+#define portNUM_PROCESSORS              2
+#define pdMS_TO_TICKS(ms)               ((TickType_t)(ms))
+#define tskNO_AFFINITY                  0x7FFFFFFF
+
+void  HostSimEnterCritical (portMUX_TYPE* pMux_p);         // <pMux_p> is not evaluated (one shared lock)
+void  HostSimExitCritical (portMUX_TYPE* pMux_p);
+
+#define portENTER_CRITICAL(pMux)        HostSimEnterCritical(pMux)
+#define portEXIT_CRITICAL(pMux)         HostSimExitCritical(pMux)
+#define portENTER_CRITICAL_ISR(pMux)    HostSimEnterCritical(pMux)
+#define portEXIT_CRITICAL_ISR(pMux)     HostSimExitCritical(pMux)
+
+
+
+//---------------------------------------------------------------------------
+//  Functions
+//---------------------------------------------------------------------------
+
+BaseType_t    xTaskCreatePinnedToCore (TaskFunction_t pfnTask_p, const char* pszName_p, uint32_t ui32StackSize_p,
+                                       void* pvParam_p, UBaseType_t uiPriority_p, TaskHandle_t* phTask_p, BaseType_t iCoreId_p);
+void          vTaskDelete (TaskHandle_t hTask_p);
+void          vTaskDelay (TickType_t Ticks_p);
+TickType_t    xTaskGetTickCount ();
+BaseType_t    xPortGetCoreID ();
+
+SemaphoreHandle_t  xSemaphoreCreateBinary ();
+SemaphoreHandle_t  xSemaphoreCreateMutex ();
+SemaphoreHandle_t  xSemaphoreCreateCounting (UBaseType_t uiMaxCount_p, UBaseType_t uiInitialCount_p);
+BaseType_t         xSemaphoreTake (SemaphoreHandle_t hSem_p, TickType_t Ticks_p);
+BaseType_t         xSemaphoreGive (SemaphoreHandle_t hSem_p);
+void               vSemaphoreDelete (SemaphoreHandle_t hSem_p);
+
+QueueHandle_t  xQueueCreate (UBaseType_t uiLength_p, UBaseType_t uiItemSize_p);
+BaseType_t     xQueueSend (QueueHandle_t hQueue_p, const void* pvItem_p, TickType_t Ticks_p);
+BaseType_t     xQueueReceive (QueueHandle_t hQueue_p, void* pvItem_p, TickType_t Ticks_p);
+UBaseType_t    uxQueueMessagesWaiting (QueueHandle_t hQueue_p);
+void           vQueueDelete (QueueHandle_t hQueue_p);
+
+EventGroupHandle_t  xEventGroupCreate ();
+void                vEventGroupDelete (EventGroupHandle_t hEventGroup_p);
+EventBits_t         xEventGroupSetBits (EventGroupHandle_t hEventGroup_p, EventBits_t Bits_p);
+EventBits_t         xEventGroupWaitBits (EventGroupHandle_t hEventGroup_p, EventBits_t Bits_p, BaseType_t fClearOnExit_p,
+                                         BaseType_t fWaitForAll_p, TickType_t Ticks_p);
+
+
+
+#endif  // _HOSTSIM_FREERTOS_H_
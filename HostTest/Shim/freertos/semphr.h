@@ -0,0 +1,21 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <freertos/semphr.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_FREERTOS_SEMPHR_H_
+#define _HOSTSIM_FREERTOS_SEMPHR_H_
+
+#include "FreeRTOS.h"
+
+#endif  // _HOSTSIM_FREERTOS_SEMPHR_H_
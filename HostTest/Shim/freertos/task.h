@@ -0,0 +1,24 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <freertos/task.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_FREERTOS_TASK_H_
+#define _HOSTSIM_FREERTOS_TASK_H_
+
+#include "FreeRTOS.h"
+
+TaskHandle_t  xTaskGetCurrentTaskHandle ();
+TaskHandle_t  xTaskGetIdleTaskHandleForCPU (UBaseType_t uiCpuId_p);
+
+#endif  // _HOSTSIM_FREERTOS_TASK_H_
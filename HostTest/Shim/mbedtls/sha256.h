@@ -0,0 +1,36 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <mbedtls/sha256.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_MBEDTLS_SHA256_H_
+#define _HOSTSIM_MBEDTLS_SHA256_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct
+{
+    uint32_t  total[2];
+    uint32_t  state[8];
+    uint8_t   buffer[64];
+    int       is224;
+} mbedtls_sha256_context;
+
+void  mbedtls_sha256_init (mbedtls_sha256_context* pCtx_p);
+void  mbedtls_sha256_free (mbedtls_sha256_context* pCtx_p);
+int   mbedtls_sha256_starts (mbedtls_sha256_context* pCtx_p, int is224_p);
+int   mbedtls_sha256_update (mbedtls_sha256_context* pCtx_p, const unsigned char* pabInput_p, size_t Len_p);
+int   mbedtls_sha256_finish (mbedtls_sha256_context* pCtx_p, unsigned char abOutput_p[32]);
+
+#endif  // _HOSTSIM_MBEDTLS_SHA256_H_
@@ -0,0 +1,47 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host emulation of <nvs.h>
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#ifndef _HOSTSIM_NVS_H_
+#define _HOSTSIM_NVS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+//  The NVS is kept in memory (one key/blob map per namespace).
+
+typedef uint32_t  nvs_handle_t;
+
+typedef enum
+{
+    NVS_READONLY,
+    NVS_READWRITE
+} nvs_open_mode_t;
+
+#define ESP_ERR_NVS_BASE                0x1100
+#define ESP_ERR_NVS_NOT_INITIALIZED     (ESP_ERR_NVS_BASE + 0x01)
+#define ESP_ERR_NVS_NOT_FOUND           (ESP_ERR_NVS_BASE + 0x02)
+#define ESP_ERR_NVS_INVALID_HANDLE      (ESP_ERR_NVS_BASE + 0x07)
+#define ESP_ERR_NVS_INVALID_LENGTH      (ESP_ERR_NVS_BASE + 0x0c)
+
+esp_err_t  nvs_open (const char* pszNamespace_p, nvs_open_mode_t Mode_p, nvs_handle_t* pHandle_p);
+void       nvs_close (nvs_handle_t Handle_p);
+esp_err_t  nvs_get_blob (nvs_handle_t Handle_p, const char* pszKey_p, void* pvValue_p, size_t* pLength_p);
+esp_err_t  nvs_set_blob (nvs_handle_t Handle_p, const char* pszKey_p, const void* pvValue_p, size_t Length_p);
+esp_err_t  nvs_erase_key (nvs_handle_t Handle_p, const char* pszKey_p);
+esp_err_t  nvs_erase_all (nvs_handle_t Handle_p);
+esp_err_t  nvs_commit (nvs_handle_t Handle_p);
+
+#endif  // _HOSTSIM_NVS_H_
@@ -0,0 +1,112 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Runner of the Memory Soak Test (DEBUG_SOAK_TEST in the sketch)
+
+  -------------------------------------------------------------------------
+
+    - Boots the sketch in BLE Config Mode, which runs the soak test after
+      the BLE Profile Setup (sessions of the simulated client and repeated
+      Shutdown/Setup of the BLE Profile). The console output of the sketch is captured,
+      the JSON line of the soak test is printed to stdout (the only output
+      there), everything else goes to stderr with option -v.
+    - Exit code: 0 = no errors and no net heap growth, 1 = leak or errors
+      ("pass":false), 2 = no soak test result found.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "Arduino.h"
+#include "HostSim.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define SOAK_PIN_KEY_BLE_CFG            36                  // PIN_KEY_BLE_CFG of the sketch (LOW = BLE Config Mode)
+
+static  const char*  SOAK_JSON_PREFIX   = "{\"soaktest\":";
+static  const char*  SOAK_JSON_PASS     = ",\"pass\":true}";
+
+void  setup ();
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main (int iArgc_p, char* apszArgv_p[])
+{
+
+FILE*        pConsole;
+char         szLine[2048];
+std::string  strJson;
+bool         fVerbose;
+
+    fVerbose = ((iArgc_p > 1) && (strcmp(apszArgv_p[1], "-v") == 0));
+
+    pConsole = tmpfile();
+    if (pConsole == NULL)
+    {
+        perror("tmpfile");
+        return (2);
+    }
+
+    HostSimReset();
+    HostSimSetSerialOutput(pConsole);
+    HostSimSetPinLevel(SOAK_PIN_KEY_BLE_CFG, LOW);
+    setup();
+    HostSimSetSerialOutput(NULL);
+
+    rewind(pConsole);
+    while (fgets(szLine, sizeof(szLine), pConsole) != NULL)
+    {
+        if (strncmp(szLine, SOAK_JSON_PREFIX, strlen(SOAK_JSON_PREFIX)) == 0)
+        {
+            strJson = szLine;
+            strJson.erase(strJson.find_last_not_of("\r\n") + 1);
+        }
+        else if ( fVerbose )
+        {
+            fputs(szLine, stderr);
+        }
+    }
+    fclose(pConsole);
+
+    if ( strJson.empty() )
+    {
+        fprintf(stderr, "ERROR: no soak test result (BLE Profile Setup failed?)\n");
+        return (2);
+    }
+
+    printf("%s\n", strJson.c_str());
+    fflush(stdout);
+
+    if ((strJson.length() < strlen(SOAK_JSON_PASS)) ||
+        (strJson.compare(strJson.length() - strlen(SOAK_JSON_PASS), strlen(SOAK_JSON_PASS), SOAK_JSON_PASS) != 0))
+    {
+        fprintf(stderr, "FAILED: net heap growth or errors (see \"free_bytes_loss\", \"allocs\", \"frees\", \"errors\")\n");
+        return (1);
+    }
+
+    return (0);
+
+}
+
+
+
+//  EOF
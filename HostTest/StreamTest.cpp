@@ -0,0 +1,467 @@
+/****************************************************************************
+
+  Copyright (c) 2026 ESP32BleConfig contributors
+
+  Project:      ESP32 BLE Config / Host Tests
+  Description:  Host Test of the Blob Transfer via service [Stream]
+
+  -------------------------------------------------------------------------
+
+    - Sets up the BLE Profile with service [Stream] and transfers blobs
+      through the simulated BLE client, using the protocol as a real
+      client has to (see ESP32BleCfgStream.h): STREAM_CMD_START, numbered
+      chunks acknowledged per window, STREAM_CMD_FINISH.
+    - Covers the resend after a NAK and the resume of a transfer after
+      a disconnect.
+    - Checks the blob stored in the flash partition via <GetBlobInfo()>
+      and <ReadBlob()>.
+    - Reports the throughput of the transfer as measured by the device.
+
+  -------------------------------------------------------------------------
+
+  Revision History:
+
+  2026/10/18:       V1.00 Initial version
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "Arduino.h"
+#include "HostSim.h"
+#include "HostTest.h"
+#include "esp_rom_crc.h"
+
+#include "ESP32BleCfgProfile.h"
+#include "ESP32BleCfgStream.h"
+
+
+
+//---------------------------------------------------------------------------
+//  Definitions
+//---------------------------------------------------------------------------
+
+#define STREAM_TEST_PART_LABEL          "spiffs"
+#define STREAM_TEST_MTU                 247
+#define STREAM_TEST_CHUNK_SIZE          (STREAM_TEST_MTU - 3 - STREAM_DATA_HDR_SIZE)
+#define STREAM_TEST_WINDOW              8
+
+// UUIDs of service [Stream] (see BleProfileDefinition.txt)
+static  const char*  STREAM_TEST_UUID_CTRL = "00004100-0000-1000-8000-E776CC14FE69";
+static  const char*  STREAM_TEST_UUID_DATA = "00004200-0000-1000-8000-E776CC14FE69";
+
+
+// Stream Response as notified via [Stream/Control]
+typedef struct
+{
+    uint8_t         m_ui8Rsp;
+    uint8_t         m_ui8Status;
+    uint16_t        m_ui16NextSeq;
+    uint32_t        m_ui32Offset;
+    uint32_t        m_ui32RunningCrc;
+} tStreamTestRsp;
+
+
+
+//---------------------------------------------------------------------------
+//  Local Variables
+//---------------------------------------------------------------------------
+
+static  unsigned int    uiStreamDoneCalls_g     = 0;
+static  uint32_t        ui32StreamDoneSize_g    = 0;
+static  uint32_t        ui32StreamDoneCrc_g     = 0;
+static  uint32_t        ui32StreamThroughput_g  = 0;
+
+
+
+//---------------------------------------------------------------------------
+//  Application Callback Handlers
+//---------------------------------------------------------------------------
+
+static  void  AppCbHdlrStreamDone (uint32_t ui32BlobSize_p, uint32_t ui32BlobCrc32_p, uint32_t ui32Throughput_p)
+{
+    uiStreamDoneCalls_g++;
+    ui32StreamDoneSize_g   = ui32BlobSize_p;
+    ui32StreamDoneCrc_g    = ui32BlobCrc32_p;
+    ui32StreamThroughput_g = ui32Throughput_p;
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Local Functions
+//---------------------------------------------------------------------------
+
+static  int  StreamTestSetup ()
+{
+
+static  const tHostTestProfileParam  Param = { "StreamTestDevice", NULL, BLE_GATT_BACKEND_OBJECTS, STREAM_TEST_MTU, 0 };
+
+    uiStreamDoneCalls_g    = 0;
+    ui32StreamDoneSize_g   = 0;
+    ui32StreamDoneCrc_g    = 0;
+    ui32StreamThroughput_g = 0;
+
+    HostTestProfile_g.EnableStream(STREAM_TEST_PART_LABEL, AppCbHdlrStreamDone);
+
+    return ((HostTestProfileSetup(&Param) < 0) ? -1 : 0);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  std::vector<uint8_t>  StreamTestBuildBlob (size_t BlobSize_p)
+{
+
+std::vector<uint8_t>  Blob(BlobSize_p);
+uint32_t              ui32Seed;
+size_t                Idx;
+
+    ui32Seed = (uint32_t)BlobSize_p;
+    for (Idx=0; Idx<BlobSize_p; Idx++)
+    {
+        ui32Seed = (ui32Seed * 1103515245) + 12345;
+        Blob[Idx] = (uint8_t)(ui32Seed >> 16);
+    }
+
+    return (Blob);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  uint16_t  StreamTestNumChunks (const std::vector<uint8_t>& Blob_p)
+{
+    return ((uint16_t)((Blob_p.size() + STREAM_TEST_CHUNK_SIZE - 1) / STREAM_TEST_CHUNK_SIZE));
+}
+
+//---------------------------------------------------------------------------
+//  Writes to the given characteristic, returns true if a response was
+//  notified via [Stream/Control]
+//---------------------------------------------------------------------------
+
+static  bool  StreamTestWrite (const char* pszUuid_p, const uint8_t* pabData_p, size_t DataLen_p, tStreamTestRsp* pRsp_p)
+{
+
+uint8_t       abRsp[STREAM_RSP_SIZE];
+unsigned int  uiNotifyCnt;
+
+    uiNotifyCnt = HostSimBleGetNotifyCount(STREAM_TEST_UUID_CTRL);
+    HostSimBleWrite(pszUuid_p, pabData_p, DataLen_p);
+    if (HostSimBleGetNotifyCount(STREAM_TEST_UUID_CTRL) == uiNotifyCnt)
+    {
+        return (false);
+    }
+
+    if (HostSimBleGetLastNotify(STREAM_TEST_UUID_CTRL, abRsp, sizeof(abRsp)) != STREAM_RSP_SIZE)
+    {
+        return (false);
+    }
+
+    pRsp_p->m_ui8Rsp         = abRsp[0];
+    pRsp_p->m_ui8Status      = abRsp[1];
+    pRsp_p->m_ui16NextSeq    = (uint16_t)(abRsp[2] | (abRsp[3] << 8));
+    pRsp_p->m_ui32Offset     = (uint32_t)abRsp[4] | ((uint32_t)abRsp[5] << 8) | ((uint32_t)abRsp[6] << 16)  | ((uint32_t)abRsp[7] << 24);
+    pRsp_p->m_ui32RunningCrc = (uint32_t)abRsp[8] | ((uint32_t)abRsp[9] << 8) | ((uint32_t)abRsp[10] << 16) | ((uint32_t)abRsp[11] << 24);
+
+    return (true);
+
+}
+
+//---------------------------------------------------------------------------
+
+static  bool  StreamTestSendStart (const std::vector<uint8_t>& Blob_p, uint32_t ui32Crc32_p, tStreamTestRsp* pRsp_p)
+{
+
+uint8_t   abCmd[STREAM_CMD_START_SIZE];
+uint32_t  ui32TotalSize;
+
+    ui32TotalSize = (uint32_t)Blob_p.size();
+
+    abCmd[0]  = STREAM_CMD_START;
+    abCmd[1]  = 0;
+    abCmd[2]  = (uint8_t)(STREAM_TEST_CHUNK_SIZE);
+    abCmd[3]  = (uint8_t)(STREAM_TEST_CHUNK_SIZE >> 8);
+    abCmd[4]  = (uint8_t)(ui32TotalSize);
+    abCmd[5]  = (uint8_t)(ui32TotalSize >> 8);
+    abCmd[6]  = (uint8_t)(ui32TotalSize >> 16);
+    abCmd[7]  = (uint8_t)(ui32TotalSize >> 24);
+    abCmd[8]  = (uint8_t)(ui32Crc32_p);
+    abCmd[9]  = (uint8_t)(ui32Crc32_p >> 8);
+    abCmd[10] = (uint8_t)(ui32Crc32_p >> 16);
+    abCmd[11] = (uint8_t)(ui32Crc32_p >> 24);
+    abCmd[12] = (uint8_t)(STREAM_TEST_WINDOW);
+    abCmd[13] = (uint8_t)(STREAM_TEST_WINDOW >> 8);
+
+    return (StreamTestWrite(STREAM_TEST_UUID_CTRL, abCmd, sizeof(abCmd), pRsp_p));
+
+}
+
+//---------------------------------------------------------------------------
+
+static  bool  StreamTestSendFinish (tStreamTestRsp* pRsp_p)
+{
+
+uint8_t  bCmd = STREAM_CMD_FINISH;
+
+    return (StreamTestWrite(STREAM_TEST_UUID_CTRL, &bCmd, sizeof(bCmd), pRsp_p));
+
+}
+
+//---------------------------------------------------------------------------
+//  Writes chunk <ui16Seq_p> of the blob to [Stream/Data]
+//---------------------------------------------------------------------------
+
+static  bool  StreamTestSendChunk (const std::vector<uint8_t>& Blob_p, uint16_t ui16Seq_p, tStreamTestRsp* pRsp_p)
+{
+
+uint8_t  abChunk[STREAM_DATA_HDR_SIZE + STREAM_TEST_CHUNK_SIZE];
+size_t   Offset;
+size_t   PayloadLen;
+
+    Offset     = (size_t)ui16Seq_p * STREAM_TEST_CHUNK_SIZE;
+    PayloadLen = Blob_p.size() - Offset;
+    if (PayloadLen > STREAM_TEST_CHUNK_SIZE)
+    {
+        PayloadLen = STREAM_TEST_CHUNK_SIZE;
+    }
+
+    abChunk[0] = (uint8_t)(ui16Seq_p);
+    abChunk[1] = (uint8_t)(ui16Seq_p >> 8);
+    memcpy(&abChunk[STREAM_DATA_HDR_SIZE], &Blob_p[Offset], PayloadLen);
+
+    return (StreamTestWrite(STREAM_TEST_UUID_DATA, abChunk, STREAM_DATA_HDR_SIZE + PayloadLen, pRsp_p));
+
+}
+
+//---------------------------------------------------------------------------
+//  Sends the chunks [FirstSeq, EndSeq) and checks that exactly the end of
+//  each window and the last chunk of the blob are acknowledged
+//---------------------------------------------------------------------------
+
+static  void  StreamTestSendChunks (const std::vector<uint8_t>& Blob_p, uint16_t ui16FirstSeq_p, uint16_t ui16EndSeq_p)
+{
+
+tStreamTestRsp  Rsp;
+uint16_t        ui16Seq;
+uint16_t        ui16SinceAck;
+bool            fAckExpected;
+bool            fRsp;
+
+    ui16SinceAck = 0;
+    for (ui16Seq=ui16FirstSeq_p; ui16Seq<ui16EndSeq_p; ui16Seq++)
+    {
+        ui16SinceAck++;
+        fAckExpected = (ui16SinceAck == STREAM_TEST_WINDOW) || ((ui16Seq + 1) == StreamTestNumChunks(Blob_p));
+
+        fRsp = StreamTestSendChunk(Blob_p, ui16Seq, &Rsp);
+        HOSTTEST_CHECK_EQ(fRsp, fAckExpected);
+        if (fRsp)
+        {
+            HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ACK);
+            HOSTTEST_CHECK_EQ(Rsp.m_ui16NextSeq, ui16Seq + 1);
+            ui16SinceAck = 0;
+        }
+    }
+
+}
+
+//---------------------------------------------------------------------------
+//  Checks the stored blob against the sent one
+//---------------------------------------------------------------------------
+
+static  void  StreamTestCheckBlob (const std::vector<uint8_t>& Blob_p, uint32_t ui32Crc32_p)
+{
+
+std::vector<uint8_t>  BlobData(Blob_p.size());
+uint32_t              ui32Size;
+uint32_t              ui32Crc32;
+
+    HOSTTEST_CHECK_EQ(ESP32BleCfgStream::GetBlobInfo(&ui32Size, &ui32Crc32), 1);
+    HOSTTEST_CHECK_EQ(ui32Size, Blob_p.size());
+    HOSTTEST_CHECK_EQ(ui32Crc32, ui32Crc32_p);
+
+    HOSTTEST_CHECK_EQ(ESP32BleCfgStream::ReadBlob(0, BlobData.data(), (uint32_t)BlobData.size()), Blob_p.size());
+    HOSTTEST_CHECK(BlobData == Blob_p);
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Test Cases
+//---------------------------------------------------------------------------
+
+// Blob of odd size (neither a multiple of the chunk size nor of the window)
+static  void  TestStreamTransfer ()
+{
+
+std::vector<uint8_t>  Blob = StreamTestBuildBlob((37 * STREAM_TEST_CHUNK_SIZE) + 123);
+uint32_t              ui32Crc32;
+tStreamTestRsp        Rsp;
+tStreamStatus         StreamStatus;
+
+    HOSTTEST_CHECK_EQ(StreamTestSetup(), 0);
+    ui32Crc32 = esp_rom_crc32_le(0, Blob.data(), (uint32_t)Blob.size());
+
+    HOSTTEST_CHECK(StreamTestSendStart(Blob, ui32Crc32, &Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ACK);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, STREAM_STATUS_OK);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui16NextSeq, 0);
+
+    StreamTestSendChunks(Blob, 0, StreamTestNumChunks(Blob));
+
+    HOSTTEST_CHECK(StreamTestSendFinish(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_DONE);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, STREAM_STATUS_OK);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui32Offset, Blob.size());
+    HOSTTEST_CHECK_EQ(Rsp.m_ui32RunningCrc, ui32Crc32);
+
+    StreamTestCheckBlob(Blob, ui32Crc32);
+
+    HOSTTEST_CHECK_EQ(uiStreamDoneCalls_g, 1);
+    HOSTTEST_CHECK_EQ(ui32StreamDoneSize_g, Blob.size());
+    HOSTTEST_CHECK_EQ(ui32StreamDoneCrc_g, ui32Crc32);
+    HOSTTEST_CHECK(ESP32BleCfgStream::GetStatus(&StreamStatus));
+    HOSTTEST_CHECK_EQ(StreamStatus.m_ui8State, STREAM_STATE_DONE);
+    HOSTTEST_CHECK_EQ(StreamStatus.m_ui32SeqGapCnt, 0);
+    HOSTTEST_CHECK_EQ(ui32StreamThroughput_g, StreamStatus.m_ui32Throughput);
+    HOSTTEST_CHECK(StreamStatus.m_ui32Throughput > 0);
+    HostTestReportThroughput("-> Stream throughput (MTU 247)", StreamStatus.m_ui32Throughput);
+
+    HostTestProfileShutdown();
+
+}
+
+// Lost chunk: one NAK for the gap, resend starting with the expected chunk
+static  void  TestStreamNakResend ()
+{
+
+std::vector<uint8_t>  Blob = StreamTestBuildBlob(3 * STREAM_TEST_WINDOW * STREAM_TEST_CHUNK_SIZE);
+uint32_t              ui32Crc32;
+tStreamTestRsp        Rsp;
+tStreamStatus         StreamStatus;
+
+    HOSTTEST_CHECK_EQ(StreamTestSetup(), 0);
+    ui32Crc32 = esp_rom_crc32_le(0, Blob.data(), (uint32_t)Blob.size());
+
+    HOSTTEST_CHECK(StreamTestSendStart(Blob, ui32Crc32, &Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ACK);
+
+    // chunk 3 gets lost: NAK for chunk 4, the following ones are dropped silently
+    StreamTestSendChunks(Blob, 0, 3);
+    HOSTTEST_CHECK(StreamTestSendChunk(Blob, 4, &Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_NAK);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, STREAM_STATUS_SEQ_GAP);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui16NextSeq, 3);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui32Offset, 3 * STREAM_TEST_CHUNK_SIZE);
+    HOSTTEST_CHECK(!StreamTestSendChunk(Blob, 5, &Rsp));
+
+    // resend: the NAK restarts the window
+    StreamTestSendChunks(Blob, 3, StreamTestNumChunks(Blob));
+
+    HOSTTEST_CHECK(StreamTestSendFinish(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_DONE);
+    StreamTestCheckBlob(Blob, ui32Crc32);
+
+    HOSTTEST_CHECK(ESP32BleCfgStream::GetStatus(&StreamStatus));
+    HOSTTEST_CHECK_EQ(StreamStatus.m_ui32SeqGapCnt, 1);
+    HostTestReportThroughput("-> Stream throughput (NAK resend)", StreamStatus.m_ui32Throughput);
+
+    HostTestProfileShutdown();
+
+}
+
+// Disconnect in the middle of the transfer: same START resumes with the next chunk
+static  void  TestStreamResumeAfterDisconnect ()
+{
+
+std::vector<uint8_t>  Blob = StreamTestBuildBlob((4 * STREAM_TEST_WINDOW * STREAM_TEST_CHUNK_SIZE) + 55);
+uint32_t              ui32Crc32;
+uint16_t              ui16ResumeSeq;
+tStreamTestRsp        Rsp;
+tStreamStatus         StreamStatus;
+
+    HOSTTEST_CHECK_EQ(StreamTestSetup(), 0);
+    ui32Crc32 = esp_rom_crc32_le(0, Blob.data(), (uint32_t)Blob.size());
+
+    HOSTTEST_CHECK(StreamTestSendStart(Blob, ui32Crc32, &Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ACK);
+
+    // connection lost within the second window
+    ui16ResumeSeq = STREAM_TEST_WINDOW + 3;
+    StreamTestSendChunks(Blob, 0, ui16ResumeSeq);
+    HOSTTEST_CHECK_EQ(HostSimBleDisconnect(), 0);
+    HOSTTEST_CHECK(HostSimBleIsAdvertising());
+
+    HOSTTEST_CHECK_EQ(HostSimBleConnect(), 0);
+    HostSimBleSetMtu(STREAM_TEST_MTU);
+    HOSTTEST_CHECK(StreamTestSendStart(Blob, ui32Crc32, &Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ACK);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, STREAM_STATUS_RESUMED);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui16NextSeq, ui16ResumeSeq);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui32Offset, ui16ResumeSeq * STREAM_TEST_CHUNK_SIZE);
+
+    StreamTestSendChunks(Blob, ui16ResumeSeq, StreamTestNumChunks(Blob));
+
+    HOSTTEST_CHECK(StreamTestSendFinish(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_DONE);
+    StreamTestCheckBlob(Blob, ui32Crc32);
+
+    HOSTTEST_CHECK(ESP32BleCfgStream::GetStatus(&StreamStatus));
+    HOSTTEST_CHECK_EQ(StreamStatus.m_ui32ResumeCnt, 1);
+    HOSTTEST_CHECK_EQ(uiStreamDoneCalls_g, 1);
+    HostTestReportThroughput("-> Stream throughput (resumed session)", StreamStatus.m_ui32Throughput);
+
+    HostTestProfileShutdown();
+
+}
+
+// Wrong CRC: FINISH fails, no valid blob
+static  void  TestStreamCrcMismatch ()
+{
+
+std::vector<uint8_t>  Blob = StreamTestBuildBlob(5 * STREAM_TEST_CHUNK_SIZE);
+uint32_t              ui32Crc32;
+tStreamTestRsp        Rsp;
+
+    HOSTTEST_CHECK_EQ(StreamTestSetup(), 0);
+    ui32Crc32 = esp_rom_crc32_le(0, Blob.data(), (uint32_t)Blob.size());
+
+    HOSTTEST_CHECK(StreamTestSendStart(Blob, ui32Crc32 ^ 0x00000001, &Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ACK);
+    StreamTestSendChunks(Blob, 0, StreamTestNumChunks(Blob));
+
+    HOSTTEST_CHECK(StreamTestSendFinish(&Rsp));
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Rsp, STREAM_RSP_ERROR);
+    HOSTTEST_CHECK_EQ(Rsp.m_ui8Status, STREAM_STATUS_CRC_ERROR);
+    HOSTTEST_CHECK_EQ(ESP32BleCfgStream::GetBlobInfo(NULL, NULL), 0);
+    HOSTTEST_CHECK_EQ(uiStreamDoneCalls_g, 0);
+
+    HostTestProfileShutdown();
+
+}
+
+
+
+//---------------------------------------------------------------------------
+//  Main
+//---------------------------------------------------------------------------
+
+int  main ()
+{
+
+    HOSTTEST_RUN(TestStreamTransfer);
+    HOSTTEST_RUN(TestStreamNakResend);
+    HOSTTEST_RUN(TestStreamResumeAfterDisconnect);
+    HOSTTEST_RUN(TestStreamCrcMismatch);
+
+    return (HostTestResult());
+
+}
+
+
+
+//  EOF
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+#############################################################################
+#
+#  Copyright (c) 2026 ESP32BleConfig contributors
+#
+#  Project:      ESP32 BLE Config / Host Tests
+#  Description:  Converts the sketch (*.ino) into a C++ source file the way
+#                the Arduino builder does: <Arduino.h> is included first and
+#                prototypes of all functions are inserted in front of the
+#                first function definition.
+#
+#  Usage:        ino2cpp.py <Sketch.ino> <Output.cpp>
+#
+#  -------------------------------------------------------------------------
+#
+#  Revision History:
+#
+#  2026/10/18:       V1.00 Initial version
+#
+#############################################################################
+
+import re
+import sys
+
+
+# return type + name + parameter list, opening brace on the next line (style of the sketch)
+FUNC_DEF_PATTERN = re.compile(r'^((?:static\s+)?[A-Za-z_][\w\s\*&:<>]*?[\s\*&]+)([A-Za-z_]\w*)\s*\(([^;{)]*)\)\s*\n\{', re.M)
+KEYWORDS = ('if', 'while', 'for', 'switch', 'return')
+
+
+def  main (argv):
+
+    if len(argv) != 3:
+        sys.stderr.write('usage: ino2cpp.py <Sketch.ino> <Output.cpp>\n')
+        return 2
+
+    with open(argv[1], encoding='utf-8-sig', newline='') as f:
+        src = f.read().replace('\r\n', '\n')
+
+    prototypes = []
+    first_def  = None
+    for m in FUNC_DEF_PATTERN.finditer(src):
+        ret_type, name, params = m.group(1).strip(), m.group(2), m.group(3)
+        if (name in KEYWORDS) or ret_type.startswith('#'):
+            continue
+        params = re.sub(r'\s*=\s*[^,]+', '', params)        # default arguments only in the definition
+        prototypes.append('%s %s(%s);' % (ret_type, name, params))
+        if first_def is None:
+            first_def = m.start()
+
+    if first_def is None:
+        first_def = len(src)
+
+    # keep the line numbers of the sketch for compiler messages
+    line = src.count('\n', 0, first_def) + 1
+    out  = '#include "Arduino.h"\n'
+    out += '#line 1 "%s"\n' % argv[1]
+    out += src[:first_def]
+    out += '\n'.join(prototypes) + '\n'
+    out += '#line %d "%s"\n' % (line, argv[1])
+    out += src[first_def:]
+
+    with open(argv[2], 'w', encoding='utf-8') as f:
+        f.write(out)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))